@@ -311,6 +311,67 @@ def get_allowed_actions_mask(actions):
             action_mask[6] = 1.0
     return action_mask
 
+class ShieldServerClient:
+    # Queries a running storm-shield-server, see storm-shield-server/server/ShieldServer.h for the protocol.
+    QUERY, DESCRIBE, STATISTICS = 0, 1, 2
+    UNKNOWN_STATE = np.iinfo(np.uint64).max
+
+    def __init__(self, socket_path):
+        import socket
+        self.socket = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        self.socket.connect(socket_path)
+        self.socket.sendall(np.uint32(self.DESCRIBE).tobytes())
+        self.__read_status()
+        self.shared_memory_name = self.__read_string()
+        self.variable_names = [self.__read_string() for _ in range(self.__read_uint32())]
+        self.action_names = [self.__read_string() for _ in range(self.__read_uint32())]
+        # Translates the bits of a mask to the MiniGrid actions
+        self.action_masks = np.array([get_allowed_actions_mask([[name]]) for name in self.action_names]).reshape(len(self.action_names), 7)
+
+    def __del__(self):
+        if hasattr(self, "socket"):
+            self.socket.close()
+
+    def __read(self, size):
+        data = bytearray()
+        while len(data) < size:
+            chunk = self.socket.recv(size - len(data))
+            assert chunk, "The shield server closed the connection"
+            data.extend(chunk)
+        return bytes(data)
+
+    def __read_uint32(self):
+        return int(np.frombuffer(self.__read(4), dtype=np.uint32)[0])
+
+    def __read_string(self):
+        return self.__read(self.__read_uint32()).decode()
+
+    def __read_status(self):
+        status = self.__read_uint32()
+        if status != 0:
+            raise RuntimeError(f"Shield server error: {self.__read_string()}")
+
+    def query(self, states):
+        # states is an (n, len(variable_names)) array, booleans are encoded as 0 and 1
+        states = np.ascontiguousarray(states, dtype=np.int64).reshape(-1, len(self.variable_names))
+        self.socket.sendall(np.array([self.QUERY, states.shape[0]], dtype=np.uint32).tobytes() + states.tobytes())
+        self.__read_status()
+        count = self.__read_uint32()
+        return np.frombuffer(self.__read(8 * count), dtype=np.uint64)
+
+    def query_action_masks(self, states):
+        # Returns MiniGrid action masks, states unknown to the shield allow no action
+        masks = self.query(states)
+        bits = (masks[:, None] >> np.arange(len(self.action_names), dtype=np.uint64)) & np.uint64(1)
+        result = np.minimum(bits.astype(np.float64) @ self.action_masks, 1.0)
+        result[masks == self.UNKNOWN_STATE] = 0.0
+        return result
+
+    def statistics(self):
+        self.socket.sendall(np.uint32(self.STATISTICS).tobytes())
+        self.__read_status()
+        return self.__read_string()
+
 def common_parser():
     parser = argparse.ArgumentParser()
     parser.add_argument("--env",
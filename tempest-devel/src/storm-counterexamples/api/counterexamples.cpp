@@ -74,5 +74,15 @@ namespace storm {
             return std::make_shared<storm::counterexamples::PathCounterexample<double>>(cex);
         }
 
+        std::shared_ptr<storm::counterexamples::ShieldCounterexample<double>> computeShieldCounterexample(std::shared_ptr<storm::models::sparse::Smg<double>> model, std::shared_ptr<storm::logic::Formula const> const& formula,
+                                                                                                           std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, size_t maxK, uint64_t numberOfThreads) {
+            STORM_LOG_THROW(shieldingExpression, storm::exceptions::InvalidArgumentException, "Shield counterexamples require a shielding expression.");
+            Environment env;
+            storm::counterexamples::SmgShieldCounterexampleGenerator<double>::Options options;
+            options.maximalNumberOfPaths = maxK;
+            options.numberOfThreads = numberOfThreads;
+            return storm::counterexamples::SmgShieldCounterexampleGenerator<double>::computeCounterexample(env, model, *formula, *shieldingExpression, options);
+        }
+
     }
 }
@@ -3,6 +3,7 @@
 #include "storm-counterexamples/counterexamples/MILPMinimalLabelSetGenerator.h"
 #include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
 #include "storm-counterexamples/counterexamples/PathCounterexample.h"
+#include "storm-counterexamples/counterexamples/SmgShieldCounterexampleGenerator.h"
 
 namespace storm {
     namespace api {
@@ -13,5 +14,11 @@ namespace storm {
 
         std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCounterexample(std::shared_ptr<storm::models::sparse::Model<double>> model, std::shared_ptr<storm::logic::Formula const> const& formula, size_t maxK);
 
+        /*!
+         * Explains all coalition states in which an absolute pre-safety shield for the given game formula can not allow any action
+         * by the strategy of the opponents and the (at most maxK) most likely violating paths.
+         */
+        std::shared_ptr<storm::counterexamples::ShieldCounterexample<double>> computeShieldCounterexample(std::shared_ptr<storm::models::sparse::Smg<double>> model, std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, size_t maxK, uint64_t numberOfThreads = 1);
+
     }
 }
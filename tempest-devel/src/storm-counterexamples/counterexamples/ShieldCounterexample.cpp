@@ -0,0 +1,108 @@
+#include "storm-counterexamples/counterexamples/ShieldCounterexample.h"
+
+#include "storm/io/export.h"
+#include "storm/utility/constants.h"
+
+namespace storm {
+    namespace counterexamples {
+
+        template<typename ValueType>
+        ShieldCounterexample<ValueType>::ShieldCounterexample(std::shared_ptr<storm::models::sparse::Smg<ValueType>> model, ValueType const& threshold) : model(model), threshold(threshold) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        void ShieldCounterexample<ValueType>::addUnsafeState(UnsafeState&& unsafeState) {
+            unsafeStates.push_back(std::move(unsafeState));
+        }
+
+        template<typename ValueType>
+        std::vector<typename ShieldCounterexample<ValueType>::UnsafeState> const& ShieldCounterexample<ValueType>::getUnsafeStates() const {
+            return unsafeStates;
+        }
+
+        template<typename ValueType>
+        ValueType const& ShieldCounterexample<ValueType>::getThreshold() const {
+            return threshold;
+        }
+
+        template<typename ValueType>
+        void ShieldCounterexample<ValueType>::writeStateToStream(std::ostream& out, state_type state) const {
+            out << "state " << state;
+            if (model->hasStateValuations()) {
+                out << ": " << model->getStateValuations().getStateInfo(state);
+            }
+            out << ": {";
+            storm::utility::outputFixedWidth(out, model->getLabelsOfState(state), 0);
+            out << "}";
+        }
+
+        template<typename ValueType>
+        void ShieldCounterexample<ValueType>::writeToStream(std::ostream& out) const {
+            out << "Shield counterexample for " << unsafeStates.size() << " states without safe action w.r.t. threshold " << threshold << ":" << std::endl;
+            for (auto const& unsafeState : unsafeStates) {
+                writeStateToStream(out, unsafeState.state);
+                out << " with optimal value " << unsafeState.value << std::endl;
+                out << "\tStrategy of the opponents:" << std::endl;
+                for (auto const& stateChoice : unsafeState.opponentChoices) {
+                    out << "\t\t";
+                    writeStateToStream(out, stateChoice.first);
+                    out << " -> choice " << stateChoice.second;
+                    if (model->hasChoiceLabeling()) {
+                        out << " {";
+                        storm::utility::outputFixedWidth(out, model->getChoiceLabeling().getLabelsOfChoice(model->getTransitionMatrix().getRowGroupIndices()[stateChoice.first] + stateChoice.second), 0);
+                        out << "}";
+                    }
+                    out << std::endl;
+                }
+                for (uint64_t k = 0; k < unsafeState.paths.size(); ++k) {
+                    out << "\t" << k + 1 << "-most likely violating path with probability " << unsafeState.pathProbabilities[k] << ":" << std::endl;
+                    for (auto const& state : unsafeState.paths[k]) {
+                        out << "\t\t";
+                        writeStateToStream(out, state);
+                        out << std::endl;
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        storm::json<storm::RationalNumber> ShieldCounterexample<ValueType>::toJson() const {
+            storm::json<storm::RationalNumber> output = storm::json<storm::RationalNumber>::array();
+            for (auto const& unsafeState : unsafeStates) {
+                storm::json<storm::RationalNumber> entry;
+                entry["state"] = unsafeState.state;
+                if (model->hasStateValuations()) {
+                    entry["valuation"] = model->getStateValuations().template toJson<storm::RationalNumber>(unsafeState.state);
+                }
+                entry["value"] = storm::utility::convertNumber<storm::RationalNumber>(unsafeState.value);
+
+                storm::json<storm::RationalNumber> strategy = storm::json<storm::RationalNumber>::array();
+                for (auto const& stateChoice : unsafeState.opponentChoices) {
+                    storm::json<storm::RationalNumber> choiceJson;
+                    choiceJson["state"] = stateChoice.first;
+                    choiceJson["choice"] = stateChoice.second;
+                    if (model->hasChoiceLabeling()) {
+                        auto labels = model->getChoiceLabeling().getLabelsOfChoice(model->getTransitionMatrix().getRowGroupIndices()[stateChoice.first] + stateChoice.second);
+                        choiceJson["labels"] = std::vector<std::string>(labels.begin(), labels.end());
+                    }
+                    strategy.push_back(choiceJson);
+                }
+                entry["opponent-strategy"] = strategy;
+
+                storm::json<storm::RationalNumber> paths = storm::json<storm::RationalNumber>::array();
+                for (uint64_t k = 0; k < unsafeState.paths.size(); ++k) {
+                    storm::json<storm::RationalNumber> pathJson;
+                    pathJson["probability"] = storm::utility::convertNumber<storm::RationalNumber>(unsafeState.pathProbabilities[k]);
+                    pathJson["states"] = unsafeState.paths[k];
+                    paths.push_back(pathJson);
+                }
+                entry["paths"] = paths;
+                output.push_back(entry);
+            }
+            return output;
+        }
+
+        template class ShieldCounterexample<double>;
+    }
+}
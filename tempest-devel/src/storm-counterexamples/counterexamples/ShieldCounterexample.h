@@ -0,0 +1,63 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "storm-counterexamples/counterexamples/Counterexample.h"
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+    namespace counterexamples {
+
+        /*!
+         * Explains why an absolute pre-safety shield for a stochastic multiplayer game can not allow any action in some states of
+         * the coalition. For each of these unsafe states, the counterexample consists of the strategy of the opponents that keeps
+         * the value of the state on the wrong side of the threshold and of the most likely paths that violate the property if the
+         * coalition plays optimally and the opponents follow this strategy.
+         */
+        template<typename ValueType>
+        class ShieldCounterexample : public Counterexample {
+        public:
+            typedef storm::storage::sparse::state_type state_type;
+
+            struct UnsafeState {
+                state_type state;
+                // The optimal value of the coalition in the state.
+                ValueType value;
+                // The (local) choices of the opponents in the opponent states with more than one choice that are reachable from the state.
+                std::map<state_type, uint64_t> opponentChoices;
+                // The most likely violating paths ordered by decreasing probability. Each path starts in the unsafe state.
+                std::vector<std::vector<state_type>> paths;
+                std::vector<ValueType> pathProbabilities;
+            };
+
+            ShieldCounterexample(std::shared_ptr<storm::models::sparse::Smg<ValueType>> model, ValueType const& threshold);
+
+            void addUnsafeState(UnsafeState&& unsafeState);
+
+            std::vector<UnsafeState> const& getUnsafeStates() const;
+
+            ValueType const& getThreshold() const;
+
+            void writeToStream(std::ostream& out) const override;
+
+            /*!
+             * Exports the unsafe states with their state valuations and the labels of the opponent choices, if available.
+             */
+            storm::json<storm::RationalNumber> toJson() const;
+
+        private:
+            void writeStateToStream(std::ostream& out, state_type state) const;
+
+            std::shared_ptr<storm::models::sparse::Smg<ValueType>> model;
+            ValueType threshold;
+            std::vector<UnsafeState> unsafeStates;
+        };
+
+    }
+}
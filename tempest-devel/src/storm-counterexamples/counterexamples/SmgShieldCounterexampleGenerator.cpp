@@ -0,0 +1,171 @@
+#include "storm-counterexamples/counterexamples/SmgShieldCounterexampleGenerator.h"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/shortestPaths.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace counterexamples {
+
+        template<typename ValueType>
+        std::shared_ptr<ShieldCounterexample<ValueType>> SmgShieldCounterexampleGenerator<ValueType>::computeCounterexample(Environment const& env, std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& model, storm::logic::Formula const& formula, storm::logic::ShieldExpression const& shieldingExpression, Options const& options, boost::optional<storm::storage::BitVector> const& relevantStates) {
+            typedef typename ShieldCounterexample<ValueType>::state_type state_type;
+
+            STORM_LOG_THROW(formula.isGameFormula(), storm::exceptions::InvalidPropertyException, "Shield counterexamples require a game formula, got " << formula << ".");
+            storm::logic::GameFormula const& gameFormula = formula.asGameFormula();
+            STORM_LOG_THROW(gameFormula.getSubformula().isProbabilityOperatorFormula(), storm::exceptions::InvalidPropertyException, "Shield counterexamples require a probability operator within the game formula, got " << formula << ".");
+            storm::logic::ProbabilityOperatorFormula const& probabilityOperator = gameFormula.getSubformula().asProbabilityOperatorFormula();
+            STORM_LOG_THROW(probabilityOperator.hasOptimalityType(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed.");
+            storm::logic::Formula const& pathFormula = probabilityOperator.getSubformula();
+            STORM_LOG_THROW(pathFormula.isUntilFormula() || pathFormula.isEventuallyFormula() || pathFormula.isGloballyFormula(), storm::exceptions::NotSupportedException, "Shield counterexamples only support path formulas of the form phi U psi, F psi and G psi, got " << pathFormula << ".");
+            STORM_LOG_THROW(shieldingExpression.isPreSafetyShield() && !shieldingExpression.isRelative(), storm::exceptions::InvalidArgumentException, "Shield counterexamples require an absolute pre-safety shield, as relative shields always allow the optimal actions.");
+            STORM_LOG_THROW(options.maximalNumberOfPaths > 0, storm::exceptions::InvalidArgumentException, "The maximal number of paths has to be positive.");
+
+            bool maximize = probabilityOperator.getOptimalityType() == storm::solver::OptimizationDirection::Maximize;
+            ValueType threshold = storm::utility::convertNumber<ValueType>(shieldingExpression.getValue());
+            auto counterexample = std::make_shared<ShieldCounterexample<ValueType>>(model, threshold);
+
+            // Solve the game. The scheduler contains the optimal choices of the coalition as well as those of the opponents.
+            storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ValueType>> checker(*model);
+            storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> checkTask(formula);
+            checkTask.setProduceSchedulers(true);
+            std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(env, checkTask);
+            auto const& quantitativeResult = result->template asExplicitQuantitativeCheckResult<ValueType>();
+            std::vector<ValueType> const& values = quantitativeResult.getValueVector();
+
+            // These are the states for which the pre-shield logs that no shielding action is possible.
+            storm::storage::BitVector statesOfCoalition = model->computeStatesOfCoalition(gameFormula.getCoalition());
+            storm::storage::BitVector unsafeStates(model->getNumberOfStates());
+            for (auto state : statesOfCoalition) {
+                if (maximize ? values[state] < threshold : values[state] > threshold) {
+                    unsafeStates.set(state);
+                }
+            }
+            if (relevantStates) {
+                unsafeStates &= relevantStates.get();
+            }
+            STORM_LOG_INFO("Found " << unsafeStates.getNumberOfSetBits() << " coalition states without safe action.");
+            if (unsafeStates.empty()) {
+                return counterexample;
+            }
+
+            // Induce the Markov chain of the optimal strategies. Without scheduler, all states are decided by the preprocessing.
+            std::vector<uint64_t> choices(model->getNumberOfStates(), 0);
+            if (quantitativeResult.hasScheduler()) {
+                for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+                    choices[state] = quantitativeResult.getScheduler().getChoice(state).getDeterministicChoice();
+                }
+            }
+            storm::storage::SparseMatrix<ValueType> inducedMatrix = model->getTransitionMatrix().selectRowsFromRowGroups(choices, false);
+
+            // Globally formulas are violated by reaching a state that does not satisfy the subformula.
+            storm::storage::BitVector phiStates(model->getNumberOfStates(), true);
+            storm::storage::BitVector targetStates;
+            if (pathFormula.isGloballyFormula()) {
+                targetStates = ~checker.check(env, pathFormula.asGloballyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else if (pathFormula.isEventuallyFormula()) {
+                targetStates = checker.check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            } else {
+                phiStates = checker.check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                targetStates = checker.check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+            }
+
+            // If the coalition wants to reach the target, the property is violated exactly if the chain reaches a state that can not
+            // reach the target anymore. Otherwise, it is violated by reaching the target.
+            storm::storage::BitVector violatingStates;
+            bool coalitionReachesTarget = maximize != pathFormula.isGloballyFormula();
+            if (coalitionReachesTarget) {
+                violatingStates = ~storm::utility::graph::performProbGreater0(inducedMatrix.transpose(true), phiStates, targetStates);
+            } else {
+                violatingStates = targetStates;
+            }
+            storm::storage::BitVector continuingStates = phiStates & ~targetStates & ~violatingStates;
+            // The paths end in the violating states, from where the meta-target of the shortest paths search is reached.
+            storm::storage::SparseMatrix<ValueType> pathMatrix = inducedMatrix.filterEntries(continuingStates);
+            // The row grouping of the matrix is created lazily and must not be created concurrently.
+            pathMatrix.getRowGroupIndices();
+
+            std::vector<state_type> unsafeStateList(unsafeStates.begin(), unsafeStates.end());
+            std::vector<typename ShieldCounterexample<ValueType>::UnsafeState> explanations(unsafeStateList.size());
+            storm::storage::BitVector allStates(model->getNumberOfStates(), true);
+            storm::storage::BitVector noStates(model->getNumberOfStates(), false);
+            // Exceptions can not leave the threads, so they are rethrown once all unsafe states are explained.
+            std::vector<std::exception_ptr> exceptions(unsafeStateList.size());
+            storm::utility::parallel::forEachBlock(unsafeStateList.size(), options.numberOfThreads, 1, [&] (uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    try {
+                        auto& explanation = explanations[index];
+                        explanation.state = unsafeStateList[index];
+                        explanation.value = values[explanation.state];
+
+                        // Restrict the search to the reachable part of the chain.
+                        storm::storage::BitVector initialState(model->getNumberOfStates());
+                        initialState.set(explanation.state);
+                        storm::storage::BitVector reachableStates = storm::utility::graph::getReachableStates(pathMatrix, initialState, allStates, noStates);
+                        for (auto state : reachableStates) {
+                            if (!statesOfCoalition.get(state) && continuingStates.get(state) && model->getTransitionMatrix().getRowGroupSize(state) > 1) {
+                                explanation.opponentChoices[state] = choices[state];
+                            }
+                        }
+
+                        storm::storage::SparseMatrix<ValueType> localMatrix = pathMatrix.getSubmatrix(false, reachableStates, reachableStates);
+                        std::vector<ValueType> violationProbabilities(reachableStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                        std::vector<state_type> localToGlobal(reachableStates.begin(), reachableStates.end());
+                        for (uint64_t localState = 0; localState < localToGlobal.size(); ++localState) {
+                            if (violatingStates.get(localToGlobal[localState])) {
+                                violationProbabilities[localState] = storm::utility::one<ValueType>();
+                            }
+                        }
+                        storm::storage::BitVector localInitialState(localToGlobal.size());
+                        localInitialState.set(reachableStates.getNumberOfSetBitsBeforeIndex(explanation.state));
+
+                        storm::utility::ksp::ShortestPathsGenerator<ValueType> generator(localMatrix, violationProbabilities, localInitialState, storm::utility::ksp::MatrixFormat::straight);
+                        for (uint64_t k = 1; k <= options.maximalNumberOfPaths; ++k) {
+                            std::vector<state_type> path;
+                            try {
+                                path = generator.getPathAsList(k);
+                            } catch (std::invalid_argument const&) {
+                                // There are less than k violating paths.
+                                break;
+                            }
+                            std::reverse(path.begin(), path.end());
+                            for (auto& state : path) {
+                                state = localToGlobal[state];
+                            }
+                            explanation.paths.push_back(std::move(path));
+                            explanation.pathProbabilities.push_back(generator.getDistance(k));
+                        }
+                    } catch (...) {
+                        exceptions[index] = std::current_exception();
+                    }
+                }
+            });
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+
+            for (auto& explanation : explanations) {
+                counterexample->addUnsafeState(std::move(explanation));
+            }
+            return counterexample;
+        }
+
+        template class SmgShieldCounterexampleGenerator<double>;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <boost/optional.hpp>
+
+#include "storm-counterexamples/counterexamples/ShieldCounterexample.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formula.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace counterexamples {
+
+        /*!
+         * Generates counterexamples for the states of a stochastic multiplayer game in which an absolute pre-safety shield can not
+         * allow any action, because even the optimal value of the coalition violates the threshold of the shield.
+         *
+         * The game is solved once. Fixing the optimal choices of the coalition and of the opponents induces a Markov chain in which
+         * the violating paths of all unsafe states are searched with a k-shortest paths algorithm. Each unsafe state only
+         * considers the part of the chain that is reachable from it, so the states can be explained independently in parallel.
+         */
+        template<typename ValueType>
+        class SmgShieldCounterexampleGenerator {
+        public:
+            struct Options {
+                // The maximal number of violating paths per unsafe state.
+                uint64_t maximalNumberOfPaths = 5;
+                // The number of threads that explain the unsafe states. If zero, the number of hardware threads is used.
+                uint64_t numberOfThreads = 1;
+            };
+
+            /*!
+             * Computes the counterexample for all unsafe states of the coalition.
+             *
+             * @param formula A game formula of the form <<coalition>> Pmax=? [phi U psi], [F psi] or [G psi] (or Pmin=?).
+             * @param shieldingExpression An absolute pre-safety shielding expression.
+             * @param relevantStates If given, only the unsafe states among these states are explained.
+             */
+            static std::shared_ptr<ShieldCounterexample<ValueType>> computeCounterexample(Environment const& env, std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& model, storm::logic::Formula const& formula, storm::logic::ShieldExpression const& shieldingExpression, Options const& options = Options(), boost::optional<storm::storage::BitVector> const& relevantStates = boost::none);
+        };
+
+    }
+}
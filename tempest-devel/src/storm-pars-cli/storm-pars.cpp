@@ -8,6 +8,7 @@
 #include "storm-pars/analysis/MonotonicityHelper.h"
 
 #include "storm-pars/modelchecker/instantiation/SparseCtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseSmgInstantiationModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseParameterLiftingModelChecker.h"
 #include "storm-pars/modelchecker/region/SparseDtmcParameterLiftingModelChecker.h"
 
@@ -503,8 +504,10 @@ namespace storm {
                 verifyPropertiesAtSamplePoints<storm::modelchecker::SparseCtmcInstantiationModelChecker, storm::models::sparse::Ctmc<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Ctmc<ValueType>>(), input, samples);
             } else if (model->isOfType(storm::models::ModelType::Mdp)) {
                 verifyPropertiesAtSamplePoints<storm::modelchecker::SparseMdpInstantiationModelChecker, storm::models::sparse::Mdp<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Mdp<ValueType>>(), input, samples);
+            } else if (model->isOfType(storm::models::ModelType::Smg)) {
+                verifyPropertiesAtSamplePoints<storm::modelchecker::SparseSmgInstantiationModelChecker, storm::models::sparse::Smg<ValueType>, ValueType, SolveValueType>(*model->template as<storm::models::sparse::Smg<ValueType>>(), input, samples);
             } else {
-                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sampling is currently only supported for DTMCs, CTMCs and MDPs.");
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sampling is currently only supported for DTMCs, CTMCs, MDPs and SMGs.");
             }
         }
 
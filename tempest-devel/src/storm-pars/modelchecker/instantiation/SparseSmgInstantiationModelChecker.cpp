@@ -0,0 +1,92 @@
+#include "storm-pars/modelchecker/instantiation/SparseSmgInstantiationModelChecker.h"
+
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/logic/GameFormula.h"
+#include "storm/logic/ProbabilityOperatorFormula.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/utility/graph.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidStateException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template <typename SparseModelType, typename ConstantType>
+        SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::SparseSmgInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel) {
+            //Intentionally left empty
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            auto const& instantiatedModel = modelInstantiator.instantiate(valuation);
+            STORM_LOG_THROW(instantiatedModel.getTransitionMatrix().isProbabilistic(), storm::exceptions::InvalidArgumentException, "Instantiation point is invalid as the transition matrix becomes non-stochastic.");
+            storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ConstantType>> modelChecker(instantiatedModel);
+
+            // Check if there are some optimizations implemented for the specified property
+            storm::logic::Formula const& formula = this->currentCheckTask->getFormula();
+            if (formula.isGameFormula() && formula.asGameFormula().getSubformula().isInFragment(storm::logic::reachability())) {
+                return checkReachabilityProbabilityFormula(env, modelChecker, instantiatedModel);
+            } else {
+                return modelChecker.check(env, *this->currentCheckTask);
+            }
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>::checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ConstantType>>& modelChecker, storm::models::sparse::Smg<ConstantType> const& instantiatedModel) {
+            storm::logic::GameFormula const& gameFormula = this->currentCheckTask->getFormula().asGameFormula();
+            storm::logic::ProbabilityOperatorFormula const& operatorFormula = gameFormula.getSubformula().asProbabilityOperatorFormula();
+
+            if (!this->currentCheckTask->getHint().isExplicitModelCheckerHint()) {
+                this->currentCheckTask->setHint(std::make_shared<ExplicitModelCheckerHint<ConstantType>>());
+            }
+            ExplicitModelCheckerHint<ConstantType>& hint = this->currentCheckTask->getHint().template asExplicitModelCheckerHint<ConstantType>();
+
+            if (this->getInstantiationsAreGraphPreserving() && !hint.hasMaybeStates()) {
+                // Perform purely qualitative analysis once. States that can not reach a psi state have value zero for all strategies.
+                storm::logic::Formula const& pathFormula = operatorFormula.getSubformula();
+                storm::storage::BitVector phiStates;
+                storm::storage::BitVector psiStates;
+                if (pathFormula.isUntilFormula()) {
+                    phiStates = modelChecker.check(env, pathFormula.asUntilFormula().getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                    psiStates = modelChecker.check(env, pathFormula.asUntilFormula().getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                } else {
+                    phiStates = storm::storage::BitVector(instantiatedModel.getNumberOfStates(), true);
+                    psiStates = modelChecker.check(env, pathFormula.asEventuallyFormula().getSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                }
+                storm::storage::BitVector maybeStates = storm::utility::graph::performProbGreater0(instantiatedModel.getBackwardTransitions(), phiStates, psiStates);
+                maybeStates &= ~psiStates;
+
+                // Check if there can be end components within the maybestates
+                if (storm::utility::graph::performProb1A(instantiatedModel.getTransitionMatrix(), instantiatedModel.getTransitionMatrix().getRowGroupIndices(), instantiatedModel.getBackwardTransitions(), maybeStates, ~maybeStates).full()) {
+                    hint.setNoEndComponentsInMaybeStates(true);
+                }
+                hint.setMaybeStates(std::move(maybeStates));
+                hint.setComputeOnlyMaybeStates(true);
+            }
+
+            std::unique_ptr<CheckResult> result;
+            // Check the formula and store the result as a hint for the next call.
+            // For qualitative properties, we still want a quantitative result hint. Hence we check the formula without its bound
+            if (operatorFormula.hasQuantitativeResult()) {
+                result = modelChecker.check(env, *this->currentCheckTask);
+                hint.setResultHint(result->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
+            } else {
+                storm::logic::OperatorInformation operatorInformation(this->currentCheckTask->substituteFormula(operatorFormula).getOptimizationDirection());
+                auto quantitativeFormula = std::make_shared<storm::logic::GameFormula>(gameFormula.getCoalition(), std::make_shared<storm::logic::ProbabilityOperatorFormula>(operatorFormula.getSubformula().asSharedPointer(), operatorInformation));
+                std::unique_ptr<CheckResult> quantitativeResult = modelChecker.check(env, this->currentCheckTask->substituteFormula(*quantitativeFormula));
+                result = quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>());
+                hint.setResultHint(std::move(quantitativeResult->template asExplicitQuantitativeCheckResult<ConstantType>().getValueVector()));
+            }
+
+            return result;
+        }
+
+        template class SparseSmgInstantiationModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, double>;
+        template class SparseSmgInstantiationModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, storm::RationalNumber>;
+
+    }
+}
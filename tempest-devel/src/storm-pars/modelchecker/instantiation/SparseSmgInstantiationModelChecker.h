@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+
+#include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
+#include "storm-pars/utility/ModelInstantiator.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * Class to efficiently check a game formula on a parametric SMG with different parameter instantiations.
+         * The structure of the instantiated game is kept and only the values of the transitions are updated.
+         * If the instantiations are graph-preserving, the value iteration for reachability properties starts
+         * at the values of the previous instantiation.
+         */
+        template <typename SparseModelType, typename ConstantType>
+        class SparseSmgInstantiationModelChecker : public SparseInstantiationModelChecker<SparseModelType, ConstantType> {
+        public:
+            SparseSmgInstantiationModelChecker(SparseModelType const& parametricModel);
+
+            virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
+
+        protected:
+            // Optimizations for the different formula types
+            std::unique_ptr<CheckResult> checkReachabilityProbabilityFormula(Environment const& env, storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ConstantType>>& modelChecker, storm::models::sparse::Smg<ConstantType> const& instantiatedModel);
+
+            storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Smg<ConstantType>> modelInstantiator;
+        };
+    }
+}
@@ -0,0 +1,460 @@
+#include "storm-pars/modelchecker/region/SparseSmgParameterLiftingModelChecker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/GameFormula.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/shields/ShieldHandling.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/parallel.h"
+#include "storm/utility/vector.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template <typename SparseModelType, typename ConstantType>
+        SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::LiftedGame::LiftedGame(storm::storage::SparseMatrix<ParametricType> const& parametricMatrix, std::vector<ParametricType> const& parametricVector, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& statesOfCoalition) : parameterLifter(parametricMatrix, parametricVector, parametricMatrix.getRowFilter(maybeStates), maybeStates), numberOfMaybeStates(maybeStates.getNumberOfSetBits()) {
+            storm::storage::SparseMatrix<ConstantType> const& liftedMatrix = parameterLifter.getMatrix();
+            uint64_t numberOfNatureStates = liftedMatrix.getRowGroupCount();
+
+            // The rows of the maybe states are followed by the rows of nature. As the rows of the maybe states each have a single entry
+            // and nature's rows are copied in order, the entries of nature start at the same index as nature's rows.
+            storm::storage::SparseMatrixBuilder<ConstantType> builder(numberOfNatureStates + liftedMatrix.getRowCount(), numberOfMaybeStates + numberOfNatureStates, numberOfNatureStates + liftedMatrix.getEntryCount(), true, true, numberOfMaybeStates + numberOfNatureStates);
+            uint64_t row = 0;
+            uint64_t natureState = numberOfMaybeStates;
+            for (auto const& state : maybeStates) {
+                builder.newRowGroup(row);
+                for (uint64_t parametricRow = parametricMatrix.getRowGroupIndices()[state]; parametricRow < parametricMatrix.getRowGroupIndices()[state + 1]; ++parametricRow) {
+                    builder.addNextValue(row, natureState, storm::utility::one<ConstantType>());
+                    ++row;
+                    ++natureState;
+                }
+            }
+            for (uint64_t group = 0; group < numberOfNatureStates; ++group) {
+                builder.newRowGroup(row);
+                for (uint64_t liftedRow = liftedMatrix.getRowGroupIndices()[group]; liftedRow < liftedMatrix.getRowGroupIndices()[group + 1]; ++liftedRow) {
+                    for (auto const& entry : liftedMatrix.getRow(liftedRow)) {
+                        builder.addNextValue(row, entry.getColumn(), entry.getValue());
+                    }
+                    ++row;
+                }
+            }
+            matrix = builder.build();
+            vector = std::vector<ConstantType>(matrix.getRowCount(), storm::utility::zero<ConstantType>());
+
+            statesOfOpponents = storm::storage::BitVector(numberOfMaybeStates, false);
+            uint64_t gameState = 0;
+            for (auto const& state : maybeStates) {
+                statesOfOpponents.set(gameState, !statesOfCoalition.get(state));
+                ++gameState;
+            }
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::LiftedGame::specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            parameterLifter.specifyRegion(region, dirForParameters);
+
+            storm::storage::SparseMatrix<ConstantType> const& liftedMatrix = parameterLifter.getMatrix();
+            uint64_t numberOfNatureStates = liftedMatrix.getRowGroupCount();
+            auto gameEntryIt = matrix.begin(numberOfNatureStates);
+            for (auto liftedEntryIt = liftedMatrix.begin(), liftedEntryIte = liftedMatrix.end(); liftedEntryIt != liftedEntryIte; ++liftedEntryIt, ++gameEntryIt) {
+                gameEntryIt->setValue(liftedEntryIt->getValue());
+            }
+            std::copy(parameterLifter.getVector().begin(), parameterLifter.getVector().end(), vector.begin() + numberOfNatureStates);
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<ConstantType> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::LiftedGame::solve(Environment const& env, storm::solver::OptimizationDirection const& coalitionDirection, storm::solver::OptimizationDirection const& dirForParameters) const {
+            // The game value iteration optimizes in the given direction and inverts it for all flagged states.
+            storm::storage::BitVector flippedStates = statesOfOpponents;
+            flippedStates.resize(matrix.getRowGroupCount(), dirForParameters != coalitionDirection);
+            storm::modelchecker::helper::internal::GameViHelper<ConstantType> viHelper(matrix, flippedStates);
+            std::vector<ConstantType> x(matrix.getRowGroupCount(), storm::utility::zero<ConstantType>());
+            std::vector<ConstantType> choiceValues;
+            viHelper.performValueIteration(env, x, vector, coalitionDirection, choiceValues);
+            return x;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::SparseSmgParameterLiftingModelChecker() : complementResult(false) {
+            // Intentionally left empty
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        bool SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::canHandle(std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask) const {
+            bool result = parametricModel->isOfType(storm::models::ModelType::Smg);
+            result &= parametricModel->isSparseModel();
+            result &= parametricModel->supportsParameters();
+            result &= static_cast<bool>(parametricModel->template as<SparseModelType>());
+            result &= checkTask.getFormula().isGameFormula();
+            if (result) {
+                storm::logic::Formula const& subformula = checkTask.getFormula().asGameFormula().getSubformula();
+                result &= subformula.isProbabilityOperatorFormula();
+                if (result) {
+                    storm::logic::Formula const& pathFormula = subformula.asProbabilityOperatorFormula().getSubformula();
+                    result &= pathFormula.isUntilFormula() || pathFormula.isEventuallyFormula() || pathFormula.isGloballyFormula();
+                }
+            }
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask, bool generateRegionSplitEstimates, bool allowModelSimplification) {
+            STORM_LOG_THROW(this->canHandle(parametricModel, checkTask), storm::exceptions::NotSupportedException, "Parameter lifting on stochastic games is not supported for the formula " << checkTask.getFormula() << ".");
+            STORM_LOG_WARN_COND(!generateRegionSplitEstimates, "Region split estimates are not supported for stochastic games.");
+            reset();
+
+            this->parametricModel = parametricModel->template as<SparseModelType>();
+            currentFormula = checkTask.getFormula().asSharedPointer();
+            storm::logic::GameFormula const& gameFormula = currentFormula->asGameFormula();
+            currentCheckTask = std::make_unique<CheckTask<storm::logic::Formula, ConstantType>>(checkTask.substituteFormula(gameFormula.getSubformula()).template convertValueType<ConstantType>());
+            STORM_LOG_THROW(currentCheckTask->isOptimizationDirectionSet(), storm::exceptions::InvalidArgumentException, "The formula " << gameFormula << " needs to specify whether the coalition minimizes or maximizes.");
+            if (checkTask.isShieldingTask()) {
+                shieldingExpression = checkTask.getShieldingExpression();
+            }
+            statesOfCoalition = this->parametricModel->computeStatesOfCoalition(gameFormula.getCoalition());
+
+            storm::logic::Formula const& pathFormula = gameFormula.getSubformula().asProbabilityOperatorFormula().getSubformula();
+            storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalChecker(*this->parametricModel);
+            storm::storage::BitVector phiStates;
+            storm::storage::BitVector psiStates;
+            if (pathFormula.isUntilFormula()) {
+                storm::logic::UntilFormula const& untilFormula = pathFormula.asUntilFormula();
+                STORM_LOG_THROW(propositionalChecker.canHandle(untilFormula.getLeftSubformula()) && propositionalChecker.canHandle(untilFormula.getRightSubformula()), storm::exceptions::NotSupportedException, "Parameter lifting with non-propositional subformulas is not supported");
+                phiStates = std::move(propositionalChecker.check(untilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                psiStates = std::move(propositionalChecker.check(untilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector());
+            } else {
+                storm::logic::Formula const& subformula = pathFormula.isEventuallyFormula() ? pathFormula.asEventuallyFormula().getSubformula() : pathFormula.asGloballyFormula().getSubformula();
+                STORM_LOG_THROW(propositionalChecker.canHandle(subformula), storm::exceptions::NotSupportedException, "Parameter lifting with non-propositional subformulas is not supported");
+                phiStates = storm::storage::BitVector(this->parametricModel->getNumberOfStates(), true);
+                psiStates = std::move(propositionalChecker.check(subformula)->asExplicitQualitativeCheckResult().getTruthValuesVector());
+                // G psi is checked via 1 - P(F !psi), where the coalition and nature switch their objectives.
+                complementResult = pathFormula.isGloballyFormula();
+                if (complementResult) {
+                    psiStates.complement();
+                }
+            }
+
+            // The states that can not reach the target under any strategies and parameter valuations in the (graph-preserving) region have value zero.
+            targetStates = std::move(psiStates);
+            maybeStates = storm::utility::graph::performProbGreater0(this->parametricModel->getBackwardTransitions(), phiStates, targetStates);
+            maybeStates &= ~targetStates;
+            parametricVector = this->parametricModel->getTransitionMatrix().getConstrainedRowSumVector(storm::storage::BitVector(this->parametricModel->getTransitionMatrix().getRowCount(), true), targetStates);
+
+            if (!maybeStates.empty()) {
+                getLiftedGame(0);
+            }
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        void SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::reset() {
+            // The instantiation checker refers to the parametric model.
+            instantiationChecker = nullptr;
+            parametricModel = nullptr;
+            currentFormula = nullptr;
+            currentCheckTask = nullptr;
+            shieldingExpression = nullptr;
+            statesOfCoalition.clear();
+            maybeStates.clear();
+            targetStates.clear();
+            parametricVector.clear();
+            complementResult = false;
+            liftedGames.clear();
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        typename SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::LiftedGame& SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::getLiftedGame(uint64_t index) {
+            if (liftedGames.size() <= index) {
+                liftedGames.resize(index + 1);
+            }
+            if (!liftedGames[index]) {
+                liftedGames[index] = std::make_unique<LiftedGame>(this->parametricModel->getTransitionMatrix(), parametricVector, maybeStates, statesOfCoalition);
+            }
+            return *liftedGames[index];
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<ConstantType> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::computeValues(Environment const& env, LiftedGame* liftedGame, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::vector<ConstantType>* choiceValues) {
+            STORM_LOG_THROW(currentCheckTask, storm::exceptions::InvalidArgumentException, "No formula has been specified.");
+            storm::solver::OptimizationDirection coalitionDirection = currentCheckTask->getOptimizationDirection();
+            storm::solver::OptimizationDirection natureDirection = dirForParameters;
+            if (complementResult) {
+                coalitionDirection = storm::solver::invert(coalitionDirection);
+                natureDirection = storm::solver::invert(natureDirection);
+            }
+
+            std::vector<ConstantType> values(this->parametricModel->getNumberOfStates(), storm::utility::zero<ConstantType>());
+            storm::utility::vector::setVectorValues(values, targetStates, storm::utility::one<ConstantType>());
+            std::vector<ConstantType> gameValues;
+            if (!maybeStates.empty()) {
+                {
+                    std::lock_guard<std::mutex> lock(functionEvaluationMutex);
+                    liftedGame->specifyRegion(region, natureDirection);
+                }
+                gameValues = liftedGame->solve(env, coalitionDirection, natureDirection);
+                storm::utility::vector::setVectorValues(values, maybeStates, gameValues);
+            }
+
+            if (choiceValues) {
+                auto const& rowGroupIndices = this->parametricModel->getTransitionMatrix().getRowGroupIndices();
+                choiceValues->assign(this->parametricModel->getTransitionMatrix().getRowCount(), storm::utility::zero<ConstantType>());
+                for (auto const& state : targetStates) {
+                    std::fill(choiceValues->begin() + rowGroupIndices[state], choiceValues->begin() + rowGroupIndices[state + 1], storm::utility::one<ConstantType>());
+                }
+                // The value of a choice is the value of the corresponding state of nature.
+                auto natureValueIt = gameValues.begin() + std::min<uint64_t>(gameValues.size(), maybeStates.getNumberOfSetBits());
+                for (auto const& state : maybeStates) {
+                    for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row, ++natureValueIt) {
+                        (*choiceValues)[row] = *natureValueIt;
+                    }
+                }
+                if (complementResult) {
+                    for (auto& value : *choiceValues) {
+                        value = storm::utility::one<ConstantType>() - value;
+                    }
+                }
+            }
+            if (complementResult) {
+                for (auto& value : values) {
+                    value = storm::utility::one<ConstantType>() - value;
+                }
+            }
+            return values;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::check(Environment const& env, LiftedGame* liftedGame, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            auto quantitativeResult = std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(computeValues(env, liftedGame, region, dirForParameters));
+            if (currentCheckTask->isBoundSet()) {
+                return quantitativeResult->compareAgainstBound(currentCheckTask->getBoundComparisonType(), currentCheckTask->getBoundThreshold());
+            }
+            return quantitativeResult;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<CheckResult> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            return check(env, liftedGames.empty() ? nullptr : liftedGames.front().get(), region, dirForParameters);
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<QuantitativeCheckResult<ConstantType>> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::getBound(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            return std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(computeValues(env, liftedGames.empty() ? nullptr : liftedGames.front().get(), region, dirForParameters));
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        typename SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::ParametricType SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::getBoundAtInitState(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            STORM_LOG_THROW(this->parametricModel->getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException, "Getting a bound at the initial state requires a model with a single initial state.");
+            return storm::utility::convertNumber<ParametricType>(getBound(env, region, dirForParameters)->template asExplicitQuantitativeCheckResult<ConstantType>()[*this->parametricModel->getInitialStates().begin()]);
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<ConstantType> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::computeChoiceValues(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) {
+            std::vector<ConstantType> choiceValues;
+            computeValues(env, liftedGames.empty() ? nullptr : liftedGames.front().get(), region, dirForParameters, &choiceValues);
+            return choiceValues;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<tempest::shields::AbstractShield<ConstantType, typename SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::IndexType>> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::computeShield(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression) {
+            std::shared_ptr<storm::logic::ShieldExpression const> expression = shieldingExpression ? shieldingExpression : this->shieldingExpression;
+            STORM_LOG_THROW(expression, storm::exceptions::InvalidArgumentException, "Computing a shield requires a shielding expression.");
+            // The shield has to be safe for all parameter valuations. Hence, nature works against the coalition.
+            storm::solver::OptimizationDirection coalitionDirection = currentCheckTask->getOptimizationDirection();
+            std::vector<ConstantType> choiceValues = computeChoiceValues(env, region, storm::solver::invert(coalitionDirection));
+            storm::storage::BitVector allStates(this->parametricModel->getNumberOfStates(), true);
+            return tempest::shields::createShield<ConstantType, IndexType>(this->parametricModel->getTransitionMatrix().getRowGroupIndices(), choiceValues, expression, coalitionDirection, allStates, statesOfCoalition);
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        RegionResult SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::analyzeRegion(Environment const& env, LiftedGame* liftedGame, storm::storage::ParameterRegion<ParametricType> const& region, RegionResultHypothesis const& hypothesis, RegionResult const& initialResult) {
+            if (initialResult == RegionResult::AllSat || initialResult == RegionResult::AllViolated) {
+                return initialResult;
+            }
+            uint64_t initialState = *this->parametricModel->getInitialStates().begin();
+            bool lowerBound = storm::logic::isLowerBound(currentCheckTask->getBoundComparisonType());
+            bool tryAllSat = hypothesis != RegionResultHypothesis::AllViolated && initialResult != RegionResult::ExistsViolated && initialResult != RegionResult::CenterViolated;
+            bool tryAllViolated = hypothesis != RegionResultHypothesis::AllSat && initialResult != RegionResult::ExistsSat && initialResult != RegionResult::CenterSat;
+
+            if (tryAllSat) {
+                // show AllSat:
+                storm::solver::OptimizationDirection parameterOptimizationDirection = lowerBound ? storm::solver::OptimizationDirection::Minimize : storm::solver::OptimizationDirection::Maximize;
+                if (check(env, liftedGame, region, parameterOptimizationDirection)->asExplicitQualitativeCheckResult()[initialState]) {
+                    return RegionResult::AllSat;
+                }
+            }
+            if (tryAllViolated) {
+                // show AllViolated:
+                storm::solver::OptimizationDirection parameterOptimizationDirection = lowerBound ? storm::solver::OptimizationDirection::Maximize : storm::solver::OptimizationDirection::Minimize;
+                if (!check(env, liftedGame, region, parameterOptimizationDirection)->asExplicitQualitativeCheckResult()[initialState]) {
+                    return RegionResult::AllViolated;
+                }
+            }
+            return initialResult;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        RegionResult SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::analyzeRegion(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResultHypothesis const& hypothesis, RegionResult const& initialResult, bool sampleVerticesOfRegion, std::shared_ptr<storm::analysis::Order> reachabilityOrder, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<ParametricType>::VariableType>> localMonotonicityResult) {
+            STORM_LOG_THROW(currentCheckTask->isBoundSet(), storm::exceptions::NotSupportedException, "Analyzing regions with parameter lifting requires a bounded property.");
+            STORM_LOG_THROW(this->parametricModel->getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException, "Analyzing regions with parameter lifting requires a model with a single initial state.");
+            STORM_LOG_WARN_COND(!reachabilityOrder && !localMonotonicityResult, "Monotonicity is not supported for stochastic games.");
+            RegionResult result = analyzeRegion(env, liftedGames.empty() ? nullptr : liftedGames.front().get(), region, hypothesis, initialResult);
+            if (sampleVerticesOfRegion) {
+                result = sampleVertices(env, region, result);
+            }
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        RegionResult SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::sampleVertices(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResult const& initialResult) {
+            RegionResult result = initialResult;
+
+            if (result == RegionResult::AllSat || result == RegionResult::AllViolated) {
+                return result;
+            }
+
+            bool hasSatPoint = result == RegionResult::ExistsSat || result == RegionResult::CenterSat;
+            bool hasViolatedPoint = result == RegionResult::ExistsViolated || result == RegionResult::CenterViolated;
+
+            // Check if there is a point in the region for which the property is satisfied
+            uint64_t initialState = *this->parametricModel->getInitialStates().begin();
+            auto vertices = region.getVerticesOfRegion(region.getVariables());
+            auto vertexIt = vertices.begin();
+            while (vertexIt != vertices.end() && !(hasSatPoint && hasViolatedPoint)) {
+                if (getInstantiationChecker().check(env, *vertexIt)->asExplicitQualitativeCheckResult()[initialState]) {
+                    hasSatPoint = true;
+                } else {
+                    hasViolatedPoint = true;
+                }
+                ++vertexIt;
+            }
+
+            if (hasSatPoint) {
+                if (hasViolatedPoint) {
+                    result = RegionResult::ExistsBoth;
+                } else if (result != RegionResult::CenterSat) {
+                    result = RegionResult::ExistsSat;
+                }
+            } else if (hasViolatedPoint && result != RegionResult::CenterViolated) {
+                result = RegionResult::ExistsViolated;
+            }
+
+            return result;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>& SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::getInstantiationChecker() {
+            if (!instantiationChecker) {
+                instantiationChecker = std::make_unique<SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>>(*this->parametricModel);
+                instantiationChecker->specifyFormula(CheckTask<storm::logic::Formula, ParametricType>(*currentFormula, true));
+                instantiationChecker->setInstantiationsAreGraphPreserving(true);
+            }
+            return *instantiationChecker;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<typename SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::ParametricType>> SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::performParallelRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold, RegionResultHypothesis const& hypothesis, uint64_t numberOfThreads) {
+            STORM_LOG_THROW(currentCheckTask->isBoundSet(), storm::exceptions::NotSupportedException, "Analyzing regions with parameter lifting requires a bounded property.");
+            STORM_LOG_THROW(this->parametricModel->getInitialStates().getNumberOfSetBits() == 1, storm::exceptions::NotSupportedException, "Analyzing regions with parameter lifting requires a model with a single initial state.");
+            STORM_LOG_INFO("Applying parallel refinement on region: " << region.toString(true) << " .");
+
+            auto thresholdAsCoefficient = coverageThreshold ? storm::utility::convertNumber<CoefficientType>(coverageThreshold.get()) : storm::utility::zero<CoefficientType>();
+            auto areaOfParameterSpace = region.area();
+            auto fractionOfUndiscoveredArea = storm::utility::one<CoefficientType>();
+            if (numberOfThreads == 0) {
+                numberOfThreads = std::max<uint64_t>(1, std::thread::hardware_concurrency());
+            }
+
+            std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> result;
+            std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> currentRegions;
+            currentRegions.emplace_back(region, RegionResult::Unknown);
+            uint64_t currentDepth = 0;
+            while (fractionOfUndiscoveredArea > thresholdAsCoefficient && !currentRegions.empty()) {
+                STORM_LOG_INFO("Analyzing " << currentRegions.size() << " regions (Refinement depth " << currentDepth << "; " << storm::utility::convertNumber<double>(fractionOfUndiscoveredArea) * 100 << "% still unknown)");
+                // Each worker solves its own lifted game. The games are created beforehand as this is not thread-safe.
+                uint64_t numberOfWorkers = std::min<uint64_t>(numberOfThreads, currentRegions.size());
+                if (!maybeStates.empty()) {
+                    for (uint64_t worker = 0; worker < numberOfWorkers; ++worker) {
+                        getLiftedGame(worker);
+                    }
+                }
+                std::atomic<uint64_t> nextRegion(0);
+                // Exceptions can not leave the threads, so they are rethrown once all regions are analyzed.
+                std::vector<std::exception_ptr> exceptions(numberOfWorkers);
+                storm::utility::parallel::forEachBlock(numberOfWorkers, numberOfWorkers, 1, [&] (uint64_t worker, uint64_t) {
+                    LiftedGame* liftedGame = maybeStates.empty() ? nullptr : liftedGames[worker].get();
+                    try {
+                        for (uint64_t index = nextRegion++; index < currentRegions.size(); index = nextRegion++) {
+                            currentRegions[index].second = analyzeRegion(env, liftedGame, currentRegions[index].first, hypothesis, currentRegions[index].second);
+                        }
+                    } catch (...) {
+                        exceptions[worker] = std::current_exception();
+                    }
+                });
+                for (auto const& exception : exceptions) {
+                    if (exception) {
+                        std::rethrow_exception(exception);
+                    }
+                }
+
+                std::vector<std::pair<storm::storage::ParameterRegion<ParametricType>, RegionResult>> nextRegions;
+                for (auto& regionResult : currentRegions) {
+                    if (regionResult.second == RegionResult::AllSat || regionResult.second == RegionResult::AllViolated) {
+                        fractionOfUndiscoveredArea -= regionResult.first.area() / areaOfParameterSpace;
+                        result.push_back(std::move(regionResult));
+                    } else if (!depthThreshold || currentDepth < depthThreshold.get()) {
+                        // Split the region as long as the desired refinement depth is not reached.
+                        std::vector<storm::storage::ParameterRegion<ParametricType>> newRegions;
+                        regionResult.first.split(regionResult.first.getCenterPoint(), newRegions);
+                        for (auto& newRegion : newRegions) {
+                            nextRegions.emplace_back(std::move(newRegion), regionResult.second);
+                        }
+                    } else {
+                        // If the region is not further refined, it is still added to the result
+                        result.push_back(std::move(regionResult));
+                    }
+                }
+                currentRegions = std::move(nextRegions);
+                ++currentDepth;
+            }
+
+            // Add the still unprocessed regions to the result
+            for (auto& regionResult : currentRegions) {
+                result.push_back(std::move(regionResult));
+            }
+
+            auto regionCopyForResult = region;
+            return std::make_unique<storm::modelchecker::RegionRefinementCheckResult<ParametricType>>(std::move(result), std::move(regionCopyForResult));
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        SparseModelType const& SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::getConsideredParametricModel() const {
+            return *parametricModel;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        CheckTask<storm::logic::Formula, ConstantType> const& SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::getCurrentCheckTask() const {
+            return *currentCheckTask;
+        }
+
+        template <typename SparseModelType, typename ConstantType>
+        storm::storage::BitVector const& SparseSmgParameterLiftingModelChecker<SparseModelType, ConstantType>::getStatesOfCoalition() const {
+            return statesOfCoalition;
+        }
+
+        template class SparseSmgParameterLiftingModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, double>;
+        template class SparseSmgParameterLiftingModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <boost/optional.hpp>
+
+#include "storm-pars/modelchecker/instantiation/SparseSmgInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/region/RegionModelChecker.h"
+#include "storm-pars/transformer/ParameterLifter.h"
+
+#include "storm/logic/ShieldExpression.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/modelchecker/results/QuantitativeCheckResult.h"
+#include "storm/shields/AbstractShield.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/StateType.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        /*!
+         * Applies parameter lifting to stochastic multiplayer games. The parameter choices are lifted to a third player, nature,
+         * that resolves the parameters of every choice within the region. Depending on the optimization direction for the
+         * parameters, nature works against or with the coalition of the game formula. The resulting game is solved at once: Every
+         * choice of the parametric game leads to a state of nature, whose choices are the vertices of the region.
+         *
+         * Supported are game formulas of the form <<coalition>> P [phi U psi], P [F psi] and P [G psi].
+         * As for the other parameter lifting model checkers, all valuations in the considered regions have to be graph-preserving.
+         */
+        template <typename SparseModelType, typename ConstantType>
+        class SparseSmgParameterLiftingModelChecker : public RegionModelChecker<typename SparseModelType::ValueType> {
+        public:
+            typedef typename SparseModelType::ValueType ParametricType;
+            typedef typename RegionModelChecker<ParametricType>::CoefficientType CoefficientType;
+            typedef storm::storage::sparse::state_type IndexType;
+
+            SparseSmgParameterLiftingModelChecker();
+            virtual ~SparseSmgParameterLiftingModelChecker() = default;
+
+            virtual bool canHandle(std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask) const override;
+            virtual void specify(Environment const& env, std::shared_ptr<storm::models::ModelBase> parametricModel, CheckTask<storm::logic::Formula, ParametricType> const& checkTask, bool generateRegionSplitEstimates = false, bool allowModelSimplification = true) override;
+
+            /*!
+             * Analyzes the given region by means of parameter lifting. AllSat is shown by letting nature work against the bound of
+             * the property and AllViolated by letting nature work towards it. If this fails, the vertices of the region can be
+             * sampled to show ExistsSat, ExistsViolated or ExistsBoth.
+             */
+            virtual RegionResult analyzeRegion(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, RegionResult const& initialResult = RegionResult::Unknown, bool sampleVerticesOfRegion = false, std::shared_ptr<storm::analysis::Order> reachabilityOrder = nullptr, std::shared_ptr<storm::analysis::LocalMonotonicityResult<typename RegionModelChecker<ParametricType>::VariableType>> localMonotonicityResult = nullptr) override;
+
+            /*!
+             * Checks the specified formula on the given region by applying parameter lifting.
+             *
+             * @param dirForParameters The optimization direction of nature. If this is, e.g., minimize, then the returned values
+             * are lower bounds for all values induced by the parameter valuations inside the region.
+             */
+            std::unique_ptr<CheckResult> check(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+
+            std::unique_ptr<QuantitativeCheckResult<ConstantType>> getBound(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+            virtual ParametricType getBoundAtInitState(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters) override;
+
+            /*!
+             * Computes the value of every choice of the game, where nature resolves the parameters in the given direction.
+             */
+            std::vector<ConstantType> computeChoiceValues(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+
+            /*!
+             * Computes a shield for the coalition that is valid for all parameter valuations in the region, i.e., nature works
+             * against the coalition when computing the choice values.
+             *
+             * @param shieldingExpression The shield to compute. If not given, the shielding expression of the check task is used.
+             */
+            std::unique_ptr<tempest::shields::AbstractShield<ConstantType, IndexType>> computeShield(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression = nullptr);
+
+            /*!
+             * Iteratively refines the region as performRegionRefinement does. However, all regions of the same refinement depth are
+             * analyzed concurrently, where every thread solves its own copy of the lifted game.
+             *
+             * @param numberOfThreads The number of threads. If zero, the number of hardware threads is used.
+             */
+            std::unique_ptr<storm::modelchecker::RegionRefinementCheckResult<ParametricType>> performParallelRegionRefinement(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, boost::optional<ParametricType> const& coverageThreshold, boost::optional<uint64_t> depthThreshold = boost::none, RegionResultHypothesis const& hypothesis = RegionResultHypothesis::Unknown, uint64_t numberOfThreads = 0);
+
+            SparseModelType const& getConsideredParametricModel() const;
+            CheckTask<storm::logic::Formula, ConstantType> const& getCurrentCheckTask() const;
+            storm::storage::BitVector const& getStatesOfCoalition() const;
+
+        private:
+            /*!
+             * The game in which nature resolves the parameters. Its first states are the maybe states of the parametric game,
+             * followed by one state of nature for each of their choices.
+             */
+            class LiftedGame {
+            public:
+                LiftedGame(storm::storage::SparseMatrix<ParametricType> const& parametricMatrix, std::vector<ParametricType> const& parametricVector, storm::storage::BitVector const& maybeStates, storm::storage::BitVector const& statesOfCoalition);
+
+                /*!
+                 * Evaluates the lifted transition probabilities w.r.t. the region. This evaluates the parametric functions.
+                 */
+                void specifyRegion(storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+
+                /*!
+                 * Solves the game for the most recently specified region.
+                 * @return the values of all states of the lifted game.
+                 */
+                std::vector<ConstantType> solve(Environment const& env, storm::solver::OptimizationDirection const& coalitionDirection, storm::solver::OptimizationDirection const& dirForParameters) const;
+
+            private:
+                storm::transformer::ParameterLifter<ParametricType, ConstantType> parameterLifter;
+                storm::storage::SparseMatrix<ConstantType> matrix;
+                std::vector<ConstantType> vector;
+                // The maybe states that do not belong to the coalition.
+                storm::storage::BitVector statesOfOpponents;
+                uint64_t numberOfMaybeStates;
+            };
+
+            void reset();
+
+            LiftedGame& getLiftedGame(uint64_t index);
+            SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>& getInstantiationChecker();
+
+            RegionResult sampleVertices(Environment const& env, storm::storage::ParameterRegion<ParametricType> const& region, RegionResult const& initialResult);
+
+            RegionResult analyzeRegion(Environment const& env, LiftedGame* liftedGame, storm::storage::ParameterRegion<ParametricType> const& region, RegionResultHypothesis const& hypothesis, RegionResult const& initialResult);
+            std::unique_ptr<CheckResult> check(Environment const& env, LiftedGame* liftedGame, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters);
+
+            /*!
+             * Computes the values of all states and, if requested, of all choices of the parametric game.
+             */
+            std::vector<ConstantType> computeValues(Environment const& env, LiftedGame* liftedGame, storm::storage::ParameterRegion<ParametricType> const& region, storm::solver::OptimizationDirection const& dirForParameters, std::vector<ConstantType>* choiceValues = nullptr);
+
+            std::shared_ptr<SparseModelType> parametricModel;
+            std::shared_ptr<storm::logic::Formula const> currentFormula;
+            std::unique_ptr<CheckTask<storm::logic::Formula, ConstantType>> currentCheckTask;
+            std::shared_ptr<storm::logic::ShieldExpression const> shieldingExpression;
+            storm::storage::BitVector statesOfCoalition;
+
+            storm::storage::BitVector maybeStates;
+            storm::storage::BitVector targetStates;
+            std::vector<ParametricType> parametricVector;
+            // Globally formulas are checked via the complementary reachability probabilities.
+            bool complementResult;
+
+            // Checks the game at single points of the parameter space, e.g., at the vertices of a region.
+            std::unique_ptr<SparseSmgInstantiationModelChecker<SparseModelType, ConstantType>> instantiationChecker;
+            // One lifted game for each thread. The games are created on demand.
+            std::vector<std::unique_ptr<LiftedGame>> liftedGames;
+            // The evaluation of the parametric functions is not thread-safe.
+            std::mutex functionEvaluationMutex;
+        };
+    }
+}
@@ -10,6 +10,7 @@
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StochasticTwoPlayerGame.h"
 #include "storm/utility/constants.h"
 
@@ -118,6 +119,21 @@ namespace storm {
                     this->instantiatedModel = std::make_shared<ConstantSparseModelType>(std::move(components));
                 }
 
+                template<typename PMT = ParametricSparseModelType>
+                typename std::enable_if<
+                            std::is_same<PMT,storm::models::sparse::Smg<typename ParametricSparseModelType::ValueType>>::value
+                >::type
+                initializeModelSpecificData(PMT const& parametricModel) {
+                    storm::storage::sparse::ModelComponents<ConstantType, typename ConstantSparseModelType::RewardModelType> components(buildDummyMatrix(parametricModel.getTransitionMatrix()));
+                    components.stateLabeling = parametricModel.getStateLabeling();
+                    components.rewardModels = buildDummyRewardModels(parametricModel.getRewardModels());
+                    components.choiceLabeling = parametricModel.getOptionalChoiceLabeling();
+                    components.statePlayerIndications = parametricModel.getStatePlayerIndications();
+                    components.playerNameToIndexMap = parametricModel.getPlayerNameToIndexMap();
+
+                    this->instantiatedModel = std::make_shared<ConstantSparseModelType>(std::move(components));
+                }
+
                 template<typename PMT = ParametricSparseModelType>
                 typename std::enable_if<
                         std::is_same<PMT,ConstantSparseModelType>::value
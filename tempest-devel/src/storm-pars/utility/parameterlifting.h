@@ -36,7 +36,7 @@ namespace storm {
                 // Check whether all numbers occurring in the model are multilinear
                 
                 // Transition matrix
-                if (model.isOfType(storm::models::ModelType::Dtmc) || model.isOfType(storm::models::ModelType::Mdp) || model.isOfType(storm::models::ModelType::Ctmc)) {
+                if (model.isOfType(storm::models::ModelType::Dtmc) || model.isOfType(storm::models::ModelType::Mdp) || model.isOfType(storm::models::ModelType::Ctmc) || model.isOfType(storm::models::ModelType::Smg)) {
                     for (auto const& entry : model.getTransitionMatrix()) {
                         if (!storm::utility::parametric::isMultiLinearPolynomial(entry.getValue())) {
                             STORM_LOG_WARN("The input model contains a non-linear polynomial as transition: '" << entry.getValue() << "'. Can not validate that parameter lifting is sound on this model.");
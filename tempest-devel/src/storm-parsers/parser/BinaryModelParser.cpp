@@ -0,0 +1,231 @@
+#include "storm-parsers/parser/BinaryModelParser.h"
+
+#include <cstring>
+
+#include "storm-parsers/parser/MappedFile.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace storm {
+    namespace parser {
+
+        namespace {
+            namespace binary = storm::exporter::binary;
+
+            class BinaryReader {
+            public:
+                BinaryReader(char const* begin, char const* end, std::string const& filename) : current(begin), end(end), filename(filename) {
+                    // Intentionally left empty.
+                }
+
+                char const* advance(uint64_t size) {
+                    STORM_LOG_THROW(static_cast<uint64_t>(end - current) >= size, storm::exceptions::WrongFormatException, "Unexpected end of binary model file " << filename << ".");
+                    char const* result = current;
+                    current += size;
+                    return result;
+                }
+
+                uint64_t readWord() {
+                    uint64_t result;
+                    std::memcpy(&result, advance(sizeof(uint64_t)), sizeof(uint64_t));
+                    return result;
+                }
+
+                std::string readString() {
+                    uint64_t const size = readWord();
+                    std::string result(advance(size), size);
+                    advance((8 - size % 8) % 8);
+                    return result;
+                }
+
+                template<typename T>
+                std::vector<T> readArray(uint64_t expectedSize) {
+                    std::vector<T> result = readArray<T>();
+                    STORM_LOG_THROW(result.size() == expectedSize, storm::exceptions::WrongFormatException, "Unexpected array size in binary model file " << filename << ".");
+                    return result;
+                }
+
+                template<typename T>
+                std::vector<T> readArray() {
+                    static_assert(sizeof(T) == sizeof(uint64_t), "Only arrays of 64-bit values can be read.");
+                    uint64_t const size = readWord();
+                    STORM_LOG_THROW(size <= static_cast<uint64_t>(end - current) / sizeof(T), storm::exceptions::WrongFormatException, "Unexpected end of binary model file " << filename << ".");
+                    std::vector<T> result(size);
+                    std::memcpy(result.data(), advance(size * sizeof(T)), size * sizeof(T));
+                    return result;
+                }
+
+                storm::storage::BitVector readBitVector(uint64_t expectedSize) {
+                    uint64_t const size = readWord();
+                    STORM_LOG_THROW(size == expectedSize, storm::exceptions::WrongFormatException, "Unexpected bit vector size in binary model file " << filename << ".");
+                    storm::storage::BitVector result(size, false);
+                    for (uint64_t bitIndex = 0; bitIndex < size; bitIndex += 64) {
+                        result.setFromInt(bitIndex, std::min<uint64_t>(64, size - bitIndex), readWord());
+                    }
+                    return result;
+                }
+
+            private:
+                char const* current;
+                char const* end;
+                std::string const& filename;
+            };
+
+            storm::storage::sparse::StateValuations readStateValuations(BinaryReader& reader, uint64_t numberOfStates, storm::expressions::ExpressionManager& manager) {
+                storm::storage::sparse::StateValuationsBuilder builder;
+                uint64_t const numberOfVariables = reader.readWord();
+                std::vector<uint64_t> variableTypes;
+                variableTypes.reserve(numberOfVariables);
+                for (uint64_t variable = 0; variable < numberOfVariables; ++variable) {
+                    std::string name = reader.readString();
+                    uint64_t const type = reader.readWord();
+                    if (type == binary::BOOLEAN_VARIABLE) {
+                        builder.addVariable(manager.declareOrGetVariable(name, manager.getBooleanType()));
+                    } else if (type == binary::INTEGER_VARIABLE) {
+                        builder.addVariable(manager.declareOrGetVariable(name, manager.getIntegerType()));
+                    } else {
+                        STORM_LOG_THROW(type == binary::RATIONAL_VARIABLE, storm::exceptions::WrongFormatException, "Unknown type of variable " << name << ".");
+                        builder.addVariable(manager.declareOrGetVariable(name, manager.getRationalType()));
+                    }
+                    variableTypes.push_back(type);
+                }
+                uint64_t const numberOfLabels = reader.readWord();
+                for (uint64_t label = 0; label < numberOfLabels; ++label) {
+                    builder.addObservationLabel(reader.readString());
+                }
+
+                uint64_t const numberOfBooleanVariables = builder.getBooleanVarCount();
+                uint64_t const numberOfIntegerVariables = builder.getIntegerVarCount();
+                uint64_t const numberOfRationalVariables = numberOfVariables - numberOfBooleanVariables - numberOfIntegerVariables;
+                storm::storage::BitVector booleanValues = reader.readBitVector(numberOfStates * numberOfBooleanVariables);
+                std::vector<int64_t> integerValues = reader.readArray<int64_t>(numberOfStates * numberOfIntegerVariables);
+                std::vector<int64_t> labelValues = reader.readArray<int64_t>(numberOfStates * numberOfLabels);
+                uint64_t const numberOfRationalValues = reader.readWord();
+                STORM_LOG_THROW(numberOfRationalValues == numberOfStates * numberOfRationalVariables, storm::exceptions::WrongFormatException, "Unexpected number of rational values.");
+
+                auto integerIt = integerValues.begin();
+                auto labelIt = labelValues.begin();
+                uint64_t booleanIndex = 0;
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    std::vector<bool> stateBooleanValues;
+                    stateBooleanValues.reserve(numberOfBooleanVariables);
+                    for (uint64_t variable = 0; variable < numberOfBooleanVariables; ++variable) {
+                        stateBooleanValues.push_back(booleanValues.get(booleanIndex++));
+                    }
+                    std::vector<int64_t> stateIntegerValues(integerIt, integerIt + numberOfIntegerVariables);
+                    integerIt += numberOfIntegerVariables;
+                    std::vector<storm::RationalNumber> stateRationalValues;
+                    stateRationalValues.reserve(numberOfRationalVariables);
+                    for (uint64_t variable = 0; variable < numberOfRationalVariables; ++variable) {
+                        stateRationalValues.push_back(storm::utility::convertNumber<storm::RationalNumber>(reader.readString()));
+                    }
+                    std::vector<int64_t> stateLabelValues(labelIt, labelIt + numberOfLabels);
+                    labelIt += numberOfLabels;
+                    builder.addState(state, std::move(stateBooleanValues), std::move(stateIntegerValues), std::move(stateRationalValues), std::move(stateLabelValues));
+                }
+                return builder.build(numberOfStates);
+            }
+        }
+
+        std::shared_ptr<storm::models::sparse::Smg<double>> BinaryModelParser::parseSmg(std::string const& filename) {
+            return parseFile(filename, nullptr);
+        }
+
+        std::shared_ptr<storm::models::sparse::Smg<double>> BinaryModelParser::parseSmg(std::string const& filename, storm::expressions::ExpressionManager& manager) {
+            return parseFile(filename, &manager);
+        }
+
+        std::shared_ptr<storm::models::sparse::Smg<double>> BinaryModelParser::parseFile(std::string const& filename, storm::expressions::ExpressionManager* manager) {
+            MappedFile file(filename.c_str());
+            BinaryReader reader(file.getData(), file.getDataEnd(), filename);
+
+            STORM_LOG_THROW(std::memcmp(reader.advance(sizeof(binary::MAGIC)), binary::MAGIC, sizeof(binary::MAGIC)) == 0, storm::exceptions::WrongFormatException, "File " << filename << " is not in binary model format.");
+            uint64_t const version = reader.readWord();
+            STORM_LOG_THROW(version == binary::VERSION, storm::exceptions::WrongFormatException, "File " << filename << " has version " << version << " of the binary model format, but version " << binary::VERSION << " is expected.");
+            uint64_t const numberOfStates = reader.readWord();
+            uint64_t const numberOfChoices = reader.readWord();
+            uint64_t const numberOfEntries = reader.readWord();
+            uint64_t const numberOfColumns = reader.readWord();
+
+            // Transition matrix.
+            std::vector<uint_fast64_t> rowGroupIndices = reader.readArray<uint_fast64_t>(numberOfStates + 1);
+            std::vector<uint_fast64_t> rowStarts = reader.readArray<uint_fast64_t>(numberOfChoices + 1);
+            STORM_LOG_THROW(rowGroupIndices.back() == numberOfChoices && rowStarts.back() == numberOfEntries, storm::exceptions::WrongFormatException, "Inconsistent matrix dimensions in " << filename << ".");
+            std::vector<storm::storage::MatrixEntry<uint_fast64_t, double>> entries;
+            {
+                std::vector<uint64_t> columns = reader.readArray<uint64_t>(numberOfEntries);
+                std::vector<double> values = reader.readArray<double>(numberOfEntries);
+                entries.reserve(numberOfEntries);
+                for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                    entries.emplace_back(columns[entry], values[entry]);
+                }
+            }
+            storm::storage::SparseMatrix<double> transitionMatrix(numberOfColumns, std::move(rowStarts), std::move(entries), std::move(rowGroupIndices));
+
+            // Players.
+            std::vector<storm::storage::PlayerIndex> statePlayerIndications = reader.readArray<storm::storage::PlayerIndex>(numberOfStates);
+            std::map<std::string, storm::storage::PlayerIndex> playerNameToIndexMap;
+            uint64_t const numberOfPlayers = reader.readWord();
+            for (uint64_t player = 0; player < numberOfPlayers; ++player) {
+                std::string name = reader.readString();
+                playerNameToIndexMap[name] = reader.readWord();
+            }
+
+            // Labelings.
+            storm::models::sparse::StateLabeling stateLabeling(numberOfStates);
+            uint64_t const numberOfStateLabels = reader.readWord();
+            for (uint64_t label = 0; label < numberOfStateLabels; ++label) {
+                std::string name = reader.readString();
+                stateLabeling.addLabel(name, reader.readBitVector(numberOfStates));
+            }
+            boost::optional<storm::models::sparse::ChoiceLabeling> choiceLabeling;
+            if (reader.readWord() != 0) {
+                choiceLabeling = storm::models::sparse::ChoiceLabeling(numberOfChoices);
+                uint64_t const numberOfChoiceLabels = reader.readWord();
+                for (uint64_t label = 0; label < numberOfChoiceLabels; ++label) {
+                    std::string name = reader.readString();
+                    choiceLabeling->addLabel(name, reader.readBitVector(numberOfChoices));
+                }
+            }
+
+            // Rewards.
+            std::unordered_map<std::string, storm::models::sparse::StandardRewardModel<double>> rewardModels;
+            uint64_t const numberOfRewardModels = reader.readWord();
+            for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+                std::string name = reader.readString();
+                uint64_t const flags = reader.readWord();
+                boost::optional<std::vector<double>> stateRewards;
+                boost::optional<std::vector<double>> stateActionRewards;
+                if (flags & binary::STATE_REWARDS) {
+                    stateRewards = reader.readArray<double>(numberOfStates);
+                }
+                if (flags & binary::STATE_ACTION_REWARDS) {
+                    stateActionRewards = reader.readArray<double>(numberOfChoices);
+                }
+                rewardModels.emplace(name, storm::models::sparse::StandardRewardModel<double>(std::move(stateRewards), std::move(stateActionRewards)));
+            }
+
+            storm::storage::sparse::ModelComponents<double> components(std::move(transitionMatrix), std::move(stateLabeling), std::move(rewardModels));
+            components.choiceLabeling = std::move(choiceLabeling);
+            components.statePlayerIndications = std::move(statePlayerIndications);
+            components.playerNameToIndexMap = std::move(playerNameToIndexMap);
+
+            if (reader.readWord() != 0) {
+                if (manager) {
+                    components.stateValuations = readStateValuations(reader, numberOfStates, *manager);
+                } else {
+                    STORM_LOG_INFO("Skipping the state valuations in " << filename << " as no expression manager is given.");
+                }
+            }
+
+            return std::make_shared<storm::models::sparse::Smg<double>>(std::move(components));
+        }
+
+    } // namespace parser
+} // namespace storm
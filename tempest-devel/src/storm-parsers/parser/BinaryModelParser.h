@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "storm/models/sparse/Smg.h"
+
+namespace storm {
+    namespace expressions {
+        class ExpressionManager;
+    }
+
+    namespace parser {
+
+        /*!
+         * Parser for games in the binary model format written by storm::exporter::exportSmgAsBinary.
+         *
+         * The file is mapped into memory and the arrays of the file are copied into the components of the game in one
+         * pass each, without any textual parsing.
+         */
+        class BinaryModelParser {
+        public:
+            /*!
+             * Loads a game from a file in binary model format. The state valuations are skipped, as their variables
+             * require an expression manager.
+             *
+             * @param filename The file to load.
+             * @return The game.
+             */
+            static std::shared_ptr<storm::models::sparse::Smg<double>> parseSmg(std::string const& filename);
+
+            /*!
+             * Loads a game from a file in binary model format. The variables of the state valuations are looked up in
+             * (or, if missing, declared in) the given expression manager, which therefore has to outlive the game.
+             *
+             * @param filename The file to load.
+             * @param manager The manager for the variables of the state valuations.
+             * @return The game.
+             */
+            static std::shared_ptr<storm::models::sparse::Smg<double>> parseSmg(std::string const& filename, storm::expressions::ExpressionManager& manager);
+
+        private:
+            static std::shared_ptr<storm::models::sparse::Smg<double>> parseFile(std::string const& filename, storm::expressions::ExpressionManager* manager);
+        };
+
+    } // namespace parser
+} // namespace storm
@@ -1,8 +1,11 @@
 #include "storm-parsers/parser/DirectEncodingParser.h"
 
+#include <algorithm>
+#include <exception>
 #include <iostream>
 #include <string>
 #include <regex>
+#include <thread>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 
@@ -14,6 +17,7 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm-parsers/parser/MappedFile.h"
 
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Ctmc.h"
@@ -49,7 +53,8 @@ namespace storm {
             size_t nrChoices = 0;
             storm::models::ModelType type;
             std::vector<std::string> rewardModelNames;
-            std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> modelComponents;
+            std::vector<std::string> playerNames;
+            std::streamoff modelStart = -1;
 
             // Parse header
             while (storm::utility::getline(file, line)) {
@@ -102,6 +107,11 @@ namespace storm {
                     STORM_LOG_THROW(rewardModelNames.empty(), storm::exceptions::WrongFormatException, "Reward model names declared twice");
                     storm::utility::getline(file, line);
                     boost::split(rewardModelNames, line, boost::is_any_of("\t "));
+                } else if (line == "@players") {
+                    // Parse player names, the index of a player is its position
+                    STORM_LOG_THROW(playerNames.empty(), storm::exceptions::WrongFormatException, "Players declared twice");
+                    storm::utility::getline(file, line);
+                    boost::split(playerNames, line, boost::is_any_of("\t "), boost::token_compress_on);
                 } else if (line == "@nr_states") {
                     // Parse no. of states
                     STORM_LOG_THROW(nrStates == 0, storm::exceptions::WrongFormatException, "Number states declared twice");
@@ -116,40 +126,117 @@ namespace storm {
                     STORM_LOG_THROW(sawType, storm::exceptions::WrongFormatException, "Type has to be declared before model.");
                     STORM_LOG_THROW(sawParameters, storm::exceptions::WrongFormatException, "Parameters have to be declared before model.");
                     STORM_LOG_THROW(nrStates != 0, storm::exceptions::WrongFormatException, "No. of states has to be declared before model.");
-                    STORM_LOG_THROW(!options.buildChoiceLabeling || nrChoices != 0, storm::exceptions::WrongFormatException, "No. of actions (@nr_choices) has to be declared before model.");
                     STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
-                    // Construct model components
-                    modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+                    // The states are parsed from the mapped file below
+                    modelStart = file.tellg();
                     break;
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
                 }
             }
-            // Done parsing
+            // Done parsing the header
             storm::utility::closeFile(file);
+            STORM_LOG_THROW(modelStart >= 0, storm::exceptions::WrongFormatException, "No model found in file " << filename << ".");
+
+            // Construct model components
+            MappedFile mappedFile(filename.c_str());
+            STORM_LOG_THROW(static_cast<std::size_t>(modelStart) <= mappedFile.getDataSize(), storm::exceptions::WrongFormatException, "Unexpected end of file " << filename << ".");
+            auto modelComponents = parseStates(mappedFile.getData() + modelStart, mappedFile.getDataEnd(), type, nrStates, placeholders, valueParser, rewardModelNames, playerNames, options);
+            STORM_LOG_WARN_COND(nrChoices == 0 || nrChoices == modelComponents->transitionMatrix.getRowCount(), "Declared " << nrChoices << " actions, but found " << modelComponents->transitionMatrix.getRowCount() << ".");
 
             // Build model
             return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
         }
 
+        template<typename ValueType, typename RewardModelType>
+        struct DirectEncodingParser<ValueType, RewardModelType>::StateBlock {
+            // The id of the first state in this block.
+            size_t firstState = 0;
+            // For each state, the number of its actions.
+            std::vector<size_t> rowGroupSizes;
+            // For each action, the number of its transitions.
+            std::vector<size_t> rowSizes;
+            // The transitions of all actions.
+            std::vector<std::pair<size_t, ValueType>> transitions;
+            // State and choice labels. The indices are relative to the block.
+            std::vector<std::pair<size_t, std::string>> stateLabels;
+            std::vector<std::pair<size_t, std::string>> choiceLabels;
+            // For each reward model, the non-zero rewards. The indices are relative to the block.
+            std::vector<std::vector<std::pair<size_t, ValueType>>> stateRewards;
+            std::vector<std::vector<std::pair<size_t, ValueType>>> actionRewards;
+            // Per state information that is only present for some model types.
+            std::vector<ValueType> exitRates;
+            std::vector<uint32_t> observations;
+            std::vector<storm::storage::PlayerIndex> players;
+            // An exception that occurred while parsing this block.
+            std::exception_ptr exception;
+        };
+
         template<typename ValueType, typename RewardModelType>
         std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
-        DirectEncodingParser<ValueType, RewardModelType>::parseStates(std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        DirectEncodingParser<ValueType, RewardModelType>::parseStates(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize,
                                                                       std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
-                                                                      std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+                                                                      std::vector<std::string> const& rewardModelNames, std::vector<std::string> const& playerNames, DirectEncodingParserOptions const& options) {
+            // Only values that are parsed without shared state can be parsed in parallel.
+            // Unless the number of threads is given explicitly, small files are parsed sequentially.
+            uint64_t const minimalBlockSize = 1 << 20;
+            uint64_t numberOfBlocks = 1;
+            if (std::is_same<ValueType, double>::value) {
+                if (options.numberOfThreads > 0) {
+                    numberOfBlocks = options.numberOfThreads;
+                } else {
+                    numberOfBlocks = std::max<uint64_t>(1, std::min<uint64_t>(std::thread::hardware_concurrency(), (end - begin) / minimalBlockSize));
+                }
+            }
+
+            // Split the input into blocks. Each block (except for the first one) starts with a state description.
+            std::vector<char const*> blockStarts = {begin};
+            std::string const stateStart = "\nstate ";
+            for (uint64_t blockIndex = 1; blockIndex < numberOfBlocks; ++blockIndex) {
+                char const* position = std::max(begin + blockIndex * (end - begin) / numberOfBlocks, blockStarts.back());
+                char const* nextState = std::search(position, end, stateStart.begin(), stateStart.end());
+                if (nextState == end) {
+                    break;
+                }
+                blockStarts.push_back(nextState + 1);
+            }
+            blockStarts.push_back(end);
+            numberOfBlocks = blockStarts.size() - 1;
+            STORM_LOG_INFO("Parsing states in " << numberOfBlocks << " block(s).");
+
+            std::vector<StateBlock> blocks(numberOfBlocks);
+            if (numberOfBlocks == 1) {
+                parseStateBlock(blockStarts[0], blockStarts[1], type, placeholders, valueParser, options, blocks[0]);
+            } else {
+                std::vector<std::thread> threads;
+                for (uint64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+                    threads.emplace_back([&, blockIndex]() {
+                        try {
+                            parseStateBlock(blockStarts[blockIndex], blockStarts[blockIndex + 1], type, placeholders, valueParser, options, blocks[blockIndex]);
+                        } catch (...) {
+                            blocks[blockIndex].exception = std::current_exception();
+                        }
+                    });
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+                for (auto const& block : blocks) {
+                    if (block.exception) {
+                        std::rethrow_exception(block.exception);
+                    }
+                }
+            }
+            STORM_LOG_TRACE("Finished parsing");
+
             // Initialize
             auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
-            bool nonDeterministic = (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
+            bool nonDeterministic = (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp || type == storm::models::ModelType::Smg);
             bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
             storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
             modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
             modelComponents->observabilityClasses = std::vector<uint32_t>();
             modelComponents->observabilityClasses->resize(stateSize);
-            if (options.buildChoiceLabeling) {
-                modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
-            }
-            std::vector<std::vector<ValueType>> stateRewards;
-            std::vector<std::vector<ValueType>> actionRewards;
             if (continuousTime) {
                 modelComponents->exitRates = std::vector<ValueType>(stateSize);
                 if (type == storm::models::ModelType::MarkovAutomaton) {
@@ -160,6 +247,130 @@ namespace storm {
             if (type == storm::models::ModelType::Ctmc) {
                 modelComponents->rateTransitions = true;
             }
+            if (type == storm::models::ModelType::Smg) {
+                modelComponents->statePlayerIndications = std::vector<storm::storage::PlayerIndex>(stateSize, storm::storage::INVALID_PLAYER_INDEX);
+                modelComponents->playerNameToIndexMap = std::map<std::string, storm::storage::PlayerIndex>();
+                for (storm::storage::PlayerIndex player = 0; player < playerNames.size(); ++player) {
+                    modelComponents->playerNameToIndexMap.get()[playerNames[player]] = player;
+                }
+            }
+
+            // Merge the blocks
+            size_t state = 0;
+            size_t row = 0;
+            size_t numberOfStateRewardModels = 0;
+            size_t numberOfActionRewardModels = 0;
+            for (auto const& block : blocks) {
+                STORM_LOG_THROW(block.firstState == state, storm::exceptions::WrongFormatException, "Expected state " << state << " but found state " << block.firstState << ".");
+                STORM_LOG_THROW(state + block.rowGroupSizes.size() <= stateSize, storm::exceptions::WrongFormatException, "Found more than " << stateSize << " states.");
+                auto transitionIt = block.transitions.begin();
+                auto rowSizeIt = block.rowSizes.begin();
+                for (uint64_t localState = 0; localState < block.rowGroupSizes.size(); ++localState) {
+                    if (nonDeterministic) {
+                        builder.newRowGroup(row);
+                    }
+                    if (continuousTime) {
+                        modelComponents->exitRates.get()[state + localState] = block.exitRates[localState];
+                        if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(block.exitRates[localState])) {
+                            modelComponents->markovianStates.get().set(state + localState);
+                        }
+                    }
+                    if (type == storm::models::ModelType::Pomdp) {
+                        modelComponents->observabilityClasses.get()[state + localState] = block.observations[localState];
+                    }
+                    if (type == storm::models::ModelType::Smg) {
+                        modelComponents->statePlayerIndications.get()[state + localState] = block.players[localState];
+                    }
+                    for (uint64_t localRow = 0; localRow < block.rowGroupSizes[localState]; ++localRow, ++row, ++rowSizeIt) {
+                        for (auto rowEnd = transitionIt + *rowSizeIt; transitionIt != rowEnd; ++transitionIt) {
+                            STORM_LOG_THROW(transitionIt->first < stateSize, storm::exceptions::WrongFormatException, "Target state " << transitionIt->first << " is greater than state size " << stateSize);
+                            builder.addNextValue(row, transitionIt->first, transitionIt->second);
+                        }
+                    }
+                }
+                for (auto const& label : block.stateLabels) {
+                    if (!modelComponents->stateLabeling.containsLabel(label.second)) {
+                        modelComponents->stateLabeling.addLabel(label.second);
+                    }
+                    modelComponents->stateLabeling.addLabelToState(label.second, state + label.first);
+                }
+                state += block.rowGroupSizes.size();
+                numberOfStateRewardModels = std::max(numberOfStateRewardModels, block.stateRewards.size());
+                numberOfActionRewardModels = std::max(numberOfActionRewardModels, block.actionRewards.size());
+            }
+            STORM_LOG_THROW(state == stateSize, storm::exceptions::WrongFormatException, "Expected " << stateSize << " states but found " << state << ".");
+
+            // Build transition matrix
+            modelComponents->transitionMatrix = builder.build(row, stateSize, nonDeterministic ? stateSize : 0);
+            STORM_LOG_TRACE("Built matrix");
+
+            // Build choice labeling. Now that all actions are known, the offsets of the blocks can be computed.
+            if (options.buildChoiceLabeling) {
+                modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(row);
+            }
+            std::vector<size_t> blockRowOffsets = {0};
+            for (auto const& block : blocks) {
+                blockRowOffsets.push_back(blockRowOffsets.back() + block.rowSizes.size());
+                if (options.buildChoiceLabeling) {
+                    for (auto const& label : block.choiceLabels) {
+                        if (!modelComponents->choiceLabeling.get().containsLabel(label.second)) {
+                            modelComponents->choiceLabeling.get().addLabel(label.second);
+                        }
+                        modelComponents->choiceLabeling.get().addLabelToChoice(label.second, blockRowOffsets[blockRowOffsets.size() - 2] + label.first);
+                    }
+                }
+            }
+
+            // Build reward models
+            uint64_t numRewardModels = std::max(numberOfStateRewardModels, numberOfActionRewardModels);
+            for (uint64_t i = 0; i < numRewardModels; ++i) {
+                std::string rewardModelName;
+                if (rewardModelNames.size() <= i) {
+                    rewardModelName = "rew" + std::to_string(i);
+                } else {
+                    rewardModelName = rewardModelNames[i];
+                }
+                boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+                for (uint64_t blockIndex = 0; blockIndex < numberOfBlocks; ++blockIndex) {
+                    auto const& block = blocks[blockIndex];
+                    if (i < block.stateRewards.size() && !block.stateRewards[i].empty()) {
+                        if (!stateRewardVector) {
+                            stateRewardVector = std::vector<ValueType>(stateSize, storm::utility::zero<ValueType>());
+                        }
+                        for (auto const& reward : block.stateRewards[i]) {
+                            stateRewardVector.get()[block.firstState + reward.first] = reward.second;
+                        }
+                    }
+                    if (i < block.actionRewards.size() && !block.actionRewards[i].empty()) {
+                        if (!actionRewardVector) {
+                            actionRewardVector = std::vector<ValueType>(row, storm::utility::zero<ValueType>());
+                        }
+                        for (auto const& reward : block.actionRewards[i]) {
+                            actionRewardVector.get()[blockRowOffsets[blockIndex] + reward.first] = reward.second;
+                        }
+                    }
+                }
+                modelComponents->rewardModels.emplace(rewardModelName,
+                                                      storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+            }
+            STORM_LOG_TRACE("Built reward models");
+            return modelComponents;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void DirectEncodingParser<ValueType, RewardModelType>::parseStateBlock(char const* begin, char const* end, storm::models::ModelType type, std::unordered_map<std::string, ValueType> const& placeholders,
+                                                                               ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options, StateBlock& block) {
+            bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+
+            // Labels are separated by whitespace and can optionally be enclosed in quotation marks
+            // Regex for labels with two cases:
+            // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
+            //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
+            //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows (?=(\s|$|\"))
+            // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
+            //   - First part matches string without whitespace and quotation marks [^\s\"]+?
+            //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
+            std::regex const labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
 
             // Iterate over all lines
             std::string line;
@@ -167,7 +378,16 @@ namespace storm {
             size_t state = 0;
             bool firstState = true;
             bool firstActionForState = true;
-            while (storm::utility::getline(file, line)) {
+            char const* lineStart = begin;
+            while (lineStart != end) {
+                char const* lineEnd = std::find(lineStart, end, '\n');
+                line.assign(lineStart, lineEnd);
+                lineStart = lineEnd == end ? end : lineEnd + 1;
+                // Remove linebreaks
+                while (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+
                 if (boost::starts_with(line, "//")) {
                     continue;
                 }
@@ -181,6 +401,8 @@ namespace storm {
                         ++row;
                     }
                     firstActionForState = true;
+                    block.rowGroupSizes.push_back(1);
+                    block.rowSizes.push_back(0);
                     STORM_LOG_TRACE("New state " << state);
 
                     // Parse state id
@@ -194,10 +416,23 @@ namespace storm {
                         line = "";
                     }
                     size_t parsedId = parseNumber<size_t>(curString);
-                    STORM_LOG_ASSERT(state == parsedId, "State ids do not correspond.");
-                    if (nonDeterministic) {
-                        STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                        builder.newRowGroup(row);
+                    if (state == 0) {
+                        block.firstState = parsedId;
+                    }
+                    STORM_LOG_THROW(block.firstState + state == parsedId, storm::exceptions::WrongFormatException, "State ids do not correspond.");
+
+                    if (type == storm::models::ModelType::Smg) {
+                        // Parse the player, states without player have a unique choice
+                        storm::storage::PlayerIndex player = storm::storage::INVALID_PLAYER_INDEX;
+                        if (boost::starts_with(line, "<")) {
+                            size_t posEndPlayer = line.find('>');
+                            STORM_LOG_THROW(posEndPlayer != std::string::npos, storm::exceptions::WrongFormatException, "> missing.");
+                            player = parseNumber<storm::storage::PlayerIndex>(line.substr(1, posEndPlayer - 1));
+                            STORM_LOG_TRACE("State player " << player);
+                            line = line.substr(posEndPlayer + 1);
+                            boost::trim_left(line);
+                        }
+                        block.players.push_back(player);
                     }
 
                     if (continuousTime) {
@@ -213,11 +448,8 @@ namespace storm {
                             line = "";
                         }
                         ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                        if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                            modelComponents->markovianStates.get().set(state);
-                        }
                         STORM_LOG_TRACE("Exit rate " << exitRate);
-                        modelComponents->exitRates.get()[state] = exitRate;
+                        block.exitRates.push_back(exitRate);
                     }
 
                     if (boost::starts_with(line, "[")) {
@@ -228,30 +460,26 @@ namespace storm {
                         STORM_LOG_TRACE("State rewards: " << rewardsStr);
                         std::vector<std::string> rewards;
                         boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                        if (stateRewards.size() < rewards.size()) {
-                            stateRewards.resize(rewards.size());
+                        if (block.stateRewards.size() < rewards.size()) {
+                            block.stateRewards.resize(rewards.size());
                         }
-                        auto stateRewardsIt = stateRewards.begin();
+                        auto stateRewardsIt = block.stateRewards.begin();
                         for (auto const& rew : rewards) {
                             auto rewardValue = parseValue(rew, placeholders, valueParser);
                             if (!storm::utility::isZero(rewardValue)) {
-                                if (stateRewardsIt->empty()) {
-                                    stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
-                                }
-                                (*stateRewardsIt)[state] = std::move(rewardValue);
+                                stateRewardsIt->emplace_back(state, std::move(rewardValue));
                             }
                             ++stateRewardsIt;
                         }
                         line = line.substr(posEndReward + 1);
                     }
 
-
                     if (type == storm::models::ModelType::Pomdp) {
                         if (boost::starts_with(line, "{")) {
                             size_t posEndObservation = line.find("}");
                             std::string observation = line.substr(1, posEndObservation - 1);
                             STORM_LOG_TRACE("State observation " << observation);
-                            modelComponents->observabilityClasses.get()[state] = std::stoi(observation);
+                            block.observations.push_back(std::stoi(observation));
                             line = line.substr(posEndObservation + 1);
                         } else {
                             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << ".");
@@ -260,17 +488,6 @@ namespace storm {
 
                     // Parse labels
                     if (!line.empty()) {
-                        std::vector<std::string> labels;
-                        // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                        // Regex for labels with two cases:
-                        // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                        //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                        //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows (?=(\s|$|\"))
-                        // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                        //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                        //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                        std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
                         // Iterate over matches
                         auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
                         auto match_end = std::sregex_iterator();
@@ -278,27 +495,23 @@ namespace storm {
                             std::smatch match = *i;
                             // Find matched group and add as label
                             if (match.length(1) > 0) {
-                                labels.push_back(match.str(1));
+                                block.stateLabels.emplace_back(state, match.str(1));
                             } else {
-                                labels.push_back(match.str(3));
+                                block.stateLabels.emplace_back(state, match.str(3));
                             }
-                        }
-
-                        for (std::string const& label : labels) {
-                            if (!modelComponents->stateLabeling.containsLabel(label)) {
-                                modelComponents->stateLabeling.addLabel(label);
-                            }
-                            modelComponents->stateLabeling.addLabelToState(label, state);
-                            STORM_LOG_TRACE("New label: '" << label << "'");
+                            STORM_LOG_TRACE("New label: '" << block.stateLabels.back().second << "'");
                         }
                     }
 
                 } else if (boost::starts_with(line, "\taction ")) {
+                    STORM_LOG_THROW(!firstState, storm::exceptions::WrongFormatException, "Action declared before the first state.");
                     // New action
                     if (firstActionForState) {
                         firstActionForState = false;
                     } else {
                         ++row;
+                        ++block.rowGroupSizes.back();
+                        block.rowSizes.push_back(0);
                     }
                     STORM_LOG_TRACE("New action: " << row);
                     line = line.substr(8); //Remove "\taction "
@@ -314,10 +527,7 @@ namespace storm {
                     // curString contains action name.
                     if (options.buildChoiceLabeling) {
                         if (curString != "__NOLABEL__") {
-                            if (!modelComponents->choiceLabeling.get().containsLabel(curString)) {
-                                modelComponents->choiceLabeling.get().addLabel(curString);
-                            }
-                            modelComponents->choiceLabeling.get().addLabelToChoice(curString, row);
+                            block.choiceLabels.emplace_back(row, curString);
                         }
                     }
                     // Check for rewards
@@ -329,17 +539,14 @@ namespace storm {
                         STORM_LOG_TRACE("Action rewards: " << rewardsStr);
                         std::vector<std::string> rewards;
                         boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                        if (actionRewards.size() < rewards.size()) {
-                            actionRewards.resize(rewards.size());
+                        if (block.actionRewards.size() < rewards.size()) {
+                            block.actionRewards.resize(rewards.size());
                         }
-                        auto actionRewardsIt = actionRewards.begin();
+                        auto actionRewardsIt = block.actionRewards.begin();
                         for (auto const& rew : rewards) {
                             auto rewardValue = parseValue(rew, placeholders, valueParser);
                             if (!storm::utility::isZero(rewardValue)) {
-                                if (actionRewardsIt->size() <= row) {
-                                    actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
-                                }
-                                (*actionRewardsIt)[row] = std::move(rewardValue);
+                                actionRewardsIt->emplace_back(row, std::move(rewardValue));
                             }
                             ++actionRewardsIt;
                         }
@@ -348,51 +555,24 @@ namespace storm {
 
                 } else {
                     // New transition
+                    STORM_LOG_THROW(!firstState, storm::exceptions::WrongFormatException, "Transition declared before the first state.");
                     size_t posColon = line.find(':');
                     STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException, "':' not found in '" << line << "'.");
                     size_t target = parseNumber<size_t>(line.substr(2, posColon - 3));
                     std::string valueStr = line.substr(posColon + 2);
                     ValueType value = parseValue(valueStr, placeholders, valueParser);
                     STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
-                    STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException, "Target state " << target << " is greater than state size " << stateSize);
-                    builder.addNextValue(row, target, value);
+                    block.transitions.emplace_back(target, std::move(value));
+                    ++block.rowSizes.back();
                 }
 
                 if (storm::utility::resources::isTerminate()) {
-                    std::cout << "Parsed " << state << "/" << stateSize << " states before abort." << std::endl;
+                    std::cout << "Parsed " << state << " states of block starting at state " << block.firstState << " before abort." << std::endl;
                     STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
                     break;
                 }
 
             } // end state iteration
-            STORM_LOG_TRACE("Finished parsing");
-
-            // Build transition matrix
-            modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
-            STORM_LOG_TRACE("Built matrix");
-
-            // Build reward models
-            uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
-            for (uint64_t i = 0; i < numRewardModels; ++i) {
-                std::string rewardModelName;
-                if (rewardModelNames.size() <= i) {
-                    rewardModelName = "rew" + std::to_string(i);
-                } else {
-                    rewardModelName = rewardModelNames[i];
-                }
-                boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
-                if (i < stateRewards.size() && !stateRewards[i].empty()) {
-                    stateRewardVector = std::move(stateRewards[i]);
-                }
-                if (i < actionRewards.size() && !actionRewards[i].empty()) {
-                    actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
-                    actionRewardVector = std::move(actionRewards[i]);
-                }
-                modelComponents->rewardModels.emplace(rewardModelName,
-                                                      storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
-            }
-            STORM_LOG_TRACE("Built reward models");
-            return modelComponents;
         }
 
         template<typename ValueType, typename RewardModelType>
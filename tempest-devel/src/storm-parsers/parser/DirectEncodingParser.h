@@ -11,6 +11,8 @@ namespace storm {
 
         struct DirectEncodingParserOptions {
             bool buildChoiceLabeling = false;
+            // The number of threads used to parse the states. Zero means that all hardware threads are used.
+            uint64_t numberOfThreads = 0;
         };
         /*!
          *	Parser for models in the DRN format with explicit encoding.
@@ -30,21 +32,39 @@ namespace storm {
 
         private:
 
+            /*!
+             * The information parsed from a contiguous block of states.
+             */
+            struct StateBlock;
+
             /*!
              * Parse states and return transition matrix.
+             * The states are split into blocks that are parsed in parallel (for double values) and merged afterwards.
              *
-             * @param file Input file stream.
+             * @param begin Beginning of the state descriptions, i.e., the position after the @model line.
+             * @param end End of the state descriptions.
              * @param type Model type.
              * @param stateSize No. of states
              * @param placeholders Placeholders for values.
              * @param valueParser Value parser.
              * @param rewardModelNames Names of reward models.
+             * @param playerNames Names of the players, ordered by their index.
              *
              * @return Transition matrix.
              */
             static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>
-            parseStates(std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-                        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+            parseStates(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, std::unordered_map<std::string, ValueType> const& placeholders,
+                        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, std::vector<std::string> const& playerNames, DirectEncodingParserOptions const& options);
+
+            /*!
+             * Parse a block of states. The block has to start with a state description.
+             *
+             * @param begin Beginning of the block.
+             * @param end End of the block.
+             * @param block The block to fill.
+             */
+            static void parseStateBlock(char const* begin, char const* end, storm::models::ModelType type, std::unordered_map<std::string, ValueType> const& placeholders,
+                                        ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options, StateBlock& block);
 
             /*!
              * Parse value from string while using placeholders.
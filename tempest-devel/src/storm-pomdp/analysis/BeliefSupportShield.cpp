@@ -0,0 +1,125 @@
+#include "storm-pomdp/analysis/BeliefSupportShield.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/logic/ProbabilityOperatorFormula.h"
+#include "storm/models/sparse/ChoiceLabeling.h"
+#include "storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h"
+
+namespace storm {
+    namespace pomdp {
+
+        template<typename ValueType>
+        BeliefSupportShield<ValueType>::BeliefSupportShield(storm::models::sparse::Pomdp<ValueType> const& pomdp, WinningRegion const& winningRegion) :
+        BeliefSupportShield(std::make_shared<storm::storage::BeliefSupportTransitions<ValueType>>(pomdp), winningRegion) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        BeliefSupportShield<ValueType>::BeliefSupportShield(std::shared_ptr<storm::storage::BeliefSupportTransitions<ValueType> const> const& transitions, WinningRegion const& winningRegion) :
+        transitions(transitions), winningRegion(winningRegion) {
+            STORM_LOG_THROW(winningRegion.getNumberOfObservations() == transitions->getNumberOfObservations(), storm::exceptions::InvalidArgumentException, "The winning region has " << winningRegion.getNumberOfObservations() << " observations, but the POMDP has " << transitions->getNumberOfObservations() << ".");
+        }
+
+        template<typename ValueType>
+        bool BeliefSupportShield<ValueType>::isWinning(uint64_t observation, storm::storage::BitVector const& support) const {
+            return winningRegion.query(observation, support);
+        }
+
+        template<typename ValueType>
+        bool BeliefSupportShield<ValueType>::isAllowed(uint64_t observation, storm::storage::BitVector const& support, uint64_t action) const {
+            STORM_LOG_ASSERT(!support.empty(), "One cannot think one is literally nowhere");
+            storm::storage::BitVector successorSupport;
+            for (uint64_t successorObservation : transitions->getSuccessorObservations(observation, support, action)) {
+                transitions->computeSuccessorSupport(observation, support, action, successorObservation, successorSupport);
+                if (!winningRegion.query(successorObservation, successorSupport)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector BeliefSupportShield<ValueType>::getAllowedActions(uint64_t observation, storm::storage::BitVector const& support) const {
+            storm::storage::BitVector allowedActions(transitions->getNumberOfActions(observation));
+            for (uint64_t action = 0; action < allowedActions.size(); ++action) {
+                if (isAllowed(observation, support, action)) {
+                    allowedActions.set(action);
+                }
+            }
+            return allowedActions;
+        }
+
+        template<typename ValueType>
+        std::shared_ptr<storm::storage::BeliefSupportTransitions<ValueType> const> const& BeliefSupportShield<ValueType>::getTransitions() const {
+            return transitions;
+        }
+
+        template<typename ValueType>
+        WinningRegion const& BeliefSupportShield<ValueType>::getWinningRegion() const {
+            return winningRegion;
+        }
+
+        template<typename ValueType>
+        storm::json<storm::RationalNumber> BeliefSupportShield<ValueType>::toJson(storm::models::sparse::Pomdp<ValueType> const* pomdp) const {
+            STORM_LOG_THROW(pomdp == nullptr || pomdp->getNumberOfStates() == transitions->getNumberOfStates(), storm::exceptions::InvalidArgumentException, "The given POMDP is not compatible with this shield.");
+            storm::json<storm::RationalNumber> output = storm::json<storm::RationalNumber>::array();
+            for (uint64_t observation = 0; observation < transitions->getNumberOfObservations(); ++observation) {
+                for (auto const& support : winningRegion.getWinningSetsPerObservation(observation)) {
+                    storm::json<storm::RationalNumber> entry;
+                    entry["observation"] = observation;
+                    if (pomdp && pomdp->hasObservationValuations()) {
+                        entry["observation-valuation"] = pomdp->getObservationValuations().template toJson<storm::RationalNumber>(observation);
+                    }
+                    std::vector<uint64_t> states;
+                    for (uint64_t offset : support) {
+                        states.push_back(transitions->getStatesWithObservation(observation)[offset]);
+                    }
+                    entry["support"] = states;
+
+                    storm::json<storm::RationalNumber> actions = storm::json<storm::RationalNumber>::array();
+                    for (uint64_t action : getAllowedActions(observation, support)) {
+                        storm::json<storm::RationalNumber> actionJson;
+                        actionJson["index"] = action;
+                        if (pomdp && pomdp->hasChoiceLabeling()) {
+                            uint64_t choice = pomdp->getTransitionMatrix().getRowGroupIndices()[states.front()] + action;
+                            auto labels = pomdp->getChoiceLabeling().getLabelsOfChoice(choice);
+                            actionJson["labels"] = std::vector<std::string>(labels.begin(), labels.end());
+                        }
+                        actions.push_back(actionJson);
+                    }
+                    entry["actions"] = actions;
+                    output.push_back(entry);
+                }
+            }
+            return output;
+        }
+
+        template<typename ValueType>
+        void BeliefSupportShield<ValueType>::printJsonToStream(std::ostream& out, storm::models::sparse::Pomdp<ValueType> const* pomdp) const {
+            out << toJson(pomdp).dump(4);
+        }
+
+        template<typename ValueType>
+        BeliefSupportShield<ValueType> synthesizeBeliefSupportShield(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::logic::Formula const& formula, std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory, MemlessSearchOptions const& options, uint64_t lookahead) {
+            STORM_LOG_THROW(formula.isProbabilityOperatorFormula(), storm::exceptions::InvalidArgumentException, "Belief support shields require a probability operator formula, got " << formula << ".");
+            // The search operates on a copy in which the states that surely miss the objective are made absorbing.
+            storm::models::sparse::Pomdp<ValueType> preparedPomdp(pomdp);
+            storm::analysis::QualitativeAnalysisOnGraphs<ValueType> qualitativeAnalysis(preparedPomdp);
+            storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(formula.asProbabilityOperatorFormula());
+            preparedPomdp.getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+            storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula.asProbabilityOperatorFormula());
+
+            IterativePolicySearch<ValueType> search(preparedPomdp, targetStates, surelyNotAlmostSurelyReachTarget, smtSolverFactory, options);
+            search.computeWinningRegion(lookahead == 0 ? pomdp.getNumberOfStates() : lookahead);
+            // Only the transitions of losing states differ, which never occur in winning supports. Hence, the shield can
+            // be based on the original POMDP.
+            return BeliefSupportShield<ValueType>(pomdp, search.getLastWinningRegion());
+        }
+
+        template class BeliefSupportShield<double>;
+        template class BeliefSupportShield<storm::RationalNumber>;
+
+        template BeliefSupportShield<double> synthesizeBeliefSupportShield(storm::models::sparse::Pomdp<double> const& pomdp, storm::logic::Formula const& formula, std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory, MemlessSearchOptions const& options, uint64_t lookahead);
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <memory>
+#include <ostream>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/logic/Formula.h"
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/utility/solver.h"
+
+#include "storm-pomdp/analysis/IterativePolicySearch.h"
+#include "storm-pomdp/analysis/WinningRegion.h"
+#include "storm-pomdp/storage/BeliefSupportTransitions.h"
+
+namespace storm {
+    namespace pomdp {
+
+        /*!
+         * A safety shield for POMDPs that is keyed by the current observation and belief support. An action is allowed
+         * if, for every observation that may be received next, the successor belief support lies in the winning region.
+         * Thus, the shielded agent never leaves the winning region, from which the reach-avoid objective used for its
+         * computation can still be satisfied almost surely. For belief supports outside the winning region, typically
+         * no action is allowed.
+         */
+        template<typename ValueType>
+        class BeliefSupportShield {
+        public:
+            BeliefSupportShield(storm::models::sparse::Pomdp<ValueType> const& pomdp, WinningRegion const& winningRegion);
+            BeliefSupportShield(std::shared_ptr<storm::storage::BeliefSupportTransitions<ValueType> const> const& transitions, WinningRegion const& winningRegion);
+
+            /*!
+             * Whether the belief support (over the states with the given observation) is in the winning region.
+             */
+            bool isWinning(uint64_t observation, storm::storage::BitVector const& support) const;
+
+            bool isAllowed(uint64_t observation, storm::storage::BitVector const& support, uint64_t action) const;
+
+            /*!
+             * The actions that keep the belief support in the winning region.
+             */
+            storm::storage::BitVector getAllowedActions(uint64_t observation, storm::storage::BitVector const& support) const;
+
+            std::shared_ptr<storm::storage::BeliefSupportTransitions<ValueType> const> const& getTransitions() const;
+            WinningRegion const& getWinningRegion() const;
+
+            /*!
+             * Exports the allowed actions for every maximal winning belief support. The actions allowed for such a
+             * support are also safe for all its subsets. If the POMDP is given, observation valuations and action
+             * labels are added.
+             */
+            storm::json<storm::RationalNumber> toJson(storm::models::sparse::Pomdp<ValueType> const* pomdp = nullptr) const;
+            void printJsonToStream(std::ostream& out, storm::models::sparse::Pomdp<ValueType> const* pomdp = nullptr) const;
+
+        private:
+            std::shared_ptr<storm::storage::BeliefSupportTransitions<ValueType> const> transitions;
+            WinningRegion winningRegion;
+        };
+
+        /*!
+         * Computes the winning region of the (canonic) POMDP for the qualitative reachability formula, e.g.
+         * Pmax=? [!"bad" U "goal"], with the SAT-based iterative policy search and builds the corresponding shield.
+         * A lookahead of zero uses the number of states of the POMDP.
+         */
+        template<typename ValueType>
+        BeliefSupportShield<ValueType> synthesizeBeliefSupportShield(storm::models::sparse::Pomdp<ValueType> const& pomdp, storm::logic::Formula const& formula, std::shared_ptr<storm::utility::solver::SmtSolverFactory> smtSolverFactory, MemlessSearchOptions const& options = MemlessSearchOptions(), uint64_t lookahead = 0);
+    }
+}
@@ -1,3 +1,5 @@
+#pragma once
+
 #include <vector>
 #include <sstream>
 #include "storm/storage/expressions/Expressions.h"
@@ -16,7 +18,7 @@ namespace pomdp {
     enum class MemlessSearchPathVariables {
         BooleanRanking, IntegerRanking, RealRanking
     };
-    MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
+    inline MemlessSearchPathVariables pathVariableTypeFromString(std::string const& in) {
         if(in == "int") {
             return MemlessSearchPathVariables::IntegerRanking;
         } else if (in == "real") {
@@ -67,7 +67,7 @@ namespace pomdp {
     }
 
     bool WinningRegion::query(uint64_t observation, storm::storage::BitVector const& currently) const {
-        for(storm::storage::BitVector winning : winningRegion[observation]) {
+        for (auto const& winning : winningRegion[observation]) {
             if(currently.isSubsetOf(winning)) {
                 return true;
             }
@@ -199,7 +199,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType>
-        void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeRewardAtCurrentState(uint64 const &localActionIndex, ValueType extraReward) {
+        void BeliefMdpExplorer<PomdpType, BeliefValueType>::computeRewardAtCurrentState(uint64_t const &localActionIndex, ValueType extraReward) {
             STORM_LOG_ASSERT(status == Status::Exploring, "Method call is invalid in current status.");
             if (getCurrentNumberOfMdpChoices() > mdpActionRewards.size()) {
                 mdpActionRewards.resize(getCurrentNumberOfMdpChoices(), storm::utility::zero<ValueType>());
@@ -442,17 +442,19 @@ namespace storm {
             // Translate various components to the "new" MDP state set
             storm::utility::vector::filterVectorInPlace(mdpStateToBeliefIdMap, relevantMdpStates);
             { // beliefIdToMdpStateMap
-                for (auto belIdToMdpStateIt = beliefIdToMdpStateMap.begin(); belIdToMdpStateIt != beliefIdToMdpStateMap.end();) {
-                    if (relevantMdpStates.get(belIdToMdpStateIt->second)) {
-                        // Translate current entry and move on to the next one.
-                        belIdToMdpStateIt->second = toRelevantStateIndexMap[belIdToMdpStateIt->second];
-                        ++belIdToMdpStateIt;
+                for (BeliefId beliefId = 0; beliefId < beliefIdToMdpStateMap.size(); ++beliefId) {
+                    MdpStateType& mdpState = beliefIdToMdpStateMap[beliefId];
+                    if (mdpState == noState()) {
+                        continue;
+                    }
+                    if (relevantMdpStates.get(mdpState)) {
+                        // Translate current entry.
+                        mdpState = toRelevantStateIndexMap[mdpState];
                     } else {
-                        STORM_LOG_ASSERT(!exploredBeliefIds.get(belIdToMdpStateIt->first),
+                        STORM_LOG_ASSERT(beliefId >= exploredBeliefIds.size() || !exploredBeliefIds.get(beliefId),
                                          "Inconsistent exploration information: Unexplored MDPState corresponds to explored beliefId");
-                        // Delete current entry and move on to the next one.
-                        // This works because std::map::erase does not invalidate other iterators within the map!
-                        beliefIdToMdpStateMap.erase(belIdToMdpStateIt++);
+                        // Delete current entry.
+                        mdpState = noState();
                     }
                 }
             }
@@ -461,7 +463,8 @@ namespace storm {
                 // Adjust column indices. Unfortunately, the fastest way seems to be to "rebuild" the map
                 // It might payoff to do this when building the matrix.
                 for (auto &transitions : exploredMdpTransitions) {
-                    std::map<MdpStateType, ValueType> newTransitions;
+                    boost::container::flat_map<MdpStateType, ValueType> newTransitions;
+                    newTransitions.reserve(transitions.size());
                     for (auto const &entry : transitions) {
                         STORM_LOG_ASSERT(relevantMdpStates.get(entry.first), "Relevant state has transition to irrelevant state.");
                         newTransitions.emplace_hint(newTransitions.end(), toRelevantStateIndexMap[entry.first], entry.second);
@@ -761,7 +764,8 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType>
         typename BeliefMdpExplorer<PomdpType, BeliefValueType>::MdpStateType BeliefMdpExplorer<PomdpType, BeliefValueType>::getExploredMdpState(BeliefId const &beliefId) const {
             if (beliefId < exploredBeliefIds.size() && exploredBeliefIds.get(beliefId)) {
-                return beliefIdToMdpStateMap.at(beliefId);
+                STORM_LOG_ASSERT(beliefId < beliefIdToMdpStateMap.size() && beliefIdToMdpStateMap[beliefId] != noState(), "Explored belief " << beliefId << " has no MDP state.");
+                return beliefIdToMdpStateMap[beliefId];
             } else {
                 return noState();
             }
@@ -787,17 +791,17 @@ namespace storm {
                 exploredBeliefIds.set(beliefId, true);
 
                 // If this is a restart of the exploration, we still might have an MDP state for the belief
-                if (exploredMdp) {
-                    auto findRes = beliefIdToMdpStateMap.find(beliefId);
-                    if (findRes != beliefIdToMdpStateMap.end()) {
-                        mdpStatesToExplore.push_back(findRes->second);
-                        return findRes->second;
-                    }
+                if (exploredMdp && beliefId < beliefIdToMdpStateMap.size() && beliefIdToMdpStateMap[beliefId] != noState()) {
+                    mdpStatesToExplore.push_back(beliefIdToMdpStateMap[beliefId]);
+                    return beliefIdToMdpStateMap[beliefId];
                 }
                 // At this point we need to add a new MDP state
                 MdpStateType result = getCurrentNumberOfMdpStates();
                 assert(getCurrentNumberOfMdpStates() == mdpStateToBeliefIdMap.size());
                 mdpStateToBeliefIdMap.push_back(beliefId);
+                if (beliefId >= beliefIdToMdpStateMap.size()) {
+                    beliefIdToMdpStateMap.resize(beliefId + 1, noState());
+                }
                 beliefIdToMdpStateMap[beliefId] = result;
                 insertValueHints(computeLowerValueBoundAtBelief(beliefId), computeUpperValueBoundAtBelief(beliefId));
                 mdpStatesToExplore.push_back(result);
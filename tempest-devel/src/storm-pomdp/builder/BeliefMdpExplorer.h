@@ -5,6 +5,7 @@
 #include <deque>
 #include <map>
 #include <boost/optional.hpp>
+#include <boost/container/flat_map.hpp>
 
 
 #include "storm/storage/BitVector.h"
@@ -73,7 +74,7 @@ namespace storm {
              */
             bool addTransitionToBelief(uint64_t const &localActionIndex, BeliefId const &transitionTarget, ValueType const &value, bool ignoreNewBeliefs);
 
-            void computeRewardAtCurrentState(uint64 const &localActionIndex, ValueType extraReward = storm::utility::zero<ValueType>());
+            void computeRewardAtCurrentState(uint64_t const &localActionIndex, ValueType extraReward = storm::utility::zero<ValueType>());
 
             void setCurrentStateIsTarget();
 
@@ -192,12 +193,12 @@ namespace storm {
             // Belief state related information
             std::shared_ptr<BeliefManagerType> beliefManager;
             std::vector<BeliefId> mdpStateToBeliefIdMap;
-            std::map<BeliefId, MdpStateType> beliefIdToMdpStateMap;
+            std::vector<MdpStateType> beliefIdToMdpStateMap; // noState() for beliefs without MDP state
             storm::storage::BitVector exploredBeliefIds;
             
             // Exploration information
             std::deque<uint64_t> mdpStatesToExplore;
-            std::vector<std::map<MdpStateType, ValueType>> exploredMdpTransitions;
+            std::vector<boost::container::flat_map<MdpStateType, ValueType>> exploredMdpTransitions;
             std::vector<MdpStateType> exploredChoiceIndices;
             std::vector<ValueType> mdpActionRewards;
             uint64_t currentMdpState;
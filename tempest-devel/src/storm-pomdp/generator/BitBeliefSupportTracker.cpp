@@ -0,0 +1,68 @@
+#include "storm-pomdp/generator/BitBeliefSupportTracker.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace generator {
+        template<typename ValueType>
+        BitBeliefSupportTracker<ValueType>::BitBeliefSupportTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp) :
+        BitBeliefSupportTracker(std::make_shared<storm::storage::BeliefSupportTransitions<ValueType>>(pomdp)) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        BitBeliefSupportTracker<ValueType>::BitBeliefSupportTracker(std::shared_ptr<storm::storage::BeliefSupportTransitions<ValueType> const> const& transitions) :
+        transitions(transitions) {
+            reset();
+        }
+
+        template<typename ValueType>
+        bool BitBeliefSupportTracker<ValueType>::track(uint64_t action, uint64_t observation) {
+            STORM_LOG_THROW(observation < transitions->getNumberOfObservations(), storm::exceptions::InvalidArgumentException, "Observation " << observation << " does not exist.");
+            STORM_LOG_THROW(action < transitions->getNumberOfActions(currentObservation), storm::exceptions::InvalidArgumentException, "Action " << action << " is not available for observation " << currentObservation << ".");
+            transitions->computeSuccessorSupport(currentObservation, currentSupport, action, observation, nextSupport);
+            std::swap(currentSupport, nextSupport);
+            currentObservation = observation;
+            return isValid();
+        }
+
+        template<typename ValueType>
+        void BitBeliefSupportTracker<ValueType>::reset() {
+            auto initial = transitions->getInitialSupport();
+            currentObservation = initial.first;
+            currentSupport = std::move(initial.second);
+        }
+
+        template<typename ValueType>
+        void BitBeliefSupportTracker<ValueType>::reset(uint64_t observation, storm::storage::BitVector const& support) {
+            STORM_LOG_THROW(observation < transitions->getNumberOfObservations(), storm::exceptions::InvalidArgumentException, "Observation " << observation << " does not exist.");
+            STORM_LOG_THROW(support.size() == transitions->getStatesWithObservation(observation).size(), storm::exceptions::InvalidArgumentException, "The belief support has size " << support.size() << ", but there are " << transitions->getStatesWithObservation(observation).size() << " states with observation " << observation << ".");
+            currentObservation = observation;
+            currentSupport = support;
+        }
+
+        template<typename ValueType>
+        uint64_t BitBeliefSupportTracker<ValueType>::getCurrentObservation() const {
+            return currentObservation;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector const& BitBeliefSupportTracker<ValueType>::getCurrentSupport() const {
+            return currentSupport;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector BitBeliefSupportTracker<ValueType>::getCurrentBeliefSupport() const {
+            return transitions->toStates(currentObservation, currentSupport);
+        }
+
+        template<typename ValueType>
+        bool BitBeliefSupportTracker<ValueType>::isValid() const {
+            return !currentSupport.empty();
+        }
+
+        template class BitBeliefSupportTracker<double>;
+        template class BitBeliefSupportTracker<storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+#include "storm-pomdp/storage/BeliefSupportTransitions.h"
+
+namespace storm {
+    namespace generator {
+        /*!
+         * Tracks the current belief support as a bit vector over the states with the current observation, which is the
+         * representation used by winning regions and belief support shields. In contrast to the BeliefSupportTracker,
+         * an update only or-s precomputed successor masks and does not allocate once the buffers are large enough.
+         */
+        template<typename ValueType>
+        class BitBeliefSupportTracker {
+        public:
+            BitBeliefSupportTracker(storm::models::sparse::Pomdp<ValueType> const& pomdp);
+            BitBeliefSupportTracker(std::shared_ptr<storm::storage::BeliefSupportTransitions<ValueType> const> const& transitions);
+
+            /*!
+             * Update the current belief support.
+             * @param action The action that was taken
+             * @param observation The new observation
+             * @return False if the observation is impossible, which leaves an empty belief support
+             */
+            bool track(uint64_t action, uint64_t observation);
+
+            /*!
+             * Reset to the initial belief support
+             */
+            void reset();
+
+            /*!
+             * Reset to the given belief support over the states with the given observation
+             */
+            void reset(uint64_t observation, storm::storage::BitVector const& support);
+
+            uint64_t getCurrentObservation() const;
+            storm::storage::BitVector const& getCurrentSupport() const;
+
+            /*!
+             * The current belief support as a set of states
+             */
+            storm::storage::BitVector getCurrentBeliefSupport() const;
+
+            bool isValid() const;
+
+        private:
+            std::shared_ptr<storm::storage::BeliefSupportTransitions<ValueType> const> transitions;
+            uint64_t currentObservation;
+            storm::storage::BitVector currentSupport;
+            storm::storage::BitVector nextSupport;
+        };
+    }
+}
@@ -28,22 +28,10 @@ namespace storm {
             }
         }
 
-        template<typename PomdpType, typename BeliefValueType, typename StateType>
-        std::size_t BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefHash::operator()(const BeliefType &belief) const {
-            std::size_t seed = 0;
-            // Assumes that beliefs are ordered
-            for (auto const &entry : belief) {
-                boost::hash_combine(seed, entry.first);
-                boost::hash_combine(seed, entry.second);
-            }
-            return seed;
-        }
-
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefManager(PomdpType const &pomdp, BeliefValueType const &precision, TriangulationMode const &triangulationMode)
                 : pomdp(pomdp), triangulationMode(triangulationMode) {
             cc = storm::utility::ConstantsComparator<ValueType>(precision, false);
-            beliefToIdMap.resize(pomdp.getNrObservations());
             initialBeliefId = computeInitialBelief();
         }
 
@@ -69,12 +57,12 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         bool BeliefManager<PomdpType, BeliefValueType, StateType>::isEqual(BeliefId const &first, BeliefId const &second) const {
-            return isEqual(getBelief(first), getBelief(second));
+            return isEqual(copyBelief(first), copyBelief(second));
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         std::string BeliefManager<PomdpType, BeliefValueType, StateType>::toString(BeliefId const &beliefId) const {
-            return toString(getBelief(beliefId));
+            return toString(copyBelief(beliefId));
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -82,7 +70,7 @@ namespace storm {
             std::stringstream str;
             str << "(\n";
             for (uint64_t i = 0; i < t.size(); ++i) {
-                str << "\t" << t.weights[i] << " * \t" << toString(getBelief(t.gridPoints[i])) << "\n";
+                str << "\t" << t.weights[i] << " * \t" << toString(t.gridPoints[i]) << "\n";
             }
             str << ")\n";
             return str.str();
@@ -106,7 +94,7 @@ namespace storm {
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::ValueType
         BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefActionReward(BeliefId const &beliefId, uint64_t const &localActionIndex) const {
-            auto const &belief = getBelief(beliefId);
+            auto belief = getBelief(beliefId);
             STORM_LOG_ASSERT(!pomdpActionRewardVector.empty(), "Requested a reward although no reward model was specified.");
             auto result = storm::utility::zero<ValueType>();
             auto const &choiceIndices = pomdp.getTransitionMatrix().getRowGroupIndices();
@@ -121,19 +109,22 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefId beliefId) {
-            return getBeliefObservation(getBelief(beliefId));
+            auto belief = getBelief(beliefId);
+            STORM_LOG_ASSERT(!belief.empty(), "Empty belief.");
+            return pomdp.getObservation(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         uint64_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefNumberOfChoices(BeliefId beliefId) {
-            auto const &belief = getBelief(beliefId);
+            auto belief = getBelief(beliefId);
             return pomdp.getNumberOfChoices(belief.begin()->first);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::Triangulation
         BeliefManager<PomdpType, BeliefValueType, StateType>::triangulateBelief(BeliefId beliefId, BeliefValueType resolution) {
-            return triangulateBelief(getBelief(beliefId), resolution);
+            // The belief is copied as triangulation may add beliefs.
+            return triangulateBelief(copyBelief(beliefId), resolution);
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -147,8 +138,7 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         void BeliefManager<PomdpType, BeliefValueType, StateType>::joinSupport(BeliefId const &beliefId, BeliefSupportType &support) {
-            auto const &belief = getBelief(beliefId);
-            for (auto const &entry : belief) {
+            for (auto const &entry : getBelief(beliefId)) {
                 support.insert(entry.first);
             }
         }
@@ -172,19 +162,24 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType const &BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefView BeliefManager<PomdpType, BeliefValueType, StateType>::getBelief(BeliefId const &id) const {
             STORM_LOG_ASSERT(id != noId(), "Tried to get a non-existend belief.");
             STORM_LOG_ASSERT(id < getNumberOfBeliefIds(), "Belief index " << id << " is out of range.");
-            return beliefs[id];
+            return beliefs.getBelief(id);
+        }
+
+        template<typename PomdpType, typename BeliefValueType, typename StateType>
+        typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefType BeliefManager<PomdpType, BeliefValueType, StateType>::copyBelief(BeliefId const &id) const {
+            auto belief = getBelief(id);
+            return BeliefType(boost::container::ordered_unique_range, belief.begin(), belief.end());
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getId(BeliefType const &belief) const {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto idIt = beliefToIdMap[obs].find(belief);
-            STORM_LOG_ASSERT(idIt != beliefToIdMap[obs].end(), "Unknown Belief.");
-            return idIt->second;
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            BeliefId id = beliefs.find(belief);
+            STORM_LOG_ASSERT(id != noId(), "Unknown Belief.");
+            return id;
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
@@ -288,7 +283,7 @@ namespace storm {
                     STORM_LOG_ERROR("Weight greater than one in triangulation.");
                 }
                 weightSum += triangulation.weights[i];
-                BeliefType const &gridPoint = getBelief(triangulation.gridPoints[i]);
+                auto gridPoint = getBelief(triangulation.gridPoints[i]);
                 for (auto const &pointEntry : gridPoint) {
                     BeliefValueType &triangulatedValue = triangulatedBelief.emplace(pointEntry.first, storm::utility::zero<ValueType>()).first->second;
                     triangulatedValue += triangulation.weights[i] * pointEntry.second;
@@ -309,7 +304,7 @@ namespace storm {
         }
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
-        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType belief) const {
+        uint32_t BeliefManager<PomdpType, BeliefValueType, StateType>::getBeliefObservation(BeliefType const &belief) const {
             STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
             return pomdp.getObservation(belief.begin()->first);
         }
@@ -440,11 +435,9 @@ namespace storm {
                                                                              boost::optional<std::vector<BeliefValueType>> const &observationTriangulationResolutions) {
             std::vector<std::pair<BeliefId, ValueType>> destinations;
 
-            BeliefType belief = getBelief(beliefId);
-
             // Find the probability we go to each observation
             BeliefType successorObs; // This is actually not a belief but has the same type
-            for (auto const &pointEntry : belief) {
+            for (auto const &pointEntry : getBelief(beliefId)) {
                 uint64_t state = pointEntry.first;
                 for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
                     if (!storm::utility::isZero(pomdpTransition.getValue())) {
@@ -457,7 +450,8 @@ namespace storm {
             // Now for each successor observation we find and potentially triangulate the successor belief
             for (auto const &successor : successorObs) {
                 BeliefType successorBelief;
-                for (auto const &pointEntry : belief) {
+                // Adding the previous successor invalidated views on the stored beliefs, so we have to get it again.
+                for (auto const &pointEntry : getBelief(beliefId)) {
                     uint64_t state = pointEntry.first;
                     for (auto const &pomdpTransition : pomdp.getTransitionMatrix().getRow(state, actionIndex)) {
                         if (pomdp.getObservation(pomdpTransition.getColumn()) == successor.first) {
@@ -499,15 +493,8 @@ namespace storm {
 
         template<typename PomdpType, typename BeliefValueType, typename StateType>
         typename BeliefManager<PomdpType, BeliefValueType, StateType>::BeliefId BeliefManager<PomdpType, BeliefValueType, StateType>::getOrAddBeliefId(BeliefType const &belief) {
-            uint32_t obs = getBeliefObservation(belief);
-            STORM_LOG_ASSERT(obs < beliefToIdMap.size(), "Belief has unknown observation.");
-            auto insertioRes = beliefToIdMap[obs].emplace(belief, beliefs.size());
-            if (insertioRes.second) {
-                // There actually was an insertion, so add the new belief
-                beliefs.push_back(belief);
-            }
-            // Return the id
-            return insertioRes.first->second;
+            STORM_LOG_ASSERT(assertBelief(belief), "Invalid belief.");
+            return beliefs.findOrAdd(belief).first;
         }
 
         template class BeliefManager<storm::models::sparse::Pomdp<double>>;
@@ -7,6 +7,7 @@
 #include <boost/container/flat_set.hpp>
 
 #include "storm/utility/ConstantsComparator.h"
+#include "storm-pomdp/storage/BeliefStore.h"
 
 namespace storm {
     namespace storage {
@@ -70,10 +71,7 @@ namespace storm {
             std::vector<std::pair<BeliefId, ValueType>> expand(BeliefId const &beliefId, uint64_t actionIndex);
 
         private:
-
-            struct BeliefHash {
-                std::size_t operator()(const BeliefType &belief) const;
-            };
+            typedef typename BeliefStore<StateType, BeliefValueType>::BeliefView BeliefView;
 
             struct FreudenthalDiff {
                 FreudenthalDiff(StateType const &dimension, BeliefValueType diff);
@@ -83,7 +81,10 @@ namespace storm {
                 bool operator>(FreudenthalDiff const &other) const;
             };
 
-            BeliefType const &getBelief(BeliefId const &id) const;
+            // The returned view is invalidated when new beliefs are added.
+            BeliefView getBelief(BeliefId const &id) const;
+
+            BeliefType copyBelief(BeliefId const &id) const;
 
             BeliefId getId(BeliefType const &belief) const;
 
@@ -95,7 +96,7 @@ namespace storm {
 
             bool assertTriangulation(BeliefType const &belief, Triangulation const &triangulation) const;
 
-            uint32_t getBeliefObservation(BeliefType belief) const;
+            uint32_t getBeliefObservation(BeliefType const &belief) const;
 
             void triangulateBeliefFreudenthal(BeliefType const &belief, BeliefValueType const &resolution, Triangulation &result);
 
@@ -113,8 +114,7 @@ namespace storm {
             PomdpType const& pomdp;
             std::vector<ValueType> pomdpActionRewardVector;
             
-            std::vector<BeliefType> beliefs;
-            std::vector<std::unordered_map<BeliefType, BeliefId, BeliefHash>> beliefToIdMap;
+            BeliefStore<StateType, BeliefValueType> beliefs;
             BeliefId initialBeliefId;
             
             storm::utility::ConstantsComparator<ValueType> cc;
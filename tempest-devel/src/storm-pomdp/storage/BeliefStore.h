@@ -0,0 +1,203 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <boost/functional/hash.hpp>
+
+#include "storm/utility/macros.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * Stores beliefs, i.e., sparse distributions over POMDP states, in a single arena. Each belief is a contiguous run
+         * of (state, value) entries ordered by state that is referenced by its offset. Beliefs are deduplicated with an
+         * open addressing hash table (linear probing) over the belief ids, so every belief is only stored once and no
+         * node-based containers are involved. Beliefs are compared exactly.
+         */
+        template<typename StateType, typename BeliefValueType>
+        class BeliefStore {
+        public:
+            typedef uint64_t BeliefId;
+            typedef std::pair<StateType, BeliefValueType> EntryType;
+
+            /*!
+             * A read-only view on a stored belief. Adding beliefs to the store invalidates existing views.
+             */
+            class BeliefView {
+            public:
+                typedef EntryType value_type;
+                typedef EntryType const* const_iterator;
+
+                BeliefView(EntryType const* first, EntryType const* last) : first(first), last(last) {
+                    // Intentionally left empty
+                }
+
+                const_iterator begin() const {
+                    return first;
+                }
+
+                const_iterator end() const {
+                    return last;
+                }
+
+                uint64_t size() const {
+                    return last - first;
+                }
+
+                bool empty() const {
+                    return first == last;
+                }
+
+            private:
+                EntryType const* first;
+                EntryType const* last;
+            };
+
+            BeliefStore() {
+                clear();
+            }
+
+            static BeliefId noId() {
+                return std::numeric_limits<BeliefId>::max();
+            }
+
+            uint64_t size() const {
+                return beliefHashes.size();
+            }
+
+            uint64_t getNumberOfEntries() const {
+                return entries.size();
+            }
+
+            BeliefView getBelief(BeliefId const& id) const {
+                STORM_LOG_ASSERT(id < size(), "Belief index " << id << " is out of range.");
+                return BeliefView(entries.data() + beliefOffsets[id], entries.data() + beliefOffsets[id + 1]);
+            }
+
+            /*!
+             * Retrieves the id of the given belief (a range of (state, value) pairs ordered by state) or noId() if it is not stored.
+             */
+            template<typename BeliefRange>
+            BeliefId find(BeliefRange const& belief) const {
+                return slots[findSlot(belief, hash(belief))];
+            }
+
+            /*!
+             * Retrieves the id of the given belief (a range of (state, value) pairs ordered by state) and adds the belief if it is not stored yet.
+             * @return The id of the belief and whether it was added.
+             */
+            template<typename BeliefRange>
+            std::pair<BeliefId, bool> findOrAdd(BeliefRange const& belief) {
+                uint64_t beliefHash = hash(belief);
+                uint64_t slot = findSlot(belief, beliefHash);
+                if (slots[slot] != noId()) {
+                    return std::make_pair(slots[slot], false);
+                }
+                BeliefId id = size();
+                entries.insert(entries.end(), belief.begin(), belief.end());
+                beliefOffsets.push_back(entries.size());
+                beliefHashes.push_back(beliefHash);
+                slots[slot] = id;
+                // Keep the load factor at most 1/2 so that probe sequences stay short.
+                if (2 * size() > slots.size()) {
+                    rehash(2 * slots.size());
+                }
+                return std::make_pair(id, true);
+            }
+
+            void reserve(uint64_t numberOfBeliefs, uint64_t numberOfEntries) {
+                entries.reserve(numberOfEntries);
+                beliefOffsets.reserve(numberOfBeliefs + 1);
+                beliefHashes.reserve(numberOfBeliefs);
+                uint64_t numberOfSlots = slots.size();
+                while (numberOfSlots < 2 * numberOfBeliefs) {
+                    numberOfSlots *= 2;
+                }
+                if (numberOfSlots != slots.size()) {
+                    rehash(numberOfSlots);
+                }
+            }
+
+            void clear() {
+                entries.clear();
+                beliefOffsets.assign(1, 0);
+                beliefHashes.clear();
+                slots.assign(minimalNumberOfSlots, noId());
+                shift = 64 - log2(minimalNumberOfSlots);
+            }
+
+        private:
+            static constexpr uint64_t minimalNumberOfSlots = 16;
+
+            static uint64_t log2(uint64_t powerOfTwo) {
+                uint64_t result = 0;
+                while (powerOfTwo > 1) {
+                    powerOfTwo >>= 1;
+                    ++result;
+                }
+                return result;
+            }
+
+            template<typename BeliefRange>
+            static uint64_t hash(BeliefRange const& belief) {
+                std::size_t seed = 0;
+                // Assumes that beliefs are ordered
+                for (auto const& entry : belief) {
+                    boost::hash_combine(seed, entry.first);
+                    boost::hash_combine(seed, entry.second);
+                }
+                return seed;
+            }
+
+            uint64_t getHomeSlot(uint64_t beliefHash) const {
+                // Fibonacci hashing spreads hashes that only differ in their low bits.
+                return (beliefHash * 11400714819323198485ull) >> shift;
+            }
+
+            template<typename BeliefRange>
+            uint64_t findSlot(BeliefRange const& belief, uint64_t beliefHash) const {
+                uint64_t const mask = slots.size() - 1;
+                for (uint64_t slot = getHomeSlot(beliefHash);; slot = (slot + 1) & mask) {
+                    BeliefId id = slots[slot];
+                    if (id == noId() || (beliefHashes[id] == beliefHash && isEqual(id, belief))) {
+                        return slot;
+                    }
+                }
+            }
+
+            template<typename BeliefRange>
+            bool isEqual(BeliefId const& id, BeliefRange const& belief) const {
+                BeliefView stored = getBelief(id);
+                if (stored.size() != static_cast<uint64_t>(belief.size())) {
+                    return false;
+                }
+                return std::equal(stored.begin(), stored.end(), belief.begin(), [](EntryType const& storedEntry, typename BeliefRange::value_type const& entry) {
+                    return storedEntry.first == entry.first && storedEntry.second == entry.second;
+                });
+            }
+
+            void rehash(uint64_t numberOfSlots) {
+                slots.assign(numberOfSlots, noId());
+                shift = 64 - log2(numberOfSlots);
+                uint64_t const mask = numberOfSlots - 1;
+                for (BeliefId id = 0; id < size(); ++id) {
+                    uint64_t slot = getHomeSlot(beliefHashes[id]);
+                    while (slots[slot] != noId()) {
+                        slot = (slot + 1) & mask;
+                    }
+                    slots[slot] = id;
+                }
+            }
+
+            std::vector<EntryType> entries;
+            std::vector<uint64_t> beliefOffsets;
+            std::vector<uint64_t> beliefHashes;
+            std::vector<BeliefId> slots;
+            uint64_t shift;
+        };
+    }
+}
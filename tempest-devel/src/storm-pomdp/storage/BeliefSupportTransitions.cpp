@@ -0,0 +1,154 @@
+#include "storm-pomdp/storage/BeliefSupportTransitions.h"
+
+#include <algorithm>
+
+#include "storm/utility/macros.h"
+#include "storm/utility/constants.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/UnexpectedException.h"
+
+namespace storm {
+    namespace storage {
+
+        template<typename ValueType>
+        BeliefSupportTransitions<ValueType>::BeliefSupportTransitions(storm::models::sparse::Pomdp<ValueType> const& pomdp) :
+        observations(pomdp.getObservations()), statesPerObservation(pomdp.getNrObservations()), offsets(pomdp.getNumberOfStates()),
+        actionsPerObservation(pomdp.getNrObservations(), 0), rowGroupIndices(pomdp.getTransitionMatrix().getRowGroupIndices()), initialStates(pomdp.getInitialStates()) {
+            STORM_LOG_THROW(pomdp.isCanonic(), storm::exceptions::InvalidArgumentException, "Belief supports can only be tracked on canonic POMDPs.");
+            for (uint64_t state = 0; state < pomdp.getNumberOfStates(); ++state) {
+                uint64_t observation = observations[state];
+                offsets[state] = statesPerObservation[observation].size();
+                statesPerObservation[observation].push_back(state);
+                actionsPerObservation[observation] = pomdp.getTransitionMatrix().getRowGroupSize(state);
+            }
+
+            auto const& matrix = pomdp.getTransitionMatrix();
+            choiceIndications.reserve(matrix.getRowCount() + 1);
+            choiceIndications.push_back(0);
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                uint64_t firstEntry = successorObservations.size();
+                for (auto const& entry : matrix.getRow(row)) {
+                    if (storm::utility::isZero(entry.getValue())) {
+                        continue;
+                    }
+                    uint64_t successorObservation = observations[entry.getColumn()];
+                    uint64_t index = firstEntry;
+                    while (index < successorObservations.size() && successorObservations[index] != successorObservation) {
+                        ++index;
+                    }
+                    if (index == successorObservations.size()) {
+                        successorObservations.push_back(successorObservation);
+                        successorMasks.emplace_back(statesPerObservation[successorObservation].size());
+                    }
+                    successorMasks[index].set(offsets[entry.getColumn()]);
+                }
+                choiceIndications.push_back(successorObservations.size());
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t BeliefSupportTransitions<ValueType>::getNumberOfStates() const {
+            return observations.size();
+        }
+
+        template<typename ValueType>
+        uint64_t BeliefSupportTransitions<ValueType>::getNumberOfObservations() const {
+            return statesPerObservation.size();
+        }
+
+        template<typename ValueType>
+        uint64_t BeliefSupportTransitions<ValueType>::getNumberOfActions(uint64_t observation) const {
+            return actionsPerObservation[observation];
+        }
+
+        template<typename ValueType>
+        uint64_t BeliefSupportTransitions<ValueType>::getObservation(uint64_t state) const {
+            return observations[state];
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> const& BeliefSupportTransitions<ValueType>::getStatesWithObservation(uint64_t observation) const {
+            return statesPerObservation[observation];
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> BeliefSupportTransitions<ValueType>::getNumberOfStatesPerObservation() const {
+            std::vector<uint64_t> result;
+            result.reserve(statesPerObservation.size());
+            for (auto const& states : statesPerObservation) {
+                result.push_back(states.size());
+            }
+            return result;
+        }
+
+        template<typename ValueType>
+        uint64_t BeliefSupportTransitions<ValueType>::getOffset(uint64_t state) const {
+            return offsets[state];
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector BeliefSupportTransitions<ValueType>::toSupport(uint64_t observation, storm::storage::BitVector const& states) const {
+            storm::storage::BitVector support(statesPerObservation[observation].size());
+            for (uint64_t state : states) {
+                STORM_LOG_THROW(observations[state] == observation, storm::exceptions::InvalidArgumentException, "State " << state << " does not have observation " << observation << ".");
+                support.set(offsets[state]);
+            }
+            return support;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector BeliefSupportTransitions<ValueType>::toStates(uint64_t observation, storm::storage::BitVector const& support) const {
+            storm::storage::BitVector states(observations.size());
+            for (uint64_t offset : support) {
+                states.set(statesPerObservation[observation][offset]);
+            }
+            return states;
+        }
+
+        template<typename ValueType>
+        std::pair<uint64_t, storm::storage::BitVector> BeliefSupportTransitions<ValueType>::getInitialSupport() const {
+            STORM_LOG_THROW(!initialStates.empty(), storm::exceptions::UnexpectedException, "The POMDP has no initial state.");
+            uint64_t observation = observations[initialStates.getNextSetIndex(0)];
+            return std::make_pair(observation, toSupport(observation, initialStates));
+        }
+
+        template<typename ValueType>
+        std::vector<uint64_t> BeliefSupportTransitions<ValueType>::getSuccessorObservations(uint64_t observation, storm::storage::BitVector const& support, uint64_t action) const {
+            std::vector<uint64_t> result;
+            for (uint64_t offset : support) {
+                uint64_t choice = getChoice(observation, offset, action);
+                result.insert(result.end(), successorObservations.begin() + choiceIndications[choice], successorObservations.begin() + choiceIndications[choice + 1]);
+            }
+            std::sort(result.begin(), result.end());
+            result.erase(std::unique(result.begin(), result.end()), result.end());
+            return result;
+        }
+
+        template<typename ValueType>
+        void BeliefSupportTransitions<ValueType>::computeSuccessorSupport(uint64_t observation, storm::storage::BitVector const& support, uint64_t action, uint64_t successorObservation, storm::storage::BitVector& result) const {
+            if (result.size() == statesPerObservation[successorObservation].size()) {
+                result.clear();
+            } else {
+                result = storm::storage::BitVector(statesPerObservation[successorObservation].size());
+            }
+            for (uint64_t offset : support) {
+                uint64_t choice = getChoice(observation, offset, action);
+                for (uint64_t index = choiceIndications[choice]; index < choiceIndications[choice + 1]; ++index) {
+                    if (successorObservations[index] == successorObservation) {
+                        result |= successorMasks[index];
+                        break;
+                    }
+                }
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t BeliefSupportTransitions<ValueType>::getChoice(uint64_t observation, uint64_t offset, uint64_t action) const {
+            STORM_LOG_ASSERT(action < actionsPerObservation[observation], "Action " << action << " is not available for observation " << observation << ".");
+            return rowGroupIndices[statesPerObservation[observation][offset]] + action;
+        }
+
+        template class BeliefSupportTransitions<double>;
+        template class BeliefSupportTransitions<storm::RationalNumber>;
+    }
+}
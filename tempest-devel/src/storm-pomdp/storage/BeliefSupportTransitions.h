@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/models/sparse/Pomdp.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+
+        /*!
+         * The transitions of a POMDP between belief supports. As in the WinningRegion, a belief support for an
+         * observation is a bit vector over the states with that observation (ordered by their index). For every choice
+         * and every observation of its successors, the successor states with that observation are stored as such a bit
+         * vector. Successor supports are then obtained by or-ing these masks, which is cheap enough to do while acting.
+         * The POMDP has to be canonic, i.e., the i-th action of all states with the same observation has to agree.
+         */
+        template<typename ValueType>
+        class BeliefSupportTransitions {
+        public:
+            BeliefSupportTransitions(storm::models::sparse::Pomdp<ValueType> const& pomdp);
+
+            uint64_t getNumberOfStates() const;
+            uint64_t getNumberOfObservations() const;
+            uint64_t getNumberOfActions(uint64_t observation) const;
+            uint64_t getObservation(uint64_t state) const;
+
+            /*!
+             * The states with the given observation, ordered by their index. The position of a state in this vector is
+             * its offset in belief supports for this observation.
+             */
+            std::vector<uint64_t> const& getStatesWithObservation(uint64_t observation) const;
+            std::vector<uint64_t> getNumberOfStatesPerObservation() const;
+            uint64_t getOffset(uint64_t state) const;
+
+            /*!
+             * Converts a set of states that all have the given observation into a belief support over offsets.
+             */
+            storm::storage::BitVector toSupport(uint64_t observation, storm::storage::BitVector const& states) const;
+
+            /*!
+             * Converts a belief support over offsets into the set of states it contains.
+             */
+            storm::storage::BitVector toStates(uint64_t observation, storm::storage::BitVector const& support) const;
+
+            /*!
+             * The observation of the initial states and the initial belief support.
+             * Throws if the initial states do not share their observation.
+             */
+            std::pair<uint64_t, storm::storage::BitVector> getInitialSupport() const;
+
+            /*!
+             * The observations of the possible successors when taking the action in any state of the support.
+             */
+            std::vector<uint64_t> getSuccessorObservations(uint64_t observation, storm::storage::BitVector const& support, uint64_t action) const;
+
+            /*!
+             * Computes the support after taking the action and receiving the successor observation.
+             *
+             * @param result Is overwritten with the successor support. It is empty if the successor observation cannot be received.
+             */
+            void computeSuccessorSupport(uint64_t observation, storm::storage::BitVector const& support, uint64_t action, uint64_t successorObservation, storm::storage::BitVector& result) const;
+
+        private:
+            uint64_t getChoice(uint64_t observation, uint64_t offset, uint64_t action) const;
+
+            std::vector<uint32_t> observations;
+            std::vector<std::vector<uint64_t>> statesPerObservation;
+            std::vector<uint64_t> offsets;
+            std::vector<uint64_t> actionsPerObservation;
+            std::vector<uint64_t> rowGroupIndices;
+            storm::storage::BitVector initialStates;
+
+            // For each choice, the range of its successor observations (and masks) in the vectors below.
+            std::vector<uint64_t> choiceIndications;
+            std::vector<uint64_t> successorObservations;
+            std::vector<storm::storage::BitVector> successorMasks;
+        };
+    }
+}
@@ -0,0 +1,56 @@
+#include "storm-shield-server/server/LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace tempest {
+    namespace shields {
+        namespace server {
+
+            LatencyHistogram::LatencyHistogram() : numberOfSamples(0), totalNanoseconds(0), maximalNanoseconds(0) {
+                buckets.fill(0);
+            }
+
+            void LatencyHistogram::add(uint64_t nanoseconds) {
+                uint64_t bucket = 0;
+                while (bucket + 1 < NUMBER_OF_BUCKETS && (nanoseconds >> (bucket + 1)) != 0) {
+                    ++bucket;
+                }
+                ++buckets[bucket];
+                ++numberOfSamples;
+                totalNanoseconds += nanoseconds;
+                maximalNanoseconds = std::max(maximalNanoseconds, nanoseconds);
+            }
+
+            uint64_t LatencyHistogram::getNumberOfSamples() const {
+                return numberOfSamples;
+            }
+
+            uint64_t LatencyHistogram::getQuantile(double quantile) const {
+                uint64_t requiredSamples = static_cast<uint64_t>(std::ceil(quantile * numberOfSamples));
+                uint64_t samples = 0;
+                for (uint64_t bucket = 0; bucket < NUMBER_OF_BUCKETS; ++bucket) {
+                    samples += buckets[bucket];
+                    if (samples >= requiredSamples && samples > 0) {
+                        return std::min<uint64_t>(maximalNanoseconds, (2ull << bucket) - 1);
+                    }
+                }
+                return maximalNanoseconds;
+            }
+
+            void LatencyHistogram::printToStream(std::ostream& out) const {
+                out << "Latencies of " << numberOfSamples << " queries";
+                if (numberOfSamples == 0) {
+                    out << "." << std::endl;
+                    return;
+                }
+                out << " (mean " << totalNanoseconds / numberOfSamples << "ns, p50 <= " << getQuantile(0.5) << "ns, p99 <= " << getQuantile(0.99) << "ns, max " << maximalNanoseconds << "ns):" << std::endl;
+                for (uint64_t bucket = 0; bucket < NUMBER_OF_BUCKETS; ++bucket) {
+                    if (buckets[bucket] > 0) {
+                        out << "\t[" << (bucket == 0 ? 0 : 1ull << bucket) << "ns, " << (2ull << bucket) << "ns): " << buckets[bucket] << std::endl;
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <ostream>
+
+namespace tempest {
+    namespace shields {
+        namespace server {
+
+            /*!
+             * Counts latencies in buckets of powers of two nanoseconds. Bucket i contains the latencies in
+             * [2^i, 2^(i+1)) nanoseconds, the first bucket also contains latencies below one nanosecond.
+             */
+            class LatencyHistogram {
+            public:
+                static constexpr uint64_t NUMBER_OF_BUCKETS = 40;
+
+                LatencyHistogram();
+
+                void add(uint64_t nanoseconds);
+
+                uint64_t getNumberOfSamples() const;
+
+                /*!
+                 * Retrieves an upper bound for the given quantile (in [0,1]) in nanoseconds.
+                 */
+                uint64_t getQuantile(double quantile) const;
+
+                void printToStream(std::ostream& out) const;
+
+            private:
+                std::array<uint64_t, NUMBER_OF_BUCKETS> buckets;
+                uint64_t numberOfSamples;
+                uint64_t totalNanoseconds;
+                uint64_t maximalNanoseconds;
+            };
+        }
+    }
+}
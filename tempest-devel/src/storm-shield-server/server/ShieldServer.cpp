@@ -0,0 +1,282 @@
+#include "storm-shield-server/server/ShieldServer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace tempest {
+    namespace shields {
+        namespace server {
+
+            namespace {
+                // Bounds the memory a single request may claim.
+                uint64_t const MAXIMAL_NUMBER_OF_STATES_PER_QUERY = 1ull << 20;
+
+                // Requests of a client are only processed while less answers are waiting to be sent to it.
+                uint64_t const MAXIMAL_NUMBER_OF_PENDING_BYTES = 1ull << 24;
+
+                // Bounds the input that is read from a client before its requests are handled.
+                uint64_t const MAXIMAL_NUMBER_OF_BYTES_PER_READ = 1ull << 20;
+
+                template<typename T>
+                void append(std::vector<char>& output, T const& value) {
+                    char const* bytes = reinterpret_cast<char const*>(&value);
+                    output.insert(output.end(), bytes, bytes + sizeof(T));
+                }
+
+                void appendString(std::vector<char>& output, std::string const& value) {
+                    append(output, static_cast<uint32_t>(value.size()));
+                    output.insert(output.end(), value.begin(), value.end());
+                }
+
+                template<typename T>
+                T read(std::vector<char> const& input, uint64_t offset) {
+                    T value;
+                    std::memcpy(&value, input.data() + offset, sizeof(T));
+                    return value;
+                }
+
+            }
+
+            uint64_t ShieldServer::Client::getNumberOfPendingBytes() const {
+                return output.size() - outputOffset;
+            }
+
+            ShieldServer::ShieldServer(ShieldTableView const& view, std::string const& sharedMemoryName) : view(view), sharedMemoryName(sharedMemoryName), listenFileDescriptor(-1), numberOfQueriedStates(0) {
+                // Intentionally left empty.
+            }
+
+            ShieldServer::~ShieldServer() {
+                for (auto& client : clients) {
+                    close(client.fileDescriptor);
+                }
+                if (listenFileDescriptor >= 0) {
+                    close(listenFileDescriptor);
+                    unlink(socketPath.c_str());
+                }
+            }
+
+            void ShieldServer::listen(std::string const& socketPath) {
+                STORM_LOG_THROW(listenFileDescriptor < 0, storm::exceptions::InvalidArgumentException, "The server is already listening on " << this->socketPath << ".");
+                sockaddr_un address;
+                std::memset(&address, 0, sizeof(address));
+                address.sun_family = AF_UNIX;
+                STORM_LOG_THROW(socketPath.size() < sizeof(address.sun_path), storm::exceptions::InvalidArgumentException, "The socket path " << socketPath << " is too long.");
+                std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+
+                int fileDescriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+                STORM_LOG_THROW(fileDescriptor >= 0, storm::exceptions::FileIoException, "Unable to create socket: " << std::strerror(errno) << ".");
+                if (bind(fileDescriptor, reinterpret_cast<sockaddr const*>(&address), sizeof(address)) != 0 || ::listen(fileDescriptor, SOMAXCONN) != 0) {
+                    int error = errno;
+                    close(fileDescriptor);
+                    STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to listen on " << socketPath << ": " << std::strerror(error) << ".");
+                }
+                fcntl(fileDescriptor, F_SETFL, O_NONBLOCK);
+                listenFileDescriptor = fileDescriptor;
+                this->socketPath = socketPath;
+            }
+
+            void ShieldServer::run(std::function<bool()> const& isTerminate) {
+                STORM_LOG_THROW(listenFileDescriptor >= 0, storm::exceptions::InvalidArgumentException, "The server has to listen on a socket before it can run.");
+                std::vector<pollfd> fileDescriptors;
+                while (!isTerminate()) {
+                    fileDescriptors.clear();
+                    fileDescriptors.push_back({listenFileDescriptor, POLLIN, 0});
+                    for (auto const& client : clients) {
+                        short events = 0;
+                        if (!client.closing && client.getNumberOfPendingBytes() < MAXIMAL_NUMBER_OF_PENDING_BYTES) {
+                            events |= POLLIN;
+                        }
+                        if (client.getNumberOfPendingBytes() > 0) {
+                            events |= POLLOUT;
+                        }
+                        fileDescriptors.push_back({client.fileDescriptor, events, 0});
+                    }
+                    int ready = poll(fileDescriptors.data(), fileDescriptors.size(), 100);
+                    if (ready < 0) {
+                        STORM_LOG_THROW(errno == EINTR, storm::exceptions::FileIoException, "Waiting for clients failed: " << std::strerror(errno) << ".");
+                        continue;
+                    }
+
+                    // Handle the clients first as accepting new ones changes the list of clients.
+                    for (uint64_t index = 1; index < fileDescriptors.size(); ++index) {
+                        if (fileDescriptors[index].revents == 0) {
+                            continue;
+                        }
+                        Client& client = clients[index - 1];
+                        bool open = true;
+                        if (fileDescriptors[index].revents & (POLLIN | POLLHUP | POLLERR)) {
+                            open = readFromClient(client);
+                        }
+                        if (open) {
+                            // Requests that were held back while too many answers were pending are processed once these are sent.
+                            handleRequests(client);
+                            open = writeToClient(client);
+                        }
+                        if (!open || (client.closing && client.getNumberOfPendingBytes() == 0)) {
+                            closeClient(client);
+                        }
+                    }
+                    clients.erase(std::remove_if(clients.begin(), clients.end(), [] (Client const& client) { return client.fileDescriptor < 0; }), clients.end());
+                    if (fileDescriptors[0].revents & POLLIN) {
+                        acceptClient();
+                    }
+                }
+            }
+
+            LatencyHistogram const& ShieldServer::getLatencyHistogram() const {
+                return latencyHistogram;
+            }
+
+            uint64_t ShieldServer::getNumberOfQueriedStates() const {
+                return numberOfQueriedStates;
+            }
+
+            void ShieldServer::acceptClient() {
+                int fileDescriptor;
+                while ((fileDescriptor = accept(listenFileDescriptor, nullptr, nullptr)) >= 0) {
+                    fcntl(fileDescriptor, F_SETFL, O_NONBLOCK);
+                    clients.push_back({fileDescriptor, {}, {}, 0, false});
+                    STORM_LOG_DEBUG("Accepted client " << fileDescriptor << ".");
+                }
+            }
+
+            bool ShieldServer::readFromClient(Client& client) {
+                char buffer[1 << 16];
+                // The remaining input is read in the next round, after the requests that arrived so far were handled.
+                for (uint64_t numberOfReadBytes = 0; numberOfReadBytes < MAXIMAL_NUMBER_OF_BYTES_PER_READ; ) {
+                    ssize_t bytes = recv(client.fileDescriptor, buffer, sizeof(buffer), 0);
+                    if (bytes > 0) {
+                        client.input.insert(client.input.end(), buffer, buffer + bytes);
+                        numberOfReadBytes += bytes;
+                    } else if (bytes == 0) {
+                        // The client closed the connection.
+                        return false;
+                    } else {
+                        return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+                    }
+                }
+                return true;
+            }
+
+            void ShieldServer::handleRequests(Client& client) {
+                uint64_t offset = 0;
+                uint64_t const tupleSize = view.getNumberOfVariables() * sizeof(int64_t);
+                std::vector<uint64_t> masks;
+                while (!client.closing && client.getNumberOfPendingBytes() < MAXIMAL_NUMBER_OF_PENDING_BYTES && client.input.size() - offset >= sizeof(uint32_t)) {
+                    auto start = std::chrono::steady_clock::now();
+                    std::vector<char> output;
+                    RequestType type = static_cast<RequestType>(read<uint32_t>(client.input, offset));
+                    if (type == RequestType::Query) {
+                        if (client.input.size() - offset < 2 * sizeof(uint32_t)) {
+                            break;
+                        }
+                        uint64_t numberOfStates = read<uint32_t>(client.input, offset + sizeof(uint32_t));
+                        if (numberOfStates > MAXIMAL_NUMBER_OF_STATES_PER_QUERY) {
+                            queueError(client, "At most " + std::to_string(MAXIMAL_NUMBER_OF_STATES_PER_QUERY) + " states can be queried at once.");
+                            break;
+                        }
+                        uint64_t requestSize = 2 * sizeof(uint32_t) + numberOfStates * tupleSize;
+                        if (client.input.size() - offset < requestSize) {
+                            break;
+                        }
+                        // Copy the tuples as the input buffer is not necessarily aligned.
+                        std::vector<int64_t> states(numberOfStates * view.getNumberOfVariables());
+                        std::memcpy(states.data(), client.input.data() + offset + 2 * sizeof(uint32_t), numberOfStates * tupleSize);
+                        masks.resize(numberOfStates);
+                        view.getAllowedActions(states.data(), numberOfStates, masks.data());
+
+                        output.reserve(2 * sizeof(uint32_t) + numberOfStates * sizeof(uint64_t));
+                        append(output, Status::Ok);
+                        append(output, static_cast<uint32_t>(numberOfStates));
+                        char const* bytes = reinterpret_cast<char const*>(masks.data());
+                        output.insert(output.end(), bytes, bytes + numberOfStates * sizeof(uint64_t));
+                        queueOutput(client, output);
+                        offset += requestSize;
+
+                        numberOfQueriedStates += numberOfStates;
+                        latencyHistogram.add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+                    } else if (type == RequestType::Describe) {
+                        append(output, Status::Ok);
+                        appendString(output, sharedMemoryName);
+                        append(output, static_cast<uint32_t>(view.getVariableNames().size()));
+                        for (auto const& variable : view.getVariableNames()) {
+                            appendString(output, variable);
+                        }
+                        append(output, static_cast<uint32_t>(view.getActionNames().size()));
+                        for (auto const& action : view.getActionNames()) {
+                            appendString(output, action);
+                        }
+                        queueOutput(client, output);
+                        offset += sizeof(uint32_t);
+                    } else if (type == RequestType::Statistics) {
+                        std::stringstream stream;
+                        latencyHistogram.printToStream(stream);
+                        append(output, Status::Ok);
+                        appendString(output, stream.str());
+                        queueOutput(client, output);
+                        offset += sizeof(uint32_t);
+                    } else {
+                        queueError(client, "Unknown request type " + std::to_string(static_cast<uint32_t>(type)) + ".");
+                        break;
+                    }
+                }
+                if (client.closing) {
+                    client.input.clear();
+                } else {
+                    client.input.erase(client.input.begin(), client.input.begin() + offset);
+                }
+            }
+
+            void ShieldServer::queueOutput(Client& client, std::vector<char> const& output) const {
+                client.output.insert(client.output.end(), output.begin(), output.end());
+            }
+
+            void ShieldServer::queueError(Client& client, std::string const& message) const {
+                std::vector<char> output;
+                append(output, Status::Error);
+                appendString(output, message);
+                queueOutput(client, output);
+                client.closing = true;
+            }
+
+            bool ShieldServer::writeToClient(Client& client) const {
+                while (client.getNumberOfPendingBytes() > 0) {
+                    ssize_t bytes = send(client.fileDescriptor, client.output.data() + client.outputOffset, client.getNumberOfPendingBytes(), MSG_NOSIGNAL);
+                    if (bytes >= 0) {
+                        client.outputOffset += bytes;
+                    } else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                        // The client does not read fast enough, the rest is sent once its socket is writable again.
+                        break;
+                    } else if (errno != EINTR) {
+                        STORM_LOG_WARN("Unable to answer client " << client.fileDescriptor << ": " << std::strerror(errno) << ".");
+                        return false;
+                    }
+                }
+                // Drop the sent part once it makes up at least half of the buffer, so every byte is moved at most once on average.
+                if (client.outputOffset > 0 && 2 * client.outputOffset >= client.output.size()) {
+                    client.output.erase(client.output.begin(), client.output.begin() + client.outputOffset);
+                    client.outputOffset = 0;
+                }
+                return true;
+            }
+
+            void ShieldServer::closeClient(Client& client) {
+                STORM_LOG_DEBUG("Closing connection to client " << client.fileDescriptor << ".");
+                close(client.fileDescriptor);
+                client.fileDescriptor = -1;
+            }
+        }
+    }
+}
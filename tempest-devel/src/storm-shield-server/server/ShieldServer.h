@@ -0,0 +1,98 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "storm/shields/ShieldTable.h"
+#include "storm-shield-server/server/LatencyHistogram.h"
+
+namespace tempest {
+    namespace shields {
+        namespace server {
+
+            /*!
+             * Answers queries for a shield table over a Unix domain socket. All numbers are sent in the byte order of
+             * the host. Every request starts with its type (uint32):
+             *
+             *  - QUERY (0) is followed by the number of states n (uint32) and n state tuples (int64 each, see
+             *    ShieldTableView). It is answered with the status (uint32), n (uint32) and n masks (uint64).
+             *  - DESCRIBE (1) is answered with the status, the name of the shared memory segment, the number of
+             *    variables and their names and the number of actions and their names. Counts are sent as uint32 and
+             *    strings as their length (uint32) followed by their characters.
+             *  - STATISTICS (2) is answered with the status and the latency histogram as a string.
+             *
+             * Invalid requests are answered with a non-zero status followed by an error message, after which the
+             * connection is closed.
+             *
+             * The server never blocks on a single client. Answers that a client does not read right away are kept until
+             * the socket is writable again. While too many answers of a client are pending, its further requests are
+             * not processed.
+             */
+            class ShieldServer {
+            public:
+                enum class RequestType : uint32_t { Query = 0, Describe = 1, Statistics = 2 };
+                enum class Status : uint32_t { Ok = 0, Error = 1 };
+
+                /*!
+                 * Creates a server for the given view. If the view is placed in a shared memory segment, its name is
+                 * reported to clients so they can map the table themselves.
+                 */
+                ShieldServer(ShieldTableView const& view, std::string const& sharedMemoryName = "");
+                ~ShieldServer();
+
+                ShieldServer(ShieldServer const&) = delete;
+                ShieldServer& operator=(ShieldServer const&) = delete;
+
+                /*!
+                 * Binds the server to the given socket path, which must not exist yet.
+                 */
+                void listen(std::string const& socketPath);
+
+                /*!
+                 * Serves clients until the given function returns true. The function is polled at least every
+                 * 100 milliseconds.
+                 */
+                void run(std::function<bool()> const& isTerminate);
+
+                /*!
+                 * Retrieves the latencies of the answered queries, measured from the arrival of the complete request
+                 * until the answer was ready to be sent.
+                 */
+                LatencyHistogram const& getLatencyHistogram() const;
+
+                uint64_t getNumberOfQueriedStates() const;
+
+            private:
+                struct Client {
+                    int fileDescriptor;
+                    std::vector<char> input;
+                    // The answers that were not sent yet start at outputOffset.
+                    std::vector<char> output;
+                    uint64_t outputOffset;
+                    // Set once an error was answered, the connection is closed after sending it.
+                    bool closing;
+
+                    uint64_t getNumberOfPendingBytes() const;
+                };
+
+                void acceptClient();
+                bool readFromClient(Client& client);
+                void handleRequests(Client& client);
+                void queueOutput(Client& client, std::vector<char> const& output) const;
+                void queueError(Client& client, std::string const& message) const;
+                bool writeToClient(Client& client) const;
+                void closeClient(Client& client);
+
+                ShieldTableView const& view;
+                std::string sharedMemoryName;
+                std::string socketPath;
+                int listenFileDescriptor;
+                std::vector<Client> clients;
+
+                LatencyHistogram latencyHistogram;
+                uint64_t numberOfQueriedStates;
+            };
+        }
+    }
+}
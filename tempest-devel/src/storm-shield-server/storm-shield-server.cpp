@@ -0,0 +1,108 @@
+#include <csignal>
+#include <fstream>
+#include <iostream>
+
+#include <unistd.h>
+
+#include "storm/utility/initialize.h"
+#include "storm/utility/macros.h"
+#include "storm/shields/ShieldTable.h"
+#include "storm/exceptions/BaseException.h"
+
+#include "storm-shield-server/server/ShieldServer.h"
+
+namespace {
+    volatile std::sig_atomic_t terminate = 0;
+
+    void handleSignal(int) {
+        terminate = 1;
+    }
+
+    void printUsage(std::ostream& out) {
+        out << "Usage: storm-shield-server --shield <file> [--socket <path>] [--shm <name>]" << std::endl << std::endl;
+        out << "Loads a pre-safety shield that was exported in the JSON format and answers queries for allowed actions." << std::endl;
+        out << "  --shield <file>   the exported shield" << std::endl;
+        out << "  --socket <path>   the Unix domain socket to listen on" << std::endl;
+        out << "  --shm <name>      places the shield in the POSIX shared memory segment with the given name (e.g. /tempest-shield)," << std::endl;
+        out << "                    which clients can map read-only instead of querying the socket" << std::endl;
+    }
+}
+
+/*!
+ * Main entry point of the shield server.
+ */
+int main(const int argc, const char** argv) {
+    std::string shieldFile;
+    std::string socketPath;
+    std::string sharedMemoryName;
+    for (int index = 1; index < argc; ++index) {
+        std::string argument = argv[index];
+        if (argument == "--help" || argument == "-h") {
+            printUsage(std::cout);
+            return 0;
+        } else if (index + 1 < argc && argument == "--shield") {
+            shieldFile = argv[++index];
+        } else if (index + 1 < argc && argument == "--socket") {
+            socketPath = argv[++index];
+        } else if (index + 1 < argc && argument == "--shm") {
+            sharedMemoryName = argv[++index];
+        } else {
+            std::cerr << "Unknown or incomplete option " << argument << "." << std::endl;
+            printUsage(std::cerr);
+            return 1;
+        }
+    }
+    if (shieldFile.empty() || (socketPath.empty() && sharedMemoryName.empty())) {
+        printUsage(std::cerr);
+        return 1;
+    }
+
+    try {
+        storm::utility::setUp();
+        std::signal(SIGINT, handleSignal);
+        std::signal(SIGTERM, handleSignal);
+
+        std::ifstream stream(shieldFile);
+        if (!stream) {
+            std::cerr << "Unable to open shield " << shieldFile << "." << std::endl;
+            return 1;
+        }
+        std::vector<char> encoding = tempest::shields::encodeShieldTable(stream);
+
+        // The table is placed in the shared memory segment if requested, so there is only one copy on the host.
+        std::unique_ptr<tempest::shields::SharedShieldTable> sharedTable;
+        std::unique_ptr<tempest::shields::ShieldTableView> localView;
+        if (!sharedMemoryName.empty()) {
+            sharedTable = tempest::shields::SharedShieldTable::create(sharedMemoryName, encoding);
+            encoding.clear();
+            encoding.shrink_to_fit();
+        } else {
+            localView = std::make_unique<tempest::shields::ShieldTableView>(encoding.data(), encoding.size());
+        }
+        tempest::shields::ShieldTableView const& view = sharedTable ? sharedTable->getView() : *localView;
+        STORM_PRINT("Loaded shield with " << view.getNumberOfStates() << " states, " << view.getVariableNames().size() << " variables and " << view.getActionNames().size() << " actions." << std::endl);
+
+        tempest::shields::server::ShieldServer server(view, sharedMemoryName);
+        if (!socketPath.empty()) {
+            server.listen(socketPath);
+            STORM_PRINT("Listening on " << socketPath << "." << std::endl);
+            server.run([] () { return terminate != 0; });
+        } else {
+            STORM_PRINT("Serving shared memory segment " << sharedMemoryName << "." << std::endl);
+            while (terminate == 0) {
+                pause();
+            }
+        }
+
+        STORM_PRINT("Answered queries for " << server.getNumberOfQueriedStates() << " states." << std::endl);
+        server.getLatencyHistogram().printToStream(std::cout);
+        storm::utility::cleanUp();
+        return 0;
+    } catch (storm::exceptions::BaseException const& exception) {
+        STORM_LOG_ERROR("An exception caused the shield server to terminate. The message of the exception is: " << exception.what());
+        return 1;
+    } catch (std::exception const& exception) {
+        STORM_LOG_ERROR("An unexpected exception occurred and caused the shield server to terminate. The message of this exception is: " << exception.what());
+        return 2;
+    }
+}
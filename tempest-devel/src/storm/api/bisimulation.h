@@ -2,12 +2,18 @@
 
 #include "storm/storage/bisimulation/DeterministicModelBisimulationDecomposition.h"
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/storage/PreScheduler.h"
 
 #include "storm/storage/dd/DdType.h"
 #include "storm/storage/dd/BisimulationDecomposition.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
     namespace api {
@@ -38,10 +44,57 @@ namespace storm {
             return bisimulationDecomposition.getQuotient();
         }
         
+        /*!
+         * Computes the bisimulation decomposition of the given game. Only states of the same player and choices with
+         * the same labels are merged. The decomposition provides the quotient as well as the mappings (and lifting
+         * functions) between the quotient and the given game, which therefore has to outlive the decomposition.
+         */
+        template<typename ValueType>
+        std::shared_ptr<storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<ValueType>>> computeGameBisimulationDecomposition(std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong) {
+            STORM_LOG_THROW(type == storm::storage::BisimulationType::Strong, storm::exceptions::NotSupportedException, "Only strong bisimulation is supported for games.");
+            typedef storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<ValueType>> DecompositionType;
+            typename DecompositionType::Options options;
+            if (!formulas.empty()) {
+                options = typename DecompositionType::Options(*model, formulas);
+            }
+            options.setType(type);
+            auto bisimulationDecomposition = std::make_shared<DecompositionType>(*model, options);
+            bisimulationDecomposition->computeBisimulationDecomposition();
+            return bisimulationDecomposition;
+        }
+
+        /*!
+         * Lifts a pre-shield computed on the quotient of the given decomposition to the original game: a choice of an
+         * original state is allowed iff the choice of the quotient it was merged into is allowed.
+         */
+        template<typename ValueType>
+        storm::storage::PreScheduler<ValueType> liftPreShield(storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<ValueType>> const& decomposition, storm::models::sparse::Smg<ValueType> const& model, storm::storage::PreScheduler<ValueType> const& quotientShield) {
+            std::vector<uint_fast64_t> const stateMapping = decomposition.getQuotientStateMapping();
+            std::vector<uint_fast64_t> const& choiceMapping = decomposition.getQuotientChoiceMapping();
+            std::vector<uint_fast64_t> const& quotientRowGroupIndices = decomposition.getQuotient()->getTransitionMatrix().getRowGroupIndices();
+            std::vector<uint_fast64_t> const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+            STORM_LOG_THROW(choiceMapping.size() == model.getNumberOfChoices(), storm::exceptions::InvalidArgumentException, "The decomposition does not belong to the given model.");
+
+            storm::storage::PreScheduler<ValueType> result(model.getNumberOfStates());
+            for (uint_fast64_t state = 0; state < model.getNumberOfStates(); ++state) {
+                uint_fast64_t quotientState = stateMapping[state];
+                storm::storage::PreSchedulerChoice<ValueType> liftedChoice;
+                for (auto const& allowedChoice : quotientShield.getChoice(quotientState).getChoiceMap()) {
+                    for (uint_fast64_t choice = rowGroupIndices[state]; choice < rowGroupIndices[state + 1]; ++choice) {
+                        if (choiceMapping[choice] - quotientRowGroupIndices[quotientState] == std::get<1>(allowedChoice)) {
+                            liftedChoice.addChoice(choice - rowGroupIndices[state], std::get<0>(allowedChoice));
+                        }
+                    }
+                }
+                result.setChoice(liftedChoice, state, 0);
+            }
+            return result;
+        }
+
         template <typename ValueType>
         std::shared_ptr<storm::models::sparse::Model<ValueType>> performBisimulationMinimization(std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, storm::storage::BisimulationType type = storm::storage::BisimulationType::Strong) {
             
-            STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp), storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs and MDPs.");
+            STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Dtmc) || model->isOfType(storm::models::ModelType::Ctmc) || model->isOfType(storm::models::ModelType::Mdp) || model->isOfType(storm::models::ModelType::Smg), storm::exceptions::NotSupportedException, "Bisimulation minimization is currently only available for DTMCs, CTMCs, MDPs and SMGs.");
 
             // Try to get rid of non state-rewards to easy bisimulation computation.
             model->reduceToStateBasedRewards();
@@ -50,6 +103,8 @@ namespace storm {
                 return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Dtmc<ValueType>>(model->template as<storm::models::sparse::Dtmc<ValueType>>(), formulas, type);
             } else if (model->isOfType(storm::models::ModelType::Ctmc)) {
                 return performDeterministicSparseBisimulationMinimization<storm::models::sparse::Ctmc<ValueType>>(model->template as<storm::models::sparse::Ctmc<ValueType>>(), formulas, type);
+            } else if (model->isOfType(storm::models::ModelType::Smg)) {
+                return performNondeterministicSparseBisimulationMinimization<storm::models::sparse::Smg<ValueType>>(model->template as<storm::models::sparse::Smg<ValueType>>(), formulas, type);
             } else {
                 return performNondeterministicSparseBisimulationMinimization<storm::models::sparse::Mdp<ValueType>>(model->template as<storm::models::sparse::Mdp<ValueType>>(), formulas, type);
             }
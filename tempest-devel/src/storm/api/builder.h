@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstdio>
+#include <unistd.h>
+
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
 #include "storm-parsers/parser/DirectEncodingParser.h"
 #include "storm-parsers/parser/ImcaMarkovAutomatonParser.h"
 
@@ -27,8 +31,11 @@
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/builder/jit/ExplicitJitJaniModelBuilder.h"
 
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/io/file.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/FileIoException.h"
 
 namespace storm {
     namespace api {
@@ -128,6 +135,34 @@ namespace storm {
             storm::builder::BuilderOptions options(formulas, model);
             return buildSparseModel<ValueType>(model, options, jit, doctor);
         }
+
+        /*!
+         * Builds the model of the given program, using the given directory as a cache. Games are stored in the binary
+         * model format under a key computed from the program and the builder options, and subsequent calls with the same
+         * input load them from there instead of building them again. Other model types are built without caching.
+         *
+         * @param program The program to build.
+         * @param options The builder options.
+         * @param cacheDirectory An existing directory in which the cached games are stored.
+         * @return The model.
+         */
+        inline std::shared_ptr<storm::models::sparse::Model<double>> buildSparseModelWithCache(storm::prism::Program const& program, storm::builder::BuilderOptions const& options, std::string const& cacheDirectory) {
+            std::string const cacheFile = cacheDirectory + "/" + storm::exporter::computeModelCacheKey(program, options) + ".smgb";
+            if (storm::utility::fileExistsAndIsReadable(cacheFile)) {
+                STORM_LOG_INFO("Loading model from cache file " << cacheFile << ".");
+                return storm::parser::BinaryModelParser::parseSmg(cacheFile, program.getManager());
+            }
+
+            std::shared_ptr<storm::models::sparse::Model<double>> model = buildSparseModel<double>(program, options);
+            if (model->isOfType(storm::models::ModelType::Smg)) {
+                // Write to a temporary file first, such that concurrent processes never load a partially written file.
+                std::string const temporaryFile = cacheFile + "." + std::to_string(::getpid()) + ".tmp";
+                storm::exporter::exportSmgAsBinary(temporaryFile, *model->as<storm::models::sparse::Smg<double>>());
+                STORM_LOG_THROW(std::rename(temporaryFile.c_str(), cacheFile.c_str()) == 0, storm::exceptions::FileIoException, "Could not move " << temporaryFile << " to " << cacheFile << ".");
+                STORM_LOG_INFO("Stored model in cache file " << cacheFile << ".");
+            }
+            return model;
+        }
         
         template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
         std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> buildSparseModel(storm::models::ModelType modelType, storm::storage::sparse::ModelComponents<ValueType, RewardModelType>&& components) {
@@ -2,6 +2,7 @@
 
 #include "storm/settings/SettingsManager.h"
 
+#include "storm/io/BinaryModelExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/io/DDEncodingExporter.h"
 #include "storm/io/file.h"
@@ -33,6 +34,11 @@ namespace storm {
             storm::utility::closeFile(stream);
         }
 
+        inline void exportSparseModelAsBinary(std::shared_ptr<storm::models::sparse::Model<double>> const& model, std::string const& filename) {
+            STORM_LOG_THROW(model->isOfType(storm::models::ModelType::Smg), storm::exceptions::NotSupportedException, "The binary model format only supports stochastic multiplayer games.");
+            storm::exporter::exportSmgAsBinary(filename, *model->as<storm::models::sparse::Smg<double>>());
+        }
+
         template<storm::dd::DdType Type, typename ValueType>
         void exportSparseModelAsDrdd(std::shared_ptr<storm::models::symbolic::Model<Type,ValueType>> const& model, std::string const& filename) {
             storm::exporter::explicitExportSymbolicModel(filename, model);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <exception>
 #include <type_traits>
 
 #include "storm/environment/Environment.h"
@@ -17,8 +18,10 @@
 #include "storm/modelchecker/abstraction/GameBasedMdpModelChecker.h"
 #include "storm/modelchecker/abstraction/BisimulationAbstractionRefinementModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/exploration/SparseSmgExplorationModelChecker.h"
 #include "storm/modelchecker/reachability/SparseDtmcEliminationModelChecker.h"
 #include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/StateFormulaCache.h"
 
 #include "storm/models/symbolic/Dtmc.h"
 #include "storm/models/symbolic/Mdp.h"
@@ -34,6 +37,7 @@
 #include "storm/settings/modules/AbstractionSettings.h"
 
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/NotImplementedException.h"
 
@@ -139,6 +143,11 @@ namespace storm {
                 if (checker.canHandle(task)) {
                     result = checker.check(env, task);
                 }
+            } else if (program.getModelType() == storm::prism::Program::ModelType::SMG) {
+                storm::modelchecker::SparseSmgExplorationModelChecker<storm::models::sparse::Smg<ValueType>> checker(program);
+                if (checker.canHandle(task)) {
+                    result = checker.check(env, task);
+                }
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type " << program.getModelType() << " is not supported by the exploration engine.");
             }
@@ -161,15 +170,17 @@ namespace storm {
         // Verifying with Sparse engine
         //
         template<typename ValueType>
-        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::StateFormulaCache> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             if (storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver() == storm::solver::EquationSolverType::Elimination && storm::settings::getModule<storm::settings::modules::EliminationSettings>().isUseDedicatedModelCheckerSet()) {
                 storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+                modelchecker.setStateFormulaCache(cache);
                 if (modelchecker.canHandle(task)) {
                     result = modelchecker.check(env, task);
                 }
             } else {
                 storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ValueType>> modelchecker(*dtmc);
+                modelchecker.setStateFormulaCache(cache);
                 if (modelchecker.canHandle(task)) {
                     result = modelchecker.check(env, task);
                 }
@@ -184,9 +195,10 @@ namespace storm {
         }
 
         template<typename ValueType>
-        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Ctmc<ValueType>> const& ctmc, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::StateFormulaCache> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             storm::modelchecker::SparseCtmcCslModelChecker<storm::models::sparse::Ctmc<ValueType>> modelchecker(*ctmc);
+            modelchecker.setStateFormulaCache(cache);
             if (modelchecker.canHandle(task)) {
                 result = modelchecker.check(env, task);
             }
@@ -200,9 +212,10 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::StateFormulaCache> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+            modelchecker.setStateFormulaCache(cache);
             if (modelchecker.canHandle(task)) {
                 result = modelchecker.check(env, task);
             }
@@ -210,9 +223,10 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Mdp<ValueType>> const& mdp, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::StateFormulaCache> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             storm::modelchecker::SparsePropositionalModelChecker<storm::models::sparse::Mdp<ValueType>> modelchecker(*mdp);
+            modelchecker.setStateFormulaCache(cache);
             if (modelchecker.canHandle(task)) {
                 result = modelchecker.check(env, task);
             }
@@ -226,7 +240,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& ma, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& ma, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::StateFormulaCache> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
 
             // Close the MA, if it is not already closed.
@@ -236,6 +250,7 @@ namespace storm {
             }
 
             storm::modelchecker::SparseMarkovAutomatonCslModelChecker<storm::models::sparse::MarkovAutomaton<ValueType>> modelchecker(*ma);
+            modelchecker.setStateFormulaCache(cache);
             if (modelchecker.canHandle(task)) {
                 result = modelchecker.check(env, task);
             }
@@ -243,7 +258,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const&, std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& , storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& ) {
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const&, std::shared_ptr<storm::models::sparse::MarkovAutomaton<ValueType>> const& , storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& , std::shared_ptr<storm::modelchecker::StateFormulaCache> const& = nullptr) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify MAs with this data type.");
         }
 
@@ -254,9 +269,10 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& smg, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<!std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& smg, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::StateFormulaCache> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ValueType>> modelchecker(*smg);
+            modelchecker.setStateFormulaCache(cache);
             if (modelchecker.canHandle(task)) {
                 result = modelchecker.check(env, task);
             }
@@ -264,7 +280,7 @@ namespace storm {
         }
 
         template<typename ValueType>
-        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& smg, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        typename std::enable_if<std::is_same<ValueType, storm::RationalFunction>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Smg<ValueType>> const& smg, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::StateFormulaCache> const& cache = nullptr) {
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Sparse engine cannot verify SMGs with this data type.");
         }
 
@@ -276,18 +292,18 @@ namespace storm {
 
 
         template<typename ValueType>
-        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+        std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task, std::shared_ptr<storm::modelchecker::StateFormulaCache> const& cache = nullptr) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
             if (model->getType() == storm::models::ModelType::Dtmc) {
-                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), task);
+                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Dtmc<ValueType>>(), task, cache);
             } else if (model->getType() == storm::models::ModelType::Mdp) {
-                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task);
+                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task, cache);
             } else if (model->getType() == storm::models::ModelType::Ctmc) {
-                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task);
+                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Ctmc<ValueType>>(), task, cache);
             } else if (model->getType() == storm::models::ModelType::MarkovAutomaton) {
-                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), task);
+                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>(), task, cache);
             } else if (model->getType() == storm::models::ModelType::Smg) {
-                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Smg<ValueType>>(), task);
+                result = verifyWithSparseEngine(env, model->template as<storm::models::sparse::Smg<ValueType>>(), task, cache);
             } else {
                 STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The model type " << model->getType() << " is not supported by the sparse engine.");
             }
@@ -300,6 +316,55 @@ namespace storm {
             return verifyWithSparseEngine(env, model, task);
         }
 
+        /*!
+         * Checks the given tasks concurrently on the same model. The results of qualitative state subformulas (e.g.
+         * the satisfaction sets of propositions) are shared among the tasks through the cache, such that common
+         * subformulas are only checked once. The model is only read, except that a Markov automaton is closed first.
+         * As the cached results are looked up by formula only, a given cache must only be shared among checks with the
+         * same environment.
+         *
+         * @param numberOfThreads The number of threads to use. If zero, one thread per task is used, up to the number
+         * of hardware threads.
+         * @param cache The cache of state formula results. If not given, a new cache is used for the given tasks.
+         * @return The results of the tasks in the same order.
+         */
+        template<typename ValueType>
+        std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> verifyWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model, std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>> const& tasks, uint64_t numberOfThreads = 0, std::shared_ptr<storm::modelchecker::StateFormulaCache> cache = nullptr) {
+            if (!cache) {
+                cache = std::make_shared<storm::modelchecker::StateFormulaCache>();
+            }
+            if (model->getType() == storm::models::ModelType::MarkovAutomaton && !model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->isClosed()) {
+                STORM_LOG_WARN("Closing Markov automaton. Consider closing the MA before verification.");
+                model->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->close();
+            }
+            // The row grouping of trivially grouped matrices is created lazily, which must not happen concurrently.
+            model->getTransitionMatrix().getRowGroupIndices();
+            for (auto const& rewardModel : model->getRewardModels()) {
+                if (rewardModel.second.hasTransitionRewards()) {
+                    rewardModel.second.getTransitionRewardMatrix().getRowGroupIndices();
+                }
+            }
+
+            std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results(tasks.size());
+            // Exceptions can not leave the threads, so they are rethrown once all tasks are done.
+            std::vector<std::exception_ptr> exceptions(tasks.size());
+            storm::utility::parallel::forEachBlock(tasks.size(), numberOfThreads, 1, [&] (uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    try {
+                        results[index] = verifyWithSparseEngine(env, model, tasks[index], cache);
+                    } catch (...) {
+                        exceptions[index] = std::current_exception();
+                    }
+                }
+            });
+            for (auto const& exception : exceptions) {
+                if (exception) {
+                    std::rethrow_exception(exception);
+                }
+            }
+            return results;
+        }
+
         template<typename ValueType>
         std::unique_ptr<storm::modelchecker::CheckResult> computeSteadyStateDistributionWithSparseEngine(storm::Environment const& env, std::shared_ptr<storm::models::sparse::Dtmc<ValueType>> const& dtmc) {
             std::unique_ptr<storm::modelchecker::CheckResult> result;
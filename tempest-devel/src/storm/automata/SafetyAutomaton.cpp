@@ -0,0 +1,229 @@
+#include "storm/automata/SafetyAutomaton.h"
+
+#include <algorithm>
+#include <tuple>
+
+#include "storm/logic/Formulas.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace automata {
+
+        namespace {
+            storm::logic::Formula const& getLeftOperand(storm::logic::Formula const& formula) {
+                return formula.isBinaryStateFormula() ? formula.asBinaryStateFormula().getLeftSubformula() : formula.asBinaryPathFormula().getLeftSubformula();
+            }
+
+            storm::logic::Formula const& getRightOperand(storm::logic::Formula const& formula) {
+                return formula.isBinaryStateFormula() ? formula.asBinaryStateFormula().getRightSubformula() : formula.asBinaryPathFormula().getRightSubformula();
+            }
+
+            bool isSafety(storm::logic::Formula const& formula, bool negated) {
+                if (formula.isBooleanLiteralFormula() || formula.isAtomicLabelFormula()) {
+                    return true;
+                } else if (formula.isUnaryBooleanStateFormula()) {
+                    return isSafety(formula.asUnaryBooleanStateFormula().getSubformula(), !negated);
+                } else if (formula.isUnaryBooleanPathFormula()) {
+                    return isSafety(static_cast<storm::logic::UnaryBooleanPathFormula const&>(formula).getSubformula(), !negated);
+                } else if (formula.isBinaryBooleanStateFormula() || formula.isBinaryBooleanPathFormula()) {
+                    return isSafety(getLeftOperand(formula), negated) && isSafety(getRightOperand(formula), negated);
+                } else if (formula.isNextFormula()) {
+                    return isSafety(formula.asNextFormula().getSubformula(), negated);
+                } else if (formula.isGloballyFormula()) {
+                    return !negated && isSafety(formula.asGloballyFormula().getSubformula(), false);
+                } else if (formula.isEventuallyFormula()) {
+                    return negated && isSafety(formula.asEventuallyFormula().getSubformula(), true);
+                } else if (formula.isUntilFormula()) {
+                    auto const& until = formula.asUntilFormula();
+                    return negated && isSafety(until.getLeftSubformula(), true) && isSafety(until.getRightSubformula(), true);
+                }
+                return false;
+            }
+        }
+
+        bool SafetyAutomaton::Node::operator<(Node const& other) const {
+            return std::tie(type, ap, positive, children) < std::tie(other.type, other.ap, other.positive, other.children);
+        }
+
+        SafetyAutomaton::SafetyAutomaton(storm::logic::Formula const& formula, APSet const& apSet) : apSet(apSet) {
+            STORM_LOG_THROW(isSafetyFormula(formula), storm::exceptions::NotSupportedException, "The formula " << formula << " is not in the syntactic safety fragment of LTL.");
+            uint64_t root = translate(formula, false);
+            getOrAddState(Dnf({Conjunction({root})}));
+        }
+
+        bool SafetyAutomaton::isSafetyFormula(storm::logic::Formula const& formula) {
+            return isSafety(formula, false);
+        }
+
+        APSet const& SafetyAutomaton::getAPSet() const {
+            return apSet;
+        }
+
+        uint64_t SafetyAutomaton::getInitialState() const {
+            return 0;
+        }
+
+        uint64_t SafetyAutomaton::getSuccessor(uint64_t state, APSet::alphabet_element letter) {
+            auto& stateSuccessors = successors[state];
+            auto successorIt = stateSuccessors.find(letter);
+            if (successorIt != stateSuccessors.end()) {
+                return successorIt->second;
+            }
+
+            Dnf successor;
+            for (auto const& conjunction : states[state]) {
+                Dnf conjunctionSuccessor = {Conjunction()};
+                for (auto const& obligation : conjunction) {
+                    conjunctionSuccessor = conjoin(conjunctionSuccessor, expand(obligation, letter));
+                    if (conjunctionSuccessor.empty()) {
+                        break;
+                    }
+                }
+                successor.insert(conjunctionSuccessor.begin(), conjunctionSuccessor.end());
+            }
+            minimize(successor);
+            uint64_t result = getOrAddState(std::move(successor));
+            // The reference into the map might have been invalidated by adding a state.
+            successors[state][letter] = result;
+            return result;
+        }
+
+        bool SafetyAutomaton::isRejecting(uint64_t state) const {
+            return states[state].empty();
+        }
+
+        bool SafetyAutomaton::isAccepting(uint64_t state) const {
+            return states[state].count(Conjunction()) > 0;
+        }
+
+        uint64_t SafetyAutomaton::getNumberOfStates() const {
+            return states.size();
+        }
+
+        uint64_t SafetyAutomaton::addNode(Node&& node) {
+            auto nodeIt = nodeToIndex.find(node);
+            if (nodeIt != nodeToIndex.end()) {
+                return nodeIt->second;
+            }
+            uint64_t index = nodes.size();
+            nodeToIndex.emplace(node, index);
+            nodes.push_back(std::move(node));
+            return index;
+        }
+
+        uint64_t SafetyAutomaton::translate(storm::logic::Formula const& formula, bool negated) {
+            if (formula.isBooleanLiteralFormula()) {
+                return addNode({formula.isTrueFormula() != negated ? NodeType::True : NodeType::False, 0, true, {}});
+            } else if (formula.isAtomicLabelFormula()) {
+                std::string const& label = formula.asAtomicLabelFormula().getLabel();
+                STORM_LOG_THROW(apSet.contains(label), storm::exceptions::NotSupportedException, "The atomic proposition " << label << " is not in the set of atomic propositions.");
+                return addNode({NodeType::Literal, apSet.getIndex(label), !negated, {}});
+            } else if (formula.isUnaryBooleanStateFormula()) {
+                return translate(formula.asUnaryBooleanStateFormula().getSubformula(), !negated);
+            } else if (formula.isUnaryBooleanPathFormula()) {
+                return translate(static_cast<storm::logic::UnaryBooleanPathFormula const&>(formula).getSubformula(), !negated);
+            } else if (formula.isBinaryBooleanStateFormula() || formula.isBinaryBooleanPathFormula()) {
+                bool isAnd = formula.isBinaryBooleanStateFormula() ? formula.asBinaryBooleanStateFormula().isAnd() : static_cast<storm::logic::BinaryBooleanPathFormula const&>(formula).isAnd();
+                uint64_t left = translate(getLeftOperand(formula), negated);
+                uint64_t right = translate(getRightOperand(formula), negated);
+                return addNode({isAnd != negated ? NodeType::And : NodeType::Or, 0, true, {std::min(left, right), std::max(left, right)}});
+            } else if (formula.isNextFormula()) {
+                return addNode({NodeType::Next, 0, true, {translate(formula.asNextFormula().getSubformula(), negated)}});
+            } else if (formula.isGloballyFormula()) {
+                return addNode({NodeType::Globally, 0, true, {translate(formula.asGloballyFormula().getSubformula(), false)}});
+            } else if (formula.isEventuallyFormula()) {
+                // !F a = G !a
+                return addNode({NodeType::Globally, 0, true, {translate(formula.asEventuallyFormula().getSubformula(), true)}});
+            } else {
+                // !(a U b) = !a R !b
+                STORM_LOG_ASSERT(formula.isUntilFormula(), "Unexpected formula " << formula << ".");
+                auto const& until = formula.asUntilFormula();
+                uint64_t left = translate(until.getLeftSubformula(), true);
+                uint64_t right = translate(until.getRightSubformula(), true);
+                return addNode({NodeType::Release, 0, true, {left, right}});
+            }
+        }
+
+        SafetyAutomaton::Dnf SafetyAutomaton::expand(uint64_t node, APSet::alphabet_element letter) const {
+            Node const& current = nodes[node];
+            switch (current.type) {
+                case NodeType::True:
+                    return {Conjunction()};
+                case NodeType::False:
+                    return {};
+                case NodeType::Literal:
+                    if (((letter >> current.ap) & 1ul) == static_cast<uint64_t>(current.positive)) {
+                        return {Conjunction()};
+                    }
+                    return {};
+                case NodeType::And:
+                    return conjoin(expand(current.children[0], letter), expand(current.children[1], letter));
+                case NodeType::Or: {
+                    Dnf result = expand(current.children[0], letter);
+                    Dnf right = expand(current.children[1], letter);
+                    result.insert(right.begin(), right.end());
+                    return result;
+                }
+                case NodeType::Next: {
+                    NodeType childType = nodes[current.children[0]].type;
+                    if (childType == NodeType::True) {
+                        return {Conjunction()};
+                    } else if (childType == NodeType::False) {
+                        return {};
+                    }
+                    return {Conjunction({current.children[0]})};
+                }
+                case NodeType::Globally:
+                    // G a = a & X G a
+                    return conjoin(expand(current.children[0], letter), {Conjunction({node})});
+                case NodeType::Release: {
+                    // a R b = b & (a | X (a R b))
+                    Dnf released = expand(current.children[0], letter);
+                    released.insert(Conjunction({node}));
+                    return conjoin(expand(current.children[1], letter), released);
+                }
+            }
+            STORM_LOG_ASSERT(false, "Unexpected node type.");
+            return {};
+        }
+
+        SafetyAutomaton::Dnf SafetyAutomaton::conjoin(Dnf const& first, Dnf const& second) {
+            Dnf result;
+            for (auto const& firstConjunction : first) {
+                for (auto const& secondConjunction : second) {
+                    Conjunction conjunction = firstConjunction;
+                    conjunction.insert(secondConjunction.begin(), secondConjunction.end());
+                    result.insert(std::move(conjunction));
+                }
+            }
+            return result;
+        }
+
+        void SafetyAutomaton::minimize(Dnf& dnf) {
+            // Drop every conjunction that is absorbed by a weaker one.
+            for (auto it = dnf.begin(); it != dnf.end();) {
+                bool absorbed = false;
+                for (auto const& other : dnf) {
+                    if (other.size() < it->size() && std::includes(it->begin(), it->end(), other.begin(), other.end())) {
+                        absorbed = true;
+                        break;
+                    }
+                }
+                it = absorbed ? dnf.erase(it) : std::next(it);
+            }
+        }
+
+        uint64_t SafetyAutomaton::getOrAddState(Dnf&& dnf) {
+            auto stateIt = stateToIndex.find(dnf);
+            if (stateIt != stateToIndex.end()) {
+                return stateIt->second;
+            }
+            uint64_t index = states.size();
+            stateToIndex.emplace(dnf, index);
+            states.push_back(std::move(dnf));
+            return index;
+        }
+    }
+}
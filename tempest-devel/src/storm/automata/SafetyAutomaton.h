@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "storm/automata/APSet.h"
+
+namespace storm {
+    namespace logic {
+        class Formula;
+    }
+
+    namespace automata {
+
+        /*!
+         * A deterministic automaton for an LTL formula of the syntactic safety fragment, i.e. a formula whose negation
+         * normal form only uses atomic propositions, conjunctions, disjunctions, next, globally and release (so
+         * eventually and until may only occur negated).
+         *
+         * The automaton is constructed lazily by formula progression: each state is a (minimal) disjunction of
+         * conjunctions of obligations that have to hold from the next letter on. Successors are only computed when
+         * requested and are cached afterwards. A state is rejecting iff it represents false, i.e. a bad prefix has been
+         * read, and accepting iff it represents true.
+         */
+        class SafetyAutomaton {
+        public:
+            /*!
+             * Creates the automaton for the given formula over the given atomic propositions. The atomic propositions
+             * have to occur as atomic labels in the formula.
+             *
+             * @param formula The formula, which has to be in the syntactic safety fragment.
+             * @param apSet The atomic propositions of the formula.
+             */
+            SafetyAutomaton(storm::logic::Formula const& formula, APSet const& apSet);
+
+            /*!
+             * Retrieves whether the given formula (over atomic labels) is in the syntactic safety fragment.
+             */
+            static bool isSafetyFormula(storm::logic::Formula const& formula);
+
+            APSet const& getAPSet() const;
+
+            /*!
+             * Retrieves the initial state, i.e. the state before the first letter is read.
+             */
+            uint64_t getInitialState() const;
+
+            /*!
+             * Retrieves the successor of the given state under the given letter, computing it if necessary.
+             */
+            uint64_t getSuccessor(uint64_t state, APSet::alphabet_element letter);
+
+            /*!
+             * Retrieves whether the given state represents false, i.e. the formula is violated.
+             */
+            bool isRejecting(uint64_t state) const;
+
+            /*!
+             * Retrieves whether the given state represents true, i.e. the formula is satisfied no matter what follows.
+             */
+            bool isAccepting(uint64_t state) const;
+
+            /*!
+             * Retrieves the number of states that have been explored so far.
+             */
+            uint64_t getNumberOfStates() const;
+
+        private:
+            enum class NodeType { True, False, Literal, And, Or, Next, Globally, Release };
+
+            struct Node {
+                NodeType type;
+                uint64_t ap;
+                bool positive;
+                std::vector<uint64_t> children;
+
+                bool operator<(Node const& other) const;
+            };
+
+            // A disjunction of conjunctions of obligations (nodes).
+            typedef std::set<uint64_t> Conjunction;
+            typedef std::set<Conjunction> Dnf;
+
+            uint64_t addNode(Node&& node);
+            uint64_t translate(storm::logic::Formula const& formula, bool negated);
+            Dnf expand(uint64_t node, APSet::alphabet_element letter) const;
+            static Dnf conjoin(Dnf const& first, Dnf const& second);
+            static void minimize(Dnf& dnf);
+            uint64_t getOrAddState(Dnf&& dnf);
+
+            APSet apSet;
+
+            // The nodes of the formula in negation normal form. Equal subformulas share the same node.
+            std::vector<Node> nodes;
+            std::map<Node, uint64_t> nodeToIndex;
+
+            // The states explored so far.
+            std::vector<Dnf> states;
+            std::map<Dnf, uint64_t> stateToIndex;
+
+            // The cached successors, indexed by state and letter.
+            std::unordered_map<uint64_t, std::unordered_map<APSet::alphabet_element, uint64_t>> successors;
+        };
+    }
+}
@@ -33,6 +33,7 @@
 #include "storm/utility/macros.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ProgressListener.h"
 
 
 namespace storm {
@@ -278,6 +279,7 @@ namespace storm {
                 }
 
                 ++numberOfExploredStates;
+                storm::utility::progress::reportExploredStates(numberOfExploredStates);
                 if (generator->getOptions().isShowProgressSet()) {
                     ++numberOfExploredStatesSinceLastMessage;
 
@@ -28,6 +28,8 @@ namespace storm {
                 label.second.resize(totalNumberOfChoices, false);
                 result.addLabel(label.first, std::move(label.second));
             }
+            // Most models have at most one label per choice, which allows to look up the label of a choice directly.
+            result.computeLabelIds();
             return result;
         }
 
@@ -19,6 +19,9 @@ namespace storm {
         }
         precision = storm::utility::convertNumber<storm::RationalNumber>(gameSettings.getPrecision());
         considerRelativeTerminationCriterion = gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Relative;
+        shieldTermination = gameSettings.isShieldTerminationSet();
+        mixedPrecision = gameSettings.isMixedPrecisionSet();
+        quantizeProbabilities = gameSettings.isQuantizeProbabilitiesSet();
         STORM_LOG_ASSERT(considerRelativeTerminationCriterion || gameSettings.getConvergenceCriterion() == storm::settings::modules::GameSolverSettings::ConvergenceCriterion::Absolute, "Unknown convergence criterion");
     }
 
@@ -64,5 +67,29 @@ namespace storm {
         considerRelativeTerminationCriterion = value;
     }
 
+    bool const& GameSolverEnvironment::isShieldTerminationSet() const {
+        return shieldTermination;
+    }
+
+    void GameSolverEnvironment::setShieldTermination(bool value) {
+        shieldTermination = value;
+    }
+
+    bool const& GameSolverEnvironment::isMixedPrecisionSet() const {
+        return mixedPrecision;
+    }
+
+    void GameSolverEnvironment::setMixedPrecision(bool value) {
+        mixedPrecision = value;
+    }
+
+    bool const& GameSolverEnvironment::isQuantizeProbabilitiesSet() const {
+        return quantizeProbabilities;
+    }
+
+    void GameSolverEnvironment::setQuantizeProbabilities(bool value) {
+        quantizeProbabilities = value;
+    }
+
 
 }
@@ -25,6 +25,12 @@ namespace storm {
         void setRelativeTerminationCriterion(bool value);
         storm::solver::MultiplicationStyle const& getMultiplicationStyle() const;
         void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
+        bool const& isShieldTerminationSet() const;
+        void setShieldTermination(bool value);
+        bool const& isMixedPrecisionSet() const;
+        void setMixedPrecision(bool value);
+        bool const& isQuantizeProbabilitiesSet() const;
+        void setQuantizeProbabilities(bool value);
         
     private:
         storm::solver::GameMethod gameMethod;
@@ -32,6 +38,9 @@ namespace storm {
         uint64_t maxIterationCount;
         storm::RationalNumber precision;
         bool considerRelativeTerminationCriterion;
+        bool shieldTermination;
+        bool mixedPrecision;
+        bool quantizeProbabilities;
     };
 }
 
@@ -485,7 +485,11 @@ namespace storm {
                 result.addVariable(varInfo.variable);
             }
             for (auto const& varInfo : transientVariableInformation.integerVariableInformation) {
-                result.addVariable(varInfo.variable);
+                if (varInfo.lowerBound && varInfo.upperBound) {
+                    result.addVariable(varInfo.variable, varInfo.lowerBound.get(), varInfo.upperBound.get());
+                } else {
+                    result.addVariable(varInfo.variable);
+                }
             }
             for (auto const& varInfo : transientVariableInformation.rationalVariableInformation) {
                 result.addVariable(varInfo.variable);
@@ -64,14 +64,15 @@ namespace storm {
         template<typename ValueType, typename StateType>
         storm::storage::sparse::StateValuationsBuilder NextStateGenerator<ValueType, StateType>::initializeStateValuationsBuilder() const {
             storm::storage::sparse::StateValuationsBuilder result;
+            // The bounds of the integer variables determine how many bytes are used to store their values.
             for (auto const& v : variableInformation.locationVariables) {
-                result.addVariable(v.variable);
+                result.addVariable(v.variable, 0, v.highestValue);
             }
             for (auto const& v : variableInformation.booleanVariables) {
                 result.addVariable(v.variable);
             }
             for (auto const& v : variableInformation.integerVariables) {
-                result.addVariable(v.variable);
+                result.addVariable(v.variable, v.lowerBound, v.upperBound);
             }
             return result;
         }
@@ -86,7 +87,7 @@ namespace storm {
             }
             for (auto const& v : variableInformation.integerVariables) {
                 if(v.observable) {
-                    result.addVariable(v.variable);
+                    result.addVariable(v.variable, v.lowerBound, v.upperBound);
                 }
             }
             for (auto const& l : variableInformation.observationLabels) {
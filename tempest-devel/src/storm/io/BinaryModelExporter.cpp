@@ -0,0 +1,282 @@
+#include "storm/io/BinaryModelExporter.h"
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/prism/Program.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace exporter {
+
+        namespace {
+            static_assert(sizeof(uint_fast64_t) == sizeof(uint64_t), "The binary model format requires 64-bit indices.");
+            static_assert(sizeof(double) == sizeof(uint64_t), "The binary model format requires 64-bit doubles.");
+
+            class BinaryWriter {
+            public:
+                BinaryWriter(std::ostream& os) : os(os) {
+                    // Intentionally left empty.
+                }
+
+                void writeWord(uint64_t value) {
+                    os.write(reinterpret_cast<char const*>(&value), sizeof(uint64_t));
+                }
+
+                void writeBytes(char const* data, uint64_t size) {
+                    writeWord(size);
+                    os.write(data, size);
+                    // Pad to the next word.
+                    uint64_t const padding = (8 - size % 8) % 8;
+                    char const zeros[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+                    os.write(zeros, padding);
+                }
+
+                void writeString(std::string const& value) {
+                    writeBytes(value.data(), value.size());
+                }
+
+                template<typename T>
+                void writeArray(std::vector<T> const& values) {
+                    static_assert(sizeof(T) == sizeof(uint64_t), "Only arrays of 64-bit values can be written.");
+                    writeWord(values.size());
+                    os.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+                }
+
+                void writeBitVector(storm::storage::BitVector const& bitVector) {
+                    uint64_t const numberOfWords = (bitVector.size() + 63) / 64;
+                    writeWord(bitVector.size());
+                    for (uint64_t word = 0; word < numberOfWords; ++word) {
+                        uint64_t const bitIndex = word * 64;
+                        writeWord(bitVector.getAsInt(bitIndex, std::min<uint64_t>(64, bitVector.size() - bitIndex)));
+                    }
+                }
+
+            private:
+                std::ostream& os;
+            };
+
+            void writeStateValuations(BinaryWriter& writer, storm::storage::sparse::StateValuations const& valuations, uint64_t numberOfStates) {
+                STORM_LOG_THROW(valuations.getNumberOfStates() == numberOfStates, storm::exceptions::NotSupportedException, "The state valuations do not cover all states.");
+                writer.writeWord(1);
+                if (numberOfStates == 0) {
+                    writer.writeWord(0);
+                    writer.writeWord(0);
+                    return;
+                }
+
+                // The variables and observation labels are the same for all states, so we take them from the first state.
+                std::vector<std::string> labels;
+                std::vector<std::pair<std::string, uint64_t>> variables;
+                for (auto valueIt = valuations.at(0).begin(); valueIt != valuations.at(0).end(); ++valueIt) {
+                    if (valueIt.isLabelAssignment()) {
+                        labels.push_back(valueIt.getLabel());
+                    } else if (valueIt.isBoolean()) {
+                        variables.emplace_back(valueIt.getName(), binary::BOOLEAN_VARIABLE);
+                    } else if (valueIt.isInteger()) {
+                        variables.emplace_back(valueIt.getName(), binary::INTEGER_VARIABLE);
+                    } else {
+                        STORM_LOG_ASSERT(valueIt.isRational(), "Unexpected variable type.");
+                        variables.emplace_back(valueIt.getName(), binary::RATIONAL_VARIABLE);
+                    }
+                }
+                writer.writeWord(variables.size());
+                for (auto const& variable : variables) {
+                    writer.writeString(variable.first);
+                    writer.writeWord(variable.second);
+                }
+                writer.writeWord(labels.size());
+                for (auto const& label : labels) {
+                    writer.writeString(label);
+                }
+
+                // Collect the values per type, so that they can be written as one array each.
+                std::vector<int64_t> integerValues;
+                std::vector<int64_t> labelValues;
+                std::vector<std::string> rationalValues;
+                uint64_t numberOfBooleanVariables = 0;
+                for (auto const& variable : variables) {
+                    if (variable.second == binary::BOOLEAN_VARIABLE) {
+                        ++numberOfBooleanVariables;
+                    }
+                }
+                storm::storage::BitVector booleanValues(numberOfStates * numberOfBooleanVariables, false);
+                uint64_t booleanIndex = 0;
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    STORM_LOG_THROW(!valuations.isEmpty(state), storm::exceptions::NotSupportedException, "State " << state << " has no valuation.");
+                    for (auto valueIt = valuations.at(state).begin(); valueIt != valuations.at(state).end(); ++valueIt) {
+                        if (valueIt.isLabelAssignment()) {
+                            labelValues.push_back(valueIt.getLabelValue());
+                        } else if (valueIt.isBoolean()) {
+                            booleanValues.set(booleanIndex++, valueIt.getBooleanValue());
+                        } else if (valueIt.isInteger()) {
+                            integerValues.push_back(valueIt.getIntegerValue());
+                        } else {
+                            rationalValues.push_back(storm::utility::to_string(valueIt.getRationalValue()));
+                        }
+                    }
+                }
+                writer.writeBitVector(booleanValues);
+                writer.writeArray(integerValues);
+                writer.writeArray(labelValues);
+                writer.writeWord(rationalValues.size());
+                for (auto const& value : rationalValues) {
+                    writer.writeString(value);
+                }
+            }
+
+            uint64_t fnv1aHash(std::string const& data, uint64_t hash) {
+                for (unsigned char character : data) {
+                    hash ^= character;
+                    hash *= 1099511628211ull;
+                }
+                return hash;
+            }
+        }
+
+        void exportSmgAsBinary(std::string const& filename, storm::models::sparse::Smg<double> const& smg) {
+            std::ofstream stream(filename, std::ios::out | std::ios::binary | std::ios::trunc);
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not open file " << filename << ".");
+            BinaryWriter writer(stream);
+
+            auto const& matrix = smg.getTransitionMatrix();
+            uint64_t const numberOfStates = smg.getNumberOfStates();
+            uint64_t const numberOfChoices = matrix.getRowCount();
+            stream.write(binary::MAGIC, sizeof(binary::MAGIC));
+            writer.writeWord(binary::VERSION);
+            writer.writeWord(numberOfStates);
+            writer.writeWord(numberOfChoices);
+            writer.writeWord(matrix.getEntryCount());
+            writer.writeWord(matrix.getColumnCount());
+
+            // The matrix is stored in CSR form with separate arrays for the columns and the values.
+            writer.writeArray(matrix.getRowGroupIndices());
+            std::vector<uint64_t> rowStarts;
+            rowStarts.reserve(numberOfChoices + 1);
+            for (uint64_t row = 0; row <= numberOfChoices; ++row) {
+                rowStarts.push_back(matrix.begin(row) - matrix.begin());
+            }
+            writer.writeArray(rowStarts);
+            std::vector<uint64_t> columns;
+            std::vector<double> values;
+            columns.reserve(matrix.getEntryCount());
+            values.reserve(matrix.getEntryCount());
+            for (auto const& entry : matrix) {
+                columns.push_back(entry.getColumn());
+                values.push_back(entry.getValue());
+            }
+            writer.writeArray(columns);
+            writer.writeArray(values);
+
+            // Players.
+            writer.writeArray(smg.getStatePlayerIndications());
+            writer.writeWord(smg.getPlayerNameToIndexMap().size());
+            for (auto const& player : smg.getPlayerNameToIndexMap()) {
+                writer.writeString(player.first);
+                writer.writeWord(player.second);
+            }
+
+            // Labelings.
+            std::set<std::string> stateLabels = smg.getStateLabeling().getLabels();
+            writer.writeWord(stateLabels.size());
+            for (auto const& label : stateLabels) {
+                writer.writeString(label);
+                writer.writeBitVector(smg.getStateLabeling().getStates(label));
+            }
+            if (smg.hasChoiceLabeling()) {
+                std::set<std::string> choiceLabels = smg.getChoiceLabeling().getLabels();
+                writer.writeWord(1);
+                writer.writeWord(choiceLabels.size());
+                for (auto const& label : choiceLabels) {
+                    writer.writeString(label);
+                    writer.writeBitVector(smg.getChoiceLabeling().getChoices(label));
+                }
+            } else {
+                writer.writeWord(0);
+            }
+
+            // Rewards.
+            writer.writeWord(smg.getNumberOfRewardModels());
+            for (auto const& rewardModel : smg.getRewardModels()) {
+                STORM_LOG_THROW(!rewardModel.second.hasTransitionRewards(), storm::exceptions::NotSupportedException, "Transition rewards are not supported by the binary model format.");
+                writer.writeString(rewardModel.first);
+                uint64_t flags = 0;
+                if (rewardModel.second.hasStateRewards()) {
+                    flags |= binary::STATE_REWARDS;
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    flags |= binary::STATE_ACTION_REWARDS;
+                }
+                writer.writeWord(flags);
+                if (rewardModel.second.hasStateRewards()) {
+                    writer.writeArray(rewardModel.second.getStateRewardVector());
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    writer.writeArray(rewardModel.second.getStateActionRewardVector());
+                }
+            }
+
+            if (smg.hasStateValuations()) {
+                writeStateValuations(writer, smg.getStateValuations(), numberOfStates);
+            } else {
+                writer.writeWord(0);
+            }
+
+            stream.close();
+            STORM_LOG_THROW(stream, storm::exceptions::FileIoException, "Could not write file " << filename << ".");
+        }
+
+        std::string computeModelCacheKey(storm::prism::Program const& program, storm::builder::BuilderOptions const& options, std::string const& constantDefinitionString) {
+            std::stringstream description;
+            description << "version " << binary::VERSION << std::endl;
+            description << program << std::endl;
+            description << "constants " << constantDefinitionString << std::endl;
+            description << "labels";
+            for (auto const& label : options.getLabelNames()) {
+                description << " " << label;
+            }
+            description << std::endl << "expression labels";
+            for (auto const& label : options.getExpressionLabels()) {
+                description << " " << label.first << "=" << label.second;
+            }
+            description << std::endl << "reward models";
+            for (auto const& rewardModelName : options.getRewardModelNames()) {
+                description << " " << rewardModelName;
+            }
+            description << std::endl << "terminal states";
+            for (auto const& terminalState : options.getTerminalStates()) {
+                if (terminalState.first.isLabel()) {
+                    description << " " << terminalState.first.getLabel();
+                } else {
+                    description << " " << terminalState.first.getExpression();
+                }
+                description << "=" << terminalState.second;
+            }
+            description << std::endl << "flags "
+                        << options.isApplyMaximalProgressAssumptionSet()
+                        << options.isBuildChoiceLabelsSet()
+                        << options.isBuildStateValuationsSet()
+                        << options.isBuildObservationValuationsSet()
+                        << options.isBuildChoiceOriginsSet()
+                        << options.isBuildAllRewardModelsSet()
+                        << options.isBuildAllLabelsSet()
+                        << options.isScaleAndLiftTransitionRewardsSet()
+                        << options.isAddOutOfBoundsStateSet()
+                        << options.isAddOverlappingGuardLabelSet()
+                        << " " << options.getReservedBitsForUnboundedVariables() << std::endl;
+
+            // Two FNV-1a hashes with different offset bases give a 128-bit key.
+            std::string const data = description.str();
+            std::stringstream key;
+            key << std::hex << std::setfill('0') << std::setw(16) << fnv1aHash(data, 14695981039346656037ull) << std::setw(16) << fnv1aHash(data, 0x6c62272e07bb0142ull);
+            return key.str();
+        }
+    }
+}
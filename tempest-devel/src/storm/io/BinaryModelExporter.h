@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "storm/models/sparse/Smg.h"
+
+namespace storm {
+    namespace prism {
+        class Program;
+    }
+
+    namespace builder {
+        class BuilderOptions;
+    }
+
+    namespace exporter {
+
+        /*!
+         * Constants describing the binary model format. A file starts with the magic bytes and the format version,
+         * followed by sections of 64-bit words. Arrays and strings are stored as their length followed by their raw
+         * content, padded to a multiple of eight bytes so that every array in the mapped file is suitably aligned.
+         */
+        namespace binary {
+            char const MAGIC[8] = {'S', 'T', 'O', 'R', 'M', 'S', 'M', 'G'};
+            uint64_t const VERSION = 1;
+
+            // The types of the variables of the state valuations.
+            uint64_t const BOOLEAN_VARIABLE = 0;
+            uint64_t const INTEGER_VARIABLE = 1;
+            uint64_t const RATIONAL_VARIABLE = 2;
+
+            // Flags indicating which vectors of a reward model are present.
+            uint64_t const STATE_REWARDS = 1;
+            uint64_t const STATE_ACTION_REWARDS = 2;
+        }
+
+        /*!
+         * Exports a stochastic multiplayer game into the binary model format. Besides the transition matrix and its row
+         * groups, the file contains the player indications, the state and choice labeling, the state and state-action
+         * rewards and the state valuations of the game.
+         *
+         * @param filename The file to export to.
+         * @param smg The game to export.
+         */
+        void exportSmgAsBinary(std::string const& filename, storm::models::sparse::Smg<double> const& smg);
+
+        /*!
+         * Computes the key under which a game built from the given program with the given options is cached. The key is a
+         * hash over the program (including the values of its defined constants), the given constant definitions and all
+         * builder options that influence the built model.
+         *
+         * @param program The program from which the model is built.
+         * @param options The options with which the model is built.
+         * @param constantDefinitionString The constant definitions that are applied to the program before building.
+         * @return A hexadecimal string that can be used as file name.
+         */
+        std::string computeModelCacheKey(storm::prism::Program const& program, storm::builder::BuilderOptions const& options, std::string const& constantDefinitionString = "");
+    }
+}
@@ -5,11 +5,13 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/exceptions/NotImplementedException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Pomdp.h"
+#include "storm/models/sparse/Smg.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
 
@@ -17,6 +19,39 @@
 namespace storm {
     namespace exporter {
 
+        namespace {
+            /*!
+             * Writes a state label. Only labels with a whitespace are put in (double) quotation marks.
+             */
+            void writeStateLabel(std::ostream& os, std::string const& label) {
+                STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
+                                "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
+                // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
+                if (std::count_if(label.begin(), label.end(), isspace) > 0) {
+                    os << " \"" << label << "\"";
+                } else {
+                    os << " " << label;
+                }
+            }
+
+            /*!
+             * Writes the player names ordered by their index, such that the index of a player is its position.
+             */
+            void writePlayers(std::ostream& os, std::map<std::string, storm::storage::PlayerIndex> const& playerNameToIndexMap) {
+                std::vector<std::string> playerNames(playerNameToIndexMap.size());
+                for (auto const& player : playerNameToIndexMap) {
+                    STORM_LOG_THROW(player.second < playerNames.size() && playerNames[player.second].empty(), storm::exceptions::NotSupportedException, "Player indices have to be consecutive to be exported.");
+                    STORM_LOG_THROW(std::count_if(player.first.begin(), player.first.end(), isspace) == 0, storm::exceptions::NotSupportedException, "Player names with whitespaces may not be exported.");
+                    playerNames[player.second] = player.first;
+                }
+                os << "@players" << std::endl;
+                for (auto const& name : playerNames) {
+                    os << name << " ";
+                }
+                os << std::endl;
+            }
+        }
+
         template<typename ValueType>
         void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters, DirectEncodingOptions const& options) {
 
@@ -65,6 +100,9 @@ namespace storm {
                 os << rewardModel.first << " ";
             }
             os << std::endl;
+            if (sparseModel->getType() == storm::models::ModelType::Smg) {
+                writePlayers(os, sparseModel->template as<storm::models::sparse::Smg<ValueType>>()->getPlayerNameToIndexMap());
+            }
             os << "@nr_states" << std::endl << sparseModel->getNumberOfStates() << std::endl;
             os << "@nr_choices" << std::endl << sparseModel->getNumberOfChoices() << std::endl;
             os << "@model" << std::endl;
@@ -75,6 +113,14 @@ namespace storm {
             for (typename storm::storage::SparseMatrix<ValueType>::index_type group = 0; group < matrix.getRowGroupCount(); ++group) {
                 os << "state " << group;
 
+                // Write the player for SMGs. States without player have a unique choice.
+                if (sparseModel->getType() == storm::models::ModelType::Smg) {
+                    storm::storage::PlayerIndex player = sparseModel->template as<storm::models::sparse::Smg<ValueType>>()->getPlayerOfState(group);
+                    if (player != storm::storage::INVALID_PLAYER_INDEX) {
+                        os << " <" << player << ">";
+                    }
+                }
+
                 // Write exit rates for CTMCs and MAs
                 if (!exitRates.empty()) {
                     os << " !";
@@ -107,16 +153,9 @@ namespace storm {
                     os << "]";
                 }
 
-                // Write labels. Only labels with a whitespace are put in (double) quotation marks.
+                // Write labels.
                 for (auto const& label : sparseModel->getStateLabeling().getLabelsOfState(group)) {
-                    STORM_LOG_THROW(std::count(label.begin(), label.end(), '\"') == 0, storm::exceptions::NotSupportedException,
-                                    "Labels with quotation marks are not supported in the DRN format and therefore may not be exported.");
-                    // TODO consider escaping the quotation marks. Not sure whether that is a good idea.
-                    if (std::count_if(label.begin(), label.end(), isspace) > 0) {
-                        os << " \"" << label << "\"";
-                    } else {
-                        os << " " << label;
-                    }
+                    writeStateLabel(os, label);
                 }
                 os << std::endl;
                 // Write state valuations as comments
@@ -276,9 +315,111 @@ namespace storm {
         }
 
 
+        template<typename ValueType>
+        DirectEncodingStreamExporter<ValueType>::DirectEncodingStreamExporter(std::ostream& os, storm::models::ModelType type, uint64_t numberOfStates, uint64_t numberOfChoices, std::vector<std::string> const& rewardModelNames, std::vector<std::string> const& playerNames)
+                : os(os), type(type), numberOfStates(numberOfStates), numberOfChoices(numberOfChoices), numberOfRewardModels(rewardModelNames.size()), currentState(0), currentChoice(0), currentChoiceOfState(0) {
+            STORM_LOG_THROW(type == storm::models::ModelType::Dtmc || type == storm::models::ModelType::Mdp || type == storm::models::ModelType::Smg, storm::exceptions::NotSupportedException, "Streaming export is not supported for model type " << type << ".");
+            STORM_LOG_THROW(playerNames.empty() || type == storm::models::ModelType::Smg, storm::exceptions::NotSupportedException, "Players are only supported for SMGs.");
+
+            os << "// Exported by storm" << std::endl;
+            os << "@type: " << type << std::endl;
+            os << "@parameters" << std::endl << std::endl;
+            os << "@reward_models" << std::endl;
+            for (auto const& rewardModelName : rewardModelNames) {
+                os << rewardModelName << " ";
+            }
+            os << std::endl;
+            if (type == storm::models::ModelType::Smg) {
+                std::map<std::string, storm::storage::PlayerIndex> playerNameToIndexMap;
+                for (storm::storage::PlayerIndex player = 0; player < playerNames.size(); ++player) {
+                    playerNameToIndexMap[playerNames[player]] = player;
+                }
+                STORM_LOG_THROW(playerNameToIndexMap.size() == playerNames.size(), storm::exceptions::NotSupportedException, "Player names have to be unique.");
+                writePlayers(os, playerNameToIndexMap);
+            }
+            os << "@nr_states" << std::endl << numberOfStates << std::endl;
+            os << "@nr_choices" << std::endl << numberOfChoices << std::endl;
+            os << "@model" << std::endl;
+        }
+
+        template<typename ValueType>
+        void DirectEncodingStreamExporter<ValueType>::addState(std::vector<std::string> const& labels, std::vector<ValueType> const& rewards, storm::storage::PlayerIndex player) {
+            STORM_LOG_THROW(currentState < numberOfStates, storm::exceptions::InvalidArgumentException, "Added more than the announced " << numberOfStates << " states.");
+            STORM_LOG_THROW(currentState == 0 || currentChoiceOfState > 0, storm::exceptions::InvalidArgumentException, "State " << currentState - 1 << " has no choice.");
+            STORM_LOG_THROW(player == storm::storage::INVALID_PLAYER_INDEX || type == storm::models::ModelType::Smg, storm::exceptions::InvalidArgumentException, "Players are only supported for SMGs.");
+            os << "state " << currentState;
+            if (player != storm::storage::INVALID_PLAYER_INDEX) {
+                os << " <" << player << ">";
+            }
+            writeRewards(rewards);
+            for (auto const& label : labels) {
+                writeStateLabel(os, label);
+            }
+            os << std::endl;
+            ++currentState;
+            currentChoiceOfState = 0;
+        }
+
+        template<typename ValueType>
+        void DirectEncodingStreamExporter<ValueType>::addChoice(std::string const& label, std::vector<ValueType> const& rewards) {
+            STORM_LOG_THROW(currentState > 0, storm::exceptions::InvalidArgumentException, "Choice added before the first state.");
+            STORM_LOG_THROW(currentChoice < numberOfChoices, storm::exceptions::InvalidArgumentException, "Added more than the announced " << numberOfChoices << " choices.");
+            STORM_LOG_THROW(currentChoiceOfState == 0 || type != storm::models::ModelType::Dtmc, storm::exceptions::InvalidArgumentException, "States of DTMCs have a single choice.");
+            STORM_LOG_THROW(std::count_if(label.begin(), label.end(), isspace) == 0, storm::exceptions::NotSupportedException, "Choice labels with whitespaces may not be exported.");
+            os << "\taction ";
+            if (label.empty()) {
+                os << currentChoiceOfState;
+            } else {
+                os << label;
+            }
+            writeRewards(rewards);
+            os << std::endl;
+            ++currentChoice;
+            ++currentChoiceOfState;
+        }
+
+        template<typename ValueType>
+        void DirectEncodingStreamExporter<ValueType>::addTransition(uint64_t target, ValueType const& value) {
+            STORM_LOG_THROW(currentChoiceOfState > 0, storm::exceptions::InvalidArgumentException, "Transition added before the first choice of the state.");
+            STORM_LOG_THROW(target < numberOfStates, storm::exceptions::InvalidArgumentException, "Target state " << target << " is greater than state size " << numberOfStates << ".");
+            os << "\t\t" << target << " : " << value << std::endl;
+        }
+
+        template<typename ValueType>
+        void DirectEncodingStreamExporter<ValueType>::finalize() {
+            STORM_LOG_THROW(currentState == numberOfStates, storm::exceptions::InvalidArgumentException, "Added " << currentState << " states, but announced " << numberOfStates << ".");
+            STORM_LOG_THROW(currentChoice == numberOfChoices, storm::exceptions::InvalidArgumentException, "Added " << currentChoice << " choices, but announced " << numberOfChoices << ".");
+            os.flush();
+        }
+
+        template<typename ValueType>
+        void DirectEncodingStreamExporter<ValueType>::writeRewards(std::vector<ValueType> const& rewards) {
+            if (numberOfRewardModels == 0) {
+                STORM_LOG_THROW(rewards.empty(), storm::exceptions::InvalidArgumentException, "Rewards given without reward models.");
+                return;
+            }
+            STORM_LOG_THROW(rewards.empty() || rewards.size() == numberOfRewardModels, storm::exceptions::InvalidArgumentException, "Expected " << numberOfRewardModels << " rewards, but got " << rewards.size() << ".");
+            os << " [";
+            for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+                if (rewardModel > 0) {
+                    os << ", ";
+                }
+                if (rewards.empty()) {
+                    os << "0";
+                } else {
+                    os << rewards[rewardModel];
+                }
+            }
+            os << "]";
+        }
+
         // Template instantiations
         template void explicitExportSparseModel<double>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<double>> sparseModel, std::vector<std::string> const& parameters, DirectEncodingOptions const& options);
         template void explicitExportSparseModel<storm::RationalNumber>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalNumber>> sparseModel, std::vector<std::string> const& parameters,DirectEncodingOptions const& options);
         template void explicitExportSparseModel<storm::RationalFunction>(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<storm::RationalFunction>> sparseModel, std::vector<std::string> const& parameters,DirectEncodingOptions const& options);
+
+        template class DirectEncodingStreamExporter<double>;
+        template class DirectEncodingStreamExporter<storm::RationalNumber>;
+        template class DirectEncodingStreamExporter<storm::RationalFunction>;
     }
 }
@@ -4,6 +4,7 @@
 #include <memory>
 
 #include "storm/models/sparse/Model.h"
+#include "storm/storage/PlayerIndex.h"
 
 namespace storm {
     namespace exporter {
@@ -22,6 +23,66 @@ namespace storm {
         void explicitExportSparseModel(std::ostream& os, std::shared_ptr<storm::models::sparse::Model<ValueType>> sparseModel, std::vector<std::string> const& parameters, DirectEncodingOptions const& options=DirectEncodingOptions());
 
 
+        /*!
+         * Exports a model into the explicit DRN format while it is generated, i.e., without building the model in memory.
+         * The states have to be added in the order of their ids. Each state is followed by its choices, and each choice
+         * by its transitions. Only DTMCs, MDPs and SMGs are supported.
+         */
+        template<typename ValueType>
+        class DirectEncodingStreamExporter {
+        public:
+            /*!
+             * Creates the exporter and writes the header.
+             *
+             * @param os               Stream to export to
+             * @param type             The type of the model
+             * @param numberOfStates   The number of states that will be added
+             * @param numberOfChoices  The number of choices that will be added
+             * @param rewardModelNames The names of the reward models
+             * @param playerNames      The names of the players (only for SMGs), ordered by their index
+             */
+            DirectEncodingStreamExporter(std::ostream& os, storm::models::ModelType type, uint64_t numberOfStates, uint64_t numberOfChoices, std::vector<std::string> const& rewardModelNames = {}, std::vector<std::string> const& playerNames = {});
+
+            /*!
+             * Adds the next state.
+             *
+             * @param labels  The labels of the state
+             * @param rewards The state rewards, one for each reward model
+             * @param player  The player controlling the state (only for SMGs)
+             */
+            void addState(std::vector<std::string> const& labels = {}, std::vector<ValueType> const& rewards = {}, storm::storage::PlayerIndex player = storm::storage::INVALID_PLAYER_INDEX);
+
+            /*!
+             * Adds the next choice of the current state.
+             *
+             * @param label   The label of the choice. If empty, the choice is named by its index within the state.
+             * @param rewards The state-action rewards, one for each reward model
+             */
+            void addChoice(std::string const& label = "", std::vector<ValueType> const& rewards = {});
+
+            /*!
+             * Adds a transition of the current choice.
+             */
+            void addTransition(uint64_t target, ValueType const& value);
+
+            /*!
+             * Checks that the announced number of states and choices have been added and flushes the stream.
+             */
+            void finalize();
+
+        private:
+            void writeRewards(std::vector<ValueType> const& rewards);
+
+            std::ostream& os;
+            storm::models::ModelType type;
+            uint64_t numberOfStates;
+            uint64_t numberOfChoices;
+            uint64_t numberOfRewardModels;
+            uint64_t currentState;
+            uint64_t currentChoice;
+            uint64_t currentChoiceOfState;
+        };
+
         /*!
          * Accumulate parameters in the model.
          *
@@ -114,6 +114,11 @@ namespace storm {
             rpatl.setStepBoundedUntilFormulasAllowed(true);
             rpatl.setTimeBoundedUntilFormulasAllowed(true);
 
+            // Safety LTL objectives.
+            rpatl.setBinaryBooleanPathFormulasAllowed(true);
+            rpatl.setUnaryBooleanPathFormulasAllowed(true);
+            rpatl.setNestedPathFormulasAllowed(true);
+
             return rpatl;
         }
 
@@ -1,5 +1,7 @@
 #include "storm/modelchecker/AbstractModelChecker.h"
 
+#include "storm/modelchecker/StateFormulaCache.h"
+
 #include "storm/modelchecker/results/QualitativeCheckResult.h"
 #include "storm/modelchecker/results/QuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
@@ -29,6 +31,7 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/logic/FormulaInformation.h"
+#include "storm/logic/FragmentSpecification.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/Bdd.h"
 
@@ -227,8 +230,30 @@ namespace storm {
             STORM_LOG_THROW(false, storm::exceptions::NotImplementedException, "This model checker (" << getClassName() << ") does not support the formula: " << checkTask.getFormula() << ".");
         }
 
+        template<typename ModelType>
+        void AbstractModelChecker<ModelType>::setStateFormulaCache(std::shared_ptr<StateFormulaCache> const& cache) {
+            stateFormulaCache = cache;
+        }
+
         template<typename ModelType>
         std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::checkStateFormula(Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
+            storm::logic::StateFormula const& stateFormula = checkTask.getFormula();
+            // Only results that depend on nothing but the formula are cached, i.e. no schedulers or shields.
+            bool cacheable = stateFormulaCache && (stateFormula.isInFragment(storm::logic::propositional()) || (stateFormula.hasQualitativeResult() && !checkTask.isProduceSchedulersSet() && !checkTask.isShieldingTask()));
+            if (!cacheable) {
+                return checkStateFormulaUncached(env, checkTask);
+            }
+            std::string key = stateFormula.toString() + (checkTask.isOnlyInitialStatesRelevantSet() ? " (initial states)" : "");
+            std::unique_ptr<CheckResult> result = stateFormulaCache->get(key);
+            if (!result) {
+                result = checkStateFormulaUncached(env, checkTask);
+                stateFormulaCache->insert(key, *result);
+            }
+            return result;
+        }
+
+        template<typename ModelType>
+        std::unique_ptr<CheckResult> AbstractModelChecker<ModelType>::checkStateFormulaUncached(Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask) {
             storm::logic::StateFormula const& stateFormula = checkTask.getFormula();
             if (stateFormula.isBinaryBooleanStateFormula()) {
                 return this->checkBinaryBooleanStateFormula(env, checkTask.substituteFormula(stateFormula.asBinaryBooleanStateFormula()));
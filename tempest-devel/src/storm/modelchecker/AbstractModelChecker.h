@@ -1,6 +1,7 @@
 #ifndef STORM_MODELCHECKER_ABSTRACTMODELCHECKER_H_
 #define STORM_MODELCHECKER_ABSTRACTMODELCHECKER_H_
 
+#include <memory>
 #include <string>
 #include <boost/optional.hpp>
 
@@ -14,6 +15,7 @@ namespace storm {
 
     namespace modelchecker {
         class CheckResult;
+        class StateFormulaCache;
 
         enum class RewardType { Expectation, Variance };
 
@@ -54,6 +56,13 @@ namespace storm {
              */
             std::unique_ptr<CheckResult> check(CheckTask<storm::logic::Formula, ValueType> const& checkTask);
 
+            /*!
+             * Sets a cache in which the results of qualitative state (sub)formulas are looked up before they are
+             * checked. The cache may be shared among model checkers of the same model, also across threads, as long as
+             * they use the same environment.
+             */
+            void setStateFormulaCache(std::shared_ptr<StateFormulaCache> const& cache);
+
             // The methods to compute probabilities for path formulas.
             virtual std::unique_ptr<CheckResult> computeProbabilities(Environment const& env, CheckTask<storm::logic::Formula, ValueType> const& checkTask);
             virtual std::unique_ptr<CheckResult> computeConditionalProbabilities(Environment const& env, CheckTask<storm::logic::ConditionalFormula, ValueType> const& checkTask);
@@ -101,6 +110,11 @@ namespace storm {
 
             // The methods to check game formulas.
             virtual std::unique_ptr<CheckResult> checkGameFormula(Environment const& env, CheckTask<storm::logic::GameFormula, ValueType> const& checkTask);
+
+        private:
+            std::unique_ptr<CheckResult> checkStateFormulaUncached(Environment const& env, CheckTask<storm::logic::StateFormula, ValueType> const& checkTask);
+
+            std::shared_ptr<StateFormulaCache> stateFormulaCache;
         };
     }
 }
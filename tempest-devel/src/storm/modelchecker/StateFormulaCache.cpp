@@ -0,0 +1,40 @@
+#include "storm/modelchecker/StateFormulaCache.h"
+
+#include "storm/modelchecker/results/CheckResult.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        std::unique_ptr<CheckResult> StateFormulaCache::get(std::string const& key) const {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto it = results.find(key);
+            if (it == results.end()) {
+                return nullptr;
+            }
+            ++numberOfHits;
+            return it->second->clone();
+        }
+
+        void StateFormulaCache::insert(std::string const& key, CheckResult const& result) {
+            std::unique_ptr<CheckResult> copy = result.clone();
+            std::lock_guard<std::mutex> lock(mutex);
+            results.emplace(key, std::move(copy));
+        }
+
+        uint64_t StateFormulaCache::getNumberOfEntries() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return results.size();
+        }
+
+        uint64_t StateFormulaCache::getNumberOfHits() const {
+            std::lock_guard<std::mutex> lock(mutex);
+            return numberOfHits;
+        }
+
+        void StateFormulaCache::clear() {
+            std::lock_guard<std::mutex> lock(mutex);
+            results.clear();
+            numberOfHits = 0;
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace storm {
+    namespace modelchecker {
+        class CheckResult;
+
+        /*!
+         * A thread-safe cache of the results of state formulas (e.g. the satisfaction sets of propositional
+         * subformulas) that model checkers of the same model share, such that checking several properties does not
+         * recompute their common subformulas.
+         *
+         * The cached results are only valid for the model for which they were computed. The keys consist of the
+         * formulas only and do not contain the environment (e.g. the precision of the solvers), so a cache must only
+         * be shared among checks with the same environment.
+         */
+        class StateFormulaCache {
+        public:
+            /*!
+             * Retrieves a copy of the result stored for the given key or a null pointer if there is none.
+             */
+            std::unique_ptr<CheckResult> get(std::string const& key) const;
+
+            /*!
+             * Stores a copy of the given result unless a result for the key is already present.
+             */
+            void insert(std::string const& key, CheckResult const& result);
+
+            uint64_t getNumberOfEntries() const;
+
+            /*!
+             * Retrieves how often a result was found in the cache.
+             */
+            uint64_t getNumberOfHits() const;
+
+            void clear();
+
+        private:
+            mutable std::mutex mutex;
+            std::unordered_map<std::string, std::unique_ptr<CheckResult>> results;
+            mutable uint64_t numberOfHits = 0;
+        };
+    }
+}
@@ -0,0 +1,535 @@
+#include "storm/modelchecker/exploration/SparseSmgExplorationModelChecker.h"
+
+#include <algorithm>
+
+#include "storm/logic/Formulas.h"
+#include "storm/logic/FragmentSpecification.h"
+
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/rpatl/helper/SparseSmgRpatlHelper.h"
+
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/settings/modules/ExplorationSettings.h"
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+
+#include "storm/shields/ShieldHandling.h"
+
+#include "storm/storage/MaximalEndComponentDecomposition.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+
+#include "storm/solver/SolveGoal.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/constants.h"
+
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+
+        template<typename ModelType, typename StateType>
+        SparseSmgExplorationModelChecker<ModelType, StateType>::SparseSmgExplorationModelChecker(storm::prism::Program const& program) : program(program.substituteConstantsFormulas()), generator(this->program), randomGenerator(std::chrono::system_clock::now().time_since_epoch().count()), comparator(storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision()), optimizationDirection(storm::OptimizationDirection::Maximize), initialState(0), numberOfExploredStates(0), numberOfUnexploredStates(0), numberOfSampledPaths(0), numberOfExplorationSteps(0), numberOfBoundUpdates(0), converged(false) {
+            STORM_LOG_THROW(this->program.getModelType() == storm::prism::Program::ModelType::SMG, storm::exceptions::NotSupportedException, "The exploration engine for games requires a program of type " << storm::prism::Program::ModelType::SMG << ".");
+        }
+
+        template<typename ModelType, typename StateType>
+        bool SparseSmgExplorationModelChecker<ModelType, StateType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+            storm::logic::Formula const& formula = checkTask.getFormula();
+            if (!formula.isGameFormula() || !checkTask.isOnlyInitialStatesRelevantSet()) {
+                return false;
+            }
+            storm::logic::Formula const& subformula = formula.asGameFormula().getSubformula();
+            if (!subformula.isProbabilityOperatorFormula()) {
+                return false;
+            }
+            storm::logic::Formula const& pathFormula = subformula.asProbabilityOperatorFormula().getSubformula();
+            storm::logic::FragmentSpecification propositional = storm::logic::propositional();
+            if (pathFormula.isEventuallyFormula()) {
+                return pathFormula.asEventuallyFormula().getSubformula().isInFragment(propositional);
+            } else if (pathFormula.isUntilFormula()) {
+                return pathFormula.asUntilFormula().getLeftSubformula().isInFragment(propositional) && pathFormula.asUntilFormula().getRightSubformula().isInFragment(propositional);
+            }
+            return false;
+        }
+
+        template<typename ModelType, typename StateType>
+        std::unique_ptr<CheckResult> SparseSmgExplorationModelChecker<ModelType, StateType>::checkGameFormula(Environment const& env, CheckTask<storm::logic::GameFormula, ValueType> const& checkTask) {
+            storm::logic::GameFormula const& gameFormula = checkTask.getFormula();
+            STORM_LOG_THROW(gameFormula.getSubformula().isProbabilityOperatorFormula(), storm::exceptions::NotSupportedException, "The exploration engine for games only supports probability operators.");
+            auto probabilityTask = checkTask.substituteFormula(gameFormula.getSubformula().asProbabilityOperatorFormula());
+            STORM_LOG_THROW(probabilityTask.isOptimizationDirectionSet(), storm::exceptions::InvalidPropertyException, "Formula needs to specify whether minimal or maximal values are to be computed on nondeterministic model.");
+            storm::logic::Formula const& pathFormula = probabilityTask.getFormula().getSubformula();
+
+            std::map<std::string, storm::expressions::Expression> labelToExpressionMapping = program.getLabelToExpressionMapping();
+            if (pathFormula.isEventuallyFormula()) {
+                conditionStateExpression = program.getManager().boolean(true);
+                targetStateExpression = pathFormula.asEventuallyFormula().getSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+            } else {
+                STORM_LOG_THROW(pathFormula.isUntilFormula(), storm::exceptions::NotSupportedException, "The exploration engine for games only supports reachability and until formulas.");
+                conditionStateExpression = pathFormula.asUntilFormula().getLeftSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+                targetStateExpression = pathFormula.asUntilFormula().getRightSubformula().toExpression(program.getManager(), labelToExpressionMapping);
+            }
+            optimizationDirection = probabilityTask.getOptimizationDirection();
+
+            // Encode the coalition by the indices of its players.
+            coalitionPlayers = storm::storage::BitVector(program.getNumberOfPlayers(), false);
+            for (auto const& player : gameFormula.getCoalition().getPlayers()) {
+                if (player.type() == typeid(std::string)) {
+                    coalitionPlayers.set(program.getIndexOfPlayer(boost::get<std::string>(player)));
+                } else {
+                    storm::storage::PlayerIndex playerIndex = boost::get<storm::storage::PlayerIndex>(player);
+                    STORM_LOG_THROW(playerIndex < coalitionPlayers.size(), storm::exceptions::InvalidPropertyException, "Unknown player index " << playerIndex << ".");
+                    coalitionPlayers.set(playerIndex);
+                }
+            }
+
+            reset();
+            std::vector<StateType> initialStates = generator.getInitialStates([this] (storm::generator::CompressedState const& state) { return getOrAddState(state); });
+            STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException, "Currently only models with one initial state are supported by the exploration engine.");
+            initialState = initialStates.front();
+
+            uint_fast64_t explorationStepsPerUpdate = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getNumberOfExplorationStepsUntilPrecomputation();
+            while (true) {
+                // Sample paths until enough steps were performed to justify solving the explored fragment.
+                uint64_t explorationStepsBeforeSampling = numberOfExplorationSteps;
+                uint64_t exploredStatesBeforeSampling = numberOfExploredStates;
+                ValueType differenceBeforeSampling = upperBounds[initialState] - lowerBounds[initialState];
+                while (numberOfUnexploredStates > 0 && !isExplorationBudgetExhausted() && numberOfExplorationSteps - explorationStepsBeforeSampling < explorationStepsPerUpdate) {
+                    samplePathFromInitialState();
+                }
+
+                updateBounds(env);
+                ValueType difference = upperBounds[initialState] - lowerBounds[initialState];
+                STORM_LOG_DEBUG("Value of initial state is in [" << lowerBounds[initialState] << ", " << upperBounds[initialState] << "] after exploring " << numberOfExploredStates << " states.");
+                converged = comparator.isZero(difference) || difference < storm::utility::zero<ValueType>();
+                if (converged) {
+                    break;
+                } else if (isExplorationBudgetExhausted()) {
+                    STORM_LOG_WARN("Exploration budget exhausted before the bounds converged, the remaining difference is " << difference << ".");
+                    break;
+                } else if (numberOfExploredStates == exploredStatesBeforeSampling && difference >= differenceBeforeSampling) {
+                    // Further rounds would neither explore new states nor tighten the bounds, as the refinement of the bounds
+                    // is monotone and already continues from the bounds of this round.
+                    STORM_LOG_WARN("The bounds did not converge as neither new states nor tighter bounds were found, the remaining difference is " << difference << ".");
+                    break;
+                }
+            }
+
+            buildExploredModel();
+            if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+                printStatisticsToStream(std::cout);
+            }
+
+            std::unique_ptr<CheckResult> result = std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(initialState, lowerBounds[initialState]);
+            if (checkTask.isShieldingTask()) {
+                // The shield is computed from the lower bounds of the explored fragment, i.e. unexplored states are losing.
+                auto pathTask = probabilityTask.substituteFormula(pathFormula);
+                storm::storage::BitVector expandedStates(states.size(), false);
+                storm::storage::BitVector targetStates(states.size(), false);
+                for (StateType state = 0; state < states.size(); ++state) {
+                    expandedStates.set(state, stateStatus[state] == StateStatus::Expanded);
+                    targetStates.set(state, stateStatus[state] == StateStatus::Target);
+                }
+                storm::storage::BitVector statesOfCoalition = exploredModel->computeStatesOfCoalition(gameFormula.getCoalition());
+                auto ret = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(*exploredModel, pathTask), exploredModel->getTransitionMatrix(), exploredModel->getBackwardTransitions(), expandedStates, targetStates, false, ~statesOfCoalition, false);
+                auto shield = tempest::shields::createShield<ValueType>(exploredModel, std::move(ret.choiceValues), checkTask.getShieldingExpression(), optimizationDirection, expandedStates, statesOfCoalition);
+                result->asExplicitQuantitativeCheckResult<ValueType>().setShield(std::move(shield));
+            }
+
+            if (probabilityTask.isBoundSet()) {
+                return result->asQuantitativeCheckResult<ValueType>().compareAgainstBound(probabilityTask.getBoundComparisonType(), probabilityTask.getBoundThreshold());
+            }
+            return result;
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::setExplorationBudget(uint64_t maximalNumberOfExploredStates) {
+            explorationBudget = maximalNumberOfExploredStates;
+        }
+
+        template<typename ModelType, typename StateType>
+        typename SparseSmgExplorationModelChecker<ModelType, StateType>::ValueType SparseSmgExplorationModelChecker<ModelType, StateType>::getPrecision() const {
+            STORM_LOG_THROW(!states.empty(), storm::exceptions::InvalidOperationException, "No exploration was performed yet.");
+            return std::max(upperBounds[initialState] - lowerBounds[initialState], storm::utility::zero<ValueType>());
+        }
+
+        template<typename ModelType, typename StateType>
+        bool SparseSmgExplorationModelChecker<ModelType, StateType>::hasConverged() const {
+            STORM_LOG_THROW(!states.empty(), storm::exceptions::InvalidOperationException, "No exploration was performed yet.");
+            return converged;
+        }
+
+        template<typename ModelType, typename StateType>
+        uint64_t SparseSmgExplorationModelChecker<ModelType, StateType>::getNumberOfExploredStates() const {
+            return numberOfExploredStates;
+        }
+
+        template<typename ModelType, typename StateType>
+        uint64_t SparseSmgExplorationModelChecker<ModelType, StateType>::getNumberOfDiscoveredStates() const {
+            return states.size();
+        }
+
+        template<typename ModelType, typename StateType>
+        std::shared_ptr<ModelType> const& SparseSmgExplorationModelChecker<ModelType, StateType>::getExploredModel() const {
+            STORM_LOG_THROW(exploredModel, storm::exceptions::InvalidOperationException, "No exploration was performed yet.");
+            return exploredModel;
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::reset() {
+            stateToId = storm::storage::BitVectorHashMap<StateType>(generator.getStateSize());
+            states.clear();
+            stateStatus.clear();
+            statePlayerIndications.clear();
+            stateChoices.clear();
+            lowerBounds.clear();
+            upperBounds.clear();
+            numberOfExploredStates = 0;
+            numberOfUnexploredStates = 0;
+            numberOfSampledPaths = 0;
+            numberOfExplorationSteps = 0;
+            numberOfBoundUpdates = 0;
+            converged = false;
+            exploredModel = nullptr;
+        }
+
+        template<typename ModelType, typename StateType>
+        StateType SparseSmgExplorationModelChecker<ModelType, StateType>::getOrAddState(storm::generator::CompressedState const& state) {
+            StateType newIndex = states.size();
+            StateType actualIndex = stateToId.findOrAdd(state, newIndex);
+            if (actualIndex == newIndex) {
+                states.push_back(state);
+                stateStatus.push_back(StateStatus::Unexplored);
+                statePlayerIndications.push_back(storm::storage::INVALID_PLAYER_INDEX);
+                stateChoices.emplace_back();
+                lowerBounds.push_back(storm::utility::zero<ValueType>());
+                upperBounds.push_back(storm::utility::one<ValueType>());
+                ++numberOfUnexploredStates;
+            }
+            return actualIndex;
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::exploreState(StateType const& state) {
+            ++numberOfExploredStates;
+            --numberOfUnexploredStates;
+            generator.load(states[state]);
+            if (generator.satisfies(targetStateExpression)) {
+                stateStatus[state] = StateStatus::Target;
+                lowerBounds[state] = storm::utility::one<ValueType>();
+                return;
+            } else if (!generator.satisfies(conditionStateExpression)) {
+                stateStatus[state] = StateStatus::Sink;
+                upperBounds[state] = storm::utility::zero<ValueType>();
+                return;
+            }
+
+            storm::generator::StateBehavior<ValueType, StateType> behavior = generator.expand([this] (storm::generator::CompressedState const& successor) { return getOrAddState(successor); });
+            if (behavior.empty()) {
+                // Deadlock states can never reach a target state.
+                stateStatus[state] = StateStatus::Sink;
+                upperBounds[state] = storm::utility::zero<ValueType>();
+                return;
+            }
+
+            // The references into the per-state vectors might have been invalidated while adding successors.
+            stateStatus[state] = StateStatus::Expanded;
+            statePlayerIndications[state] = behavior.getChoices().front().getPlayerIndex();
+            auto& choices = stateChoices[state];
+            choices.reserve(behavior.getNumberOfChoices());
+            for (auto const& choice : behavior) {
+                choices.emplace_back(choice.begin(), choice.end());
+            }
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::samplePathFromInitialState() {
+            ++numberOfSampledPaths;
+            std::vector<StateType> path;
+            StateType currentState = initialState;
+            // Bound the length of a path so that cycles in the explored part do not stall the sampling.
+            for (uint64_t pathLength = 0; pathLength <= states.size(); ++pathLength) {
+                ++numberOfExplorationSteps;
+                if (stateStatus[currentState] == StateStatus::Unexplored) {
+                    if (isExplorationBudgetExhausted()) {
+                        break;
+                    }
+                    exploreState(currentState);
+                }
+                if (stateStatus[currentState] != StateStatus::Expanded) {
+                    break;
+                }
+                path.push_back(currentState);
+
+                uint64_t choice = sampleChoiceOfState(currentState);
+                boost::optional<StateType> successor = sampleSuccessorFromChoice(currentState, choice);
+                if (!successor) {
+                    break;
+                }
+                currentState = successor.get();
+            }
+
+            // Propagate the bounds of the reached states back to the initial state.
+            for (auto stateIt = path.rbegin(); stateIt != path.rend(); ++stateIt) {
+                updateBoundsOfState(*stateIt);
+            }
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::updateBoundsOfState(StateType const& state) {
+            bool maximize = isMaximizingState(state);
+            std::pair<ValueType, ValueType> stateBounds = computeBoundsOfChoice(state, 0);
+            for (uint64_t choice = 1; choice < stateChoices[state].size(); ++choice) {
+                std::pair<ValueType, ValueType> choiceBounds = computeBoundsOfChoice(state, choice);
+                if (maximize) {
+                    stateBounds.first = std::max(stateBounds.first, choiceBounds.first);
+                    stateBounds.second = std::max(stateBounds.second, choiceBounds.second);
+                } else {
+                    stateBounds.first = std::min(stateBounds.first, choiceBounds.first);
+                    stateBounds.second = std::min(stateBounds.second, choiceBounds.second);
+                }
+            }
+            lowerBounds[state] = std::max(lowerBounds[state], stateBounds.first);
+            upperBounds[state] = std::min(upperBounds[state], stateBounds.second);
+        }
+
+        template<typename ModelType, typename StateType>
+        bool SparseSmgExplorationModelChecker<ModelType, StateType>::isMaximizingState(StateType const& state) const {
+            storm::storage::PlayerIndex player = statePlayerIndications[state];
+            bool coalitionState = player < coalitionPlayers.size() && coalitionPlayers.get(player);
+            return coalitionState == (optimizationDirection == storm::OptimizationDirection::Maximize);
+        }
+
+        template<typename ModelType, typename StateType>
+        bool SparseSmgExplorationModelChecker<ModelType, StateType>::isExplorationBudgetExhausted() const {
+            return explorationBudget && numberOfExploredStates >= explorationBudget.get();
+        }
+
+        template<typename ModelType, typename StateType>
+        uint64_t SparseSmgExplorationModelChecker<ModelType, StateType>::sampleChoiceOfState(StateType const& state) const {
+            auto const& choices = stateChoices[state];
+            if (choices.size() == 1) {
+                return 0;
+            }
+
+            // Maximizing states are optimistic and pick the choice with the highest upper bound, minimizing states
+            // pick the choice with the lowest lower bound.
+            bool maximize = isMaximizingState(state);
+            std::vector<uint64_t> bestChoices;
+            ValueType bestValue = storm::utility::zero<ValueType>();
+            for (uint64_t choice = 0; choice < choices.size(); ++choice) {
+                std::pair<ValueType, ValueType> choiceBounds = computeBoundsOfChoice(state, choice);
+                ValueType value = maximize ? choiceBounds.second : choiceBounds.first;
+                if (bestChoices.empty() || (maximize ? value > bestValue : value < bestValue)) {
+                    if (bestChoices.empty() || !comparator.isEqual(value, bestValue)) {
+                        bestChoices.clear();
+                    }
+                    bestValue = value;
+                    bestChoices.push_back(choice);
+                } else if (comparator.isEqual(value, bestValue)) {
+                    bestChoices.push_back(choice);
+                }
+            }
+
+            std::uniform_int_distribution<uint64_t> distribution(0, bestChoices.size() - 1);
+            return bestChoices[distribution(randomGenerator)];
+        }
+
+        template<typename ModelType, typename StateType>
+        boost::optional<StateType> SparseSmgExplorationModelChecker<ModelType, StateType>::sampleSuccessorFromChoice(StateType const& state, uint64_t const& choice) {
+            auto const& row = stateChoices[state][choice];
+            std::vector<ValueType> weights;
+            weights.reserve(row.size());
+            bool positiveWeight = false;
+            for (auto const& entry : row) {
+                weights.push_back(entry.second * (upperBounds[entry.first] - lowerBounds[entry.first]));
+                positiveWeight |= !comparator.isZero(weights.back());
+            }
+            // If the bounds of all successors agree, there is nothing left to learn along this path.
+            if (!positiveWeight) {
+                return boost::none;
+            }
+            std::discrete_distribution<uint64_t> distribution(weights.begin(), weights.end());
+            return row[distribution(randomGenerator)].first;
+        }
+
+        template<typename ModelType, typename StateType>
+        std::pair<typename SparseSmgExplorationModelChecker<ModelType, StateType>::ValueType, typename SparseSmgExplorationModelChecker<ModelType, StateType>::ValueType> SparseSmgExplorationModelChecker<ModelType, StateType>::computeBoundsOfChoice(StateType const& state, uint64_t const& choice) const {
+            std::pair<ValueType, ValueType> result = std::make_pair(storm::utility::zero<ValueType>(), storm::utility::zero<ValueType>());
+            for (auto const& entry : stateChoices[state][choice]) {
+                result.first += entry.second * lowerBounds[entry.first];
+                result.second += entry.second * upperBounds[entry.first];
+            }
+            return result;
+        }
+
+        template<typename ModelType, typename StateType>
+        storm::storage::SparseMatrix<typename SparseSmgExplorationModelChecker<ModelType, StateType>::ValueType> SparseSmgExplorationModelChecker<ModelType, StateType>::buildFragmentMatrix() const {
+            storm::storage::SparseMatrixBuilder<ValueType> builder(0, states.size(), 0, false, true, states.size());
+            uint64_t row = 0;
+            for (StateType state = 0; state < states.size(); ++state) {
+                builder.newRowGroup(row);
+                if (stateStatus[state] == StateStatus::Expanded) {
+                    for (auto const& choice : stateChoices[state]) {
+                        for (auto const& entry : choice) {
+                            builder.addNextValue(row, entry.first, entry.second);
+                        }
+                        ++row;
+                    }
+                } else {
+                    // All other states are made absorbing, their values are determined by the state status.
+                    builder.addNextValue(row, state, storm::utility::one<ValueType>());
+                    ++row;
+                }
+            }
+            return builder.build();
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::updateBounds(Environment const& env) {
+            ++numberOfBoundUpdates;
+            storm::storage::SparseMatrix<ValueType> matrix = buildFragmentMatrix();
+            storm::storage::SparseMatrix<ValueType> backwardTransitions = matrix.transpose(true);
+
+            storm::storage::BitVector expandedStates(states.size(), false);
+            storm::storage::BitVector targetStates(states.size(), false);
+            // The game helpers expect the states that do not belong to the coalition.
+            storm::storage::BitVector otherStates(states.size(), true);
+            for (StateType state = 0; state < states.size(); ++state) {
+                expandedStates.set(state, stateStatus[state] == StateStatus::Expanded);
+                targetStates.set(state, stateStatus[state] == StateStatus::Target);
+                storm::storage::PlayerIndex player = statePlayerIndications[state];
+                if (player < coalitionPlayers.size() && coalitionPlayers.get(player)) {
+                    otherStates.set(state, false);
+                }
+            }
+
+            // Unexplored states are losing for the lower bound. The value iteration approaches the values from below, so
+            // its result is sound. As the fragment only grows, we keep the tightest bounds seen so far.
+            auto lower = storm::modelchecker::helper::SparseSmgRpatlHelper<ValueType>::computeUntilProbabilities(env, storm::solver::SolveGoal<ValueType>(optimizationDirection), matrix, backwardTransitions, expandedStates, targetStates, false, otherStates, false);
+            for (StateType state = 0; state < states.size(); ++state) {
+                lowerBounds[state] = std::max(lowerBounds[state], lower.values[state]);
+            }
+            refineUpperBounds(env, matrix, backwardTransitions, expandedStates);
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::refineUpperBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& expandedStates) {
+            // The upper bounds are at least the actual values (unexplored states are winning), so they remain sound under
+            // Bellman updates. In end components, the updates alone may get stuck above the actual values.
+            ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
+            uint64_t maximalNumberOfIterations = env.solver().game().getMaximalNumberOfIterations();
+            for (uint64_t iteration = 0; iteration < maximalNumberOfIterations; ++iteration) {
+                ValueType maximalDecrease = storm::utility::zero<ValueType>();
+                for (auto state : expandedStates) {
+                    ValueType previousUpperBound = upperBounds[state];
+                    updateBoundsOfState(state);
+                    maximalDecrease = std::max(maximalDecrease, previousUpperBound - upperBounds[state]);
+                }
+                if (maximalDecrease <= precision && !deflateUpperBounds(matrix, backwardTransitions, expandedStates, precision)) {
+                    break;
+                }
+            }
+        }
+
+        template<typename ModelType, typename StateType>
+        bool SparseSmgExplorationModelChecker<ModelType, StateType>::deflateUpperBounds(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& expandedStates, ValueType const& precision) {
+            // The minimizing player is restricted to the choices that are optimal with respect to the lower bounds. Within
+            // an end component of the restricted game, staying forever is losing, so the maximizing player can at best
+            // achieve the upper bound of a choice that leaves the end component.
+            auto const& rowGroupIndices = matrix.getRowGroupIndices();
+            storm::storage::BitVector allowedChoices(matrix.getRowCount(), true);
+            for (auto state : expandedStates) {
+                if (isMaximizingState(state)) {
+                    continue;
+                }
+                std::vector<ValueType> choiceLowerBounds;
+                for (uint64_t choice = 0; choice < stateChoices[state].size(); ++choice) {
+                    choiceLowerBounds.push_back(computeBoundsOfChoice(state, choice).first);
+                }
+                ValueType optimalLowerBound = *std::min_element(choiceLowerBounds.begin(), choiceLowerBounds.end());
+                for (uint64_t choice = 0; choice < choiceLowerBounds.size(); ++choice) {
+                    allowedChoices.set(rowGroupIndices[state] + choice, comparator.isEqual(choiceLowerBounds[choice], optimalLowerBound));
+                }
+            }
+
+            bool significantDecrease = false;
+            storm::storage::MaximalEndComponentDecomposition<ValueType> endComponents(matrix, backwardTransitions, expandedStates, allowedChoices);
+            for (auto const& endComponent : endComponents) {
+                ValueType bestExitValue = storm::utility::zero<ValueType>();
+                for (auto const& stateAndChoices : endComponent) {
+                    StateType state = stateAndChoices.first;
+                    if (!isMaximizingState(state)) {
+                        continue;
+                    }
+                    for (uint64_t choice = 0; choice < stateChoices[state].size(); ++choice) {
+                        if (!endComponent.containsChoice(state, rowGroupIndices[state] + choice)) {
+                            bestExitValue = std::max(bestExitValue, computeBoundsOfChoice(state, choice).second);
+                        }
+                    }
+                }
+                for (auto const& stateAndChoices : endComponent) {
+                    ValueType& upperBound = upperBounds[stateAndChoices.first];
+                    if (upperBound > bestExitValue) {
+                        significantDecrease |= upperBound - bestExitValue > precision;
+                        upperBound = bestExitValue;
+                    }
+                }
+            }
+            return significantDecrease;
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::buildExploredModel() {
+            storm::models::sparse::StateLabeling labeling(states.size());
+            storm::storage::BitVector initialStates(states.size(), false);
+            initialStates.set(initialState);
+            labeling.addLabel("init", std::move(initialStates));
+            storm::storage::BitVector targetStates(states.size(), false);
+            storm::storage::BitVector unexploredStates(states.size(), false);
+            for (StateType state = 0; state < states.size(); ++state) {
+                targetStates.set(state, stateStatus[state] == StateStatus::Target);
+                unexploredStates.set(state, stateStatus[state] == StateStatus::Unexplored);
+            }
+            labeling.addLabel("target", std::move(targetStates));
+            labeling.addLabel("unexplored", std::move(unexploredStates));
+
+            storm::storage::sparse::ModelComponents<ValueType> components(buildFragmentMatrix(), std::move(labeling));
+            components.statePlayerIndications = statePlayerIndications;
+            components.playerNameToIndexMap = program.getPlayerNameToIndexMapping();
+
+            storm::storage::sparse::StateValuationsBuilder valuationsBuilder = generator.initializeStateValuationsBuilder();
+            for (StateType state = 0; state < states.size(); ++state) {
+                generator.load(states[state]);
+                generator.addStateValuation(state, valuationsBuilder);
+            }
+            components.stateValuations = valuationsBuilder.build(states.size());
+
+            exploredModel = std::make_shared<ModelType>(std::move(components));
+        }
+
+        template<typename ModelType, typename StateType>
+        void SparseSmgExplorationModelChecker<ModelType, StateType>::printStatisticsToStream(std::ostream& out) const {
+            uint64_t numberOfTargetStates = std::count(stateStatus.begin(), stateStatus.end(), StateStatus::Target);
+            out << std::endl << "Exploration statistics:" << std::endl;
+            out << "Discovered states: " << states.size() << " (" << numberOfExploredStates << " explored, " << numberOfUnexploredStates << " unexplored, " << numberOfTargetStates << " target)" << std::endl;
+            out << "Exploration steps: " << numberOfExplorationSteps << std::endl;
+            out << "Sampled paths: " << numberOfSampledPaths << std::endl;
+            out << "Bound updates: " << numberOfBoundUpdates << std::endl;
+            out << "Value of initial state: [" << lowerBounds[initialState] << ", " << upperBounds[initialState] << "]" << std::endl;
+        }
+
+        template class SparseSmgExplorationModelChecker<storm::models::sparse::Smg<double>, uint32_t>;
+    }
+}
@@ -0,0 +1,142 @@
+#ifndef STORM_MODELCHECKER_EXPLORATION_SPARSESMGEXPLORATIONMODELCHECKER_H_
+#define STORM_MODELCHECKER_EXPLORATION_SPARSESMGEXPLORATIONMODELCHECKER_H_
+
+#include <random>
+
+#include <boost/optional.hpp>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+
+#include "storm/storage/prism/Program.h"
+#include "storm/storage/PlayerIndex.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+
+#include "storm/utility/ConstantsComparator.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace modelchecker {
+
+        /*!
+         * Checks reachability objectives on stochastic games that are given as PRISM programs without building the
+         * full game. The states are generated lazily while paths are sampled from the initial state: the coalition
+         * picks choices with the most optimistic bound, its opponents the most pessimistic one and successors are
+         * chosen according to their probability weighted with the gap between their bounds. Periodically, the bounds
+         * of the explored fragment are refined. The lower bounds are computed by the game value iteration treating the
+         * unexplored states as losing. As this iteration approaches the values from below, the upper bounds are instead
+         * obtained by Bellman updates starting from the previous upper bounds (one for unexplored states). End components
+         * in which the maximizing player could stay forever are deflated to the best value of leaving them, as otherwise
+         * the upper bounds would not converge. The exploration stops as soon as the bounds for the initial state are
+         * closer than the precision of the exploration settings, the exploration budget is exhausted or neither new
+         * states nor tighter bounds are found.
+         *
+         * If a shield is requested, it is computed from the lower bounds and attached to the result. Its states are the
+         * states of the explored fragment, which is available as a game via getExploredModel.
+         */
+        template<typename ModelType, typename StateType = uint32_t>
+        class SparseSmgExplorationModelChecker : public AbstractModelChecker<ModelType> {
+        public:
+            typedef typename ModelType::ValueType ValueType;
+            typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+
+            SparseSmgExplorationModelChecker(storm::prism::Program const& program);
+
+            virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+            virtual std::unique_ptr<CheckResult> checkGameFormula(Environment const& env, CheckTask<storm::logic::GameFormula, ValueType> const& checkTask) override;
+
+            /*!
+             * Limits the number of states that are explored. Once the limit is reached, the bounds of the explored
+             * fragment are returned even if they did not yet converge.
+             */
+            void setExplorationBudget(uint64_t maximalNumberOfExploredStates);
+
+            /*!
+             * Retrieves the difference between the upper and the lower bound for the initial state after the most
+             * recent call. The returned result is the lower bound.
+             */
+            ValueType getPrecision() const;
+
+            /*!
+             * Retrieves whether the bounds for the initial state converged in the most recent call, i.e. whether their
+             * difference is within the precision of the exploration settings.
+             */
+            bool hasConverged() const;
+
+            uint64_t getNumberOfExploredStates() const;
+            uint64_t getNumberOfDiscoveredStates() const;
+
+            /*!
+             * Retrieves the explored fragment of the most recent call. Unexplored states are absorbing and labelled
+             * with "unexplored".
+             */
+            std::shared_ptr<ModelType> const& getExploredModel() const;
+
+        private:
+            enum class StateStatus { Unexplored, Expanded, Target, Sink };
+
+            void reset();
+            StateType getOrAddState(storm::generator::CompressedState const& state);
+            void exploreState(StateType const& state);
+            void samplePathFromInitialState();
+            void updateBoundsOfState(StateType const& state);
+            bool isMaximizingState(StateType const& state) const;
+            bool isExplorationBudgetExhausted() const;
+            uint64_t sampleChoiceOfState(StateType const& state) const;
+            boost::optional<StateType> sampleSuccessorFromChoice(StateType const& state, uint64_t const& choice);
+            std::pair<ValueType, ValueType> computeBoundsOfChoice(StateType const& state, uint64_t const& choice) const;
+            storm::storage::SparseMatrix<ValueType> buildFragmentMatrix() const;
+            void updateBounds(Environment const& env);
+            void refineUpperBounds(Environment const& env, storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& expandedStates);
+            bool deflateUpperBounds(storm::storage::SparseMatrix<ValueType> const& matrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& expandedStates, ValueType const& precision);
+            void buildExploredModel();
+            void printStatisticsToStream(std::ostream& out) const;
+
+            // The program that defines the game to check.
+            storm::prism::Program program;
+
+            // The generator used for the lazy exploration.
+            storm::generator::PrismNextStateGenerator<ValueType, StateType> generator;
+
+            // The random number generator.
+            mutable std::default_random_engine randomGenerator;
+
+            // A comparator used to determine whether the bounds converged.
+            storm::utility::ConstantsComparator<ValueType> comparator;
+
+            boost::optional<uint64_t> explorationBudget;
+
+            // The data of the most recent exploration.
+            storm::expressions::Expression conditionStateExpression;
+            storm::expressions::Expression targetStateExpression;
+            storm::storage::BitVector coalitionPlayers;
+            storm::OptimizationDirection optimizationDirection;
+
+            storm::storage::BitVectorHashMap<StateType> stateToId;
+            std::vector<storm::generator::CompressedState> states;
+            std::vector<StateStatus> stateStatus;
+            std::vector<storm::storage::PlayerIndex> statePlayerIndications;
+            std::vector<std::vector<std::vector<std::pair<StateType, ValueType>>>> stateChoices;
+            std::vector<ValueType> lowerBounds;
+            std::vector<ValueType> upperBounds;
+            StateType initialState;
+
+            uint64_t numberOfExploredStates;
+            uint64_t numberOfUnexploredStates;
+            uint64_t numberOfSampledPaths;
+            uint64_t numberOfExplorationSteps;
+            uint64_t numberOfBoundUpdates;
+            bool converged;
+
+            std::shared_ptr<ModelType> exploredModel;
+        };
+    }
+}
+
+#endif /* STORM_MODELCHECKER_EXPLORATION_SPARSESMGEXPLORATIONMODELCHECKER_H_ */
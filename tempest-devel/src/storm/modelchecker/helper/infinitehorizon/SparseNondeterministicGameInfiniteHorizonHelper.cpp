@@ -61,14 +61,13 @@ namespace storm {
 
             template <typename ValueType>
             void SparseNondeterministicGameInfiniteHorizonHelper<ValueType>::createDecomposition() {
-                // TODO This needs to be changed to return the whole model as one component as long as there is no overwritten version of MaximalEndComponentDecomposition for SMGs.
                 if (this->_longRunComponentDecomposition == nullptr) {
                     // The decomposition has not been provided or computed, yet.
-                    if (this->_backwardTransitions == nullptr) {
-                        this->_computedBackwardTransitions = std::make_unique<storm::storage::SparseMatrix<ValueType>>(this->_transitionMatrix.transpose(true));
-                        this->_backwardTransitions = this->_computedBackwardTransitions.get();
-                    }
-                    this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::GameMaximalEndComponentDecomposition<ValueType>>(this->_transitionMatrix, *this->_backwardTransitions);
+                    // In a game, a player may stay forever in a set of states that the other player could leave. Hence, the long
+                    // run average values are not determined by the game MECs, i.e., the sets that no player can leave, and the
+                    // values reached from them. As there is no stochastic shortest path game either, the whole game is
+                    // solved as one component.
+                    this->_computedLongRunComponentDecomposition = std::make_unique<storm::storage::GameMaximalEndComponentDecomposition<ValueType>>(storm::storage::GameMaximalEndComponentDecomposition<ValueType>::wholeStateSpace(this->_transitionMatrix));
 
                     this->_longRunComponentDecomposition = this->_computedLongRunComponentDecomposition.get();
                 }
@@ -0,0 +1,211 @@
+#include "storm/modelchecker/rpatl/helper/SparseSmgLtlHelper.h"
+
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <boost/functional/hash.hpp>
+
+#include "storm/automata/SafetyAutomaton.h"
+#include "storm/logic/ExtractMaximalStateFormulasVisitor.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/rpatl/helper/SparseSmgRpatlHelper.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/shields/PreShield.h"
+#include "storm/solver/SolveGoal.h"
+#include "storm/storage/sparse/ModelComponents.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace modelchecker {
+        namespace helper {
+
+            template<typename ValueType>
+            SparseSmgLtlHelper<ValueType>::SparseSmgLtlHelper(storm::models::sparse::Smg<ValueType> const& model, storm::storage::BitVector const& statesOfCoalition) : model(model), statesOfCoalition(statesOfCoalition), numberOfProductStates(0) {
+                // Intentionally left empty.
+            }
+
+            template<typename ValueType>
+            std::vector<ValueType> SparseSmgLtlHelper<ValueType>::computeLtlProbabilities(Environment const& env, CheckTask<storm::logic::PathFormula, ValueType> const& checkTask, CheckFormulaCallback const& formulaChecker) {
+                STORM_LOG_THROW(!checkTask.isShieldingTask() || checkTask.getShieldingExpression()->isPreSafetyShield(), storm::exceptions::NotSupportedException, "Only pre-safety shields are supported for LTL objectives.");
+                uint64_t const numberOfStates = model.getNumberOfStates();
+
+                // Replace the state subformulas by atomic propositions and compute the letter of each state.
+                storm::logic::ExtractMaximalStateFormulasVisitor::ApToFormulaMap extracted;
+                std::shared_ptr<storm::logic::Formula> ltlFormula = storm::logic::ExtractMaximalStateFormulasVisitor::extract(checkTask.getFormula(), extracted);
+                STORM_LOG_INFO("Extracted LTL formula " << *ltlFormula << " with " << extracted.size() << " atomic propositions.");
+                storm::automata::APSet apSet;
+                std::vector<storm::automata::APSet::alphabet_element> letters(numberOfStates, apSet.elementAllFalse());
+                for (auto const& apAndFormula : extracted) {
+                    apSet.add(apAndFormula.first);
+                    storm::storage::BitVector apStates = formulaChecker(*apAndFormula.second);
+                    for (auto const& state : apStates) {
+                        letters[state] = apSet.elementAddAP(letters[state], apSet.getIndex(apAndFormula.first));
+                    }
+                }
+                storm::automata::SafetyAutomaton automaton(*ltlFormula, apSet);
+
+                // The monitor only distinguishes the letters that actually occur.
+                std::map<storm::automata::APSet::alphabet_element, uint64_t> letterToIndex;
+                std::vector<storm::automata::APSet::alphabet_element> indexToLetter;
+                std::vector<uint64_t> letterOfState(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    auto insertionResult = letterToIndex.emplace(letters[state], indexToLetter.size());
+                    if (insertionResult.second) {
+                        indexToLetter.push_back(letters[state]);
+                    }
+                    letterOfState[state] = insertionResult.first->second;
+                }
+                uint64_t const numberOfLetters = indexToLetter.size();
+                std::vector<uint64_t> monitorTransitions;
+                auto getAutomatonSuccessor = [&] (uint64_t automatonState, uint64_t modelState) {
+                    uint64_t letter = letterOfState[modelState];
+                    uint64_t successor = automaton.getSuccessor(automatonState, indexToLetter[letter]);
+                    monitorTransitions.resize(automaton.getNumberOfStates() * numberOfLetters, tempest::shields::SafetyMonitor::INVALID_STATE);
+                    monitorTransitions[automatonState * numberOfLetters + letter] = successor;
+                    return successor;
+                };
+
+                // Product states 0 and 1 are the sinks for violated and satisfied formulas, respectively.
+                uint64_t const violatedSink = 0;
+                uint64_t const satisfiedSink = 1;
+                std::vector<std::pair<uint64_t, uint64_t>> productStates = {{0, 0}, {0, 0}};
+                std::unordered_map<std::pair<uint64_t, uint64_t>, uint64_t, boost::hash<std::pair<uint64_t, uint64_t>>> productStateToIndex;
+                auto getOrAddProductState = [&] (uint64_t modelState, uint64_t automatonState) {
+                    if (automaton.isRejecting(automatonState)) {
+                        return violatedSink;
+                    } else if (automaton.isAccepting(automatonState)) {
+                        return satisfiedSink;
+                    }
+                    auto insertionResult = productStateToIndex.emplace(std::make_pair(modelState, automatonState), productStates.size());
+                    if (insertionResult.second) {
+                        productStates.emplace_back(modelState, automatonState);
+                    }
+                    return insertionResult.first->second;
+                };
+
+                storm::storage::BitVector seedStates = checkTask.isOnlyInitialStatesRelevantSet() ? model.getInitialStates() : storm::storage::BitVector(numberOfStates, true);
+                std::vector<uint64_t> productStateOfSeed(numberOfStates, 0);
+                for (auto const& state : seedStates) {
+                    productStateOfSeed[state] = getOrAddProductState(state, getAutomatonSuccessor(automaton.getInitialState(), state));
+                }
+
+                // Explore the product in breadth-first order. The choices of a product state are exactly the choices of its game state.
+                storm::storage::SparseMatrix<ValueType> const& transitionMatrix = model.getTransitionMatrix();
+                storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true, 0);
+                uint64_t currentRow = 0;
+                for (uint64_t sink = 0; sink < 2; ++sink) {
+                    builder.newRowGroup(currentRow);
+                    builder.addNextValue(currentRow, sink, storm::utility::one<ValueType>());
+                    ++currentRow;
+                }
+                std::vector<std::pair<uint64_t, ValueType>> rowEntries;
+                for (uint64_t productState = 2; productState < productStates.size(); ++productState) {
+                    uint64_t const modelState = productStates[productState].first;
+                    uint64_t const automatonState = productStates[productState].second;
+                    builder.newRowGroup(currentRow);
+                    for (uint64_t row = transitionMatrix.getRowGroupIndices()[modelState]; row < transitionMatrix.getRowGroupIndices()[modelState + 1]; ++row, ++currentRow) {
+                        rowEntries.clear();
+                        for (auto const& entry : transitionMatrix.getRow(row)) {
+                            rowEntries.emplace_back(getOrAddProductState(entry.getColumn(), getAutomatonSuccessor(automatonState, entry.getColumn())), entry.getValue());
+                        }
+                        std::sort(rowEntries.begin(), rowEntries.end(), [] (std::pair<uint64_t, ValueType> const& first, std::pair<uint64_t, ValueType> const& second) { return first.first < second.first; });
+                        // Several successors might be collapsed into the same sink.
+                        for (auto entryIt = rowEntries.begin(); entryIt != rowEntries.end();) {
+                            uint64_t column = entryIt->first;
+                            ValueType value = entryIt->second;
+                            for (++entryIt; entryIt != rowEntries.end() && entryIt->first == column; ++entryIt) {
+                                value += entryIt->second;
+                            }
+                            builder.addNextValue(currentRow, column, value);
+                        }
+                    }
+                }
+                numberOfProductStates = productStates.size();
+                STORM_LOG_INFO("Built product of game and safety automaton with " << numberOfProductStates << " states and " << automaton.getNumberOfStates() << " automaton states.");
+
+                // Assemble the product game.
+                storm::models::sparse::StateLabeling productLabeling(numberOfProductStates);
+                storm::storage::BitVector productInitialStates(numberOfProductStates, false);
+                for (auto const& state : seedStates) {
+                    productInitialStates.set(productStateOfSeed[state]);
+                }
+                productLabeling.addLabel("init", std::move(productInitialStates));
+                storm::storage::BitVector badStates(numberOfProductStates, false);
+                badStates.set(violatedSink);
+                productLabeling.addLabel("bad", std::move(badStates));
+                std::vector<storm::storage::PlayerIndex> productPlayers(numberOfProductStates, storm::storage::INVALID_PLAYER_INDEX);
+                storm::storage::BitVector productStatesOfCoalition(numberOfProductStates, true);
+                for (uint64_t productState = 2; productState < numberOfProductStates; ++productState) {
+                    productPlayers[productState] = model.getPlayerOfState(productStates[productState].first);
+                    productStatesOfCoalition.set(productState, statesOfCoalition.get(productStates[productState].first));
+                }
+                storm::storage::sparse::ModelComponents<ValueType> components(builder.build(currentRow, numberOfProductStates, numberOfProductStates), std::move(productLabeling));
+                components.statePlayerIndications = std::move(productPlayers);
+                components.playerNameToIndexMap = model.getPlayerNameToIndexMap();
+                storm::models::sparse::Smg<ValueType> product(std::move(components));
+
+                // Solve the safety objective on the product.
+                storm::storage::BitVector notViolatedStates(numberOfProductStates, true);
+                notViolatedStates.set(violatedSink, false);
+                auto ret = SparseSmgRpatlHelper<ValueType>::computeGloballyProbabilities(env, storm::solver::SolveGoal<ValueType>(product, checkTask), product.getTransitionMatrix(), product.getBackwardTransitions(), notViolatedStates, checkTask.isQualitativeSet(), productStatesOfCoalition, false);
+
+                std::vector<ValueType> result(numberOfStates, storm::utility::zero<ValueType>());
+                for (auto const& state : seedStates) {
+                    result[state] = ret.values[productStateOfSeed[state]];
+                }
+
+                if (checkTask.isShieldingTask()) {
+                    tempest::shields::PreShield<ValueType, IndexType> productPreShield(product.getTransitionMatrix().getRowGroupIndices(), ret.choiceValues, checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), storm::storage::BitVector(numberOfProductStates, true), productStatesOfCoalition);
+                    storm::storage::PreScheduler<ValueType> productShield = productPreShield.construct();
+
+                    // Index the product states by their game state and automaton state.
+                    std::vector<uint64_t> productStateStarts(numberOfStates + 1, 0);
+                    for (uint64_t productState = 2; productState < numberOfProductStates; ++productState) {
+                        ++productStateStarts[productStates[productState].first + 1];
+                    }
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        productStateStarts[state + 1] += productStateStarts[state];
+                    }
+                    std::vector<std::pair<uint64_t, uint64_t>> automatonAndProductStates(numberOfProductStates - 2);
+                    std::vector<uint64_t> nextEntry(productStateStarts.begin(), productStateStarts.end() - 1);
+                    for (uint64_t productState = 2; productState < numberOfProductStates; ++productState) {
+                        automatonAndProductStates[nextEntry[productStates[productState].first]++] = std::make_pair(productStates[productState].second, productState);
+                    }
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        std::sort(automatonAndProductStates.begin() + productStateStarts[state], automatonAndProductStates.begin() + productStateStarts[state + 1]);
+                    }
+
+                    storm::storage::BitVector violatingStates(automaton.getNumberOfStates(), false);
+                    storm::storage::BitVector satisfyingStates(automaton.getNumberOfStates(), false);
+                    for (uint64_t automatonState = 0; automatonState < automaton.getNumberOfStates(); ++automatonState) {
+                        violatingStates.set(automatonState, automaton.isRejecting(automatonState));
+                        satisfyingStates.set(automatonState, automaton.isAccepting(automatonState));
+                    }
+                    monitorTransitions.resize(automaton.getNumberOfStates() * numberOfLetters, tempest::shields::SafetyMonitor::INVALID_STATE);
+                    tempest::shields::SafetyMonitor monitor(automaton.getInitialState(), std::move(letterOfState), numberOfLetters, std::move(monitorTransitions), std::move(violatingStates), std::move(satisfyingStates));
+
+                    shield = std::make_unique<tempest::shields::SafetyLtlShield<ValueType, IndexType>>(transitionMatrix.getRowGroupIndices(), checkTask.getShieldingExpression(), checkTask.getOptimizationDirection(), storm::storage::BitVector(numberOfStates, true), statesOfCoalition, monitor, productStateStarts, automatonAndProductStates, productShield);
+                }
+                return result;
+            }
+
+            template<typename ValueType>
+            std::unique_ptr<tempest::shields::SafetyLtlShield<ValueType, typename SparseSmgLtlHelper<ValueType>::IndexType>> SparseSmgLtlHelper<ValueType>::extractShield() {
+                STORM_LOG_ASSERT(shield, "No shield has been computed.");
+                return std::move(shield);
+            }
+
+            template<typename ValueType>
+            uint64_t SparseSmgLtlHelper<ValueType>::getNumberOfProductStates() const {
+                return numberOfProductStates;
+            }
+
+            template class SparseSmgLtlHelper<double>;
+#ifdef STORM_HAVE_CARL
+            template class SparseSmgLtlHelper<storm::RationalNumber>;
+#endif
+        }
+    }
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storm/modelchecker/CheckTask.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/shields/SafetyLtlShield.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/PreScheduler.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace logic {
+        class Formula;
+        class PathFormula;
+    }
+
+    namespace modelchecker {
+        namespace helper {
+
+            /*!
+             * Helper class for checking safety LTL objectives on games.
+             *
+             * The game is multiplied on-the-fly with a (lazily explored) deterministic automaton of the formula, starting
+             * from the relevant states of the game. Product states in which the formula is decided are collapsed into
+             * two absorbing sinks, so that the objective becomes a safety objective on the product that is solved with
+             * the usual game value iteration. If a shield is requested, it is computed on the product and projected back
+             * to the game together with a monitor that tracks the automaton state.
+             */
+            template<typename ValueType>
+            class SparseSmgLtlHelper {
+            public:
+                typedef std::function<storm::storage::BitVector(storm::logic::Formula const&)> CheckFormulaCallback;
+                typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+
+                /*!
+                 * Initializes the helper.
+                 *
+                 * @param model The game.
+                 * @param statesOfCoalition The states that do not belong to the coalition (as used by the game helpers).
+                 */
+                SparseSmgLtlHelper(storm::models::sparse::Smg<ValueType> const& model, storm::storage::BitVector const& statesOfCoalition);
+
+                /*!
+                 * Computes the optimal probabilities to satisfy the given formula.
+                 *
+                 * @param checkTask The task for the (possibly nested) path formula.
+                 * @param formulaChecker Evaluates the maximal state subformulas of the formula.
+                 * @return The value for each state. If only the initial states are relevant, the other values are zero.
+                 */
+                std::vector<ValueType> computeLtlProbabilities(Environment const& env, CheckTask<storm::logic::PathFormula, ValueType> const& checkTask, CheckFormulaCallback const& formulaChecker);
+
+                /*!
+                 * @pre before calling this, a computation call for a shielding task should have been performed.
+                 * @return The shield of the most recent call, projected to the game.
+                 */
+                std::unique_ptr<tempest::shields::SafetyLtlShield<ValueType, IndexType>> extractShield();
+
+                /*!
+                 * Retrieves the number of states of the product built in the most recent call.
+                 */
+                uint64_t getNumberOfProductStates() const;
+
+            private:
+                storm::models::sparse::Smg<ValueType> const& model;
+                storm::storage::BitVector statesOfCoalition;
+
+                uint64_t numberOfProductStates;
+                std::unique_ptr<tempest::shields::SafetyLtlShield<ValueType, IndexType>> shield;
+            };
+        }
+    }
+}
@@ -9,21 +9,38 @@
 #include "storm/utility/vector.h"
 #include "storm/utility/graph.h"
 #include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+#include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/solver/TerminationCondition.h"
+#include "storm/logic/ShieldExpression.h"
 
 namespace storm {
     namespace modelchecker {
         namespace helper {
 
             template<typename ValueType>
-            SMGSparseModelCheckingHelperReturnType<ValueType> SparseSmgRpatlHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::storage::BitVector statesOfCoalition, bool produceScheduler, ModelCheckerHint const& hint) {
+            SMGSparseModelCheckingHelperReturnType<ValueType> SparseSmgRpatlHelper<ValueType>::computeUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates, bool qualitative, storm::storage::BitVector statesOfCoalition, bool produceScheduler, ModelCheckerHint const& hint, bool complementedChoiceValues) {
                 auto solverEnv = env;
                 solverEnv.solver().minMax().setMethod(storm::solver::MinMaxMethod::ValueIteration, false);
 
                 // Relevant states are those states which are phiStates and not PsiStates.
                 storm::storage::BitVector relevantStates = phiStates & ~psiStates;
+                // The shield termination condition treats the iterates as lower bounds, so it requires value iteration to start from zero.
+                bool useShieldTermination = goal.isShieldingTask() && goal.getShieldingExpression() && env.solver().game().isShieldTerminationSet();
+                bool useResultHint = false;
+                if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
+                    // The hint's maybe states are the relevant states that can reach a psi state. All other relevant states have value zero.
+                    auto const& explicitHint = hint.template asExplicitModelCheckerHint<ValueType>();
+                    STORM_LOG_ASSERT(explicitHint.hasMaybeStates() && explicitHint.getMaybeStates().isSubsetOf(relevantStates), "The maybe states of the hint are not a subset of the relevant states.");
+                    relevantStates = explicitHint.getMaybeStates();
+                    // Without end components, the fixpoint is unique and value iteration may start from the previous result.
+                    useResultHint = explicitHint.hasResultHint() && explicitHint.getNoEndComponentsInMaybeStates() && !useShieldTermination;
+                }
 
                 // Initialize the x vector and solution vector result.
                 std::vector<ValueType> x = std::vector<ValueType>(relevantStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
+                if (useResultHint) {
+                    storm::utility::vector::selectVectorValues(x, relevantStates, hint.template asExplicitModelCheckerHint<ValueType>().getResultHint());
+                }
                 std::vector<ValueType> result = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
                 std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(relevantStates, psiStates);
                 std::vector<ValueType> constrainedChoiceValues = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
@@ -40,6 +57,9 @@ namespace storm {
                     if (produceScheduler) {
                         viHelper.setProduceScheduler(true);
                     }
+                    if (useShieldTermination) {
+                        viHelper.setShieldTerminationCondition(createShieldTerminationCondition(goal, submatrix.getRowGroupIndices(), complementedChoiceValues));
+                    }
                     viHelper.performValueIteration(env, x, b, goal.direction(), constrainedChoiceValues);
                     if(goal.isShieldingTask()) {
                         viHelper.getChoiceValues(env, x, constrainedChoiceValues);
@@ -49,7 +69,7 @@ namespace storm {
                     viHelper.fillChoiceValuesVector(constrainedChoiceValues, relevantStates, transitionMatrix.getRowGroupIndices());
 
                     if (produceScheduler) {
-                        scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(expandScheduler(viHelper.extractScheduler(), psiStates, ~phiStates));
+                        scheduler = std::make_unique<storm::storage::Scheduler<ValueType>>(expandScheduler(viHelper.extractScheduler(), psiStates, ~relevantStates));
                     }
                 }
 
@@ -59,6 +79,18 @@ namespace storm {
                 return SMGSparseModelCheckingHelperReturnType<ValueType>(std::move(result), std::move(relevantStates), std::move(scheduler), std::move(constrainedChoiceValues));
             }
 
+            template<typename ValueType>
+            std::unique_ptr<storm::solver::TerminateIfShieldDecisionsFixed<ValueType>> SparseSmgRpatlHelper<ValueType>::createShieldTerminationCondition(storm::solver::SolveGoal<ValueType> const& goal, std::vector<uint_fast64_t> const& rowGroupIndices, bool complementedChoiceValues) {
+                // The shields compare the choice values according to the direction of the check task, see tempest::shields::utility::ChoiceFilter.
+                storm::logic::ShieldExpression const& shieldingExpression = *goal.getShieldingExpression();
+                bool maximize = goal.direction() == storm::OptimizationDirection::Maximize;
+                bool requireOptimalChoice = !shieldingExpression.isPreSafetyShield();
+                // Optimal shields always fall back to the choice with the maximal value.
+                bool optimalChoiceIsMaximal = maximize || shieldingExpression.isOptimalShield();
+                std::vector<uint64_t> indices(rowGroupIndices.begin(), rowGroupIndices.end());
+                return std::make_unique<storm::solver::TerminateIfShieldDecisionsFixed<ValueType>>(indices, maximize, shieldingExpression.isRelative(), storm::utility::convertNumber<ValueType>(shieldingExpression.getValue()), requireOptimalChoice, optimalChoiceIsMaximal, complementedChoiceValues);
+            }
+
             template<typename ValueType>
             storm::storage::Scheduler<ValueType> SparseSmgRpatlHelper<ValueType>::expandScheduler(storm::storage::Scheduler<ValueType> scheduler, storm::storage::BitVector psiStates, storm::storage::BitVector notPhiStates) {
                 storm::storage::Scheduler<ValueType> completeScheduler(psiStates.size());
@@ -86,7 +118,7 @@ namespace storm {
                 storm::storage::BitVector notPsiStates = ~psiStates;
                 statesOfCoalition.complement();
 
-                auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), notPsiStates, qualitative, statesOfCoalition, produceScheduler, hint);
+                auto result = computeUntilProbabilities(env, std::move(goal), transitionMatrix, backwardTransitions, storm::storage::BitVector(transitionMatrix.getRowGroupCount(), true), notPsiStates, qualitative, statesOfCoalition, produceScheduler, hint, true);
                 for (auto& element : result.values) {
                     element = storm::utility::one<ValueType>() - element;
                 }
@@ -155,7 +187,7 @@ namespace storm {
                 std::vector<ValueType> x = std::vector<ValueType>(relevantStates.getNumberOfSetBits(), storm::utility::zero<ValueType>());
                 std::vector<ValueType> b = transitionMatrix.getConstrainedRowGroupSumVector(relevantStates, psiStates);
                 std::vector<ValueType> result = std::vector<ValueType>(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-                std::vector<ValueType> constrainedChoiceValues = std::vector<ValueType>(transitionMatrix.getConstrainedRowGroupSumVector(relevantStates, psiStates).size(), storm::utility::zero<ValueType>());
+                std::vector<ValueType> constrainedChoiceValues = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
                 std::unique_ptr<storm::storage::Scheduler<ValueType>> scheduler;
 
                 storm::storage::BitVector clippedStatesOfCoalition(relevantStates.getNumberOfSetBits());
@@ -193,18 +225,19 @@ namespace storm {
                         submatrix = transitionMatrix.getSubmatrix(true, relevantStates, relevantStates, false);
 
                         // Update the viHelper for the (full-size) submatrix and statesOfCoalition.
-                        viHelper.updateTransitionMatrix(submatrix);
+                        viHelper.updateTransitionMatrix(std::move(submatrix));
                         viHelper.updateStatesOfCoalition(statesOfCoalition);
 
                         // Reset constrainedChoiceValues and b to 0-vector in the correct dimension.
-                        constrainedChoiceValues = std::vector<ValueType>(transitionMatrix.getConstrainedRowGroupSumVector(relevantStates, newPsiStates).size(), storm::utility::zero<ValueType>());
-                        b = std::vector<ValueType>(transitionMatrix.getConstrainedRowGroupSumVector(relevantStates, newPsiStates).size(), storm::utility::zero<ValueType>());
+                        // As all states are relevant, there is one entry per row of the transition matrix.
+                        constrainedChoiceValues.assign(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
+                        b.assign(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
                         // The second computation is done between step 0 and the lowerBound
                         solverEnv.solver().game().setMaximalNumberOfIterations(lowerBound);
                         viHelper.performValueIteration(solverEnv, subResult, b, goal.direction(), constrainedChoiceValues);
 
-                        x = subResult;
+                        x = std::move(subResult);
                     }
                     viHelper.fillChoiceValuesVector(constrainedChoiceValues, relevantStates, transitionMatrix.getRowGroupIndices());
                     if (produceScheduler) {
@@ -1,11 +1,18 @@
 #include "GameViHelper.h"
 
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+#include <unordered_map>
+
 #include "storm/environment/Environment.h"
 #include "storm/environment/solver/SolverEnvironment.h"
 #include "storm/environment/solver/GameSolverEnvironment.h"
 
 
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ProgressListener.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -13,6 +20,12 @@ namespace storm {
         namespace helper {
             namespace internal {
 
+                namespace {
+                    // The single-precision phase is only a warm start for the double-precision iterations, so it is cut off if
+                    // rounding errors prevent it from converging.
+                    uint64_t const maximalNumberOfReducedPrecisionIterations = 1000000;
+                }
+
                 template <typename ValueType>
                 GameViHelper<ValueType>::GameViHelper(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector statesOfCoalition) : _transitionMatrix(transitionMatrix), _statesOfCoalition(statesOfCoalition) {
                     // Intentionally left empty.
@@ -21,53 +34,110 @@ namespace storm {
                 template <typename ValueType>
                 void GameViHelper<ValueType>::prepareSolversAndMultipliers(const Environment& env) {
                     _multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, _transitionMatrix);
+                    // The multiplier reduces over the row group ends, i.e. the row group indices without the leading zero.
+                    _rowGroupEnds.assign(_transitionMatrix.getRowGroupIndices().begin() + 1, _transitionMatrix.getRowGroupIndices().end());
                     _x1IsCurrent = false;
                 }
 
                 template <typename ValueType>
-                void GameViHelper<ValueType>::performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues) {
-                    prepareSolversAndMultipliers(env);
+                void GameViHelper<ValueType>::performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues) {
+                    // The multiplier and the buffers below are kept across calls and only rebuilt if the transition matrix changes.
+                    if (!_multiplier) {
+                        prepareSolversAndMultipliers(env);
+                    }
                     // Get precision for convergence check.
                     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().game().getPrecision());
                     uint64_t maxIter = env.solver().game().getMaximalNumberOfIterations();
-                    _b = b;
-                    //_x1.assign(_transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
-                    _x1 = x;
-                    _x2 = _x1;
+                    // Assigning keeps the capacity of the buffer, so b is only copied and not reallocated.
+                    _b.assign(b.begin(), b.end());
+                    // Copy into the existing buffers. The result is swapped into x at the end, so the helper keeps two buffers of the right size.
+                    _x1.resize(x.size());
+                    std::copy(x.begin(), x.end(), _x1.begin());
+                    _x2.resize(x.size());
+                    _x1IsCurrent = true;
 
                     if (this->isProduceSchedulerSet()) {
                         if (!this->_producedOptimalChoices.is_initialized()) {
                             this->_producedOptimalChoices.emplace();
                         }
-                        this->_producedOptimalChoices->resize(this->_transitionMatrix.getRowGroupCount());
+                        this->_producedOptimalChoices.get().resize(this->_transitionMatrix.getRowGroupCount());
                     }
 
                     uint64_t iter = 0;
-                    constrainedChoiceValues = std::vector<ValueType>(b.size(), storm::utility::zero<ValueType>());
+                    constrainedChoiceValues.resize(_b.size());
+                    std::fill(constrainedChoiceValues.begin(), constrainedChoiceValues.end(), storm::utility::zero<ValueType>());
+
+                    // The upper iterate is only sound for unbounded reachability, i.e. if the number of iterations is not bounded.
+                    bool useShieldTermination = _shieldTerminationCondition && maxIter == std::numeric_limits<uint64_t>::max();
+                    if (useShieldTermination) {
+                        _xUpperOld.resize(_x1.size());
+                        std::fill(_xUpperOld.begin(), _xUpperOld.end(), storm::utility::one<ValueType>());
+                        _xUpperNew.resize(_x1.size());
+                        std::fill(_xUpperNew.begin(), _xUpperNew.end(), storm::utility::one<ValueType>());
+                        _choiceValuesLower.resize(_b.size());
+                        _choiceValuesUpper.resize(_b.size());
+                        _previousResidual = storm::utility::zero<ValueType>();
+                    }
+                    _estimatedNumberOfSavedIterations = 0;
+
+                    // Mixed precision is only used if the number of iterations is not bounded, as it changes the number of double-precision iterations.
+                    bool useMixedPrecision = env.solver().game().isMixedPrecisionSet() && !useShieldTermination && maxIter == std::numeric_limits<uint64_t>::max();
+                    _numberOfReducedPrecisionIterations = 0;
+                    _reducedPrecisionDistance = storm::utility::zero<ValueType>();
+                    _reducedPrecisionErrorBound = storm::utility::zero<ValueType>();
+                    if (useMixedPrecision) {
+                        performReducedPrecisionIterations(env, dir, precision);
+                    }
 
                     while (iter < maxIter) {
                         if(iter == maxIter - 1) {
                             _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
-                            auto rowGroupIndices = this->_transitionMatrix.getRowGroupIndices();
-                            rowGroupIndices.erase(rowGroupIndices.begin());
-                            _multiplier->reduce(env, dir, rowGroupIndices, constrainedChoiceValues, xNew(), nullptr, &_statesOfCoalition);
+                            _multiplier->reduce(env, dir, _rowGroupEnds, constrainedChoiceValues, xNew(), nullptr, &_statesOfCoalition);
                             break;
                         }
-                        performIterationStep(env, dir);
+                        if (useShieldTermination) {
+                            if (performShieldIterationStep(env, dir)) {
+                                _estimatedNumberOfSavedIterations = estimateRemainingIterations(precision);
+                                STORM_LOG_INFO("All shield decisions are fixed after " << iter + 1 << " iterations. This saved an estimated " << _estimatedNumberOfSavedIterations << " iterations.");
+                                _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
+                                ++iter;
+                                break;
+                            }
+                        } else {
+                            performIterationStep(env, dir);
+                        }
                         if (checkConvergence(precision)) {
                             _multiplier->multiply(env, xNew(), &_b, constrainedChoiceValues);
+                            ++iter;
                             break;
                         }
+                        if (storm::utility::progress::isProgressReportDue()) {
+                            storm::utility::progress::reportIteration(iter + 1, storm::utility::convertNumber<double>(computeResidual()));
+                        }
                         if (storm::utility::resources::isTerminate()) {
                             break;
                         }
                         ++iter;
                     }
-                    x = xNew();
+                    _numberOfPerformedIterations = iter;
+
+                    if (useMixedPrecision && _numberOfReducedPrecisionIterations > 0) {
+                        if constexpr (std::is_same<ValueType, double>::value) {
+                            std::vector<float> const& reducedResult = _numberOfReducedPrecisionIterations % 2 == 0 ? _reducedX1 : _reducedX2;
+                            for (uint64_t state = 0; state < reducedResult.size(); ++state) {
+                                _reducedPrecisionDistance = std::max(_reducedPrecisionDistance, std::abs(xNew()[state] - static_cast<double>(reducedResult[state])));
+                            }
+                        }
+                        STORM_LOG_INFO("Mixed-precision value iteration performed " << _numberOfReducedPrecisionIterations << " single-precision and " << iter << " double-precision iterations. The single-precision result deviates by at most " << _reducedPrecisionErrorBound << " from the exact iterate and differs by up to " << _reducedPrecisionDistance << " from the refined result.");
+                    }
 
                     if (isProduceSchedulerSet()) {
                         // We will be doing one more iteration step and track scheduler choices this time.
                         performIterationStep(env, dir, &_producedOptimalChoices.get());
+                        // The result is the iterate before this additional step.
+                        std::swap(x, xOld());
+                    } else {
+                        std::swap(x, xNew());
                     }
                 }
 
@@ -85,6 +155,221 @@ namespace storm {
                     }
                 }
 
+                template <typename ValueType>
+                bool GameViHelper<ValueType>::performShieldIterationStep(Environment const& env, storm::solver::OptimizationDirection const dir) {
+                    _x1IsCurrent = !_x1IsCurrent;
+
+                    // The choice values of the lower and the upper iterate enclose the actual choice values.
+                    _multiplier->multiply(env, xOld(), &_b, _choiceValuesLower);
+                    _multiplier->multiply(env, _xUpperOld, &_b, _choiceValuesUpper);
+                    _shieldTerminationCondition->setUpperBounds(_choiceValuesUpper);
+                    bool decisionsFixed = _shieldTerminationCondition->terminateNow(_choiceValuesLower, storm::solver::SolverGuarantee::LessOrEqual);
+
+                    _multiplier->reduce(env, dir, _rowGroupEnds, _choiceValuesLower, xNew(), nullptr, &_statesOfCoalition);
+                    _multiplier->reduce(env, dir, _rowGroupEnds, _choiceValuesUpper, _xUpperNew, nullptr, &_statesOfCoalition);
+                    std::swap(_xUpperOld, _xUpperNew);
+
+                    if (!decisionsFixed) {
+                        _previousResidual = computeResidual();
+                    }
+                    return decisionsFixed;
+                }
+
+                template <typename ValueType>
+                void GameViHelper<ValueType>::prepareReducedPrecisionMatrix(bool quantize) {
+                    if (!_reducedRowStarts.empty() && quantize == _reducedMatrixQuantizationRequested) {
+                        return;
+                    }
+                    _reducedMatrixQuantizationRequested = quantize;
+                    uint64_t numberOfEntries = _transitionMatrix.getEntryCount();
+                    _reducedColumns.resize(numberOfEntries);
+                    _reducedRowStarts.resize(_transitionMatrix.getRowCount() + 1);
+                    for (uint64_t row = 0; row <= _transitionMatrix.getRowCount(); ++row) {
+                        _reducedRowStarts[row] = _transitionMatrix.begin(row) - _transitionMatrix.begin();
+                    }
+                    _reducedValues.clear();
+                    _reducedValueTable.clear();
+                    _reducedValueIndices.clear();
+                    _reducedMaximalRowLength = 0;
+                    _reducedMaximalRowSum = 0.0;
+                    for (uint64_t row = 0; row < _transitionMatrix.getRowCount(); ++row) {
+                        _reducedMaximalRowLength = std::max<uint64_t>(_reducedMaximalRowLength, _reducedRowStarts[row + 1] - _reducedRowStarts[row]);
+                        double rowSum = 0.0;
+                        for (auto const& entry : _transitionMatrix.getRow(row)) {
+                            rowSum += std::abs(storm::utility::convertNumber<double>(entry.getValue()));
+                        }
+                        _reducedMaximalRowSum = std::max(_reducedMaximalRowSum, rowSum);
+                    }
+
+                    _reducedMatrixQuantized = false;
+                    if (quantize) {
+                        // Models with slippery moves typically have only a handful of distinct probabilities.
+                        std::unordered_map<float, uint16_t> valueToIndex;
+                        _reducedValueIndices.reserve(numberOfEntries);
+                        for (auto const& entry : _transitionMatrix) {
+                            float value = storm::utility::convertNumber<double>(entry.getValue());
+                            auto findRes = valueToIndex.find(value);
+                            if (findRes == valueToIndex.end()) {
+                                if (_reducedValueTable.size() > std::numeric_limits<uint16_t>::max()) {
+                                    break;
+                                }
+                                findRes = valueToIndex.emplace(value, _reducedValueTable.size()).first;
+                                _reducedValueTable.push_back(value);
+                            }
+                            _reducedValueIndices.push_back(findRes->second);
+                        }
+                        _reducedMatrixQuantized = _reducedValueIndices.size() == numberOfEntries;
+                        STORM_LOG_INFO_COND(_reducedMatrixQuantized, "Not quantizing the transition probabilities as there are more than " << std::numeric_limits<uint16_t>::max() + 1 << " distinct probabilities.");
+                        if (!_reducedMatrixQuantized) {
+                            _reducedValueTable.clear();
+                            _reducedValueIndices.clear();
+                        }
+                    }
+
+                    auto columnIt = _reducedColumns.begin();
+                    if (!_reducedMatrixQuantized) {
+                        _reducedValues.reserve(numberOfEntries);
+                    }
+                    for (auto const& entry : _transitionMatrix) {
+                        *columnIt = static_cast<uint32_t>(entry.getColumn());
+                        ++columnIt;
+                        if (!_reducedMatrixQuantized) {
+                            _reducedValues.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+                        }
+                    }
+                }
+
+                template <typename ValueType>
+                template <typename ValueGetter>
+                void GameViHelper<ValueType>::performReducedPrecisionIterationStep(storm::solver::OptimizationDirection const dir, ValueGetter const& valueGetter, std::vector<float> const& xOld, std::vector<float>& xNew) const {
+                    auto const& rowGroupIndices = _transitionMatrix.getRowGroupIndices();
+                    for (uint64_t group = 0; group + 1 < rowGroupIndices.size(); ++group) {
+                        uint64_t const groupEnd = rowGroupIndices[group + 1];
+                        bool const maximize = (dir == storm::solver::OptimizationDirection::Maximize) != _statesOfCoalition.get(group);
+                        float groupValue = 0.0f;
+                        for (uint64_t row = rowGroupIndices[group]; row < groupEnd; ++row) {
+                            float rowValue = _reducedB[row];
+                            for (uint64_t entry = _reducedRowStarts[row], entryEnd = _reducedRowStarts[row + 1]; entry < entryEnd; ++entry) {
+                                rowValue += valueGetter(entry) * xOld[_reducedColumns[entry]];
+                            }
+                            if (row == rowGroupIndices[group]) {
+                                groupValue = rowValue;
+                            } else {
+                                groupValue = maximize ? std::max(groupValue, rowValue) : std::min(groupValue, rowValue);
+                            }
+                        }
+                        if (rowGroupIndices[group] < groupEnd) {
+                            xNew[group] = groupValue;
+                        }
+                    }
+                }
+
+                template <typename ValueType>
+                void GameViHelper<ValueType>::performReducedPrecisionIterations(Environment const& env, storm::solver::OptimizationDirection const dir, ValueType precision) {
+                    if constexpr (std::is_same<ValueType, double>::value) {
+                        if (_transitionMatrix.getColumnCount() > std::numeric_limits<uint32_t>::max()) {
+                            STORM_LOG_WARN("Mixed-precision value iteration is not supported for more than 2^32 states.");
+                            return;
+                        }
+                        if (xNew().empty()) {
+                            return;
+                        }
+                        prepareReducedPrecisionMatrix(env.solver().game().isQuantizeProbabilitiesSet());
+                        _reducedB.resize(_b.size());
+                        std::copy(_b.begin(), _b.end(), _reducedB.begin());
+                        _reducedX1.resize(xNew().size());
+                        std::copy(xNew().begin(), xNew().end(), _reducedX1.begin());
+                        _reducedX2.resize(xNew().size());
+                        std::copy(xNew().begin(), xNew().end(), _reducedX2.begin());
+
+                        // Bound the rounding errors of the single-precision iterates x~_n against the exact iterates F^n(x_0). The rounding
+                        // of the initial vector contributes u * |x_0|, where u is the unit roundoff of single precision. In a step, each row
+                        // sums up the rounded entry of b and at most m products of rounded probabilities and values, so it is computed with
+                        // an error of at most gamma_(m+2) * (|b| + sum_j |A_j| * |x~_n|) where gamma_k = k*u / (1 - k*u). The minimum and the
+                        // maximum over the rows of a state do not increase this error and F is non-expansive in the maximum norm (the rows of
+                        // the matrix sum up to at most one), so the error bounds of the single steps add up.
+                        double const unitRoundoff = std::numeric_limits<float>::epsilon() / 2;
+                        double const roundingsPerRow = static_cast<double>(_reducedMaximalRowLength + 2) * unitRoundoff;
+                        double const stepErrorFactor = roundingsPerRow / (1.0 - roundingsPerRow);
+                        double maximalB = 0.0;
+                        for (auto const& value : _b) {
+                            maximalB = std::max(maximalB, std::abs(value));
+                        }
+                        double maximalValue = 0.0;
+                        for (auto const& value : xNew()) {
+                            maximalValue = std::max(maximalValue, std::abs(value));
+                        }
+                        _reducedPrecisionErrorBound = unitRoundoff * maximalValue;
+
+                        // Single precision can not resolve differences much below its machine epsilon, the remaining iterations are done in double precision.
+                        float threshold = std::max(static_cast<float>(precision), 16 * std::numeric_limits<float>::epsilon());
+                        bool converged = false;
+                        while (!converged && _numberOfReducedPrecisionIterations < maximalNumberOfReducedPrecisionIterations && !storm::utility::resources::isTerminate()) {
+                            std::vector<float> const& reducedOld = _numberOfReducedPrecisionIterations % 2 == 0 ? _reducedX1 : _reducedX2;
+                            std::vector<float>& reducedNew = _numberOfReducedPrecisionIterations % 2 == 0 ? _reducedX2 : _reducedX1;
+                            if (_reducedMatrixQuantized) {
+                                performReducedPrecisionIterationStep(dir, [this] (uint64_t entry) { return _reducedValueTable[_reducedValueIndices[entry]]; }, reducedOld, reducedNew);
+                            } else {
+                                performReducedPrecisionIterationStep(dir, [this] (uint64_t entry) { return _reducedValues[entry]; }, reducedOld, reducedNew);
+                            }
+                            ++_numberOfReducedPrecisionIterations;
+                            _reducedPrecisionErrorBound += stepErrorFactor * (maximalB + _reducedMaximalRowSum * maximalValue);
+
+                            float maxDiff = reducedNew.front() - reducedOld.front();
+                            float minDiff = maxDiff;
+                            maximalValue = std::abs(reducedNew.front());
+                            for (uint64_t state = 1; state < reducedNew.size(); ++state) {
+                                float diff = reducedNew[state] - reducedOld[state];
+                                maxDiff = std::max(maxDiff, diff);
+                                minDiff = std::min(minDiff, diff);
+                                maximalValue = std::max<double>(maximalValue, std::abs(reducedNew[state]));
+                            }
+                            converged = maxDiff - minDiff <= threshold;
+                        }
+
+                        STORM_LOG_WARN_COND(converged || storm::utility::resources::isTerminate(), "Single-precision value iteration did not converge within " << maximalNumberOfReducedPrecisionIterations << " iterations, continuing in double precision.");
+
+                        // Continue in double precision from the single-precision result, lowered by its error bound. As F is monotone,
+                        // this vector lies below F^n(x_0), so if x_0 is a lower bound on the fixpoint (e.g. zero), the double-precision
+                        // iterations still approach the fixpoint from below. The values are not lowered below zero, which is a lower
+                        // bound on the (non-negative) fixpoint as well.
+                        std::vector<float> const& reducedResult = _numberOfReducedPrecisionIterations % 2 == 0 ? _reducedX1 : _reducedX2;
+                        for (uint64_t state = 0; state < reducedResult.size(); ++state) {
+                            xNew()[state] = std::max(storm::utility::zero<ValueType>(), static_cast<double>(reducedResult[state]) - _reducedPrecisionErrorBound);
+                        }
+                    } else {
+                        STORM_LOG_WARN("Mixed-precision value iteration is only supported for double values.");
+                    }
+                }
+
+                template <typename ValueType>
+                ValueType GameViHelper<ValueType>::computeResidual() const {
+                    ValueType maxDiff = storm::utility::zero<ValueType>();
+                    ValueType minDiff = storm::utility::zero<ValueType>();
+                    for (auto x1It = xOld().begin(), x2It = xNew().begin(); x1It != xOld().end(); ++x1It, ++x2It) {
+                        ValueType diff = (*x2It - *x1It);
+                        maxDiff = std::max(maxDiff, diff);
+                        minDiff = std::min(minDiff, diff);
+                    }
+                    return maxDiff - minDiff;
+                }
+
+                template <typename ValueType>
+                uint64_t GameViHelper<ValueType>::estimateRemainingIterations(ValueType precision) const {
+                    // Assume that the residual keeps decreasing geometrically with the rate observed in the last step.
+                    double residual = storm::utility::convertNumber<double>(computeResidual());
+                    double previousResidual = storm::utility::convertNumber<double>(_previousResidual);
+                    double targetResidual = storm::utility::convertNumber<double>(precision);
+                    if (residual <= targetResidual) {
+                        return 0;
+                    }
+                    if (previousResidual <= residual) {
+                        // No contraction observed (yet), so we can not give a meaningful estimate.
+                        return 0;
+                    }
+                    return static_cast<uint64_t>(std::ceil(std::log(targetResidual / residual) / std::log(residual / previousResidual)));
+                }
+
                 template <typename ValueType>
                 bool GameViHelper<ValueType>::checkConvergence(ValueType threshold) const {
                     STORM_LOG_ASSERT(_multiplier, "tried to check for convergence without doing an iteration first.");
@@ -135,9 +420,42 @@ namespace storm {
                     return _shieldingTask;
                 }
 
+                template <typename ValueType>
+                void GameViHelper<ValueType>::setShieldTerminationCondition(std::unique_ptr<storm::solver::TerminateIfShieldDecisionsFixed<ValueType>>&& terminationCondition) {
+                    _shieldTerminationCondition = std::move(terminationCondition);
+                }
+
+                template <typename ValueType>
+                uint64_t GameViHelper<ValueType>::getNumberOfPerformedIterations() const {
+                    return _numberOfPerformedIterations;
+                }
+
+                template <typename ValueType>
+                uint64_t GameViHelper<ValueType>::getEstimatedNumberOfSavedIterations() const {
+                    return _estimatedNumberOfSavedIterations;
+                }
+
+                template <typename ValueType>
+                uint64_t GameViHelper<ValueType>::getNumberOfReducedPrecisionIterations() const {
+                    return _numberOfReducedPrecisionIterations;
+                }
+
+                template <typename ValueType>
+                ValueType GameViHelper<ValueType>::getReducedPrecisionDistance() const {
+                    return _reducedPrecisionDistance;
+                }
+
+                template <typename ValueType>
+                ValueType GameViHelper<ValueType>::getReducedPrecisionErrorBound() const {
+                    return _reducedPrecisionErrorBound;
+                }
+
                 template <typename ValueType>
                 void GameViHelper<ValueType>::updateTransitionMatrix(storm::storage::SparseMatrix<ValueType> newTransitionMatrix) {
-                    _transitionMatrix = newTransitionMatrix;
+                    _transitionMatrix = std::move(newTransitionMatrix);
+                    // The multiplier and the single-precision matrix refer to the previous matrix, so they are recreated in the next call.
+                    _multiplier.reset();
+                    _reducedRowStarts.clear();
                 }
 
                 template <typename ValueType>
@@ -175,18 +493,23 @@ namespace storm {
                 }
 
                 template <typename ValueType>
-                void GameViHelper<ValueType>::fillChoiceValuesVector(std::vector<ValueType>& choiceValues, storm::storage::BitVector psiStates, std::vector<storm::storage::SparseMatrix<double>::index_type> rowGroupIndices) {
-                    std::vector<ValueType> allChoices = std::vector<ValueType>(rowGroupIndices.at(rowGroupIndices.size() - 1), storm::utility::zero<ValueType>());
-                    auto choice_it = choiceValues.begin();
-                    for(uint state = 0; state < rowGroupIndices.size() - 1; state++) {
-                        uint rowGroupSize = rowGroupIndices[state + 1] - rowGroupIndices[state];
-                        if (psiStates.get(state)) {
-                            for(uint choice = 0; choice < rowGroupSize; choice++, choice_it++) {
-                                allChoices.at(rowGroupIndices.at(state) + choice) = *choice_it;
+                void GameViHelper<ValueType>::fillChoiceValuesVector(std::vector<ValueType>& choiceValues, storm::storage::BitVector const& psiStates, std::vector<storm::storage::SparseMatrix<double>::index_type> const& rowGroupIndices) {
+                    // Spread the values in place. Going backwards, every value is moved to a position that is not before its
+                    // current one, so no value is overwritten before it has been moved.
+                    uint64_t compactChoice = choiceValues.size();
+                    choiceValues.resize(rowGroupIndices.back());
+                    for (uint64_t state = rowGroupIndices.size() - 1; state > 0; --state) {
+                        uint64_t groupStart = rowGroupIndices[state - 1];
+                        uint64_t groupEnd = rowGroupIndices[state];
+                        if (psiStates.get(state - 1)) {
+                            for (uint64_t choice = groupEnd; choice > groupStart; --choice) {
+                                choiceValues[choice - 1] = std::move(choiceValues[--compactChoice]);
                             }
+                        } else {
+                            std::fill(choiceValues.begin() + groupStart, choiceValues.begin() + groupEnd, storm::utility::zero<ValueType>());
                         }
                     }
-                    choiceValues = allChoices;
+                    STORM_LOG_ASSERT(compactChoice == 0, "Unexpected number of choice values.");
                 }
 
                 template <typename ValueType>
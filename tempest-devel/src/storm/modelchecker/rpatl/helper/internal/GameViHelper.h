@@ -4,6 +4,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/Multiplier.h"
+#include "storm/solver/TerminationCondition.h"
 
 namespace storm {
     class Environment;
@@ -24,9 +25,10 @@ namespace storm {
                     void prepareSolversAndMultipliers(const Environment& env);
 
                     /*!
-                     * Perform value iteration until convergence
+                     * Perform value iteration until convergence.
+                     * The vector b is copied into a buffer of the helper. This and the other buffers are reused across calls on the same helper.
                      */
-                    void performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues);
+                    void performValueIteration(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b, storm::solver::OptimizationDirection const dir, std::vector<ValueType>& constrainedChoiceValues);
 
                     /*!
                      * Sets whether an optimal scheduler shall be constructed during the computation
@@ -48,6 +50,41 @@ namespace storm {
                      */
                     bool isShieldingTask() const;
 
+                    /*!
+                     * Sets a termination condition that stops the value iteration as soon as all shield decisions are fixed.
+                     * To this end, a second iteration from above (starting with value one) provides upper bounds on the choice
+                     * values. This is only sound for unbounded reachability probabilities.
+                     */
+                    void setShieldTerminationCondition(std::unique_ptr<storm::solver::TerminateIfShieldDecisionsFixed<ValueType>>&& terminationCondition);
+
+                    /*!
+                     * @return the number of iterations performed in the most recent call to performValueIteration
+                     */
+                    uint64_t getNumberOfPerformedIterations() const;
+
+                    /*!
+                     * @return an estimate of the number of iterations the shield termination condition saved in the most recent call
+                     */
+                    uint64_t getEstimatedNumberOfSavedIterations() const;
+
+                    /*!
+                     * @return the number of single-precision iterations performed in the most recent call if mixed precision is enabled
+                     */
+                    uint64_t getNumberOfReducedPrecisionIterations() const;
+
+                    /*!
+                     * @return the maximal distance between the single-precision result and the result refined in full precision in the
+                     * most recent call if mixed precision is enabled
+                     */
+                    ValueType getReducedPrecisionDistance() const;
+
+                    /*!
+                     * @return a bound on the rounding error of the single-precision result in the most recent call if mixed precision is
+                     * enabled, i.e. on its distance to the iterate that exact arithmetic yields after the same number of iterations. The
+                     * result was lowered by this bound before refining it, so the refinement starts below the exact iterate.
+                     */
+                    ValueType getReducedPrecisionErrorBound() const;
+
                     /*!
                      * Changes the transitionMatrix to the given one.
                      */
@@ -65,7 +102,7 @@ namespace storm {
                     /*!
                      * Fills the choice values vector to the original size with zeros for ~psiState choices.
                      */
-                    void fillChoiceValuesVector(std::vector<ValueType>& choiceValues, storm::storage::BitVector psiStates, std::vector<storm::storage::SparseMatrix<double>::index_type> rowGroupIndices);
+                    void fillChoiceValuesVector(std::vector<ValueType>& choiceValues, storm::storage::BitVector const& psiStates, std::vector<storm::storage::SparseMatrix<double>::index_type> const& rowGroupIndices);
 
                 private:
                     /*!
@@ -73,6 +110,39 @@ namespace storm {
                      */
                     void performIterationStep(Environment const& env, storm::solver::OptimizationDirection const dir, std::vector<uint64_t>* choices = nullptr);
 
+                    /*!
+                     * Performs one iteration step for the lower and the upper iterate and checks whether all shield decisions are fixed
+                     */
+                    bool performShieldIterationStep(Environment const& env, storm::solver::OptimizationDirection const dir);
+
+                    /*!
+                     * Builds the single-precision copy of the transition matrix. If quantize is set and there are at most 2^16 distinct
+                     * probabilities, these are stored as indices into a table of the distinct probabilities.
+                     */
+                    void prepareReducedPrecisionMatrix(bool quantize);
+
+                    /*!
+                     * Performs value iteration in single precision until convergence (or up to a maximal number of iterations) and
+                     * writes the result, lowered by its error bound, to the current iterate
+                     */
+                    void performReducedPrecisionIterations(Environment const& env, storm::solver::OptimizationDirection const dir, ValueType precision);
+
+                    /*!
+                     * Performs one single-precision iteration step, where valueGetter retrieves the probability of the given entry
+                     */
+                    template<typename ValueGetter>
+                    void performReducedPrecisionIterationStep(storm::solver::OptimizationDirection const dir, ValueGetter const& valueGetter, std::vector<float> const& xOld, std::vector<float>& xNew) const;
+
+                    /*!
+                     * Estimates how many iterations are left until the convergence check would succeed
+                     */
+                    uint64_t estimateRemainingIterations(ValueType precision) const;
+
+                    /*!
+                     * @return the difference between the largest and the smallest change of the last iteration step
+                     */
+                    ValueType computeResidual() const;
+
                     /*!
                      * Checks whether the curently computed value achieves the desired precision
                      */
@@ -101,6 +171,26 @@ namespace storm {
                     storm::storage::BitVector _statesOfCoalition;
                     std::vector<ValueType> _x, _x1, _x2, _b;
                     std::unique_ptr<storm::solver::Multiplier<ValueType>> _multiplier;
+                    std::vector<storm::storage::SparseMatrix<double>::index_type> _rowGroupEnds;
+
+                    std::unique_ptr<storm::solver::TerminateIfShieldDecisionsFixed<ValueType>> _shieldTerminationCondition;
+                    std::vector<ValueType> _xUpperOld, _xUpperNew, _choiceValuesLower, _choiceValuesUpper;
+                    ValueType _previousResidual;
+                    uint64_t _numberOfPerformedIterations = 0;
+                    uint64_t _estimatedNumberOfSavedIterations = 0;
+
+                    std::vector<uint32_t> _reducedColumns;
+                    std::vector<uint64_t> _reducedRowStarts;
+                    std::vector<float> _reducedValues, _reducedValueTable;
+                    std::vector<uint16_t> _reducedValueIndices;
+                    std::vector<float> _reducedB, _reducedX1, _reducedX2;
+                    bool _reducedMatrixQuantizationRequested = false;
+                    bool _reducedMatrixQuantized = false;
+                    uint64_t _reducedMaximalRowLength = 0;
+                    double _reducedMaximalRowSum = 0.0;
+                    uint64_t _numberOfReducedPrecisionIterations = 0;
+                    ValueType _reducedPrecisionDistance;
+                    ValueType _reducedPrecisionErrorBound;
 
                     bool _produceScheduler = false;
                     bool _shieldingTask = false;
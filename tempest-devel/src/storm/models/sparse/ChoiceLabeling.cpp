@@ -4,6 +4,7 @@
 
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
 
 
 namespace storm {
@@ -44,10 +45,19 @@ namespace storm {
             }
 
             ChoiceLabeling ChoiceLabeling::getSubLabeling(storm::storage::BitVector const& choices) const {
-                return ChoiceLabeling(ItemLabeling::getSubLabeling(choices));
+                ChoiceLabeling result(ItemLabeling::getSubLabeling(choices));
+                if (hasLabelIds()) {
+                    result.computeLabelIds();
+                }
+                return result;
             }
 
             std::set<std::string> ChoiceLabeling::getLabelsOfChoice(uint64_t choice) const {
+                if (hasLabelIds()) {
+                    STORM_LOG_THROW(choice < itemCount, storm::exceptions::OutOfRangeException, "Choice index out of range.");
+                    uint64_t labelId = labelIdOfChoice[choice];
+                    return labelId == NO_LABEL ? std::set<std::string>() : std::set<std::string>({labelsById[labelId]});
+                }
                 return this->getLabelsOfItem(choice);
             }
 
@@ -74,6 +84,57 @@ namespace storm {
             }
 
 
+            bool ChoiceLabeling::computeLabelIds() {
+                labelsById.assign(nameToLabelingIndexMap.size(), "");
+                labelIdOfChoice.assign(itemCount, NO_LABEL);
+                // Assign the ids in the order of the label names so that they do not depend on the order of insertion.
+                uint64_t labelId = 0;
+                for (auto const& label : getLabels()) {
+                    labelsById[labelId] = label;
+                    for (auto const& choice : labelings[nameToLabelingIndexMap.at(label)]) {
+                        if (labelIdOfChoice[choice] != NO_LABEL) {
+                            labelingChanged();
+                            return false;
+                        }
+                        labelIdOfChoice[choice] = labelId;
+                    }
+                    ++labelId;
+                }
+                labelIdsAvailable = true;
+                return true;
+            }
+
+            bool ChoiceLabeling::hasLabelIds() const {
+                return labelIdsAvailable;
+            }
+
+            std::vector<std::string> const& ChoiceLabeling::getLabelsById() const {
+                STORM_LOG_THROW(hasLabelIds(), storm::exceptions::InvalidOperationException, "The label ids of the choices are not available.");
+                return labelsById;
+            }
+
+            uint64_t ChoiceLabeling::getLabelIdOfChoice(uint64_t choice) const {
+                STORM_LOG_ASSERT(hasLabelIds(), "The label ids of the choices are not available.");
+                STORM_LOG_ASSERT(choice < itemCount, "Choice index out of range.");
+                return labelIdOfChoice[choice];
+            }
+
+            void ChoiceLabeling::getLabelIdsOfChoices(uint64_t const* choices, uint64_t numberOfChoices, uint64_t* labelIds) const {
+                STORM_LOG_THROW(hasLabelIds(), storm::exceptions::InvalidOperationException, "The label ids of the choices are not available.");
+                for (uint64_t index = 0; index < numberOfChoices; ++index) {
+                    STORM_LOG_THROW(choices[index] < itemCount, storm::exceptions::OutOfRangeException, "Choice index " << choices[index] << " out of range.");
+                    labelIds[index] = labelIdOfChoice[choices[index]];
+                }
+            }
+
+            void ChoiceLabeling::labelingChanged() {
+                labelIdsAvailable = false;
+                labelsById.clear();
+                labelsById.shrink_to_fit();
+                labelIdOfChoice.clear();
+                labelIdOfChoice.shrink_to_fit();
+            }
+
             std::ostream& operator<<(std::ostream& out, ChoiceLabeling const& labeling) {
                 out << "Choice ";
                 labeling.printLabelingInformationToStream(out);
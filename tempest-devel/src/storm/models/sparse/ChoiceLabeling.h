@@ -1,5 +1,8 @@
 #pragma once
 
+#include <limits>
+#include <vector>
+
 #include "storm/models/sparse/ItemLabeling.h"
 
 
@@ -9,9 +12,16 @@ namespace storm {
 
             /*!
              * This class manages the labeling of the choice space with a number of (atomic) labels.
+             *
+             * If every choice has at most one label (e.g. the action names of a PRISM model), the labeling can
+             * additionally store the id of the label of each choice, which allows to look up the label of a choice in
+             * constant time. The label ids are discarded as soon as the labeling is modified.
              */
             class ChoiceLabeling : public ItemLabeling {
             public:
+                // The label id of choices without label.
+                static constexpr uint64_t NO_LABEL = std::numeric_limits<uint64_t>::max();
+
                 /*!
                  * Constructs an empty labeling for the given number of choices.
                  *
@@ -94,8 +104,44 @@ namespace storm {
                  */
                 void setChoices(std::string const& label, storage::BitVector&& labeling);
 
+                /*!
+                 * Computes the label id of each choice if every choice has at most one label.
+                 *
+                 * @return True iff the label ids could be computed.
+                 */
+                bool computeLabelIds();
+
+                /*!
+                 * Checks whether the label ids are available.
+                 */
+                bool hasLabelIds() const;
+
+                /*!
+                 * Retrieves the labels ordered by their id.
+                 */
+                std::vector<std::string> const& getLabelsById() const;
+
+                /*!
+                 * Retrieves the id of the label of the given choice or NO_LABEL if the choice has no label. This may only be
+                 * called if the label ids are available.
+                 */
+                uint64_t getLabelIdOfChoice(uint64_t choice) const;
+
+                /*!
+                 * Retrieves the label ids of the given choices. This may only be called if the label ids are available.
+                 */
+                void getLabelIdsOfChoices(uint64_t const* choices, uint64_t numberOfChoices, uint64_t* labelIds) const;
+
                 friend std::ostream& operator<<(std::ostream& out, ChoiceLabeling const& labeling);
 
+            protected:
+                virtual void labelingChanged() override;
+
+            private:
+                // If every choice has at most one label, the labels ordered by their id and the label id of each choice.
+                bool labelIdsAvailable = false;
+                std::vector<std::string> labelsById;
+                std::vector<uint64_t> labelIdOfChoice;
             };
 
         } // namespace sparse
@@ -81,6 +81,7 @@ namespace storm {
                         break;
                     }
                 }
+                labelingChanged();
             }
 
             void ItemLabeling::join(ItemLabeling const& other) {
@@ -121,6 +122,7 @@ namespace storm {
                 }
 
                 this->labelings = newLabelings;
+                labelingChanged();
             }
 
             void ItemLabeling::addLabel(std::string const& label, storage::BitVector const& labeling) {
@@ -128,6 +130,7 @@ namespace storm {
                 STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
                 nameToLabelingIndexMap.emplace(label, labelings.size());
                 labelings.push_back(labeling);
+                labelingChanged();
             }
 
             void ItemLabeling::addLabel(std::string const& label, storage::BitVector&& labeling) {
@@ -135,6 +138,7 @@ namespace storm {
                 STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size. Expected: " << itemCount << " Actual: " << labeling.size());
                 nameToLabelingIndexMap.emplace(label, labelings.size());
                 labelings.emplace_back(std::move(labeling));
+                labelingChanged();
             }
 
             std::string ItemLabeling::addUniqueLabel(std::string const& prefix, storage::BitVector const& labeling) {
@@ -157,12 +161,14 @@ namespace storm {
                 STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "Label '" << label << "' unknown.");
                 STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
                 this->labelings[nameToLabelingIndexMap.at(label)].set(item, true);
+                labelingChanged();
             }
 
             void ItemLabeling::removeLabelFromItem(std::string const& label, uint64_t item) {
                 STORM_LOG_THROW(item < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
                 STORM_LOG_THROW(this->getItemHasLabel(label, item),storm::exceptions::InvalidArgumentException, "Item " << item << " does not have label '" << label << "'.");
                 this->labelings[nameToLabelingIndexMap.at(label)].set(item, false);
+                labelingChanged();
             }
 
             bool ItemLabeling::getItemHasLabel(std::string const& label, uint64_t item) const {
@@ -187,12 +193,18 @@ namespace storm {
                 STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "The label " << label << " is invalid for the labeling of the model.");
                 STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
                 this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+                labelingChanged();
             }
 
             void ItemLabeling::setItems(std::string const& label, storage::BitVector&& labeling) {
                 STORM_LOG_THROW(this->containsLabel(label), storm::exceptions::InvalidArgumentException, "The label " << label << " is invalid for the labeling of the model.");
                 STORM_LOG_THROW(labeling.size() == itemCount, storm::exceptions::InvalidArgumentException, "Labeling vector has invalid size.");
                 this->labelings[nameToLabelingIndexMap.at(label)] = labeling;
+                labelingChanged();
+            }
+
+            void ItemLabeling::labelingChanged() {
+                // Intentionally left empty.
             }
 
             void ItemLabeling::printLabelingInformationToStream(std::ostream& out) const {
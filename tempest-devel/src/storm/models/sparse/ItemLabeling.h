@@ -230,6 +230,12 @@ namespace storm {
                 * @param item The index of the item.
                 */
                 virtual void removeLabelFromItem(std::string const& label, uint64_t item);
+
+                /*!
+                 * Called after the labeling has been modified. Derived classes may use this to discard information
+                 * that they derived from the labeling.
+                 */
+                virtual void labelingChanged();
                 
 
                 // The number of items for which this object can hold the labeling.
@@ -17,6 +17,9 @@ namespace storm {
             const std::string GameSolverSettings::maximalIterationsOptionShortName = "i";
             const std::string GameSolverSettings::precisionOptionName = "precision";
             const std::string GameSolverSettings::absoluteOptionName = "absolute";
+            const std::string GameSolverSettings::shieldTerminationOptionName = "shield-termination";
+            const std::string GameSolverSettings::mixedPrecisionOptionName = "mixed-precision";
+            const std::string GameSolverSettings::quantizeProbabilitiesOptionName = "quantize-probabilities";
 
             GameSolverSettings::GameSolverSettings() : ModuleSettings(moduleName) {
                 std::vector<std::string> gameSolvingTechniques = {"vi", "value-iteration", "pi", "policy-iteration"};
@@ -28,6 +31,12 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, precisionOptionName, false, "The precision used for detecting convergence of iterative methods.").setIsAdvanced().addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.").setDefaultValueDouble(1e-06).addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0)).build()).build());
 
                 this->addOption(storm::settings::OptionBuilder(moduleName, absoluteOptionName, false, "Sets whether the relative or the absolute error is considered for detecting convergence.").setIsAdvanced().build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, shieldTerminationOptionName, false, "Sets whether value iteration for shielding tasks stops as soon as the decisions of the shield are fixed.").setIsAdvanced().build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, mixedPrecisionOptionName, false, "Sets whether value iteration first iterates in single precision and then refines the result in double precision.").setIsAdvanced().build());
+
+                this->addOption(storm::settings::OptionBuilder(moduleName, quantizeProbabilitiesOptionName, false, "Sets whether mixed-precision value iteration stores the transition probabilities as 16-bit indices into a table of the distinct probabilities.").setIsAdvanced().build());
             }
             
             storm::solver::GameMethod GameSolverSettings::getGameSolvingMethod() const {
@@ -71,6 +80,18 @@ namespace storm {
             GameSolverSettings::ConvergenceCriterion GameSolverSettings::getConvergenceCriterion() const {
                 return this->getOption(absoluteOptionName).getHasOptionBeenSet() ? GameSolverSettings::ConvergenceCriterion::Absolute : GameSolverSettings::ConvergenceCriterion::Relative;
             }
+
+            bool GameSolverSettings::isShieldTerminationSet() const {
+                return this->getOption(shieldTerminationOptionName).getHasOptionBeenSet();
+            }
+
+            bool GameSolverSettings::isMixedPrecisionSet() const {
+                return this->getOption(mixedPrecisionOptionName).getHasOptionBeenSet();
+            }
+
+            bool GameSolverSettings::isQuantizeProbabilitiesSet() const {
+                return this->getOption(quantizeProbabilitiesOptionName).getHasOptionBeenSet();
+            }
             
         }
     }
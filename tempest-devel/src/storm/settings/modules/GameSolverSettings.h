@@ -81,6 +81,28 @@ namespace storm {
                  * @return The selected convergence criterion.
                  */
                 ConvergenceCriterion getConvergenceCriterion() const;
+
+                /*!
+                 * Retrieves whether value iteration for shielding tasks may stop as soon as all shield decisions are fixed.
+                 *
+                 * @return True iff shield-aware termination has been set.
+                 */
+                bool isShieldTerminationSet() const;
+
+                /*!
+                 * Retrieves whether value iteration should first iterate in single precision and only refine the result in double precision.
+                 *
+                 * @return True iff mixed-precision value iteration has been set.
+                 */
+                bool isMixedPrecisionSet() const;
+
+                /*!
+                 * Retrieves whether the single-precision transition probabilities should be stored as 16-bit indices into a table of
+                 * the distinct probabilities.
+                 *
+                 * @return True iff quantized probabilities have been set.
+                 */
+                bool isQuantizeProbabilitiesSet() const;
                 
                 // The name of the module.
                 static const std::string moduleName;
@@ -91,6 +113,9 @@ namespace storm {
                 static const std::string maximalIterationsOptionShortName;
                 static const std::string precisionOptionName;
                 static const std::string absoluteOptionName;
+                static const std::string shieldTerminationOptionName;
+                static const std::string mixedPrecisionOptionName;
+                static const std::string quantizeProbabilitiesOptionName;
             };
             
         }
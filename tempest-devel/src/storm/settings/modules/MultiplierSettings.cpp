@@ -15,7 +15,7 @@ namespace storm {
             const std::string MultiplierSettings::multiplierTypeOptionName = "type";
 
             MultiplierSettings::MultiplierSettings() : ModuleSettings(moduleName) {
-                std::vector<std::string> multiplierTypes = {"native", "gmmxx"};
+                std::vector<std::string> multiplierTypes = {"native", "gmmxx", "simd"};
                 this->addOption(storm::settings::OptionBuilder(moduleName, multiplierTypeOptionName, true, "Sets which type of multiplier is preferred.").setIsAdvanced()
                                 .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of a multiplier.").addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(multiplierTypes)).setDefaultValueString("gmmxx").build()).build());
                 
@@ -27,6 +27,8 @@ namespace storm {
                     return storm::solver::MultiplierType::Native;
                 } else if (type == "gmmxx") {
                     return storm::solver::MultiplierType::Gmmxx;
+                } else if (type == "simd") {
+                    return storm::solver::MultiplierType::Simd;
                 }
                 
                 STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown multiplier type '" << type << "'.");
@@ -29,6 +29,11 @@ namespace tempest {
             return optimizationDirection;
         }
 
+        template<typename ValueType, typename IndexType>
+        std::vector<IndexType> const& AbstractShield<ValueType, IndexType>::getRowGroupIndices() const {
+            return rowGroupIndices;
+        }
+
         template<typename ValueType, typename IndexType>
         std::string AbstractShield<ValueType, IndexType>::getClassName() const {
             return std::string(boost::core::demangled_name(BOOST_CORE_TYPEID(*this)));
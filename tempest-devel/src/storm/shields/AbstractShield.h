@@ -48,6 +48,11 @@ namespace tempest {
 
             storm::OptimizationDirection getOptimizationDirection();
 
+            /*!
+             * Retrieves the indices of the first rows of the row groups, i.e. the first choice of each state.
+             */
+            std::vector<IndexType> const& getRowGroupIndices() const;
+
             std::string getClassName() const;
             
             virtual void printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) = 0;
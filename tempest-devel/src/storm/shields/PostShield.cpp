@@ -10,6 +10,11 @@ namespace tempest {
             // Intentionally left empty.
         }
 
+        template<typename ValueType, typename IndexType>
+        std::vector<ValueType> const& PostShield<ValueType, IndexType>::getChoiceValues() const {
+            return choiceValues;
+        }
+
         template<typename ValueType, typename IndexType>
         storm::storage::PostScheduler<ValueType> PostShield<ValueType, IndexType>::construct() {
             if (this->getOptimizationDirection() == storm::OptimizationDirection::Minimize) {
@@ -12,6 +12,12 @@ namespace tempest {
             PostShield(std::vector<IndexType> const& rowGroupIndices, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
 
             storm::storage::PostScheduler<ValueType> construct();
+
+            /*!
+             * Retrieves the values of the choices (i.e. rows of the transition matrix) the shield is based on.
+             */
+            std::vector<ValueType> const& getChoiceValues() const;
+
             template<typename Compare, bool relative>
             storm::storage::PostScheduler<ValueType> constructWithCompareType();
 
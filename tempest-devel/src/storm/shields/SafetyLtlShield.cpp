@@ -0,0 +1,205 @@
+#include "storm/shields/SafetyLtlShield.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <boost/algorithm/string/join.hpp>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace tempest {
+    namespace shields {
+
+        SafetyMonitor::SafetyMonitor(uint64_t initialState, std::vector<uint64_t>&& letterOfState, uint64_t numberOfLetters, std::vector<uint64_t>&& transitions, storm::storage::BitVector&& violatingStates, storm::storage::BitVector&& satisfyingStates) : initialState(initialState), letterOfState(std::move(letterOfState)), numberOfLetters(numberOfLetters), transitions(std::move(transitions)), violatingStates(std::move(violatingStates)), satisfyingStates(std::move(satisfyingStates)) {
+            STORM_LOG_ASSERT(this->transitions.size() == this->violatingStates.size() * numberOfLetters, "Unexpected number of monitor transitions.");
+        }
+
+        uint64_t SafetyMonitor::getInitialState(uint64_t modelState) const {
+            return getSuccessor(initialState, modelState);
+        }
+
+        uint64_t SafetyMonitor::getSuccessor(uint64_t monitorState, uint64_t modelState) const {
+            STORM_LOG_THROW(monitorState < getNumberOfStates() && modelState < letterOfState.size(), storm::exceptions::InvalidArgumentException, "Invalid monitor state " << monitorState << " or model state " << modelState << ".");
+            uint64_t successor = transitions[monitorState * numberOfLetters + letterOfState[modelState]];
+            STORM_LOG_THROW(successor != INVALID_STATE, storm::exceptions::InvalidArgumentException, "The monitor has no transition from state " << monitorState << " to model state " << modelState << " as the move is not possible in the game.");
+            return successor;
+        }
+
+        bool SafetyMonitor::isViolated(uint64_t monitorState) const {
+            return violatingStates.get(monitorState);
+        }
+
+        bool SafetyMonitor::isSatisfied(uint64_t monitorState) const {
+            return satisfyingStates.get(monitorState);
+        }
+
+        uint64_t SafetyMonitor::getNumberOfStates() const {
+            return violatingStates.size();
+        }
+
+        uint64_t SafetyMonitor::getNumberOfLetters() const {
+            return numberOfLetters;
+        }
+
+        void SafetyMonitor::printToStream(std::ostream& out) const {
+            out << "Monitor with " << getNumberOfStates() << " states and " << numberOfLetters << " letters, initial state " << initialState << ":" << std::endl;
+            for (uint64_t monitorState = 0; monitorState < getNumberOfStates(); ++monitorState) {
+                out << std::setw(6) << monitorState;
+                if (isViolated(monitorState)) {
+                    out << " (violated)";
+                } else if (isSatisfied(monitorState)) {
+                    out << " (satisfied)";
+                }
+                out << ":";
+                for (uint64_t letter = 0; letter < numberOfLetters; ++letter) {
+                    uint64_t successor = transitions[monitorState * numberOfLetters + letter];
+                    if (successor != INVALID_STATE) {
+                        out << " " << letter << "->" << successor;
+                    }
+                }
+                out << std::endl;
+            }
+        }
+
+        storm::json<storm::RationalNumber> SafetyMonitor::toJson() const {
+            storm::json<storm::RationalNumber> output;
+            output["initial"] = initialState;
+            output["letters"] = letterOfState;
+            std::vector<int64_t> transitionsJson;
+            transitionsJson.reserve(transitions.size());
+            for (auto const& successor : transitions) {
+                transitionsJson.push_back(successor == INVALID_STATE ? -1 : static_cast<int64_t>(successor));
+            }
+            output["transitions"] = std::move(transitionsJson);
+            output["violated"] = std::vector<uint64_t>(violatingStates.begin(), violatingStates.end());
+            output["satisfied"] = std::vector<uint64_t>(satisfyingStates.begin(), satisfyingStates.end());
+            return output;
+        }
+
+        template<typename ValueType, typename IndexType>
+        SafetyLtlShield<ValueType, IndexType>::SafetyLtlShield(std::vector<IndexType> const& rowGroupIndices, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, SafetyMonitor const& monitor, std::vector<uint64_t> const& productStateStarts, std::vector<std::pair<uint64_t, uint64_t>> const& productStates, storm::storage::PreScheduler<ValueType> const& productShield) : AbstractShield<ValueType, IndexType>(rowGroupIndices, shieldingExpression, optimizationDirection, relevantStates, coalitionStates), monitor(monitor), productStateStarts(productStateStarts), productStates(productStates), productShield(productShield) {
+            if (this->coalitionStates.is_initialized()) {
+                this->relevantStates &= ~this->coalitionStates.get();
+            }
+        }
+
+        template<typename ValueType, typename IndexType>
+        SafetyMonitor const& SafetyLtlShield<ValueType, IndexType>::getMonitor() const {
+            return monitor;
+        }
+
+        template<typename ValueType, typename IndexType>
+        storm::storage::PreSchedulerChoice<ValueType> SafetyLtlShield<ValueType, IndexType>::getChoice(uint64_t modelState, uint64_t monitorState) const {
+            STORM_LOG_THROW(modelState + 1 < this->rowGroupIndices.size(), storm::exceptions::InvalidArgumentException, "Invalid model state " << modelState << ".");
+            storm::storage::PreSchedulerChoice<ValueType> result;
+            if (!this->relevantStates.get(modelState) || monitor.isViolated(monitorState)) {
+                return result;
+            }
+            if (monitor.isSatisfied(monitorState)) {
+                // Every choice is safe once the formula can no longer be violated.
+                for (uint64_t choice = 0; choice < this->rowGroupIndices[modelState + 1] - this->rowGroupIndices[modelState]; ++choice) {
+                    result.addChoice(choice, storm::utility::one<ValueType>());
+                }
+                return result;
+            }
+            auto begin = productStates.begin() + productStateStarts[modelState];
+            auto end = productStates.begin() + productStateStarts[modelState + 1];
+            auto productIt = std::lower_bound(begin, end, std::make_pair(monitorState, static_cast<uint64_t>(0)));
+            STORM_LOG_THROW(productIt != end && productIt->first == monitorState, storm::exceptions::InvalidArgumentException, "Model state " << modelState << " with monitor state " << monitorState << " is not reachable.");
+            return productShield.getChoice(productIt->second);
+        }
+
+        template<typename ValueType, typename IndexType>
+        void SafetyLtlShield<ValueType, IndexType>::printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+            STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() + 1 == this->rowGroupIndices.size(), storm::exceptions::InvalidArgumentException, "The given model is not compatible with this shield.");
+            bool const stateValuationsGiven = model != nullptr && model->hasStateValuations();
+            bool const choiceLabelsGiven = model != nullptr && model->hasChoiceLabeling();
+
+            out << "___________________________________________________________________" << std::endl;
+            out << this->shieldingExpression->prettify() << std::endl;
+            out << std::setw(12) << "model state:" << "    " << "monitor state:" << "    " << "choice(s)";
+            if (choiceLabelsGiven) {
+                out << " [<value>: (<action {action label})>]";
+            } else {
+                out << " [<value>: (<action>)}";
+            }
+            out << ":" << std::endl;
+            for (uint64_t state = 0; state + 1 < productStateStarts.size(); ++state) {
+                for (uint64_t entry = productStateStarts[state]; entry < productStateStarts[state + 1]; ++entry) {
+                    auto const& choices = getChoice(state, productStates[entry].first);
+                    if (choices.isEmpty()) {
+                        continue;
+                    }
+                    if (stateValuationsGiven) {
+                        out << std::setw(12) << (std::to_string(state) + ": " + model->getStateValuations().getStateInfo(state));
+                    } else {
+                        out << std::setw(12) << state;
+                    }
+                    out << "    " << std::setw(14) << productStates[entry].first << "    ";
+                    bool firstChoice = true;
+                    for (auto const& choiceProbPair : choices.getChoiceMap()) {
+                        if (firstChoice) {
+                            firstChoice = false;
+                        } else {
+                            out << ";    ";
+                        }
+                        out << std::get<0>(choiceProbPair) << ": (" << std::get<1>(choiceProbPair);
+                        if (choiceLabelsGiven) {
+                            auto choiceLabels = model->getChoiceLabeling().getLabelsOfChoice(this->rowGroupIndices[state] + std::get<1>(choiceProbPair));
+                            out << " {" << boost::join(choiceLabels, ", ") << "}";
+                        }
+                        out << ")";
+                    }
+                    out << std::endl;
+                }
+            }
+            monitor.printToStream(out);
+            out << "___________________________________________________________________" << std::endl;
+        }
+
+        template<typename ValueType, typename IndexType>
+        void SafetyLtlShield<ValueType, IndexType>::printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) {
+            STORM_LOG_THROW(model == nullptr || model->getNumberOfStates() + 1 == this->rowGroupIndices.size(), storm::exceptions::InvalidArgumentException, "The given model is not compatible with this shield.");
+            storm::json<storm::RationalNumber> output;
+            storm::json<storm::RationalNumber> shieldJson;
+            for (uint64_t state = 0; state + 1 < productStateStarts.size(); ++state) {
+                for (uint64_t entry = productStateStarts[state]; entry < productStateStarts[state + 1]; ++entry) {
+                    auto const& choices = getChoice(state, productStates[entry].first);
+                    if (choices.isEmpty()) {
+                        continue;
+                    }
+                    storm::json<storm::RationalNumber> stateChoicesJson;
+                    if (model && model->hasStateValuations()) {
+                        stateChoicesJson["s"] = model->getStateValuations().template toJson<storm::RationalNumber>(state);
+                    } else {
+                        stateChoicesJson["s"] = state;
+                    }
+                    stateChoicesJson["q"] = productStates[entry].first;
+                    storm::json<storm::RationalNumber> choicesJson;
+                    for (auto const& choiceProbPair : choices.getChoiceMap()) {
+                        uint64_t globalChoiceIndex = this->rowGroupIndices[state] + std::get<uint_fast64_t>(choiceProbPair);
+                        storm::json<storm::RationalNumber> choiceJson;
+                        if (model && model->hasChoiceLabeling()) {
+                            auto choiceLabels = model->getChoiceLabeling().getLabelsOfChoice(globalChoiceIndex);
+                            choiceJson["labels"] = std::vector<std::string>(choiceLabels.begin(), choiceLabels.end());
+                        }
+                        choiceJson["index"] = globalChoiceIndex;
+                        choiceJson["prob"] = storm::utility::convertNumber<storm::RationalNumber>(std::get<ValueType>(choiceProbPair));
+                        choicesJson.push_back(std::move(choiceJson));
+                    }
+                    stateChoicesJson["c"] = std::move(choicesJson);
+                    shieldJson.push_back(std::move(stateChoicesJson));
+                }
+            }
+            output["shield"] = std::move(shieldJson);
+            output["monitor"] = monitor.toJson();
+            out << output.dump(4);
+        }
+
+        // Explicitly instantiate appropriate classes
+        template class SafetyLtlShield<double, typename storm::storage::SparseMatrix<double>::index_type>;
+#ifdef STORM_HAVE_CARL
+        template class SafetyLtlShield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>;
+#endif
+    }
+}
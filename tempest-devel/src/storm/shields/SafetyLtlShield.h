@@ -0,0 +1,100 @@
+#pragma once
+
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/shields/AbstractShield.h"
+#include "storm/storage/PreScheduler.h"
+
+namespace tempest {
+    namespace shields {
+
+        /*!
+         * A deterministic monitor that tracks the progress of a safety LTL formula along a run of a game. The monitor
+         * reads the labels of the visited game states; it only contains the transitions that were explored while
+         * building the product of the game with the automaton of the formula.
+         */
+        class SafetyMonitor {
+        public:
+            static constexpr uint64_t INVALID_STATE = std::numeric_limits<uint64_t>::max();
+
+            /*!
+             * Creates a monitor.
+             *
+             * @param initialState The state of the monitor before any game state has been visited.
+             * @param letterOfState For each game state, the index of the letter it is labelled with.
+             * @param numberOfLetters The number of distinct letters.
+             * @param transitions The successor for each monitor state and letter (row-major) or INVALID_STATE.
+             * @param violatingStates The monitor states in which the formula is violated.
+             * @param satisfyingStates The monitor states in which the formula is satisfied by every continuation.
+             */
+            SafetyMonitor(uint64_t initialState, std::vector<uint64_t>&& letterOfState, uint64_t numberOfLetters, std::vector<uint64_t>&& transitions, storm::storage::BitVector&& violatingStates, storm::storage::BitVector&& satisfyingStates);
+
+            /*!
+             * Retrieves the monitor state after a run starts in the given game state.
+             */
+            uint64_t getInitialState(uint64_t modelState) const;
+
+            /*!
+             * Retrieves the monitor state after the run moves to the given game state.
+             */
+            uint64_t getSuccessor(uint64_t monitorState, uint64_t modelState) const;
+
+            bool isViolated(uint64_t monitorState) const;
+            bool isSatisfied(uint64_t monitorState) const;
+
+            uint64_t getNumberOfStates() const;
+            uint64_t getNumberOfLetters() const;
+
+            void printToStream(std::ostream& out) const;
+            storm::json<storm::RationalNumber> toJson() const;
+
+        private:
+            uint64_t initialState;
+            std::vector<uint64_t> letterOfState;
+            uint64_t numberOfLetters;
+            std::vector<uint64_t> transitions;
+            storm::storage::BitVector violatingStates;
+            storm::storage::BitVector satisfyingStates;
+        };
+
+        /*!
+         * A pre-safety shield for a safety LTL objective. The shield is computed on the product of the game with the
+         * automaton of the formula and projected back to the game: the allowed choices of a game state depend on the
+         * state of the accompanying SafetyMonitor.
+         */
+        template<typename ValueType, typename IndexType>
+        class SafetyLtlShield : public AbstractShield<ValueType, IndexType> {
+        public:
+            /*!
+             * Creates the shield.
+             *
+             * @param rowGroupIndices The row group indices of the game.
+             * @param monitor The monitor for the formula.
+             * @param productStateStarts For each game state, the first entry of productStates that belongs to it.
+             * @param productStates Pairs of monitor state and product state, sorted by monitor state for each game state.
+             * @param productShield The pre-safety shield for the product.
+             */
+            SafetyLtlShield(std::vector<IndexType> const& rowGroupIndices, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates, SafetyMonitor const& monitor, std::vector<uint64_t> const& productStateStarts, std::vector<std::pair<uint64_t, uint64_t>> const& productStates, storm::storage::PreScheduler<ValueType> const& productShield);
+
+            SafetyMonitor const& getMonitor() const;
+
+            /*!
+             * Retrieves the choices that are allowed in the given game state if the monitor is in the given state.
+             */
+            storm::storage::PreSchedulerChoice<ValueType> getChoice(uint64_t modelState, uint64_t monitorState) const;
+
+            virtual void printToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) override;
+            virtual void printJsonToStream(std::ostream& out, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& model) override;
+
+        private:
+            SafetyMonitor monitor;
+            std::vector<uint64_t> productStateStarts;
+            std::vector<std::pair<uint64_t, uint64_t>> productStates;
+            storm::storage::PreScheduler<ValueType> productShield;
+        };
+    }
+}
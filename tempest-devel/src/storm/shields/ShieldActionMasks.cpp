@@ -0,0 +1,150 @@
+#include "storm/shields/ShieldActionMasks.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "storm/models/sparse/StateLabeling.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+namespace tempest {
+    namespace shields {
+
+        namespace {
+            // Batches below this size per thread are not worth spawning a thread for.
+            uint64_t const MINIMAL_NUMBER_OF_STATES_PER_THREAD = 1ull << 14;
+        }
+
+        template<typename ValueType>
+        ShieldActionMasks<ValueType>::ShieldActionMasks(storm::storage::PreScheduler<ValueType> const& shield, storm::models::sparse::Model<ValueType> const& model, bool useChoiceLabels, std::shared_ptr<storm::storage::sparse::StateValuationIndex const> valuationIndex) : numberOfStates(model.getNumberOfStates()), valuationIndex(valuationIndex) {
+            STORM_LOG_THROW(shield.isMemorylessScheduler(), storm::exceptions::InvalidOperationException, "Action masks can only be built for memoryless shields.");
+            STORM_LOG_THROW(!useChoiceLabels || model.hasChoiceLabeling(), storm::exceptions::InvalidArgumentException, "Action masks over choice labels require a model with choice labels.");
+            auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+
+            // For each choice, the actions it enables.
+            std::vector<std::vector<uint64_t>> actionsOfChoice;
+            if (useChoiceLabels) {
+                auto const& choiceLabeling = model.getChoiceLabeling();
+                actionsOfChoice.resize(model.getNumberOfChoices());
+                for (auto const& label : choiceLabeling.getLabels()) {
+                    for (auto const& choice : choiceLabeling.getChoices(label)) {
+                        actionsOfChoice[choice].push_back(actionNames.size());
+                    }
+                    actionNames.push_back(label);
+                }
+                numberOfActions = actionNames.size();
+            } else {
+                numberOfActions = 0;
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    numberOfActions = std::max<uint64_t>(numberOfActions, rowGroupIndices[state + 1] - rowGroupIndices[state]);
+                }
+                for (uint64_t action = 0; action < numberOfActions; ++action) {
+                    actionNames.push_back(std::to_string(action));
+                }
+            }
+
+            allowed.assign(numberOfStates * numberOfActions, 0);
+            allowedChoices = storm::storage::BitVector(model.getNumberOfChoices(), false);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                uint8_t* mask = allowed.data() + state * numberOfActions;
+                auto enableChoice = [&] (uint64_t localChoice) {
+                    if (useChoiceLabels) {
+                        for (auto const& action : actionsOfChoice[rowGroupIndices[state] + localChoice]) {
+                            mask[action] = 1;
+                        }
+                    } else {
+                        mask[localChoice] = 1;
+                    }
+                };
+                // An empty choice map (no safe action or a state the shield does not consider) allows nothing.
+                for (auto const& choice : shield.getChoice(state).getChoiceMap()) {
+                    enableChoice(std::get<1>(choice));
+                    allowedChoices.set(rowGroupIndices[state] + std::get<1>(choice), true);
+                }
+            }
+
+            if (!this->valuationIndex && model.hasStateValuations()) {
+                this->valuationIndex = std::make_shared<storm::storage::sparse::StateValuationIndex>(model.getStateValuations());
+            }
+        }
+
+        template<typename ValueType>
+        uint64_t ShieldActionMasks<ValueType>::getNumberOfStates() const {
+            return numberOfStates;
+        }
+
+        template<typename ValueType>
+        uint64_t ShieldActionMasks<ValueType>::getNumberOfActions() const {
+            return numberOfActions;
+        }
+
+        template<typename ValueType>
+        std::vector<std::string> const& ShieldActionMasks<ValueType>::getActionNames() const {
+            return actionNames;
+        }
+
+        template<typename ValueType>
+        std::vector<std::string> const& ShieldActionMasks<ValueType>::getVariableNames() const {
+            static std::vector<std::string> const noVariables;
+            return valuationIndex ? valuationIndex->getVariableNames() : noVariables;
+        }
+
+        template<typename ValueType>
+        bool ShieldActionMasks<ValueType>::hasValuationLookup() const {
+            return valuationIndex != nullptr;
+        }
+
+        template<typename ValueType>
+        bool ShieldActionMasks<ValueType>::isAllowed(uint64_t state, uint64_t action) const {
+            STORM_LOG_ASSERT(state < numberOfStates && action < numberOfActions, "Illegal state or action.");
+            return allowed[state * numberOfActions + action] != 0;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector const& ShieldActionMasks<ValueType>::getAllowedChoices() const {
+            return allowedChoices;
+        }
+
+        template<typename ValueType>
+        void ShieldActionMasks<ValueType>::getMasks(uint64_t const* states, uint64_t numberOfStates, bool* masks, uint64_t numberOfThreads) const {
+            for (uint64_t index = 0; index < numberOfStates; ++index) {
+                STORM_LOG_THROW(states[index] < this->numberOfStates, storm::exceptions::InvalidArgumentException, "State " << states[index] << " does not exist.");
+            }
+            storm::utility::parallel::forEachBlock(numberOfStates, numberOfThreads, MINIMAL_NUMBER_OF_STATES_PER_THREAD, [&] (uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    std::memcpy(masks + index * numberOfActions, allowed.data() + states[index] * numberOfActions, numberOfActions);
+                }
+            });
+        }
+
+        template<typename ValueType>
+        uint64_t ShieldActionMasks<ValueType>::getStateOfValuation(int64_t const* valuation) const {
+            STORM_LOG_THROW(hasValuationLookup(), storm::exceptions::InvalidOperationException, "States can only be looked up by their valuation if the model has state valuations over boolean and integer variables.");
+            return valuationIndex->getState(valuation);
+        }
+
+        template<typename ValueType>
+        void ShieldActionMasks<ValueType>::getMasksOfValuations(int64_t const* valuations, uint64_t numberOfStates, bool* masks, uint64_t numberOfThreads) const {
+            STORM_LOG_THROW(hasValuationLookup(), storm::exceptions::InvalidOperationException, "States can only be looked up by their valuation if the model has state valuations over boolean and integer variables.");
+            uint64_t const numberOfVariables = valuationIndex->getVariables().size();
+            storm::utility::parallel::forEachBlock(numberOfStates, numberOfThreads, MINIMAL_NUMBER_OF_STATES_PER_THREAD, [&] (uint64_t begin, uint64_t end) {
+                for (uint64_t index = begin; index < end; ++index) {
+                    uint64_t state = valuationIndex->getState(valuations + index * numberOfVariables);
+                    if (state == UNKNOWN_STATE) {
+                        std::fill(masks + index * numberOfActions, masks + (index + 1) * numberOfActions, false);
+                    } else {
+                        std::memcpy(masks + index * numberOfActions, allowed.data() + state * numberOfActions, numberOfActions);
+                    }
+                }
+            });
+        }
+
+        template class ShieldActionMasks<double>;
+#ifdef STORM_HAVE_CARL
+        template class ShieldActionMasks<storm::RationalNumber>;
+#endif
+    }
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/PreScheduler.h"
+#include "storm/storage/sparse/StateValuationIndex.h"
+#include "storm/models/sparse/Model.h"
+
+namespace tempest {
+    namespace shields {
+
+        /*!
+         * A dense table of the actions that a pre-safety shield allows in each state of a model, built once so that
+         * the allowed actions of many states can be looked up at once (e.g. for a batch of simulated environments).
+         *
+         * The actions are either the local choice indices of the states or the choice labels of the model. States for
+         * which the shield has no choice, be it because no action is safe or because the state was not considered,
+         * allow no action, just like unknown valuations. If the model has state
+         * valuations over boolean and integer variables, states can also be looked up by their valuation.
+         */
+        template<typename ValueType>
+        class ShieldActionMasks {
+        public:
+            static constexpr uint64_t UNKNOWN_STATE = std::numeric_limits<uint64_t>::max();
+
+            /*!
+             * Builds the table for the given memoryless shield.
+             *
+             * @param useChoiceLabels If set, each distinct choice label is an action and a choice enables all of its
+             * labels. Otherwise, the actions are the local choice indices.
+             * @param valuationIndex The index used to look up states by their valuation. If not given, an index over all
+             * boolean and integer variables is built if the model has state valuations.
+             */
+            ShieldActionMasks(storm::storage::PreScheduler<ValueType> const& shield, storm::models::sparse::Model<ValueType> const& model, bool useChoiceLabels = false, std::shared_ptr<storm::storage::sparse::StateValuationIndex const> valuationIndex = nullptr);
+
+            uint64_t getNumberOfStates() const;
+            uint64_t getNumberOfActions() const;
+
+            /*!
+             * Retrieves the names of the actions, which are the choice labels or the local choice indices.
+             */
+            std::vector<std::string> const& getActionNames() const;
+
+            /*!
+             * Retrieves the names of the variables in the order in which valuations are given to getStateOfValuation.
+             * Empty if the states can not be looked up by their valuation.
+             */
+            std::vector<std::string> const& getVariableNames() const;
+            bool hasValuationLookup() const;
+
+            bool isAllowed(uint64_t state, uint64_t action) const;
+
+            /*!
+             * Retrieves the choices (i.e. rows of the transition matrix) that the shield allows.
+             */
+            storm::storage::BitVector const& getAllowedChoices() const;
+
+            /*!
+             * Writes the masks of the given states as rows of a row-major matrix with getNumberOfActions columns.
+             *
+             * @param numberOfThreads The number of threads to use. If zero, large batches are split among all hardware
+             * threads.
+             */
+            void getMasks(uint64_t const* states, uint64_t numberOfStates, bool* masks, uint64_t numberOfThreads = 0) const;
+
+            /*!
+             * Retrieves the state with the given valuation (booleans are encoded as 0 and 1) or UNKNOWN_STATE. If
+             * several states have the valuation, the smallest one is returned.
+             */
+            uint64_t getStateOfValuation(int64_t const* valuation) const;
+
+            /*!
+             * Writes the masks of the states with the given consecutive valuations. Rows of unknown valuations are
+             * set to false.
+             */
+            void getMasksOfValuations(int64_t const* valuations, uint64_t numberOfStates, bool* masks, uint64_t numberOfThreads = 0) const;
+
+        private:
+            uint64_t numberOfStates;
+            uint64_t numberOfActions;
+            std::vector<std::string> actionNames;
+
+            // The masks of all states, one byte per action.
+            std::vector<uint8_t> allowed;
+            storm::storage::BitVector allowedChoices;
+
+            std::shared_ptr<storm::storage::sparse::StateValuationIndex const> valuationIndex;
+        };
+    }
+}
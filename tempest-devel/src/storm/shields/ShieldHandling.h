@@ -24,6 +24,13 @@ namespace tempest {
         template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
         std::unique_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> createShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
 
+        /*!
+         * Creates a safety shield for a model with the given row groups. This is used if the choice values are not computed on a model of
+         * the same value type, e.g., when they stem from parameter lifting.
+         */
+        template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
+        std::unique_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> createShield(std::vector<IndexType> const& rowGroupIndices, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
+
         template<typename ValueType, typename IndexType = storm::storage::sparse::state_type>
         std::unique_ptr<tempest::shields::AbstractShield<ValueType, IndexType>> createQuantitativeShield(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<ValueType> const& choiceValues, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, storm::OptimizationDirection optimizationDirection, storm::storage::BitVector relevantStates, boost::optional<storm::storage::BitVector> coalitionStates);
 
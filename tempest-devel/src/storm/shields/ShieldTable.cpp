@@ -0,0 +1,249 @@
+#include "storm/shields/ShieldTable.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "storm/adapters/JsonAdapter.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace tempest {
+    namespace shields {
+
+        namespace {
+            // "TSHIELD1" read as a little endian number.
+            uint64_t const SHIELD_TABLE_MAGIC = 0x31444c4549485354ull;
+
+            // The encoding starts with a header of five numbers: the magic number, the number of states, variables and
+            // actions, and the size of the names section. It is followed by the sorted state tuples, the masks and
+            // the zero-terminated variable and action names.
+            uint64_t const HEADER_SIZE = 5;
+
+            int64_t getValue(storm::json<double> const& value, std::string const& variable) {
+                if (value.is_boolean()) {
+                    return value.get<bool>() ? 1 : 0;
+                }
+                STORM_LOG_THROW(value.is_number_integer(), storm::exceptions::NotSupportedException, "Variable " << variable << " has the value " << value.dump() << ", but only boolean and integer variables are supported.");
+                return value.get<int64_t>();
+            }
+        }
+
+        ShieldTableView::ShieldTableView(void const* data, uint64_t size) {
+            uint64_t const* header = static_cast<uint64_t const*>(data);
+            STORM_LOG_THROW(size >= HEADER_SIZE * sizeof(uint64_t) && header[0] == SHIELD_TABLE_MAGIC, storm::exceptions::WrongFormatException, "The given data is not an encoded shield table.");
+            numberOfStates = header[1];
+            numberOfVariables = header[2];
+            uint64_t numberOfActions = header[3];
+            uint64_t namesSize = header[4];
+            uint64_t expectedSize = (HEADER_SIZE + numberOfStates * (numberOfVariables + 1)) * sizeof(uint64_t) + namesSize;
+            STORM_LOG_THROW(size >= expectedSize, storm::exceptions::WrongFormatException, "The encoded shield table is truncated (" << size << " instead of " << expectedSize << " bytes).");
+
+            states = reinterpret_cast<int64_t const*>(header + HEADER_SIZE);
+            masks = reinterpret_cast<uint64_t const*>(states + numberOfStates * numberOfVariables);
+            char const* names = reinterpret_cast<char const*>(masks + numberOfStates);
+            char const* namesEnd = names + namesSize;
+            for (uint64_t index = 0; index < numberOfVariables + numberOfActions; ++index) {
+                char const* nameEnd = std::find(names, namesEnd, '\0');
+                STORM_LOG_THROW(nameEnd != namesEnd, storm::exceptions::WrongFormatException, "The names of the encoded shield table are truncated.");
+                (index < numberOfVariables ? variableNames : actionNames).emplace_back(names, nameEnd);
+                names = nameEnd + 1;
+            }
+        }
+
+        uint64_t ShieldTableView::getNumberOfStates() const {
+            return numberOfStates;
+        }
+
+        uint64_t ShieldTableView::getNumberOfVariables() const {
+            return numberOfVariables;
+        }
+
+        std::vector<std::string> const& ShieldTableView::getVariableNames() const {
+            return variableNames;
+        }
+
+        std::vector<std::string> const& ShieldTableView::getActionNames() const {
+            return actionNames;
+        }
+
+        uint64_t ShieldTableView::getAllowedActions(int64_t const* state) const {
+            // Binary search over the lexicographically sorted state tuples.
+            uint64_t low = 0;
+            uint64_t high = numberOfStates;
+            while (low < high) {
+                uint64_t middle = low + (high - low) / 2;
+                int64_t const* candidate = states + middle * numberOfVariables;
+                if (std::lexicographical_compare(candidate, candidate + numberOfVariables, state, state + numberOfVariables)) {
+                    low = middle + 1;
+                } else {
+                    high = middle;
+                }
+            }
+            if (low < numberOfStates && std::equal(state, state + numberOfVariables, states + low * numberOfVariables)) {
+                return masks[low];
+            }
+            return UNKNOWN_STATE;
+        }
+
+        void ShieldTableView::getAllowedActions(int64_t const* states, uint64_t numberOfStates, uint64_t* masks) const {
+            for (uint64_t index = 0; index < numberOfStates; ++index) {
+                masks[index] = getAllowedActions(states + index * numberOfVariables);
+            }
+        }
+
+        std::vector<char> encodeShieldTable(std::istream& jsonShield) {
+            storm::json<double> shield;
+            jsonShield >> shield;
+            if (shield.is_object() && shield.count("shield") > 0) {
+                // Shields with a monitor wrap the state choices.
+                shield = shield["shield"];
+            }
+            STORM_LOG_THROW(shield.is_array(), storm::exceptions::WrongFormatException, "Expected a list of state choices in the exported shield.");
+
+            std::vector<std::string> variableNames;
+            std::map<std::string, uint64_t> actionToIndex;
+            std::vector<std::pair<std::vector<int64_t>, std::vector<std::string>>> rows;
+            for (auto const& entry : shield) {
+                STORM_LOG_THROW(entry.count("s") > 0 && entry["s"].is_object(), storm::exceptions::WrongFormatException, "The exported shield does not contain state valuations.");
+                STORM_LOG_THROW(entry.count("m") == 0 && entry.count("q") == 0, storm::exceptions::NotSupportedException, "Shields with memory can not be encoded as a table.");
+                auto const& valuation = entry["s"];
+                if (variableNames.empty()) {
+                    for (auto assignment = valuation.begin(); assignment != valuation.end(); ++assignment) {
+                        variableNames.push_back(assignment.key());
+                    }
+                }
+                STORM_LOG_THROW(valuation.size() == variableNames.size(), storm::exceptions::WrongFormatException, "All states of the exported shield need to assign the same variables.");
+                std::vector<int64_t> state;
+                state.reserve(variableNames.size());
+                for (auto const& variable : variableNames) {
+                    STORM_LOG_THROW(valuation.count(variable) > 0, storm::exceptions::WrongFormatException, "State " << valuation.dump() << " does not assign variable " << variable << ".");
+                    state.push_back(getValue(valuation[variable], variable));
+                }
+
+                std::vector<std::string> actions;
+                if (entry.count("c") > 0 && entry["c"].is_array()) {
+                    for (auto const& choice : entry["c"]) {
+                        STORM_LOG_THROW(choice.count("labels") > 0, storm::exceptions::WrongFormatException, "The exported shield does not contain choice labels.");
+                        for (auto const& label : choice["labels"]) {
+                            actions.push_back(label.get<std::string>());
+                            actionToIndex.emplace(actions.back(), 0);
+                        }
+                    }
+                }
+                // States without any allowed choice (exported as "undefined") are kept with an empty mask, so they are not
+                // mistaken for states the shield does not know.
+                rows.emplace_back(std::move(state), std::move(actions));
+            }
+            STORM_LOG_THROW(actionToIndex.size() <= ShieldTableView::MAXIMAL_NUMBER_OF_ACTIONS, storm::exceptions::NotSupportedException, "The exported shield has " << actionToIndex.size() << " distinct actions, but at most " << ShieldTableView::MAXIMAL_NUMBER_OF_ACTIONS << " are supported.");
+            uint64_t actionIndex = 0;
+            for (auto& action : actionToIndex) {
+                action.second = actionIndex++;
+            }
+
+            std::sort(rows.begin(), rows.end(), [] (auto const& first, auto const& second) { return first.first < second.first; });
+            for (uint64_t row = 1; row < rows.size(); ++row) {
+                STORM_LOG_THROW(rows[row - 1].first != rows[row].first, storm::exceptions::WrongFormatException, "The exported shield contains several states with the same valuation.");
+            }
+
+            std::string names;
+            for (auto const& variable : variableNames) {
+                names.append(variable).push_back('\0');
+            }
+            for (auto const& action : actionToIndex) {
+                names.append(action.first).push_back('\0');
+            }
+
+            std::vector<uint64_t> encoding = {SHIELD_TABLE_MAGIC, rows.size(), variableNames.size(), actionToIndex.size(), names.size()};
+            encoding.reserve(HEADER_SIZE + rows.size() * (variableNames.size() + 1));
+            for (auto const& row : rows) {
+                for (auto const& value : row.first) {
+                    encoding.push_back(static_cast<uint64_t>(value));
+                }
+            }
+            for (auto const& row : rows) {
+                uint64_t mask = 0;
+                for (auto const& action : row.second) {
+                    mask |= 1ull << actionToIndex.at(action);
+                }
+                encoding.push_back(mask);
+            }
+
+            std::vector<char> result(encoding.size() * sizeof(uint64_t) + names.size());
+            std::memcpy(result.data(), encoding.data(), encoding.size() * sizeof(uint64_t));
+            std::memcpy(result.data() + encoding.size() * sizeof(uint64_t), names.data(), names.size());
+            return result;
+        }
+
+        SharedShieldTable::SharedShieldTable(std::string const& name, void* data, uint64_t size, bool owner) : name(name), data(data), size(size), owner(owner), view(std::make_unique<ShieldTableView>(data, size)) {
+            // Intentionally left empty.
+        }
+
+        std::unique_ptr<SharedShieldTable> SharedShieldTable::create(std::string const& name, std::vector<char> const& encoding) {
+            // Validate the encoding before anything is published.
+            ShieldTableView(encoding.data(), encoding.size());
+
+            int fileDescriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+            STORM_LOG_THROW(fileDescriptor >= 0, storm::exceptions::FileIoException, "Unable to create shared memory segment " << name << ": " << std::strerror(errno) << ".");
+            if (ftruncate(fileDescriptor, encoding.size()) != 0) {
+                int error = errno;
+                close(fileDescriptor);
+                shm_unlink(name.c_str());
+                STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to resize shared memory segment " << name << ": " << std::strerror(error) << ".");
+            }
+            void* data = mmap(nullptr, encoding.size(), PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+            close(fileDescriptor);
+            if (data == MAP_FAILED) {
+                shm_unlink(name.c_str());
+                STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to map shared memory segment " << name << ".");
+            }
+            std::memcpy(data, encoding.data(), encoding.size());
+            // The segment is not modified afterwards.
+            mprotect(data, encoding.size(), PROT_READ);
+            return std::unique_ptr<SharedShieldTable>(new SharedShieldTable(name, data, encoding.size(), true));
+        }
+
+        std::unique_ptr<SharedShieldTable> SharedShieldTable::open(std::string const& name) {
+            int fileDescriptor = shm_open(name.c_str(), O_RDONLY, 0);
+            STORM_LOG_THROW(fileDescriptor >= 0, storm::exceptions::FileIoException, "Unable to open shared memory segment " << name << ": " << std::strerror(errno) << ".");
+            struct stat status;
+            if (fstat(fileDescriptor, &status) != 0) {
+                close(fileDescriptor);
+                STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Unable to determine the size of shared memory segment " << name << ".");
+            }
+            uint64_t size = status.st_size;
+            void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+            close(fileDescriptor);
+            STORM_LOG_THROW(data != MAP_FAILED, storm::exceptions::FileIoException, "Unable to map shared memory segment " << name << ".");
+            try {
+                return std::unique_ptr<SharedShieldTable>(new SharedShieldTable(name, data, size, false));
+            } catch (...) {
+                munmap(data, size);
+                throw;
+            }
+        }
+
+        SharedShieldTable::~SharedShieldTable() {
+            munmap(data, size);
+            if (owner) {
+                shm_unlink(name.c_str());
+            }
+        }
+
+        std::string const& SharedShieldTable::getName() const {
+            return name;
+        }
+
+        ShieldTableView const& SharedShieldTable::getView() const {
+            return *view;
+        }
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace tempest {
+    namespace shields {
+
+        /*!
+         * A read-only view on a flat, position-independent encoding of a pre-safety shield that maps state tuples to
+         * masks of allowed actions. The encoding does not contain any pointers, so a single copy can be placed in
+         * shared memory and be queried by several processes at once.
+         *
+         * The state tuples are the values of the state variables (in the order given by getVariableNames, booleans
+         * are encoded as 0 and 1). Bit i of a mask is set if the action with index i (see getActionNames) is allowed.
+         */
+        class ShieldTableView {
+        public:
+            static constexpr uint64_t UNKNOWN_STATE = std::numeric_limits<uint64_t>::max();
+            static constexpr uint64_t MAXIMAL_NUMBER_OF_ACTIONS = 63;
+
+            /*!
+             * Creates a view on the given encoding, which has to stay alive as long as the view is used.
+             */
+            ShieldTableView(void const* data, uint64_t size);
+
+            uint64_t getNumberOfStates() const;
+            uint64_t getNumberOfVariables() const;
+            std::vector<std::string> const& getVariableNames() const;
+            std::vector<std::string> const& getActionNames() const;
+
+            /*!
+             * Retrieves the mask of allowed actions for the given state tuple or UNKNOWN_STATE if the shield does not
+             * contain the state. Clients should not allow any action in unknown states.
+             */
+            uint64_t getAllowedActions(int64_t const* state) const;
+
+            /*!
+             * Looks up the given number of consecutive state tuples.
+             */
+            void getAllowedActions(int64_t const* states, uint64_t numberOfStates, uint64_t* masks) const;
+
+        private:
+            int64_t const* states;
+            uint64_t const* masks;
+            uint64_t numberOfStates;
+            uint64_t numberOfVariables;
+            std::vector<std::string> variableNames;
+            std::vector<std::string> actionNames;
+        };
+
+        /*!
+         * Encodes a shield that was exported in the JSON format (see PreShield::printJsonToStream). Rational state
+         * variables are not supported, states without any allowed choice are kept with an empty mask and every distinct
+         * choice label becomes an action.
+         */
+        std::vector<char> encodeShieldTable(std::istream& jsonShield);
+
+        /*!
+         * A shield table that is placed in a named POSIX shared memory segment.
+         */
+        class SharedShieldTable {
+        public:
+            /*!
+             * Creates the segment with the given name (e.g. "/tempest-shield") and copies the encoding into it. The
+             * segment is removed when the created object is destroyed.
+             */
+            static std::unique_ptr<SharedShieldTable> create(std::string const& name, std::vector<char> const& encoding);
+
+            /*!
+             * Maps an existing segment read-only.
+             */
+            static std::unique_ptr<SharedShieldTable> open(std::string const& name);
+
+            ~SharedShieldTable();
+
+            SharedShieldTable(SharedShieldTable const&) = delete;
+            SharedShieldTable& operator=(SharedShieldTable const&) = delete;
+
+            std::string const& getName() const;
+            ShieldTableView const& getView() const;
+
+        private:
+            SharedShieldTable(std::string const& name, void* data, uint64_t size, bool owner);
+
+            std::string name;
+            void* data;
+            uint64_t size;
+            bool owner;
+            std::unique_ptr<ShieldTableView> view;
+        };
+    }
+}
@@ -0,0 +1,223 @@
+#include "storm/shields/StatisticalShieldEvaluation.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/beta.hpp>
+
+#include "storm/simulator/BatchedSparseModelSimulator.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace tempest {
+    namespace shields {
+
+        namespace {
+            // Batches below this size per thread are not worth spawning a thread for.
+            uint64_t const MINIMAL_NUMBER_OF_STATES_PER_THREAD = 1ull << 14;
+            // Values of choices that differ by at most this are considered equal when picking adversarial choices.
+            double const ADVERSARIAL_TOLERANCE = 1e-9;
+        }
+
+        std::pair<double, double> computeClopperPearsonInterval(uint64_t numberOfSuccesses, uint64_t numberOfTrials, double confidence) {
+            STORM_LOG_THROW(numberOfSuccesses <= numberOfTrials, storm::exceptions::InvalidArgumentException, "More successes than trials.");
+            STORM_LOG_THROW(confidence > 0 && confidence < 1, storm::exceptions::InvalidArgumentException, "The confidence must be in (0, 1).");
+            if (numberOfTrials == 0) {
+                return {0.0, 1.0};
+            }
+            double const errorProbability = 1 - confidence;
+            double lowerBound = 0;
+            double upperBound = 1;
+            if (numberOfSuccesses > 0) {
+                lowerBound = boost::math::ibeta_inv(static_cast<double>(numberOfSuccesses), static_cast<double>(numberOfTrials - numberOfSuccesses + 1), errorProbability / 2);
+            }
+            if (numberOfSuccesses < numberOfTrials) {
+                upperBound = boost::math::ibeta_inv(static_cast<double>(numberOfSuccesses + 1), static_cast<double>(numberOfTrials - numberOfSuccesses), 1 - errorProbability / 2);
+            }
+            return {lowerBound, upperBound};
+        }
+
+        template<typename ValueType>
+        StatisticalShieldEvaluator<ValueType>::StatisticalShieldEvaluator(storm::models::sparse::Model<ValueType> const& model, storm::storage::BitVector const& shieldedStates, storm::storage::BitVector const& allowedChoices, storm::storage::BitVector const& badStates) : model(model), shieldedStates(shieldedStates), allowedChoices(allowedChoices), badStates(badStates), stopStates(model.getNumberOfStates(), false) {
+            STORM_LOG_THROW(shieldedStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "Expected " << model.getNumberOfStates() << " shielded states, but got " << shieldedStates.size() << ".");
+            STORM_LOG_THROW(allowedChoices.size() == model.getNumberOfChoices(), storm::exceptions::InvalidArgumentException, "Expected " << model.getNumberOfChoices() << " allowed choices, but got " << allowedChoices.size() << ".");
+            STORM_LOG_THROW(badStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "Expected " << model.getNumberOfStates() << " bad states, but got " << badStates.size() << ".");
+        }
+
+        template<typename ValueType>
+        StatisticalShieldEvaluator<ValueType>::StatisticalShieldEvaluator(storm::models::sparse::Smg<ValueType> const& game, storm::logic::PlayerCoalition const& shieldedCoalition, storm::storage::BitVector const& allowedChoices, storm::storage::BitVector const& badStates) : StatisticalShieldEvaluator(game, game.computeStatesOfCoalition(shieldedCoalition), allowedChoices, badStates) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        void StatisticalShieldEvaluator<ValueType>::setStopStates(storm::storage::BitVector const& stopStates) {
+            STORM_LOG_THROW(stopStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "Expected " << model.getNumberOfStates() << " stop states, but got " << stopStates.size() << ".");
+            this->stopStates = stopStates;
+        }
+
+        template<typename ValueType>
+        storm::storage::BitVector StatisticalShieldEvaluator<ValueType>::computeChoicesOfPlayers(ShieldEvaluationOptions const& options) const {
+            auto const& rowGroupIndices = model.getTransitionMatrix().getRowGroupIndices();
+            uint64_t const numberOfStates = model.getNumberOfStates();
+
+            // The choices each player picks from. Shielded states without allowed choices are unrestricted.
+            storm::storage::BitVector candidateChoices(model.getNumberOfChoices(), true);
+            for (auto const& state : shieldedStates) {
+                bool hasAllowedChoice = false;
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    hasAllowedChoice |= allowedChoices.get(row);
+                }
+                if (hasAllowedChoice) {
+                    for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                        candidateChoices.set(row, allowedChoices.get(row));
+                    }
+                }
+            }
+            if (options.shieldedBehavior == PlayerBehavior::Uniform && options.environmentBehavior == PlayerBehavior::Uniform) {
+                return candidateChoices;
+            }
+
+            auto isAdversarial = [&] (uint64_t state) {
+                return (shieldedStates.get(state) ? options.shieldedBehavior : options.environmentBehavior) == PlayerBehavior::Adversarial;
+            };
+
+            // Compute the maximal violation probabilities within the horizon by value iteration, where uniform players
+            // average over their choices.
+            storm::storage::SparseMatrix<double> matrix = model.getTransitionMatrix().template toValueType<double>();
+            storm::storage::BitVector const absorbingStates = badStates | stopStates;
+            std::vector<double> values(numberOfStates, 0.0);
+            for (auto const& state : badStates) {
+                values[state] = 1.0;
+            }
+            std::vector<double> newValues = values;
+            auto computeStateValue = [&] (uint64_t state) {
+                double maximum = 0;
+                double sum = 0;
+                uint64_t numberOfCandidates = 0;
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    if (candidateChoices.get(row)) {
+                        double value = matrix.multiplyRowWithVector(row, values);
+                        maximum = std::max(maximum, value);
+                        sum += value;
+                        ++numberOfCandidates;
+                    }
+                }
+                if (numberOfCandidates == 0) {
+                    return values[state];
+                }
+                return isAdversarial(state) ? maximum : sum / numberOfCandidates;
+            };
+            for (uint64_t iteration = 0; iteration < options.horizon; ++iteration) {
+                storm::utility::parallel::forEachBlock(numberOfStates, options.numberOfThreads, MINIMAL_NUMBER_OF_STATES_PER_THREAD, [&] (uint64_t begin, uint64_t end) {
+                    for (uint64_t state = begin; state < end; ++state) {
+                        if (!absorbingStates.get(state)) {
+                            newValues[state] = computeStateValue(state);
+                        }
+                    }
+                });
+                double difference = 0;
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    difference = std::max(difference, std::abs(newValues[state] - values[state]));
+                }
+                std::swap(values, newValues);
+                if (difference <= ADVERSARIAL_TOLERANCE) {
+                    break;
+                }
+            }
+
+            // Adversarial players only keep the choices that maximize the violation probability.
+            storm::storage::BitVector choices = candidateChoices;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (!isAdversarial(state) || absorbingStates.get(state)) {
+                    continue;
+                }
+                double maximum = computeStateValue(state);
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    if (candidateChoices.get(row) && matrix.multiplyRowWithVector(row, values) < maximum - ADVERSARIAL_TOLERANCE) {
+                        choices.set(row, false);
+                    }
+                }
+            }
+            return choices;
+        }
+
+        template<typename ValueType>
+        ShieldEvaluationResult StatisticalShieldEvaluator<ValueType>::evaluate(ShieldEvaluationOptions const& options) const {
+            STORM_LOG_THROW(options.confidence > 0 && options.confidence < 1, storm::exceptions::InvalidArgumentException, "The confidence must be in (0, 1).");
+            STORM_LOG_THROW(options.batchSize > 0, storm::exceptions::InvalidArgumentException, "The batch size must be positive.");
+            double lowerHypothesis = 0;
+            double upperHypothesis = 0;
+            if (options.test == StatisticalTest::Sprt) {
+                STORM_LOG_THROW(options.threshold, storm::exceptions::InvalidArgumentException, "The SPRT requires a threshold.");
+                lowerHypothesis = options.threshold.get() - options.indifference;
+                upperHypothesis = options.threshold.get() + options.indifference;
+                STORM_LOG_THROW(lowerHypothesis > 0 && upperHypothesis < 1 && lowerHypothesis < upperHypothesis, storm::exceptions::InvalidArgumentException, "The indifference region around the threshold must be non-empty and lie within (0, 1).");
+                STORM_LOG_THROW(options.alpha > 0 && options.alpha < 1 && options.beta > 0 && options.beta < 1, storm::exceptions::InvalidArgumentException, "The error probabilities of the SPRT must be in (0, 1).");
+            }
+
+            uint64_t const batchSize = std::min(options.batchSize, std::max<uint64_t>(1, options.maximalNumberOfEpisodes));
+            storm::simulator::BatchedSparseModelSimulator<ValueType> simulator(model, batchSize);
+            simulator.setAllowedChoices(computeChoicesOfPlayers(options));
+            simulator.setTerminalStates(badStates | stopStates);
+
+            ShieldEvaluationResult result;
+            double logLikelihoodRatio = 0;
+            for (uint64_t batch = 1; result.numberOfEpisodes < options.maximalNumberOfEpisodes; ++batch) {
+                simulator.setSeed(options.seed + batch * 0x9E3779B97F4A7C15ull);
+                simulator.resetToInitial();
+                auto const& done = simulator.getDone();
+                for (uint64_t step = 0; step < options.horizon && !std::all_of(done.begin(), done.end(), [] (uint8_t value) { return value != 0; }); ++step) {
+                    simulator.randomStep(options.numberOfThreads);
+                }
+                uint64_t numberOfViolations = 0;
+                for (uint64_t episode = 0; episode < batchSize; ++episode) {
+                    if (!done[episode]) {
+                        ++result.numberOfUnfinishedEpisodes;
+                    } else if (badStates.get(simulator.getCurrentStates()[episode])) {
+                        ++numberOfViolations;
+                    }
+                }
+                result.numberOfEpisodes += batchSize;
+                result.numberOfViolations += numberOfViolations;
+
+                // Spend the error probability over the batches, such that the intervals hold at all batches at once.
+                double const batchErrorProbability = (1 - options.confidence) * 6 / (boost::math::constants::pi<double>() * boost::math::constants::pi<double>() * batch * batch);
+                std::tie(result.lowerBound, result.upperBound) = computeClopperPearsonInterval(result.numberOfViolations, result.numberOfEpisodes, 1 - batchErrorProbability);
+                result.estimate = static_cast<double>(result.numberOfViolations) / result.numberOfEpisodes;
+
+                if (options.test == StatisticalTest::Sprt) {
+                    logLikelihoodRatio += numberOfViolations * std::log(upperHypothesis / lowerHypothesis) + (batchSize - numberOfViolations) * std::log((1 - upperHypothesis) / (1 - lowerHypothesis));
+                    if (logLikelihoodRatio >= std::log((1 - options.beta) / options.alpha)) {
+                        result.decision = ThresholdDecision::AboveThreshold;
+                        break;
+                    } else if (logLikelihoodRatio <= std::log(options.beta / (1 - options.alpha))) {
+                        result.decision = ThresholdDecision::BelowThreshold;
+                        break;
+                    }
+                } else {
+                    if (options.threshold) {
+                        if (result.upperBound < options.threshold.get()) {
+                            result.decision = ThresholdDecision::BelowThreshold;
+                            break;
+                        } else if (result.lowerBound > options.threshold.get()) {
+                            result.decision = ThresholdDecision::AboveThreshold;
+                            break;
+                        }
+                    }
+                    if (result.upperBound - result.lowerBound <= 2 * options.precision) {
+                        break;
+                    }
+                }
+            }
+            STORM_LOG_WARN_COND(result.numberOfUnfinishedEpisodes == 0, result.numberOfUnfinishedEpisodes << " episodes did not end within the horizon of " << options.horizon << " steps and were counted as safe.");
+            return result;
+        }
+
+        template class StatisticalShieldEvaluator<double>;
+        template class StatisticalShieldEvaluator<storm::RationalNumber>;
+    }
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/storage/BitVector.h"
+#include "storm/models/sparse/Model.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/logic/PlayerCoalition.h"
+
+namespace tempest {
+    namespace shields {
+
+        enum class PlayerBehavior { Uniform, Adversarial };
+        enum class StatisticalTest { ClopperPearson, Sprt };
+        enum class ThresholdDecision { Undecided, BelowThreshold, AboveThreshold };
+
+        struct ShieldEvaluationOptions {
+            // The maximal number of steps of an episode. Episodes that neither violate nor stop within the horizon
+            // count as safe.
+            uint64_t horizon = 1000;
+
+            // How the shielded player chooses among the allowed choices and how the other players choose among all
+            // of their choices. Adversarial players take the choices that maximize the probability of a violation.
+            PlayerBehavior shieldedBehavior = PlayerBehavior::Uniform;
+            PlayerBehavior environmentBehavior = PlayerBehavior::Uniform;
+
+            // Clopper-Pearson simulates until the confidence interval is narrower than twice the precision (or
+            // excludes the threshold, if one is given). The SPRT decides whether the violation probability is above
+            // or below the threshold with the given error probabilities, outside of the indifference region.
+            StatisticalTest test = StatisticalTest::ClopperPearson;
+            double confidence = 0.95;
+            double precision = 0.01;
+            boost::optional<double> threshold;
+            double indifference = 0.005;
+            double alpha = 0.05;
+            double beta = 0.05;
+
+            // Episodes are simulated in batches of the given size, the statistics are only checked between batches.
+            uint64_t batchSize = 1ull << 14;
+            uint64_t maximalNumberOfEpisodes = 1ull << 24;
+            uint64_t seed = 0;
+            // If zero, all hardware threads are used.
+            uint64_t numberOfThreads = 0;
+        };
+
+        struct ShieldEvaluationResult {
+            uint64_t numberOfEpisodes = 0;
+            uint64_t numberOfViolations = 0;
+            // Episodes that reached the horizon without violating or stopping.
+            uint64_t numberOfUnfinishedEpisodes = 0;
+
+            // The estimated violation probability and a confidence interval around it. The interval holds with the
+            // requested confidence at all batches simultaneously, so it remains valid although it is used to stop.
+            double estimate = 0;
+            double lowerBound = 0;
+            double upperBound = 1;
+            ThresholdDecision decision = ThresholdDecision::Undecided;
+        };
+
+        /*!
+         * Estimates the probability that episodes of a game reach a bad state when one player is restricted by a
+         * shield, by simulating many episodes on all cores. This checks the safety a shield delivers in seconds,
+         * without training an agent behind it.
+         *
+         * The shielded player picks among the choices the shield allows. Adversarial behavior is memoryless: it
+         * follows the choices that maximize the violation probability within the horizon, as computed by value
+         * iteration on the game, and picks uniformly among ties.
+         */
+        template<typename ValueType>
+        class StatisticalShieldEvaluator {
+        public:
+            /*!
+             * @param shieldedStates The states in which the shield restricts the choices.
+             * @param allowedChoices The choices (i.e. rows of the transition matrix) the shield allows, e.g. from
+             * ShieldActionMasks::getAllowedChoices. Shielded states without allowed choices are unrestricted.
+             * @param badStates The states whose reachability is a violation.
+             */
+            StatisticalShieldEvaluator(storm::models::sparse::Model<ValueType> const& model, storm::storage::BitVector const& shieldedStates, storm::storage::BitVector const& allowedChoices, storm::storage::BitVector const& badStates);
+
+            /*!
+             * Shields the states of the given coalition of the game.
+             */
+            StatisticalShieldEvaluator(storm::models::sparse::Smg<ValueType> const& game, storm::logic::PlayerCoalition const& shieldedCoalition, storm::storage::BitVector const& allowedChoices, storm::storage::BitVector const& badStates);
+
+            /*!
+             * Episodes that reach one of the given states end without a violation.
+             */
+            void setStopStates(storm::storage::BitVector const& stopStates);
+
+            ShieldEvaluationResult evaluate(ShieldEvaluationOptions const& options) const;
+
+            /*!
+             * Computes the choices of the players under the given behaviors, i.e. the allowed choices of uniform
+             * shielded players, all choices of uniform environment players and the violation maximizing choices of
+             * adversarial players.
+             */
+            storm::storage::BitVector computeChoicesOfPlayers(ShieldEvaluationOptions const& options) const;
+
+        private:
+            storm::models::sparse::Model<ValueType> const& model;
+            storm::storage::BitVector shieldedStates;
+            storm::storage::BitVector allowedChoices;
+            storm::storage::BitVector badStates;
+            storm::storage::BitVector stopStates;
+        };
+
+        /*!
+         * Computes the Clopper-Pearson interval of the success probability of a binomial distribution with the given
+         * number of successes in the given number of trials.
+         */
+        std::pair<double, double> computeClopperPearsonInterval(uint64_t numberOfSuccesses, uint64_t numberOfTrials, double confidence);
+    }
+}
@@ -0,0 +1,312 @@
+#include "storm/simulator/BatchedSparseModelSimulator.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace simulator {
+
+        namespace {
+            // Batches below this size per thread are not worth spawning a thread for.
+            uint64_t const MINIMAL_NUMBER_OF_EPISODES_PER_THREAD = 1ull << 12;
+            uint64_t const NO_CHOICE = std::numeric_limits<uint64_t>::max();
+
+            // The finalizer of SplitMix64, which turns a counter into a well-distributed random number.
+            uint64_t mix(uint64_t value) {
+                value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+                value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+                return value ^ (value >> 31);
+            }
+
+            // Maps the upper 32 bits of a random number uniformly to [0, bound).
+            uint64_t scaleToBound(uint64_t random, uint64_t bound) {
+                return ((random >> 32) * bound) >> 32;
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        BatchedSparseModelSimulator<ValueType, RewardModelType>::BatchedSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model, uint64_t numberOfEpisodes, uint64_t seed) : model(model), rowGroupIndices(model.getTransitionMatrix().getRowGroupIndices()), numberOfEpisodes(numberOfEpisodes), numberOfRewardModels(model.getNumberOfRewardModels()) {
+            STORM_LOG_THROW(!model.getInitialStates().empty(), storm::exceptions::InvalidArgumentException, "The model has no initial state.");
+            STORM_LOG_WARN_COND(model.getInitialStates().getNumberOfSetBits() == 1, "The model has multiple initial states. This simulator assumes it starts from the initial state with the lowest index.");
+            auto const& matrix = model.getTransitionMatrix();
+            uint64_t const numberOfStates = model.getNumberOfStates();
+
+            // Build the alias table of each row (Vose's method).
+            rowStarts.reserve(matrix.getRowCount() + 1);
+            successors.reserve(matrix.getEntryCount());
+            aliasProbabilities.reserve(matrix.getEntryCount());
+            aliases.reserve(matrix.getEntryCount());
+            std::vector<double> scaledProbabilities;
+            std::vector<uint32_t> small;
+            std::vector<uint32_t> large;
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                uint64_t const rowStart = successors.size();
+                rowStarts.push_back(rowStart);
+                STORM_LOG_THROW(matrix.getRow(row).getNumberOfEntries() <= std::numeric_limits<uint32_t>::max(), storm::exceptions::NotSupportedException, "Row " << row << " has too many entries.");
+                uint32_t const numberOfEntries = matrix.getRow(row).getNumberOfEntries();
+                double sum = 0;
+                for (auto const& entry : matrix.getRow(row)) {
+                    successors.push_back(entry.getColumn());
+                    scaledProbabilities.push_back(storm::utility::convertNumber<double>(entry.getValue()));
+                    sum += scaledProbabilities.back();
+                }
+                aliasProbabilities.resize(successors.size(), 1.0);
+                aliases.resize(successors.size());
+                for (uint32_t index = 0; index < numberOfEntries; ++index) {
+                    aliases[rowStart + index] = index;
+                    scaledProbabilities[index] *= numberOfEntries / sum;
+                    (scaledProbabilities[index] < 1.0 ? small : large).push_back(index);
+                }
+                while (!small.empty() && !large.empty()) {
+                    uint32_t smallIndex = small.back();
+                    small.pop_back();
+                    uint32_t largeIndex = large.back();
+                    large.pop_back();
+                    aliasProbabilities[rowStart + smallIndex] = scaledProbabilities[smallIndex];
+                    aliases[rowStart + smallIndex] = largeIndex;
+                    scaledProbabilities[largeIndex] -= 1.0 - scaledProbabilities[smallIndex];
+                    (scaledProbabilities[largeIndex] < 1.0 ? small : large).push_back(largeIndex);
+                }
+                // Entries that remain (only due to rounding errors in the small list) are kept with probability one.
+                small.clear();
+                large.clear();
+                scaledProbabilities.clear();
+            }
+            rowStarts.push_back(successors.size());
+
+            stateRewards.assign(numberOfStates * numberOfRewardModels, 0.0);
+            stateActionRewards.assign(matrix.getRowCount() * numberOfRewardModels, 0.0);
+            uint64_t rewardModelIndex = 0;
+            for (auto const& rewardModel : model.getRewardModels()) {
+                if (rewardModel.second.hasStateRewards()) {
+                    for (uint64_t state = 0; state < numberOfStates; ++state) {
+                        stateRewards[state * numberOfRewardModels + rewardModelIndex] = storm::utility::convertNumber<double>(rewardModel.second.getStateReward(state));
+                    }
+                }
+                if (rewardModel.second.hasStateActionRewards()) {
+                    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                        stateActionRewards[row * numberOfRewardModels + rewardModelIndex] = storm::utility::convertNumber<double>(rewardModel.second.getStateActionReward(row));
+                    }
+                }
+                ++rewardModelIndex;
+            }
+
+            sinkStates = storm::storage::BitVector(numberOfStates, false);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                if (model.isSinkState(state)) {
+                    sinkStates.set(state, true);
+                }
+            }
+            terminalStates = sinkStates;
+            clearAllowedChoices();
+
+            currentStates.resize(numberOfEpisodes);
+            lastChoices.resize(numberOfEpisodes);
+            lastRewards.resize(numberOfEpisodes * numberOfRewardModels);
+            done.resize(numberOfEpisodes);
+            overridden.resize(numberOfEpisodes);
+            setSeed(seed);
+            resetToInitial();
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        uint64_t BatchedSparseModelSimulator<ValueType, RewardModelType>::getNumberOfEpisodes() const {
+            return numberOfEpisodes;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setSeed(uint64_t seed) {
+            randomStreams.resize(numberOfEpisodes);
+            for (uint64_t episode = 0; episode < numberOfEpisodes; ++episode) {
+                randomStreams[episode] = mix(seed ^ mix(episode + 1));
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setAllowedChoices(storm::storage::BitVector const& allowedChoices) {
+            STORM_LOG_THROW(allowedChoices.size() == model.getNumberOfChoices(), storm::exceptions::InvalidArgumentException, "Expected " << model.getNumberOfChoices() << " choices, but got " << allowedChoices.size() << ".");
+            this->allowedChoices = allowedChoices;
+            numberOfAllowedChoices.resize(model.getNumberOfStates());
+            for (uint64_t state = 0; state < model.getNumberOfStates(); ++state) {
+                numberOfAllowedChoices[state] = 0;
+                for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                    if (allowedChoices.get(row)) {
+                        ++numberOfAllowedChoices[state];
+                    }
+                }
+                if (numberOfAllowedChoices[state] == 0) {
+                    for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                        this->allowedChoices.set(row, true);
+                    }
+                    numberOfAllowedChoices[state] = rowGroupIndices[state + 1] - rowGroupIndices[state];
+                }
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::clearAllowedChoices() {
+            setAllowedChoices(storm::storage::BitVector(model.getNumberOfChoices(), true));
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setTerminalStates(storm::storage::BitVector const& terminalStates) {
+            STORM_LOG_THROW(terminalStates.size() == model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "Expected " << model.getNumberOfStates() << " states, but got " << terminalStates.size() << ".");
+            this->terminalStates = sinkStates | terminalStates;
+            for (uint64_t episode = 0; episode < numberOfEpisodes; ++episode) {
+                done[episode] = this->terminalStates.get(currentStates[episode]) ? 1 : 0;
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::resetToInitial(bool const* episodes) {
+            uint64_t initialState = *model.getInitialStates().begin();
+            for (uint64_t episode = 0; episode < numberOfEpisodes; ++episode) {
+                if (episodes == nullptr || episodes[episode]) {
+                    setState(episode, initialState);
+                }
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setCurrentStates(uint64_t const* states) {
+            for (uint64_t episode = 0; episode < numberOfEpisodes; ++episode) {
+                STORM_LOG_THROW(states[episode] < model.getNumberOfStates(), storm::exceptions::InvalidArgumentException, "State " << states[episode] << " does not exist.");
+            }
+            for (uint64_t episode = 0; episode < numberOfEpisodes; ++episode) {
+                setState(episode, states[episode]);
+            }
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::step(uint64_t const* choices, uint64_t numberOfThreads) {
+            for (uint64_t episode = 0; episode < numberOfEpisodes; ++episode) {
+                uint64_t state = currentStates[episode];
+                STORM_LOG_THROW(done[episode] || choices[episode] < rowGroupIndices[state + 1] - rowGroupIndices[state], storm::exceptions::InvalidArgumentException, "Choice " << choices[episode] << " of episode " << episode << " does not exist in state " << state << ".");
+            }
+            storm::utility::parallel::forEachBlock(numberOfEpisodes, numberOfThreads, MINIMAL_NUMBER_OF_EPISODES_PER_THREAD, [&] (uint64_t begin, uint64_t end) {
+                for (uint64_t episode = begin; episode < end; ++episode) {
+                    if (done[episode]) {
+                        lastChoices[episode] = NO_CHOICE;
+                        std::fill_n(lastRewards.begin() + episode * numberOfRewardModels, numberOfRewardModels, 0.0);
+                        overridden[episode] = 0;
+                        continue;
+                    }
+                    uint64_t state = currentStates[episode];
+                    uint64_t row = rowGroupIndices[state] + choices[episode];
+                    overridden[episode] = allowedChoices.get(row) ? 0 : 1;
+                    if (overridden[episode]) {
+                        row = sampleAllowedChoice(episode, state);
+                    }
+                    takeChoice(episode, row);
+                }
+            });
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::randomStep(uint64_t numberOfThreads) {
+            storm::utility::parallel::forEachBlock(numberOfEpisodes, numberOfThreads, MINIMAL_NUMBER_OF_EPISODES_PER_THREAD, [&] (uint64_t begin, uint64_t end) {
+                for (uint64_t episode = begin; episode < end; ++episode) {
+                    overridden[episode] = 0;
+                    if (done[episode]) {
+                        lastChoices[episode] = NO_CHOICE;
+                        std::fill_n(lastRewards.begin() + episode * numberOfRewardModels, numberOfRewardModels, 0.0);
+                        continue;
+                    }
+                    takeChoice(episode, sampleAllowedChoice(episode, currentStates[episode]));
+                }
+            });
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::vector<uint64_t> const& BatchedSparseModelSimulator<ValueType, RewardModelType>::getCurrentStates() const {
+            return currentStates;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::vector<uint64_t> const& BatchedSparseModelSimulator<ValueType, RewardModelType>::getLastChoices() const {
+            return lastChoices;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::vector<double> const& BatchedSparseModelSimulator<ValueType, RewardModelType>::getLastRewards() const {
+            return lastRewards;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::vector<uint8_t> const& BatchedSparseModelSimulator<ValueType, RewardModelType>::getDone() const {
+            return done;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        std::vector<uint8_t> const& BatchedSparseModelSimulator<ValueType, RewardModelType>::getOverridden() const {
+            return overridden;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        uint64_t BatchedSparseModelSimulator<ValueType, RewardModelType>::nextRandom(uint64_t episode) {
+            return mix(randomStreams[episode] += 0x9E3779B97F4A7C15ull);
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        uint64_t BatchedSparseModelSimulator<ValueType, RewardModelType>::sampleAllowedChoice(uint64_t episode, uint64_t state) {
+            uint64_t const numberOfChoices = rowGroupIndices[state + 1] - rowGroupIndices[state];
+            STORM_LOG_ASSERT(numberOfChoices > 0, "Can not sample a choice of state " << state << " without choices.");
+            if (numberOfChoices == 1) {
+                return rowGroupIndices[state];
+            }
+            uint64_t index = scaleToBound(nextRandom(episode), numberOfAllowedChoices[state]);
+            if (numberOfAllowedChoices[state] == numberOfChoices) {
+                return rowGroupIndices[state] + index;
+            }
+            uint64_t row = allowedChoices.getNextSetIndex(rowGroupIndices[state]);
+            for (; index > 0; --index) {
+                row = allowedChoices.getNextSetIndex(row + 1);
+            }
+            return row;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::takeChoice(uint64_t episode, uint64_t row) {
+            uint64_t const rowStart = rowStarts[row];
+            uint64_t const numberOfEntries = rowStarts[row + 1] - rowStart;
+            uint64_t successor = currentStates[episode];
+            if (numberOfEntries == 1) {
+                successor = successors[rowStart];
+            } else if (numberOfEntries > 1) {
+                // The upper bits select the entry and the lower bits decide between the entry and its alias.
+                uint64_t random = nextRandom(episode);
+                uint64_t index = scaleToBound(random, numberOfEntries);
+                if (static_cast<double>(random & 0xFFFFFFFFull) * (1.0 / 4294967296.0) >= aliasProbabilities[rowStart + index]) {
+                    index = aliases[rowStart + index];
+                }
+                successor = successors[rowStart + index];
+            }
+            lastChoices[episode] = row;
+            for (uint64_t rewardModel = 0; rewardModel < numberOfRewardModels; ++rewardModel) {
+                lastRewards[episode * numberOfRewardModels + rewardModel] = stateActionRewards[row * numberOfRewardModels + rewardModel] + stateRewards[successor * numberOfRewardModels + rewardModel];
+            }
+            currentStates[episode] = successor;
+            done[episode] = terminalStates.get(successor) ? 1 : 0;
+        }
+
+        template<typename ValueType, typename RewardModelType>
+        void BatchedSparseModelSimulator<ValueType, RewardModelType>::setState(uint64_t episode, uint64_t state) {
+            currentStates[episode] = state;
+            lastChoices[episode] = NO_CHOICE;
+            std::copy_n(stateRewards.begin() + state * numberOfRewardModels, numberOfRewardModels, lastRewards.begin() + episode * numberOfRewardModels);
+            done[episode] = terminalStates.get(state) ? 1 : 0;
+            overridden[episode] = 0;
+        }
+
+        template class BatchedSparseModelSimulator<double>;
+        template class BatchedSparseModelSimulator<storm::RationalNumber>;
+    }
+}
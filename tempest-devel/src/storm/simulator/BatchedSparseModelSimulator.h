@@ -0,0 +1,135 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "storm/models/sparse/Model.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace simulator {
+
+        /*!
+         * Simulates many independent episodes of a discrete-time model stored explicitly as a SparseModel at once.
+         * The current states of all episodes are kept in one array and advanced by a single call.
+         *
+         * Successors are sampled in constant time from alias tables that are built once for each choice. Each episode
+         * draws its random numbers from its own counter-based stream, so the simulated episodes only depend on the seed
+         * and not on the number of threads used.
+         *
+         * Episodes end in terminal states, which are the sink states of the model and the states that are explicitly
+         * marked as terminal. Episodes that ended are no longer advanced until they are reset.
+         */
+        template<typename ValueType, typename RewardModelType = storm::models::sparse::StandardRewardModel<ValueType>>
+        class BatchedSparseModelSimulator {
+        public:
+            BatchedSparseModelSimulator(storm::models::sparse::Model<ValueType, RewardModelType> const& model, uint64_t numberOfEpisodes, uint64_t seed = 0);
+
+            uint64_t getNumberOfEpisodes() const;
+
+            /*!
+             * Restarts the random streams of all episodes.
+             */
+            void setSeed(uint64_t seed);
+
+            /*!
+             * Restricts the choices that are taken in each state, e.g. to the choices allowed by a shield. A chosen
+             * choice that is not allowed is replaced by an allowed choice selected uniformly at random. States in which
+             * no choice is allowed are unrestricted.
+             */
+            void setAllowedChoices(storm::storage::BitVector const& allowedChoices);
+            void clearAllowedChoices();
+
+            /*!
+             * Marks the given states as terminal in addition to the sink states of the model.
+             */
+            void setTerminalStates(storm::storage::BitVector const& terminalStates);
+
+            /*!
+             * Moves all episodes (or only the selected ones) to the initial state with the lowest index.
+             */
+            void resetToInitial(bool const* episodes = nullptr);
+
+            /*!
+             * Moves the episodes to the given states.
+             */
+            void setCurrentStates(uint64_t const* states);
+
+            /*!
+             * Takes the given local choice in each episode.
+             *
+             * @param numberOfThreads The number of threads to use. If zero, large batches are split among all hardware
+             * threads.
+             */
+            void step(uint64_t const* choices, uint64_t numberOfThreads = 0);
+
+            /*!
+             * Takes a choice selected uniformly at random among the allowed choices in each episode.
+             */
+            void randomStep(uint64_t numberOfThreads = 0);
+
+            /*!
+             * The current state of each episode.
+             */
+            std::vector<uint64_t> const& getCurrentStates() const;
+
+            /*!
+             * The choice (i.e. row of the transition matrix) taken in the last step of each episode or
+             * std::numeric_limits<uint64_t>::max() if the episode did not move.
+             */
+            std::vector<uint64_t> const& getLastChoices() const;
+
+            /*!
+             * The rewards collected in the last step of each episode as a row-major matrix with one column per reward
+             * model. As in DiscreteTimeSparseModelSimulator, a step collects the state-action reward of the choice and
+             * the state reward of the successor.
+             */
+            std::vector<double> const& getLastRewards() const;
+
+            /*!
+             * For each episode, one if the episode is in a terminal state and zero otherwise.
+             */
+            std::vector<uint8_t> const& getDone() const;
+
+            /*!
+             * For each episode, one if the choice given to the last step was not allowed and had to be replaced.
+             */
+            std::vector<uint8_t> const& getOverridden() const;
+
+        private:
+            uint64_t nextRandom(uint64_t episode);
+            uint64_t sampleAllowedChoice(uint64_t episode, uint64_t state);
+            void takeChoice(uint64_t episode, uint64_t row);
+            void setState(uint64_t episode, uint64_t state);
+
+            storm::models::sparse::Model<ValueType, RewardModelType> const& model;
+            std::vector<typename storm::storage::SparseMatrix<ValueType>::index_type> const& rowGroupIndices;
+            uint64_t numberOfEpisodes;
+            uint64_t numberOfRewardModels;
+
+            // For each entry of the transition matrix, its successor state and the alias table of its row, i.e. the
+            // probability to keep the entry and the (row-local) index of the entry taken otherwise.
+            std::vector<uint64_t> rowStarts;
+            std::vector<uint64_t> successors;
+            std::vector<double> aliasProbabilities;
+            std::vector<uint32_t> aliases;
+
+            // The state rewards of each state and the state-action rewards of each choice, one column per reward model.
+            std::vector<double> stateRewards;
+            std::vector<double> stateActionRewards;
+
+            storm::storage::BitVector sinkStates;
+            storm::storage::BitVector terminalStates;
+            // The allowed choices (all choices of states in which no choice is allowed) and their number in each state.
+            storm::storage::BitVector allowedChoices;
+            std::vector<uint64_t> numberOfAllowedChoices;
+
+            std::vector<uint64_t> randomStreams;
+            std::vector<uint64_t> currentStates;
+            std::vector<uint64_t> lastChoices;
+            std::vector<double> lastRewards;
+            std::vector<uint8_t> done;
+            std::vector<uint8_t> overridden;
+        };
+    }
+}
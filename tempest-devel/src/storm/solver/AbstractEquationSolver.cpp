@@ -10,6 +10,7 @@
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/utility/ProgressListener.h"
 
 
 namespace storm {
@@ -310,6 +311,21 @@ namespace storm {
         }
 
 
+        template<typename ValueType>
+        void AbstractEquationSolver<ValueType>::reportProgressIterative(uint64_t iterations, std::vector<ValueType> const& previousX, std::vector<ValueType> const& currentX) const {
+            if (storm::utility::progress::isProgressReportDue()) {
+                double residual = std::numeric_limits<double>::quiet_NaN();
+                if constexpr (!std::is_same<ValueType, storm::RationalFunction>::value) {
+                    ValueType maxDiff = storm::utility::zero<ValueType>();
+                    for (auto previousIt = previousX.begin(), currentIt = currentX.begin(); previousIt != previousX.end(); ++previousIt, ++currentIt) {
+                        maxDiff = storm::utility::max<ValueType>(maxDiff, storm::utility::abs<ValueType>(*currentIt - *previousIt));
+                    }
+                    residual = storm::utility::convertNumber<double>(maxDiff);
+                }
+                storm::utility::progress::reportIteration(iterations, residual);
+            }
+        }
+
         template<typename ValueType>
         void AbstractEquationSolver<ValueType>::reportStatus(SolverStatus status, boost::optional<uint64_t> const& iterations) const {
             if (iterations) {
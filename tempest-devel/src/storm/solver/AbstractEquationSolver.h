@@ -195,6 +195,12 @@ namespace storm {
              */
             void showProgressIterative(uint64_t iterations, boost::optional<uint64_t> const& bound = boost::none) const;
 
+            /*!
+             * Reports the iteration and the maximal difference between the given iterates to the installed progress
+             * callback (see storm::utility::progress), if a report is due.
+             */
+            void reportProgressIterative(uint64_t iterations, std::vector<ValueType> const& previousX, std::vector<ValueType> const& currentX) const;
+
         protected:
             /*!
              * Retrieves the custom termination condition (if any was set).
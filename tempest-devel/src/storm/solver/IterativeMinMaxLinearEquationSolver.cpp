@@ -343,6 +343,7 @@ namespace storm {
 
                 // Potentially show progress.
                 this->showProgressIterative(iterations);
+                this->reportProgressIterative(iterations, *newX, *currentX);
             }
 
             return ValueIterationResult(iterations - currentIterations, status);
@@ -661,6 +662,7 @@ namespace storm {
 
                 // Potentially show progress.
                 this->showProgressIterative(iterations);
+                this->reportProgressIterative(iterations, *lowerX, *upperX);
             }
 
             this->reportStatus(status, iterations);
@@ -146,6 +146,7 @@ namespace storm {
                 
                 // Potentially show progress.
                 this->showProgressIterative(iterations);
+                this->reportProgressIterative(iterations, *nextX, *currentX);
                 
                 // Increase iteration count so we can abort if convergence is too slow.
                 ++iterations;
@@ -337,6 +338,7 @@ namespace storm {
 
                 // Potentially show progress.
                 this->showProgressIterative(iterations);
+                this->reportProgressIterative(iterations, *newX, *currentX);
             }
 
             return PowerIterationResult(iterations - currentIterations, status);
@@ -551,6 +553,7 @@ namespace storm {
                 
                 // Potentially show progress.
                 this->showProgressIterative(iterations);
+                this->reportProgressIterative(iterations, *lowerX, *upperX);
 
                 
                 // Set up next iteration.
@@ -0,0 +1,387 @@
+#include "storm/solver/SimdMultiplier.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+
+#include "storm-config.h"
+
+#include "storm/storage/SparseMatrix.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define STORM_SIMD_MULTIPLIER_X86
+#include <immintrin.h>
+#endif
+
+namespace storm {
+    namespace solver {
+
+        namespace {
+            enum class RowKernel { Scalar, Avx2, Avx512 };
+
+            // The rows of the matrix in sliced ELLPACK format. Each slice holds sliceHeight rows, which are padded to the length
+            // of the longest row of the slice. The entries are stored column by column, i.e. the k-th entries of all rows of a
+            // slice are consecutive, so that one vector register processes a whole slice. Slots of the last slice without a row
+            // refer to the row numberOfRows.
+            struct SlicedRows {
+                uint64_t numberOfRows;
+                uint64_t numberOfSlices;
+                uint64_t sliceHeight;
+                uint64_t const* sliceStarts;
+                uint64_t const* sliceRows;
+                uint32_t const* rowLengths;
+                double const* values;
+                uint32_t const* columns;
+            };
+
+            void computeRowValuesScalar(SlicedRows const& rows, double const* x, double const* b, double* target) {
+                for (uint64_t slice = 0; slice < rows.numberOfSlices; ++slice) {
+                    for (uint64_t slot = slice * rows.sliceHeight, slotEnd = slot + rows.sliceHeight; slot < slotEnd; ++slot) {
+                        uint64_t const row = rows.sliceRows[slot];
+                        if (row == rows.numberOfRows) {
+                            continue;
+                        }
+                        double rowValue = b ? b[row] : 0.0;
+                        for (uint64_t entry = rows.sliceStarts[slice] + slot - slice * rows.sliceHeight, entryEnd = entry + rows.rowLengths[slot] * rows.sliceHeight; entry < entryEnd; entry += rows.sliceHeight) {
+                            rowValue += rows.values[entry] * x[rows.columns[entry]];
+                        }
+                        target[row] = rowValue;
+                    }
+                }
+            }
+
+#ifdef STORM_SIMD_MULTIPLIER_X86
+            // The gathers interpret the column indices as signed 32-bit integers, which is fine as the multiplier only uses
+            // the kernels if all columns fit into an int32_t. Padded entries are masked out of the gathers, so they neither
+            // read x nor turn infinite values into NaNs. Each row is summed up in the same order as by the scalar kernel.
+            __attribute__((target("avx2")))
+            void computeRowValuesAvx2(SlicedRows const& rows, double const* x, double const* b, double* target) {
+                for (uint64_t slice = 0; slice < rows.numberOfSlices; ++slice) {
+                    uint64_t const* sliceRows = rows.sliceRows + 4 * slice;
+                    alignas(32) double rowValues[4];
+                    for (uint64_t lane = 0; lane < 4; ++lane) {
+                        rowValues[lane] = b && sliceRows[lane] != rows.numberOfRows ? b[sliceRows[lane]] : 0.0;
+                    }
+                    __m256d sums = _mm256_load_pd(rowValues);
+                    __m256i rowLengths = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<__m128i const*>(rows.rowLengths + 4 * slice)));
+                    for (uint64_t entry = rows.sliceStarts[slice], entryEnd = rows.sliceStarts[slice + 1], k = 0; entry < entryEnd; entry += 4, ++k) {
+                        __m256d mask = _mm256_castsi256_pd(_mm256_cmpgt_epi64(rowLengths, _mm256_set1_epi64x(k)));
+                        __m128i columnIndices = _mm_loadu_si128(reinterpret_cast<__m128i const*>(rows.columns + entry));
+                        __m256d vectorValues = _mm256_mask_i32gather_pd(_mm256_setzero_pd(), x, columnIndices, mask, sizeof(double));
+                        sums = _mm256_add_pd(sums, _mm256_mul_pd(_mm256_loadu_pd(rows.values + entry), vectorValues));
+                    }
+                    _mm256_store_pd(rowValues, sums);
+                    for (uint64_t lane = 0; lane < 4; ++lane) {
+                        if (sliceRows[lane] != rows.numberOfRows) {
+                            target[sliceRows[lane]] = rowValues[lane];
+                        }
+                    }
+                }
+            }
+
+            __attribute__((target("avx512f")))
+            void computeRowValuesAvx512(SlicedRows const& rows, double const* x, double const* b, double* target) {
+                for (uint64_t slice = 0; slice < rows.numberOfSlices; ++slice) {
+                    uint64_t const* sliceRows = rows.sliceRows + 8 * slice;
+                    alignas(64) double rowValues[8];
+                    for (uint64_t lane = 0; lane < 8; ++lane) {
+                        rowValues[lane] = b && sliceRows[lane] != rows.numberOfRows ? b[sliceRows[lane]] : 0.0;
+                    }
+                    __m512d sums = _mm512_load_pd(rowValues);
+                    __m512i rowLengths = _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(rows.rowLengths + 8 * slice)));
+                    for (uint64_t entry = rows.sliceStarts[slice], entryEnd = rows.sliceStarts[slice + 1], k = 0; entry < entryEnd; entry += 8, ++k) {
+                        __mmask8 mask = _mm512_cmpgt_epi64_mask(rowLengths, _mm512_set1_epi64(k));
+                        __m256i columnIndices = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(rows.columns + entry));
+                        __m512d vectorValues = _mm512_mask_i32gather_pd(_mm512_setzero_pd(), mask, columnIndices, x, sizeof(double));
+                        sums = _mm512_add_pd(sums, _mm512_mul_pd(_mm512_loadu_pd(rows.values + entry), vectorValues));
+                    }
+                    _mm512_store_pd(rowValues, sums);
+                    for (uint64_t lane = 0; lane < 8; ++lane) {
+                        if (sliceRows[lane] != rows.numberOfRows) {
+                            target[sliceRows[lane]] = rowValues[lane];
+                        }
+                    }
+                }
+            }
+#endif
+
+            RowKernel selectRowKernel() {
+#ifdef STORM_SIMD_MULTIPLIER_X86
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f")) {
+                    return RowKernel::Avx512;
+                } else if (__builtin_cpu_supports("avx2")) {
+                    return RowKernel::Avx2;
+                }
+#endif
+                return RowKernel::Scalar;
+            }
+
+            RowKernel getRowKernel() {
+                // The supported instruction set does not change while running, so we only detect it once.
+                static RowKernel const kernel = selectRowKernel();
+                return kernel;
+            }
+
+            // The number of rows processed by one vector register of the kernel.
+            uint64_t getSliceHeight(RowKernel kernel) {
+                switch (kernel) {
+                    case RowKernel::Avx512:
+                        return 8;
+                    case RowKernel::Avx2:
+                        return 4;
+                    default:
+                        return 1;
+                }
+            }
+
+            void computeRowValuesWithKernel(SlicedRows const& rows, double const* x, double const* b, double* target) {
+                switch (getRowKernel()) {
+#ifdef STORM_SIMD_MULTIPLIER_X86
+                    case RowKernel::Avx512:
+                        computeRowValuesAvx512(rows, x, b, target);
+                        return;
+                    case RowKernel::Avx2:
+                        computeRowValuesAvx2(rows, x, b, target);
+                        return;
+#endif
+                    default:
+                        computeRowValuesScalar(rows, x, b, target);
+                }
+            }
+
+            // Rows are sorted by their length within windows of this many slices, so that the rows of a slice have similar
+            // lengths (and little padding) while the accesses to the result stay local.
+            uint64_t const slicesPerSortingWindow = 8;
+        }
+
+        template<typename ValueType>
+        SimdMultiplier<ValueType>::SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix) : Multiplier<ValueType>(matrix), initialized(false), useKernel(false), sliceHeight(1), batchesInitialized(false) {
+            // Intentionally left empty.
+        }
+
+        template<typename ValueType>
+        bool SimdMultiplier<ValueType>::initialize() const {
+            if (!initialized) {
+                initialized = true;
+                // The gathers use signed 32-bit indices.
+                useKernel = std::is_same<ValueType, double>::value && this->matrix.getColumnCount() <= static_cast<uint64_t>(std::numeric_limits<int32_t>::max());
+                STORM_LOG_WARN_COND(useKernel, "The SIMD multiplier only supports double values and matrices with at most 2^31 - 1 columns. Falling back to the sparse matrix operations.");
+                if (useKernel) {
+                    uint64_t const numberOfRows = this->matrix.getRowCount();
+                    sliceHeight = getSliceHeight(getRowKernel());
+                    uint64_t const numberOfSlices = (numberOfRows + sliceHeight - 1) / sliceHeight;
+                    auto getRowLength = [this] (uint64_t row) { return this->matrix.getRow(row).getNumberOfEntries(); };
+
+                    sliceRows.resize(numberOfSlices * sliceHeight);
+                    std::iota(sliceRows.begin(), sliceRows.begin() + numberOfRows, 0);
+                    std::fill(sliceRows.begin() + numberOfRows, sliceRows.end(), numberOfRows);
+                    if (sliceHeight > 1) {
+                        uint64_t const windowSize = slicesPerSortingWindow * sliceHeight;
+                        for (uint64_t windowStart = 0; windowStart < numberOfRows; windowStart += windowSize) {
+                            std::stable_sort(sliceRows.begin() + windowStart, sliceRows.begin() + std::min(numberOfRows, windowStart + windowSize), [&getRowLength] (uint64_t first, uint64_t second) { return getRowLength(first) > getRowLength(second); });
+                        }
+                    }
+
+                    sliceRowLengths.resize(sliceRows.size());
+                    sliceStarts.resize(numberOfSlices + 1);
+                    sliceStarts.front() = 0;
+                    for (uint64_t slice = 0; slice < numberOfSlices; ++slice) {
+                        uint64_t sliceLength = 0;
+                        for (uint64_t slot = slice * sliceHeight; slot < (slice + 1) * sliceHeight; ++slot) {
+                            sliceRowLengths[slot] = sliceRows[slot] == numberOfRows ? 0 : static_cast<uint32_t>(getRowLength(sliceRows[slot]));
+                            sliceLength = std::max<uint64_t>(sliceLength, sliceRowLengths[slot]);
+                        }
+                        sliceStarts[slice + 1] = sliceStarts[slice] + sliceLength * sliceHeight;
+                    }
+
+                    values.assign(sliceStarts.back(), storm::utility::zero<ValueType>());
+                    columns.assign(sliceStarts.back(), 0);
+                    for (uint64_t slot = 0; slot < sliceRows.size(); ++slot) {
+                        if (sliceRows[slot] == numberOfRows) {
+                            continue;
+                        }
+                        uint64_t entry = sliceStarts[slot / sliceHeight] + slot % sliceHeight;
+                        for (auto const& matrixEntry : this->matrix.getRow(sliceRows[slot])) {
+                            values[entry] = matrixEntry.getValue();
+                            columns[entry] = static_cast<uint32_t>(matrixEntry.getColumn());
+                            entry += sliceHeight;
+                        }
+                    }
+                    rowValues.resize(numberOfRows);
+                }
+            }
+            return useKernel;
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::clearCache() const {
+            initialized = false;
+            useKernel = false;
+            values = std::vector<ValueType>();
+            columns = std::vector<uint32_t>();
+            sliceStarts = std::vector<uint64_t>();
+            sliceRows = std::vector<uint64_t>();
+            sliceRowLengths = std::vector<uint32_t>();
+            rowValues = std::vector<ValueType>();
+            batchesInitialized = false;
+            regularBatch = std::vector<uint64_t>();
+            overriddenBatch = std::vector<uint64_t>();
+            Multiplier<ValueType>::clearCache();
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::computeRowValues(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& target) const {
+            // The rows of a slice are accumulated in the lanes of a register, so the products of the entries are never written to memory.
+            if constexpr (std::is_same<ValueType, double>::value) {
+                SlicedRows rows = {this->matrix.getRowCount(), sliceStarts.size() - 1, sliceHeight, sliceStarts.data(), sliceRows.data(), sliceRowLengths.data(), values.data(), columns.data()};
+                computeRowValuesWithKernel(rows, x.data(), b ? b->data() : nullptr, target.data());
+            } else {
+                STORM_LOG_ASSERT(false, "The SIMD kernels only support double values.");
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::updateBatches(storm::storage::BitVector const* dirOverride) const {
+            bool overridden = dirOverride && !dirOverride->empty();
+            if (batchesInitialized && (overridden ? *dirOverride == batchDirOverride : batchDirOverride.empty())) {
+                return;
+            }
+            batchesInitialized = true;
+            batchDirOverride = overridden ? *dirOverride : storm::storage::BitVector();
+            regularBatch.clear();
+            overriddenBatch.clear();
+            auto const& rowGroupIndices = this->matrix.getRowGroupIndices();
+            for (uint64_t group = 0; group + 1 < rowGroupIndices.size(); ++group) {
+                // Empty row groups are skipped, their result is not touched.
+                if (rowGroupIndices[group] == rowGroupIndices[group + 1]) {
+                    continue;
+                }
+                if (overridden && dirOverride->get(group)) {
+                    overriddenBatch.push_back(group);
+                } else {
+                    regularBatch.push_back(group);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        template<bool maximize>
+        void SimdMultiplier<ValueType>::reduceBatch(std::vector<uint64_t> const& batch, std::vector<ValueType>& result) const {
+            auto const& rowGroupIndices = this->matrix.getRowGroupIndices();
+            for (auto group : batch) {
+                auto rowValueIt = rowValues.begin() + rowGroupIndices[group];
+                auto rowValueIte = rowValues.begin() + rowGroupIndices[group + 1];
+                ValueType groupValue = *rowValueIt;
+                for (++rowValueIt; rowValueIt != rowValueIte; ++rowValueIt) {
+                    groupValue = maximize ? std::max(groupValue, *rowValueIt) : std::min(groupValue, *rowValueIt);
+                }
+                result[group] = groupValue;
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const {
+            if (initialize()) {
+                if (&x == &result) {
+                    computeRowValues(x, b, rowValues);
+                    result.assign(rowValues.begin(), rowValues.end());
+                } else {
+                    computeRowValues(x, b, result);
+                }
+            } else {
+                if (&x == &result) {
+                    if (this->cachedVector) {
+                        this->cachedVector->resize(x.size());
+                    } else {
+                        this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                    }
+                    this->matrix.multiplyWithVector(x, *this->cachedVector, b);
+                    std::swap(result, *this->cachedVector);
+                } else {
+                    this->matrix.multiplyWithVector(x, result, b);
+                }
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards) const {
+            if (backwards) {
+                this->matrix.multiplyWithVectorBackward(x, x, b);
+            } else {
+                this->matrix.multiplyWithVectorForward(x, x, b);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices, storm::storage::BitVector const* dirOverride) const {
+            // The batches are built for the row groups of the matrix. Other row groupings and the tracking of choices are left to the sparse matrix.
+            if constexpr (std::is_same<ValueType, double>::value) {
+                if (!choices && &rowGroupIndices == &this->matrix.getRowGroupIndices() && initialize()) {
+                    computeRowValues(x, b, rowValues);
+                    updateBatches(dirOverride);
+                    if (dir == OptimizationDirection::Maximize) {
+                        reduceBatch<true>(regularBatch, result);
+                        reduceBatch<false>(overriddenBatch, result);
+                    } else {
+                        reduceBatch<false>(regularBatch, result);
+                        reduceBatch<true>(overriddenBatch, result);
+                    }
+                    return;
+                }
+            }
+
+            std::vector<ValueType>* target = &result;
+            if (&x == &result) {
+                if (this->cachedVector) {
+                    this->cachedVector->resize(x.size());
+                } else {
+                    this->cachedVector = std::make_unique<std::vector<ValueType>>(x.size());
+                }
+                target = this->cachedVector.get();
+            }
+            this->matrix.multiplyAndReduce(dir, rowGroupIndices, x, b, *target, choices, dirOverride);
+            if (&x == &result) {
+                std::swap(result, *this->cachedVector);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices, storm::storage::BitVector const* dirOverride, bool backwards) const {
+            if (backwards) {
+                this->matrix.multiplyAndReduceBackward(dir, rowGroupIndices, x, b, x, choices, dirOverride);
+            } else {
+                this->matrix.multiplyAndReduceForward(dir, rowGroupIndices, x, b, x, choices, dirOverride);
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const {
+            for (auto const& entry : this->matrix.getRow(rowIndex)) {
+                value += entry.getValue() * x[entry.getColumn()];
+            }
+        }
+
+        template<typename ValueType>
+        void SimdMultiplier<ValueType>::multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const {
+            for (auto const& entry : this->matrix.getRow(rowIndex)) {
+                val1 += entry.getValue() * x1[entry.getColumn()];
+                val2 += entry.getValue() * x2[entry.getColumn()];
+            }
+        }
+
+        template class SimdMultiplier<double>;
+#ifdef STORM_HAVE_CARL
+        template class SimdMultiplier<storm::RationalNumber>;
+        template class SimdMultiplier<storm::RationalFunction>;
+#endif
+
+    }
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "storm/solver/Multiplier.h"
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/storage/BitVector.h"
+
+namespace storm {
+    namespace storage {
+        template<typename ValueType>
+        class SparseMatrix;
+    }
+
+    namespace solver {
+
+        /*!
+         * A multiplier that works on a copy of the matrix in sliced ELLPACK format: The rows are grouped into slices of four
+         * (AVX2) or eight (AVX-512) rows of similar length, which are padded to the same length and stored column by column.
+         * For double values, the rows of a slice are then multiplied with the vector at once, each in one lane of a register,
+         * using gathers. This also vectorizes the short rows of grid games. The instruction set is selected at run time, with
+         * a scalar fallback on the plain row layout. For multiply-and-reduce, the row groups are split into one
+         * batch per optimization direction once, so that the reduction does not need to branch on the direction override
+         * of each row group. Operations that are not covered (Gauss-Seidel, scheduler extraction, non-double values) are
+         * delegated to the sparse matrix.
+         */
+        template<typename ValueType>
+        class SimdMultiplier : public Multiplier<ValueType> {
+        public:
+            SimdMultiplier(storm::storage::SparseMatrix<ValueType> const& matrix);
+            virtual ~SimdMultiplier() = default;
+
+            virtual void multiply(Environment const& env, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result) const override;
+            virtual void multiplyGaussSeidel(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const* b, bool backwards = true) const override;
+            virtual void multiplyAndReduce(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& result, std::vector<uint_fast64_t>* choices = nullptr, storm::storage::BitVector const* dirOverride = nullptr) const override;
+            virtual void multiplyAndReduceGaussSeidel(Environment const& env, OptimizationDirection const& dir, std::vector<uint64_t> const& rowGroupIndices, std::vector<ValueType>& x, std::vector<ValueType> const* b, std::vector<uint_fast64_t>* choices = nullptr, storm::storage::BitVector const* dirOverride = nullptr, bool backwards = true) const override;
+            virtual void multiplyRow(uint64_t const& rowIndex, std::vector<ValueType> const& x, ValueType& value) const override;
+            virtual void multiplyRow2(uint64_t const& rowIndex, std::vector<ValueType> const& x1, ValueType& val1, std::vector<ValueType> const& x2, ValueType& val2) const override;
+            virtual void clearCache() const override;
+
+        private:
+            /*!
+             * Checks whether the vectorized kernel can be used, i.e. whether the values are doubles and the column indices
+             * fit into signed 32-bit integers. If so, the sliced copy of the matrix is built (if not done already).
+             */
+            bool initialize() const;
+
+            /*!
+             * Computes the value of every row, i.e. the scalar product of the row with x plus the corresponding entry of b.
+             */
+            void computeRowValues(std::vector<ValueType> const& x, std::vector<ValueType> const* b, std::vector<ValueType>& target) const;
+
+            /*!
+             * Splits the non-empty row groups into those that are reduced according to the given direction and those whose
+             * direction is overridden. The batches are only rebuilt if the direction override changes.
+             */
+            void updateBatches(storm::storage::BitVector const* dirOverride) const;
+
+            template<bool maximize>
+            void reduceBatch(std::vector<uint64_t> const& batch, std::vector<ValueType>& result) const;
+
+            mutable bool initialized;
+            mutable bool useKernel;
+            // The number of rows per slice, the start of each slice in the values and columns, the row of each slot of a slice
+            // (the row count for unused slots) and the length of the row of each slot.
+            mutable uint64_t sliceHeight;
+            mutable std::vector<ValueType> values;
+            mutable std::vector<uint32_t> columns;
+            mutable std::vector<uint64_t> sliceStarts;
+            mutable std::vector<uint64_t> sliceRows;
+            mutable std::vector<uint32_t> sliceRowLengths;
+            mutable std::vector<ValueType> rowValues;
+
+            mutable bool batchesInitialized;
+            mutable storm::storage::BitVector batchDirOverride;
+            mutable std::vector<uint64_t> regularBatch;
+            mutable std::vector<uint64_t> overriddenBatch;
+        };
+
+    }
+}
@@ -127,6 +127,11 @@ namespace storm {
             return shieldingTask;
         }
 
+        template<typename ValueType>
+        std::shared_ptr<storm::logic::ShieldExpression const> const& SolveGoal<ValueType>::getShieldingExpression() const {
+            return shieldingExpression;
+        }
+
         template class SolveGoal<double>;
         
 #ifdef STORM_HAVE_CARL
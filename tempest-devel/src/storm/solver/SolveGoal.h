@@ -24,6 +24,9 @@ namespace storm {
     namespace modelchecker {
         template<typename FormulaType, typename ValueType> class CheckTask;
     }
+    namespace logic {
+        class ShieldExpression;
+    }
     namespace models {
         namespace sparse {
             template<typename ValueType, typename RewardModelType> class Model;
@@ -52,6 +55,9 @@ namespace storm {
                     threshold = checkTask.getBoundThreshold();
                 }
                 shieldingTask = checkTask.isShieldingTask();
+                if (shieldingTask) {
+                    shieldingExpression = checkTask.getShieldingExpression();
+                }
             }
             
             SolveGoal(bool minimize);
@@ -87,6 +93,8 @@ namespace storm {
 
             bool isShieldingTask() const;
 
+            std::shared_ptr<storm::logic::ShieldExpression const> const& getShieldingExpression() const;
+
         private:
             boost::optional<OptimizationDirection> optimizationDirection;
             
@@ -95,6 +103,7 @@ namespace storm {
             boost::optional<storm::storage::BitVector> relevantValueVector;
             // We only want to know if it **is** a shielding task
             bool shieldingTask;
+            std::shared_ptr<storm::logic::ShieldExpression const> shieldingExpression;
         };
         
         template<typename ValueType, typename MatrixType>
@@ -36,6 +36,8 @@ namespace storm {
                     return "Native";
                 case MultiplierType::Gmmxx:
                     return "Gmmxx";
+                case MultiplierType::Simd:
+                    return "Simd";
             }
             return "invalid";
         }
@@ -1,5 +1,6 @@
 #include "storm/solver/TerminationCondition.h"
 #include "storm/utility/vector.h"
+#include "storm/utility/constants.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -149,17 +150,121 @@ namespace storm {
             return guarantee == SolverGuarantee::GreaterOrEqual;
         }
         
+        template<typename ValueType>
+        TerminateIfShieldDecisionsFixed<ValueType>::TerminateIfShieldDecisionsFixed(std::vector<uint64_t> const& rowGroupIndices, bool maximize, bool relative, ValueType const& shieldValue, bool requireOptimalChoice, bool optimalChoiceIsMaximal, bool complementValues) : rowGroupIndices(rowGroupIndices), maximize(maximize), relative(relative), shieldValue(shieldValue), requireOptimalChoice(requireOptimalChoice), optimalChoiceIsMaximal(optimalChoiceIsMaximal), complementValues(complementValues), upperBounds(nullptr), undecidedStates(rowGroupIndices.size() - 1, true) {
+            STORM_LOG_THROW(!rowGroupIndices.empty(), storm::exceptions::InvalidArgumentException, "Expected at least one row group index.");
+        }
+
+        template<typename ValueType>
+        bool TerminateIfShieldDecisionsFixed<ValueType>::terminateNow(std::function<ValueType(uint64_t const&)> const& valueGetter, SolverGuarantee const& guarantee) const {
+            if (guarantee != SolverGuarantee::LessOrEqual || upperBounds == nullptr) {
+                return false;
+            }
+
+            bool allDecided = true;
+            for (auto state : undecidedStates) {
+                if (isStateDecided(state, valueGetter)) {
+                    undecidedStates.set(state, false);
+                } else {
+                    allDecided = false;
+                }
+            }
+            return allDecided;
+        }
+
+        template<typename ValueType>
+        bool TerminateIfShieldDecisionsFixed<ValueType>::isStateDecided(uint64_t state, std::function<ValueType(uint64_t const&)> const& valueGetter) const {
+            uint64_t const firstChoice = rowGroupIndices[state];
+            uint64_t const endChoice = rowGroupIndices[state + 1];
+            if (firstChoice == endChoice) {
+                return true;
+            }
+
+            // Obtain the interval of each choice value as seen by the shield.
+            auto lower = [&] (uint64_t choice) { return complementValues ? storm::utility::one<ValueType>() - (*upperBounds)[choice] : valueGetter(choice); };
+            auto upper = [&] (uint64_t choice) { return complementValues ? storm::utility::one<ValueType>() - valueGetter(choice) : (*upperBounds)[choice]; };
+
+            // Compute the interval in which the optimal choice value of this state lies.
+            ValueType optLower = lower(firstChoice);
+            ValueType optUpper = upper(firstChoice);
+            for (uint64_t choice = firstChoice + 1; choice < endChoice; ++choice) {
+                if (maximize) {
+                    optLower = std::max(optLower, lower(choice));
+                    optUpper = std::max(optUpper, upper(choice));
+                } else {
+                    optLower = std::min(optLower, lower(choice));
+                    optUpper = std::min(optUpper, upper(choice));
+                }
+            }
+
+            // Compute the interval in which the threshold of this state lies.
+            ValueType thresholdLower = shieldValue;
+            ValueType thresholdUpper = shieldValue;
+            if (relative) {
+                ValueType factor = maximize ? shieldValue : storm::utility::one<ValueType>() + shieldValue;
+                thresholdLower = optLower * factor;
+                thresholdUpper = optUpper * factor;
+            }
+
+            // Every choice needs to either pass or fail the threshold for all values in its interval.
+            for (uint64_t choice = firstChoice; choice < endChoice; ++choice) {
+                if (maximize) {
+                    storm::utility::ElementGreaterEqual<ValueType> greaterEqual;
+                    if (!greaterEqual(lower(choice), thresholdUpper) && greaterEqual(upper(choice), thresholdLower)) {
+                        return false;
+                    }
+                } else {
+                    storm::utility::ElementLessEqual<ValueType> lessEqual;
+                    if (!lessEqual(upper(choice), thresholdLower) && lessEqual(lower(choice), thresholdUpper)) {
+                        return false;
+                    }
+                }
+            }
+
+            if (requireOptimalChoice) {
+                // Some choice has to be strictly better than all other choices for all values in the intervals.
+                bool optimalChoiceFixed = false;
+                for (uint64_t candidate = firstChoice; !optimalChoiceFixed && candidate < endChoice; ++candidate) {
+                    optimalChoiceFixed = true;
+                    for (uint64_t choice = firstChoice; optimalChoiceFixed && choice < endChoice; ++choice) {
+                        if (choice != candidate) {
+                            optimalChoiceFixed = optimalChoiceIsMaximal ? lower(candidate) > upper(choice) : upper(candidate) < lower(choice);
+                        }
+                    }
+                }
+                return optimalChoiceFixed;
+            }
+            return true;
+        }
+
+        template<typename ValueType>
+        bool TerminateIfShieldDecisionsFixed<ValueType>::requiresGuarantee(SolverGuarantee const& guarantee) const {
+            return guarantee == SolverGuarantee::LessOrEqual;
+        }
+
+        template<typename ValueType>
+        void TerminateIfShieldDecisionsFixed<ValueType>::setUpperBounds(std::vector<ValueType> const& upperBounds) {
+            this->upperBounds = &upperBounds;
+        }
+
+        template<typename ValueType>
+        uint64_t TerminateIfShieldDecisionsFixed<ValueType>::getNumberOfUndecidedStates() const {
+            return undecidedStates.getNumberOfSetBits();
+        }
+
         template class TerminationCondition<double>;
         template class NoTerminationCondition<double>;
         template class TerminateIfFilteredSumExceedsThreshold<double>;
         template class TerminateIfFilteredExtremumExceedsThreshold<double>;
         template class TerminateIfFilteredExtremumBelowThreshold<double>;
+        template class TerminateIfShieldDecisionsFixed<double>;
 #ifdef STORM_HAVE_CARL
         template class TerminationCondition<storm::RationalNumber>;
         template class NoTerminationCondition<storm::RationalNumber>;
         template class TerminateIfFilteredSumExceedsThreshold<storm::RationalNumber>;
         template class TerminateIfFilteredExtremumExceedsThreshold<storm::RationalNumber>;
         template class TerminateIfFilteredExtremumBelowThreshold<storm::RationalNumber>;
+        template class TerminateIfShieldDecisionsFixed<storm::RationalNumber>;
 #endif
         
     }
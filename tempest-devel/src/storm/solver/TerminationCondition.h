@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <vector>
 
 #include "storm/solver/SolverGuarantee.h"
 #include "storm/storage/BitVector.h"
@@ -71,5 +72,55 @@ namespace storm {
             bool useMinimum;
             mutable uint64_t cachedExtremumIndex;
         };
+
+        /*!
+         * Terminates as soon as the decisions of a safety shield are fixed, i.e. as soon as no choice of any state can
+         * still switch between passing and failing the shield threshold. The values given to terminateNow are lower
+         * bounds on the choice values, the corresponding upper bounds have to be provided via setUpperBounds.
+         */
+        template<typename ValueType>
+        class TerminateIfShieldDecisionsFixed : public TerminationCondition<ValueType> {
+        public:
+            /*!
+             * @param rowGroupIndices The row group indices of the choices.
+             * @param maximize Whether the shield allows choices whose value is at least (true) or at most (false) the threshold.
+             * @param relative Whether the threshold is relative to the optimal choice value of the state.
+             * @param shieldValue The value of the shielding expression.
+             * @param requireOptimalChoice Whether the optimal choice of each state also needs to be fixed (post and optimal shields).
+             * @param optimalChoiceIsMaximal Whether the optimal choice is the one with the maximal value.
+             * @param complementValues Whether the shield is built over one minus the given choice values.
+             */
+            TerminateIfShieldDecisionsFixed(std::vector<uint64_t> const& rowGroupIndices, bool maximize, bool relative, ValueType const& shieldValue, bool requireOptimalChoice, bool optimalChoiceIsMaximal, bool complementValues);
+
+            using TerminationCondition<ValueType>::terminateNow;
+            bool terminateNow(std::function<ValueType(uint64_t const&)> const& valueGetter, SolverGuarantee const& guarantee = SolverGuarantee::None) const override;
+            virtual bool requiresGuarantee(SolverGuarantee const& guarantee) const override;
+
+            /*!
+             * Sets the upper bounds on the choice values that are used in the next check. The vector has to stay valid
+             * until then.
+             */
+            void setUpperBounds(std::vector<ValueType> const& upperBounds);
+
+            /*!
+             * Retrieves the number of states whose shield decision was not fixed during the last check.
+             */
+            uint64_t getNumberOfUndecidedStates() const;
+
+        protected:
+            bool isStateDecided(uint64_t state, std::function<ValueType(uint64_t const&)> const& valueGetter) const;
+
+            std::vector<uint64_t> rowGroupIndices;
+            bool maximize;
+            bool relative;
+            ValueType shieldValue;
+            bool requireOptimalChoice;
+            bool optimalChoiceIsMaximal;
+            bool complementValues;
+            std::vector<ValueType> const* upperBounds;
+
+            // Decisions that were fixed once stay fixed, so we only need to revisit the remaining states.
+            mutable storm::storage::BitVector undecidedStates;
+        };
     }
 }
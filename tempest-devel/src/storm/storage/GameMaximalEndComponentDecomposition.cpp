@@ -18,26 +18,34 @@ namespace storm {
         template<typename ValueType>
         template<typename RewardModelType>
         GameMaximalEndComponentDecomposition<ValueType>::GameMaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType, RewardModelType> const& model) {
-            singleMEC(model.getTransitionMatrix(), model.getBackwardTransitions());
-            //performGameMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions());
+            performGameMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions());
         }
 
         template<typename ValueType>
         GameMaximalEndComponentDecomposition<ValueType>::GameMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions) {
-            singleMEC(transitionMatrix, backwardTransitions);
-            //performGameMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+            performGameMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions);
+        }
+
+        template<typename ValueType>
+        GameMaximalEndComponentDecomposition<ValueType> GameMaximalEndComponentDecomposition<ValueType>::wholeStateSpace(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+            GameMaximalEndComponentDecomposition<ValueType> result;
+            result.singleMEC(transitionMatrix);
+            return result;
         }
 
         template<typename ValueType>
         GameMaximalEndComponentDecomposition<ValueType>::GameMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states) {
+            performGameMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states);
         }
 
         template<typename ValueType>
         GameMaximalEndComponentDecomposition<ValueType>::GameMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& states, storm::storage::BitVector const& choices) {
+            performGameMaximalEndComponentDecomposition(transitionMatrix, backwardTransitions, &states, &choices);
         }
 
         template<typename ValueType>
         GameMaximalEndComponentDecomposition<ValueType>::GameMaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model, storm::storage::BitVector const& states) {
+            performGameMaximalEndComponentDecomposition(model.getTransitionMatrix(), model.getBackwardTransitions(), &states);
         }
 
         template<typename ValueType>
@@ -63,22 +71,17 @@ namespace storm {
         }
 
         template <typename ValueType>
-        void GameMaximalEndComponentDecomposition<ValueType>::performGameMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices) {
+        void GameMaximalEndComponentDecomposition<ValueType>::performGameMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices) {
             // Get some data for convenient access.
             uint_fast64_t numberOfStates = transitionMatrix.getRowGroupCount();
             std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
 
-            // Initialize the maximal end component list to be the full state space.
-            std::list<StateBlock> endComponentStateSets;
-            if (states) {
-                endComponentStateSets.emplace_back(states->begin(), states->end(), true);
-            } else {
-                std::vector<storm::storage::sparse::state_type> allStates;
-                allStates.resize(transitionMatrix.getRowGroupCount());
-                std::iota(allStates.begin(), allStates.end(), 0);
-                endComponentStateSets.emplace_back(allStates.begin(), allStates.end(), true);
-            }
-            storm::storage::BitVector statesToCheck(numberOfStates);
+            // A game MEC is a set of states that is strongly connected and that can not be left by any choice of any player.
+            // Such a set is necessarily a bottom SCC of the subsystem once all states that can leave the subsystem are
+            // removed. Hence, instead of repeatedly refining SCC decompositions, we first remove all states that can
+            // (possibly via other states) reach a state outside of the subsystem and then compute the bottom SCCs of the
+            // remaining closed subsystem. Overall, this takes time linear in the size of the (sub-)system.
+            storm::storage::BitVector remainingStates = states ? *states : storm::storage::BitVector(numberOfStates, true);
             storm::storage::BitVector includedChoices;
             if (choices) {
                 includedChoices = *choices;
@@ -92,124 +95,65 @@ namespace storm {
             } else {
                 includedChoices = storm::storage::BitVector(transitionMatrix.getRowCount(), true);
             }
-            storm::storage::BitVector currMecAsBitVector(transitionMatrix.getRowGroupCount());
-
-            for (std::list<StateBlock>::const_iterator mecIterator = endComponentStateSets.begin(); mecIterator != endComponentStateSets.end();) {
-                StateBlock const& mec = *mecIterator;
-                currMecAsBitVector.clear();
-                currMecAsBitVector.set(mec.begin(), mec.end(), true);
-                // Keep track of whether the MEC changed during this iteration.
-                bool mecChanged = false;
 
-                // Get an SCC decomposition of the current MEC candidate.
-
-                StronglyConnectedComponentDecomposition<ValueType> sccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&currMecAsBitVector).choices(&includedChoices).dropNaiveSccs());
-                for(auto const& sc: sccs) {
-                    STORM_LOG_DEBUG("SCC size: " << sc.size());
+            // Checks whether the given choice has a (non-zero) successor for which the given predicate holds.
+            auto choiceHasSuccessor = [&transitionMatrix] (uint_fast64_t choice, auto const& predicate) {
+                for (auto const& entry : transitionMatrix.getRow(choice)) {
+                    if (!storm::utility::isZero(entry.getValue()) && predicate(entry.getColumn())) {
+                        return true;
+                    }
                 }
+                return false;
+            };
 
-                // We need to do another iteration in case we have either more than once SCC or the SCC is smaller than
-                // the MEC canditate itself.
-                mecChanged |= sccs.size() != 1 || (sccs.size() > 0 && sccs[0].size() < mec.size());
-
-                // Check for each of the SCCs whether all actions for each state do not leave the SCC. // TODO there is certainly a better way to do that...
-                for (auto& scc : sccs) {
-                    statesToCheck.set(scc.begin(), scc.end());
-
-                    while (!statesToCheck.empty()) {
-                        storm::storage::BitVector statesToRemove(numberOfStates);
-
-                        for (auto state : statesToCheck) {
-                            bool keepStateInMEC = true;
-
-                            for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-
-                                // If the choice is not part of our subsystem, skip it.
-                                if (choices && !choices->get(choice)) {
-                                    continue;
-                                }
-
-                                // If the choice is not included any more, skip it.
-                                //if (!includedChoices.get(choice)) {
-                                //    continue;
-                                //}
-
-                                bool choiceContainedInMEC = true;
-                                for (auto const& entry : transitionMatrix.getRow(choice)) {
-                                    if (storm::utility::isZero(entry.getValue())) {
-                                        continue;
-                                    }
-
-                                    if (!scc.containsState(entry.getColumn())) {
-                                        //includedChoices.set(choice, false);
-                                        choiceContainedInMEC = false;
-                                        break;
-                                    }
-                                }
-
-                                //TODO If there is at least one choice whose successor states are fully contained in the MEC, we can leave the state in the MEC.
-                                if (!choiceContainedInMEC) {
-                                    keepStateInMEC = false;
-                                    break;
-                                }
-                            }
-                            if (!keepStateInMEC) {
-                                statesToRemove.set(state, true);
-                            }
-
-                        }
-
-                        // Now erase the states that have no option to stay inside the MEC with all successors.
-                        mecChanged |= !statesToRemove.empty();
-                        for (uint_fast64_t state : statesToRemove) {
-                            scc.erase(state);
-                        }
-
-                        // Now check which states should be reconsidered, because successors of them were removed.
-                        statesToCheck.clear();
-                        for (auto state : statesToRemove) {
-                            for (auto const& entry : backwardTransitions.getRow(state)) {
-                                if (scc.containsState(entry.getColumn())) {
-                                    statesToCheck.set(entry.getColumn());
-                                }
-                            }
+            // Seed the removal with all states that have an included choice leaving the subsystem.
+            std::vector<uint_fast64_t> stack;
+            if (states || choices) {
+                for (auto state : remainingStates) {
+                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                        if (includedChoices.get(choice) && choiceHasSuccessor(choice, [&remainingStates] (uint_fast64_t successor) { return !remainingStates.get(successor); })) {
+                            stack.push_back(state);
+                            break;
                         }
                     }
                 }
+                for (auto state : stack) {
+                    remainingStates.set(state, false);
+                }
+            }
 
-                // If the MEC changed, we delete it from the list of MECs and append the possible new MEC candidates to
-                // the list instead.
-                if (mecChanged) {
-                    for (StronglyConnectedComponent& scc : sccs) {
-                        if (!scc.empty()) {
-                            endComponentStateSets.push_back(std::move(scc));
-                        }
+            // Remove all states that can reach a removed state via some included choice.
+            while (!stack.empty()) {
+                uint_fast64_t removedState = stack.back();
+                stack.pop_back();
+                for (auto const& predecessorEntry : backwardTransitions.getRow(removedState)) {
+                    uint_fast64_t predecessor = predecessorEntry.getColumn();
+                    if (!remainingStates.get(predecessor)) {
+                        continue;
+                    }
+                    bool hasChoiceToRemovedState = !choices;
+                    for (uint_fast64_t choice = nondeterministicChoiceIndices[predecessor]; !hasChoiceToRemovedState && choice < nondeterministicChoiceIndices[predecessor + 1]; ++choice) {
+                        hasChoiceToRemovedState = includedChoices.get(choice) && choiceHasSuccessor(choice, [removedState] (uint_fast64_t successor) { return successor == removedState; });
+                    }
+                    if (hasChoiceToRemovedState) {
+                        remainingStates.set(predecessor, false);
+                        stack.push_back(predecessor);
                     }
-
-                    std::list<StateBlock>::const_iterator eraseIterator(mecIterator);
-                    ++mecIterator;
-                    endComponentStateSets.erase(eraseIterator);
-                } else {
-                    // Otherwise, we proceed with the next MEC candidate.
-                    ++mecIterator;
                 }
+            }
 
-            } // End of loop over all MEC candidates.
+            // The remaining states form a closed subsystem, so its non-trivial bottom SCCs are exactly the game MECs.
+            StronglyConnectedComponentDecomposition<ValueType> bsccs(transitionMatrix, StronglyConnectedComponentDecompositionOptions().subsystem(&remainingStates).choices(&includedChoices).dropNaiveSccs().onlyBottomSccs());
 
             // Now that we computed the underlying state sets of the MECs, we need to properly identify the choices
-            // contained in the MEC and store them as actual MECs.
-            this->blocks.reserve(endComponentStateSets.size());
-            for (auto const& mecStateSet : endComponentStateSets) {
+            // contained in the MEC and store them as actual MECs. By construction, every included choice stays inside.
+            this->blocks.reserve(bsccs.size());
+            for (auto const& mecStateSet : bsccs) {
                 MaximalEndComponent newMec;
 
                 for (auto state : mecStateSet) {
                     MaximalEndComponent::set_type containedChoices;
                     for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                        // Skip the choice if it is not part of our subsystem.
-                        if (choices && !choices->get(choice)) {
-                            continue;
-                        }
-
                         if (includedChoices.get(choice)) {
                             containedChoices.insert(choice);
                         }
@@ -226,7 +170,7 @@ namespace storm {
         }
 
         template <typename ValueType>
-        void GameMaximalEndComponentDecomposition<ValueType>::singleMEC(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states, storm::storage::BitVector const* choices) {
+        void GameMaximalEndComponentDecomposition<ValueType>::singleMEC(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
             MaximalEndComponent singleMec;
 
             std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = transitionMatrix.getRowGroupIndices();
@@ -245,11 +189,6 @@ namespace storm {
                 for (auto state : mecStateSet) {
                     MaximalEndComponent::set_type containedChoices;
                     for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
-                        // Skip the choice if it is not part of our subsystem.
-                        if (choices && !choices->get(choice)) {
-                            continue;
-                        }
-
                         if (includedChoices.get(choice)) {
                             containedChoices.insert(choice);
                         }
@@ -62,6 +62,15 @@ namespace storm  {
              */
             GameMaximalEndComponentDecomposition(storm::models::sparse::NondeterministicModel<ValueType> const& model, storm::storage::BitVector const& states);
 
+            /*!
+             * Creates a decomposition that consists of a single component with all states and choices of the given model.
+             * This is not a decomposition into game MECs. It is used by the long run average computation for games, which
+             * solves the whole game at once.
+             *
+             * @param transitionMatrix The transition relation of the model.
+             */
+            static GameMaximalEndComponentDecomposition wholeStateSpace(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
             /*!
              * Creates an MEC decomposition by copying the contents of the given MEC decomposition.
              *
@@ -93,15 +102,20 @@ namespace storm  {
         private:
             /*!
              * Performs the actual decomposition of the given subsystem in the given model into MECs. As a side-effect
-             * this stores the MECs found in the current decomposition.
+             * this stores the MECs found in the current decomposition. States that can leave the subsystem are pruned
+             * backwards in a single pass, so only one (bottom) SCC decomposition is needed.
              *
              * @param transitionMatrix The transition matrix representing the system whose subsystem to decompose into MECs.
              * @param backwardTransitions The reversed transition relation.
              * @param states The states of the subsystem to decompose.
              * @param choices The choices of the subsystem to decompose.
              */
-            void performGameMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr, storm::storage::BitVector const* choices = nullptr);
-            void singleMEC(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> backwardTransitions, storm::storage::BitVector const* states = nullptr, storm::storage::BitVector const* choices = nullptr);
+            void performGameMaximalEndComponentDecomposition(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const* states = nullptr, storm::storage::BitVector const* choices = nullptr);
+
+            /*!
+             * Stores the whole state space as a single component.
+             */
+            void singleMEC(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
         };
     }
 }
@@ -680,6 +680,16 @@ namespace storm {
             return rowGroupIndices.get();
         }
 
+        template<typename ValueType>
+        std::vector<typename SparseMatrix<ValueType>::index_type> const& SparseMatrix<ValueType>::getRowIndications() const {
+            return rowIndications;
+        }
+
+        template<typename ValueType>
+        std::vector<MatrixEntry<typename SparseMatrix<ValueType>::index_type, typename SparseMatrix<ValueType>::value_type>> const& SparseMatrix<ValueType>::getColumnsAndValues() const {
+            return columnsAndValues;
+        }
+
         template<typename ValueType>
         std::vector<typename SparseMatrix<ValueType>::index_type> SparseMatrix<ValueType>::swapRowGroupIndices(std::vector<index_type>&& newRowGrouping) {
             std::vector<index_type> result;
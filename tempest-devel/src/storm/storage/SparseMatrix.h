@@ -595,6 +595,21 @@ namespace storm {
              */
             std::vector<index_type> const& getRowGroupIndices() const;
 
+            /*!
+             * Returns the row indications of the compressed row storage, i.e. the entries of row i are the entries
+             * with indices rowIndications[i] to rowIndications[i + 1] - 1.
+             *
+             * @return The row indications of this matrix.
+             */
+            std::vector<index_type> const& getRowIndications() const;
+
+            /*!
+             * Returns the entries of this matrix in the order of the compressed row storage.
+             *
+             * @return The entries of this matrix.
+             */
+            std::vector<MatrixEntry<index_type, value_type>> const& getColumnsAndValues() const;
+
             /*!
              * Swaps the grouping of rows of this matrix.
              *
@@ -12,6 +12,7 @@
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/Ctmc.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -268,6 +269,18 @@ namespace storm {
             return this->quotient;
         }
 
+        template<typename ModelType, typename BlockDataType>
+        std::vector<uint_fast64_t> BisimulationDecomposition<ModelType, BlockDataType>::getQuotientStateMapping() const {
+            STORM_LOG_THROW(this->blocks.size() == partition.size() && !this->blocks.empty(), storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient state mapping, because the decomposition was not computed.");
+            std::vector<uint_fast64_t> result(model.getNumberOfStates());
+            for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
+                for (auto state : this->blocks[blockIndex]) {
+                    result[state] = blockIndex;
+                }
+            }
+            return result;
+        }
+
         template<typename ModelType, typename BlockDataType>
         void BisimulationDecomposition<ModelType, BlockDataType>::splitInitialPartitionBasedOnRewards() {
             auto const& rewardModel = model.getUniqueRewardModel();
@@ -360,15 +373,18 @@ namespace storm {
         template class BisimulationDecomposition<storm::models::sparse::Dtmc<double>, bisimulation::DeterministicBlockData>;
         template class BisimulationDecomposition<storm::models::sparse::Ctmc<double>, bisimulation::DeterministicBlockData>;
         template class BisimulationDecomposition<storm::models::sparse::Mdp<double>, bisimulation::DeterministicBlockData>;
+        template class BisimulationDecomposition<storm::models::sparse::Smg<double>, bisimulation::DeterministicBlockData>;
 
 #ifdef STORM_HAVE_CARL
         template class BisimulationDecomposition<storm::models::sparse::Dtmc<storm::RationalNumber>, bisimulation::DeterministicBlockData>;
         template class BisimulationDecomposition<storm::models::sparse::Ctmc<storm::RationalNumber>, bisimulation::DeterministicBlockData>;
         template class BisimulationDecomposition<storm::models::sparse::Mdp<storm::RationalNumber>, bisimulation::DeterministicBlockData>;
+        template class BisimulationDecomposition<storm::models::sparse::Smg<storm::RationalNumber>, bisimulation::DeterministicBlockData>;
 
         template class BisimulationDecomposition<storm::models::sparse::Dtmc<storm::RationalFunction>, bisimulation::DeterministicBlockData>;
         template class BisimulationDecomposition<storm::models::sparse::Ctmc<storm::RationalFunction>, bisimulation::DeterministicBlockData>;
         template class BisimulationDecomposition<storm::models::sparse::Mdp<storm::RationalFunction>, bisimulation::DeterministicBlockData>;
+        template class BisimulationDecomposition<storm::models::sparse::Smg<storm::RationalFunction>, bisimulation::DeterministicBlockData>;
 #endif
     }
 }
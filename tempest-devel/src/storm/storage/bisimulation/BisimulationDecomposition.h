@@ -186,6 +186,15 @@ namespace storm {
              */
             std::shared_ptr<ModelType> getQuotient() const;
             
+            /*!
+             * Retrieves the mapping from the states of the original model to the states of the quotient model, i.e. the
+             * indices of the blocks of the decomposition. This is only available after the decomposition has been
+             * computed.
+             *
+             * @return The index of the quotient state for each state of the original model.
+             */
+            std::vector<uint_fast64_t> getQuotientStateMapping() const;
+            
             /*!
              * Computes the decomposition of the model into bisimulation equivalence classes. If requested, a quotient
              * model is built.
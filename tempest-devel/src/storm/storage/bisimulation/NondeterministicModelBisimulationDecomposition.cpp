@@ -1,12 +1,16 @@
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/ModelComponents.h"
 
 #include "storm/utility/graph.h"
 
 #include "storm/utility/macros.h"
 #include "storm/exceptions/IllegalFunctionCallException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -15,6 +19,14 @@ namespace storm {
         
         using namespace bisimulation;
         
+        namespace {
+            template<typename ModelType>
+            struct IsGame : std::false_type {};
+            
+            template<typename ValueType, typename RewardModelType>
+            struct IsGame<storm::models::sparse::Smg<ValueType, RewardModelType>> : std::true_type {};
+        }
+        
         template<typename ModelType>
         NondeterministicModelBisimulationDecomposition<ModelType>::NondeterministicModelBisimulationDecomposition(ModelType const& model, typename BisimulationDecomposition<ModelType, NondeterministicModelBisimulationDecomposition::BlockDataType>::Options const& options) : BisimulationDecomposition<ModelType, NondeterministicModelBisimulationDecomposition::BlockDataType>(model, model.getTransitionMatrix().transpose(false), options), choiceToStateMapping(model.getNumberOfChoices()), quotientDistributions(model.getNumberOfChoices()), orderedQuotientDistributions(model.getNumberOfChoices()) {
             STORM_LOG_THROW(options.getType() == BisimulationType::Strong, storm::exceptions::IllegalFunctionCallException, "Weak bisimulation is currently not supported for nondeterministic models.");
@@ -22,6 +34,7 @@ namespace storm {
         
         template<typename ModelType>
         std::pair<storm::storage::BitVector, storm::storage::BitVector> NondeterministicModelBisimulationDecomposition<ModelType>::getStatesWithProbability01() {
+            STORM_LOG_THROW(!IsGame<ModelType>::value, storm::exceptions::NotSupportedException, "The measure-driven initial partition is not supported for games.");
             STORM_LOG_THROW(this->options.isOptimizationDirectionSet(), storm::exceptions::IllegalFunctionCallException, "Can only compute states with probability 0/1 with an optimization direction (min/max).");
             if (this->options.getOptimizationDirection() == OptimizationDirection::Minimize) {
                 return storm::utility::graph::performProb01Min(this->model.getTransitionMatrix(), this->model.getTransitionMatrix().getRowGroupIndices(), this->model.getBackwardTransitions(), this->options.phiStates.get(), this->options.psiStates.get());
@@ -32,10 +45,48 @@ namespace storm {
         
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::initialize() {
+            this->initializeGameStructure();
             this->createChoiceToStateMapping();
             this->initializeQuotientDistributions();
         }
         
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::initializeGameStructure() {
+            if constexpr (IsGame<ModelType>::value) {
+                // States of different players must never be merged.
+                std::vector<storm::storage::PlayerIndex> const& statePlayerIndications = this->model.getStatePlayerIndications();
+                this->partition.split([&statePlayerIndications] (storm::storage::sparse::state_type const& a, storm::storage::sparse::state_type const& b) { return statePlayerIndications[a] < statePlayerIndications[b]; });
+                
+                // Choices may only be matched if they carry the same labels, so that shields (which refer to the labels
+                // of the choices) remain meaningful for the quotient.
+                if (this->model.hasChoiceLabeling()) {
+                    std::map<std::set<std::string>, uint_fast64_t> labelSetToClass;
+                    choiceLabelClasses.resize(this->model.getNumberOfChoices());
+                    for (uint_fast64_t choice = 0; choice < this->model.getNumberOfChoices(); ++choice) {
+                        auto insertionResult = labelSetToClass.emplace(this->model.getChoiceLabeling().getLabelsOfChoice(choice), labelSetToClass.size());
+                        choiceLabelClasses[choice] = insertionResult.first->second;
+                    }
+                }
+            }
+        }
+        
+        template<typename ModelType>
+        bool NondeterministicModelBisimulationDecomposition<ModelType>::choiceLabelsEqual(uint_fast64_t choice1, uint_fast64_t choice2) const {
+            return choiceLabelClasses.empty() || choiceLabelClasses[choice1] == choiceLabelClasses[choice2];
+        }
+        
+        template<typename ModelType>
+        bool NondeterministicModelBisimulationDecomposition<ModelType>::choiceLess(storm::storage::DistributionWithReward<ValueType> const* distribution1, storm::storage::DistributionWithReward<ValueType> const* distribution2) const {
+            if (!choiceLabelClasses.empty()) {
+                uint_fast64_t labelClass1 = choiceLabelClasses[distribution1 - quotientDistributions.data()];
+                uint_fast64_t labelClass2 = choiceLabelClasses[distribution2 - quotientDistributions.data()];
+                if (labelClass1 != labelClass2) {
+                    return labelClass1 < labelClass2;
+                }
+            }
+            return distribution1->less(*distribution2, this->comparator);
+        }
+        
         template<typename ModelType>
         void NondeterministicModelBisimulationDecomposition<ModelType>::createChoiceToStateMapping() {
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
@@ -89,8 +140,8 @@ namespace storm {
         void NondeterministicModelBisimulationDecomposition<ModelType>::updateOrderedQuotientDistributions(storm::storage::sparse::state_type state) {
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
             std::sort(this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state], this->orderedQuotientDistributions.begin() + nondeterministicChoiceIndices[state + 1],
-                      [this] (storm::storage::Distribution<ValueType> const* dist1, storm::storage::Distribution<ValueType> const* dist2) {
-                          return dist1->less(*dist2, this->comparator);
+                      [this] (storm::storage::DistributionWithReward<ValueType> const* dist1, storm::storage::DistributionWithReward<ValueType> const* dist2) {
+                          return choiceLess(dist1, dist2);
                       });
         }
         
@@ -127,6 +178,12 @@ namespace storm {
                 }
             }
             
+            // Remember for each row of the quotient the choice of the original model it was created from, so that the
+            // choice labels can be transferred and the choice mapping can be computed.
+            std::vector<uint_fast64_t> quotientRowGroupIndices;
+            quotientRowGroupIndices.reserve(this->blocks.size() + 1);
+            std::vector<uint_fast64_t> quotientChoiceOrigins;
+            
             // Now build (a) and (b) by traversing all blocks.
             uint_fast64_t currentRow = 0;
             std::vector<uint_fast64_t> nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
@@ -135,6 +192,7 @@ namespace storm {
                 
                 // Open new row group for the new meta state.
                 builder.newRowGroup(currentRow);
+                quotientRowGroupIndices.push_back(currentRow);
                 
                 // Pick one representative state. For strong bisimulation it doesn't matter which state it is, because
                 // they all behave equally.
@@ -144,6 +202,7 @@ namespace storm {
                 // If the block is absorbing, we simply add a self-loop.
                 if (oldBlock.data().absorbing()) {
                     builder.addNextValue(currentRow, blockIndex, storm::utility::one<ValueType>());
+                    quotientChoiceOrigins.push_back(std::numeric_limits<uint_fast64_t>::max());
                     ++currentRow;
                     
                     // If the block has a special representative state, we retrieve it now.
@@ -167,13 +226,14 @@ namespace storm {
                     // Add the outgoing choices of the block.
                     for (uint_fast64_t choice = nondeterministicChoiceIndices[representativeState]; choice < nondeterministicChoiceIndices[representativeState + 1]; ++choice) {
                         // If the choice is the same as the last one, we do not need to add it.
-                        if (choice > nondeterministicChoiceIndices[representativeState] && quotientDistributions[choice - 1].equals(quotientDistributions[choice], this->comparator)) {
+                        if (choice > nondeterministicChoiceIndices[representativeState] && choiceLabelsEqual(choice - 1, choice) && quotientDistributions[choice - 1].equals(quotientDistributions[choice], this->comparator)) {
                             continue;
                         }
                         
                         for (auto entry : quotientDistributions[choice]) {
                             builder.addNextValue(currentRow, entry.first, entry.second);
                         }
+                        quotientChoiceOrigins.push_back(choice);
                         if (this->options.getKeepRewards() && rewardModel && rewardModel.get().hasStateActionRewards()) {
                             stateActionRewards.get().push_back(quotientDistributions[choice].getReward());
                         }
@@ -196,6 +256,8 @@ namespace storm {
                 }
             }
             
+            quotientRowGroupIndices.push_back(currentRow);
+            
             // Now check which of the blocks of the partition contain at least one initial state.
             for (auto initialState : this->model.getInitialStates()) {
                 Block<BlockDataType> const& initialBlock = this->partition.getBlock(initialState);
@@ -211,7 +273,93 @@ namespace storm {
             }
             
             // Finally construct the quotient model.
-            this->quotient = std::make_shared<ModelType>(builder.build(0,this->size(), this->size()), std::move(newLabeling), std::move(rewardModels));
+            storm::storage::sparse::ModelComponents<ValueType, RewardModelType> components(builder.build(0, this->size(), this->size()), std::move(newLabeling), std::move(rewardModels));
+            if constexpr (IsGame<ModelType>::value) {
+                // All states of a block belong to the same player.
+                components.statePlayerIndications = std::vector<storm::storage::PlayerIndex>(this->size());
+                for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
+                    components.statePlayerIndications.get()[blockIndex] = this->model.getPlayerOfState(*this->blocks[blockIndex].begin());
+                }
+                components.playerNameToIndexMap = this->model.getPlayerNameToIndexMap();
+                
+                // As only equally labeled choices are merged, the labels of the quotient's choices are well-defined.
+                if (this->model.hasChoiceLabeling()) {
+                    storm::models::sparse::ChoiceLabeling newChoiceLabeling(quotientChoiceOrigins.size());
+                    for (auto const& label : this->model.getChoiceLabeling().getLabels()) {
+                        storm::storage::BitVector const& originalChoices = this->model.getChoiceLabeling().getChoices(label);
+                        storm::storage::BitVector quotientChoices(quotientChoiceOrigins.size());
+                        for (uint_fast64_t row = 0; row < quotientChoiceOrigins.size(); ++row) {
+                            if (quotientChoiceOrigins[row] != std::numeric_limits<uint_fast64_t>::max() && originalChoices.get(quotientChoiceOrigins[row])) {
+                                quotientChoices.set(row);
+                            }
+                        }
+                        newChoiceLabeling.addLabel(label, std::move(quotientChoices));
+                    }
+                    components.choiceLabeling = std::move(newChoiceLabeling);
+                }
+            }
+            this->quotient = std::make_shared<ModelType>(std::move(components));
+            
+            this->createQuotientChoiceMapping(quotientRowGroupIndices, quotientChoiceOrigins);
+        }
+        
+        template<typename ModelType>
+        void NondeterministicModelBisimulationDecomposition<ModelType>::createQuotientChoiceMapping(std::vector<uint_fast64_t> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientChoiceOrigins) {
+            std::vector<uint_fast64_t> const& nondeterministicChoiceIndices = this->model.getTransitionMatrix().getRowGroupIndices();
+            quotientChoiceMapping.resize(this->model.getNumberOfChoices());
+            for (uint_fast64_t blockIndex = 0; blockIndex < this->blocks.size(); ++blockIndex) {
+                uint_fast64_t firstRow = quotientRowGroupIndices[blockIndex];
+                uint_fast64_t lastRow = quotientRowGroupIndices[blockIndex + 1];
+                for (auto state : this->blocks[blockIndex]) {
+                    for (uint_fast64_t choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1]; ++choice) {
+                        // Absorbing blocks only have their self-loop, to which all choices are mapped.
+                        if (quotientChoiceOrigins[firstRow] == std::numeric_limits<uint_fast64_t>::max()) {
+                            quotientChoiceMapping[choice] = firstRow;
+                            continue;
+                        }
+                        
+                        // Otherwise, all states of the block are bisimilar, so the representative has an equivalent choice.
+                        uint_fast64_t row = firstRow;
+                        for (; row < lastRow; ++row) {
+                            uint_fast64_t origin = quotientChoiceOrigins[row];
+                            if (choiceLabelsEqual(origin, choice) && quotientDistributions[origin].equals(quotientDistributions[choice], this->comparator)) {
+                                break;
+                            }
+                        }
+                        STORM_LOG_ASSERT(row < lastRow, "Unable to find the quotient choice of choice " << choice << ".");
+                        quotientChoiceMapping[choice] = row;
+                    }
+                }
+            }
+        }
+        
+        template<typename ModelType>
+        std::vector<uint_fast64_t> const& NondeterministicModelBisimulationDecomposition<ModelType>::getQuotientChoiceMapping() const {
+            STORM_LOG_THROW(this->quotient != nullptr, storm::exceptions::IllegalFunctionCallException, "Unable to retrieve quotient choice mapping, because the quotient was not built.");
+            return quotientChoiceMapping;
+        }
+        
+        template<typename ModelType>
+        std::vector<typename ModelType::ValueType> NondeterministicModelBisimulationDecomposition<ModelType>::liftChoiceValues(std::vector<ValueType> const& quotientChoiceValues) const {
+            std::vector<uint_fast64_t> const& choiceMapping = this->getQuotientChoiceMapping();
+            STORM_LOG_THROW(quotientChoiceValues.size() == this->quotient->getNumberOfChoices(), storm::exceptions::InvalidArgumentException, "Expected " << this->quotient->getNumberOfChoices() << " choice values, but got " << quotientChoiceValues.size() << ".");
+            std::vector<ValueType> result;
+            result.reserve(choiceMapping.size());
+            for (auto quotientChoice : choiceMapping) {
+                result.push_back(quotientChoiceValues[quotientChoice]);
+            }
+            return result;
+        }
+        
+        template<typename ModelType>
+        std::vector<typename ModelType::ValueType> NondeterministicModelBisimulationDecomposition<ModelType>::liftStateValues(std::vector<ValueType> const& quotientStateValues) const {
+            STORM_LOG_THROW(quotientStateValues.size() == this->size(), storm::exceptions::InvalidArgumentException, "Expected " << this->size() << " state values, but got " << quotientStateValues.size() << ".");
+            std::vector<ValueType> result;
+            result.reserve(this->model.getNumberOfStates());
+            for (auto quotientState : this->getQuotientStateMapping()) {
+                result.push_back(quotientStateValues[quotientState]);
+            }
+            return result;
         }
         
         template<typename ModelType>
@@ -300,7 +448,7 @@ namespace storm {
                 }
                 
                 for (auto choice = nondeterministicChoiceIndices[state]; choice < nondeterministicChoiceIndices[state + 1] - 1; ++choice) {
-                    if (orderedQuotientDistributions[choice + 1]->less(*orderedQuotientDistributions[choice], this->comparator)) {
+                    if (choiceLess(orderedQuotientDistributions[choice + 1], orderedQuotientDistributions[choice])) {
                         std::cout << "choice " << (choice+1) << " is less than predecessor" << std::endl;
                         std::cout << *orderedQuotientDistributions[choice] << " should be less than " << *orderedQuotientDistributions[choice + 1] << std::endl;
                         exit(-1);
@@ -392,18 +540,18 @@ namespace storm {
             
             for (; firstIt != firstIte && secondIt != secondIte; ++firstIt, ++secondIt) {
                 // If the current distributions are in a less-than relationship, we can return a result.
-                if ((*firstIt)->less(**secondIt, this->comparator)) {
+                if (choiceLess(*firstIt, *secondIt)) {
                     return true;
-                } else if ((*secondIt)->less(**firstIt, this->comparator)) {
+                } else if (choiceLess(*secondIt, *firstIt)) {
                     return false;
                 }
                 
                 // If the distributions matched, we need to advance both distribution iterators to the next distribution
                 // that is larger.
-                while (firstIt != firstIte && std::next(firstIt) != firstIte && !(*firstIt)->less(**std::next(firstIt), this->comparator)) {
+                while (firstIt != firstIte && std::next(firstIt) != firstIte && !choiceLess(*firstIt, *std::next(firstIt))) {
                     ++firstIt;
                 }
-                while (secondIt != secondIte && std::next(secondIt) != secondIte && !(*secondIt)->less(**std::next(secondIt), this->comparator)) {
+                while (secondIt != secondIte && std::next(secondIt) != secondIte && !choiceLess(*secondIt, *std::next(secondIt))) {
                     ++secondIt;
                 }
             }
@@ -426,10 +574,13 @@ namespace storm {
         }
         
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<double>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>>;
 
 #ifdef STORM_HAVE_CARL
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<storm::RationalNumber>>;
         template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Mdp<storm::RationalFunction>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<storm::RationalNumber>>;
+        template class NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<storm::RationalFunction>>;
 #endif
     }
 }
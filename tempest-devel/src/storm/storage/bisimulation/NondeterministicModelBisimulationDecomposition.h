@@ -28,6 +28,31 @@ namespace storm {
              */
             NondeterministicModelBisimulationDecomposition(ModelType const& model, typename BisimulationDecomposition<ModelType, BlockDataType>::Options const& options = typename BisimulationDecomposition<ModelType, BlockDataType>::Options());
             
+            /*!
+             * Retrieves the mapping from the choices of the original model to the choices of the quotient model. This
+             * is only available after the quotient has been built.
+             *
+             * @return The index of the quotient choice for each choice of the original model.
+             */
+            std::vector<uint_fast64_t> const& getQuotientChoiceMapping() const;
+            
+            /*!
+             * Lifts values of the choices of the quotient (e.g. the choice values from which a shield is computed) to
+             * the choices of the original model.
+             *
+             * @param quotientChoiceValues The values of the choices of the quotient.
+             * @return The values of the choices of the original model.
+             */
+            std::vector<ValueType> liftChoiceValues(std::vector<ValueType> const& quotientChoiceValues) const;
+            
+            /*!
+             * Lifts values of the states of the quotient to the states of the original model.
+             *
+             * @param quotientStateValues The values of the states of the quotient.
+             * @return The values of the states of the original model.
+             */
+            std::vector<ValueType> liftStateValues(std::vector<ValueType> const& quotientStateValues) const;
+            
         protected:
             virtual std::pair<storm::storage::BitVector, storm::storage::BitVector> getStatesWithProbability01() override;
             
@@ -44,6 +69,20 @@ namespace storm {
             // Initializes the quotient distributions wrt. to the current partition.
             void initializeQuotientDistributions();
             
+            // For games, splits the initial partition such that each block only contains states of one player and
+            // assigns the choices to classes of equally labeled choices.
+            void initializeGameStructure();
+            
+            // Retrieves whether the given choices carry the same labels (only relevant for games).
+            bool choiceLabelsEqual(uint_fast64_t choice1, uint_fast64_t choice2) const;
+            
+            // Retrieves whether the first quotient distribution is considered to be less than the second one. For
+            // games, the labels of the choices take precedence over the distributions.
+            bool choiceLess(storm::storage::DistributionWithReward<ValueType> const* distribution1, storm::storage::DistributionWithReward<ValueType> const* distribution2) const;
+            
+            // Computes the mapping from choices of the original model to the choices of the quotient.
+            void createQuotientChoiceMapping(std::vector<uint_fast64_t> const& quotientRowGroupIndices, std::vector<uint_fast64_t> const& quotientChoiceOrigins);
+            
             // Retrieves whether the given block possibly needs refinement.
             bool possiblyNeedsRefinement(bisimulation::Block<BlockDataType> const& block) const;
             
@@ -73,6 +112,12 @@ namespace storm {
             
             // A vector that stores for each state the ordered list of quotient distributions.
             std::vector<storm::storage::DistributionWithReward<ValueType> const*> orderedQuotientDistributions;
+            
+            // For games with choice labels, the class of equally labeled choices for each choice. Empty otherwise.
+            std::vector<uint_fast64_t> choiceLabelClasses;
+            
+            // A mapping from the choices of the original model to the choices of the quotient (if it was built).
+            std::vector<uint_fast64_t> quotientChoiceMapping;
         };
     }
 }
@@ -0,0 +1,195 @@
+#include "storm/storage/sparse/StateValuationIndex.h"
+
+#include <algorithm>
+#include <map>
+#include <numeric>
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+    namespace storage {
+        namespace sparse {
+
+            namespace {
+                uint64_t hashKey(uint64_t key, uint64_t shift) {
+                    // Fibonacci hashing, the upper bits of the product are the best mixed ones.
+                    return (key * 0x9E3779B97F4A7C15ull) >> shift;
+                }
+            }
+
+            StateValuationIndex::StateValuationIndex(StateValuations const& valuations, std::vector<storm::expressions::Variable> const& variables) : variables(variables) {
+                if (this->variables.empty() && valuations.getNumberOfStates() > 0) {
+                    for (auto valueIt = valuations.at(0).begin(); valueIt != valuations.at(0).end(); ++valueIt) {
+                        if (valueIt.isVariableAssignment() && !valueIt.isRational()) {
+                            this->variables.push_back(valueIt.getVariable());
+                        }
+                    }
+                }
+                build(valuations);
+            }
+
+            StateValuationIndex::StateValuationIndex(StateValuations const& valuations, std::vector<std::string> const& variableNames) {
+                STORM_LOG_THROW(valuations.getNumberOfStates() > 0 || variableNames.empty(), storm::exceptions::InvalidArgumentException, "Variables can not be selected by their name in state valuations without states.");
+                for (auto const& name : variableNames) {
+                    bool found = false;
+                    for (auto valueIt = valuations.at(0).begin(); valueIt != valuations.at(0).end(); ++valueIt) {
+                        if (valueIt.isVariableAssignment() && valueIt.getName() == name) {
+                            variables.push_back(valueIt.getVariable());
+                            found = true;
+                            break;
+                        }
+                    }
+                    STORM_LOG_THROW(found, storm::exceptions::InvalidArgumentException, "The state valuations do not contain a variable named " << name << ".");
+                }
+                build(valuations);
+            }
+
+            void StateValuationIndex::build(StateValuations const& valuations) {
+                uint64_t const numberOfVariables = variables.size();
+                uint64_t const numberOfStates = valuations.getNumberOfStates();
+                std::map<storm::expressions::Variable, uint64_t> variableToPosition;
+                for (uint64_t position = 0; position < numberOfVariables; ++position) {
+                    variableNames.push_back(variables[position].getName());
+                    bool inserted = variableToPosition.emplace(variables[position], position).second;
+                    STORM_LOG_THROW(inserted, storm::exceptions::InvalidArgumentException, "Variable " << variables[position].getName() << " is selected twice.");
+                }
+
+                // Collect the values of the selected variables.
+                std::vector<int64_t> values(numberOfStates * numberOfVariables);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    uint64_t numberOfFoundVariables = 0;
+                    for (auto valueIt = valuations.at(state).begin(); valueIt != valuations.at(state).end(); ++valueIt) {
+                        if (!valueIt.isVariableAssignment()) {
+                            continue;
+                        }
+                        auto positionIt = variableToPosition.find(valueIt.getVariable());
+                        if (positionIt == variableToPosition.end()) {
+                            continue;
+                        }
+                        STORM_LOG_THROW(!valueIt.isRational(), storm::exceptions::NotSupportedException, "The rational variable " << valueIt.getName() << " can not be indexed.");
+                        values[state * numberOfVariables + positionIt->second] = valueIt.isBoolean() ? (valueIt.getBooleanValue() ? 1 : 0) : valueIt.getIntegerValue();
+                        ++numberOfFoundVariables;
+                    }
+                    STORM_LOG_THROW(numberOfFoundVariables == numberOfVariables, storm::exceptions::InvalidArgumentException, "State " << state << " does not have a value for all selected variables.");
+                }
+
+                // Determine the layout of the keys from the ranges of the variables.
+                minimalValues.assign(numberOfVariables, std::numeric_limits<int64_t>::max());
+                std::vector<int64_t> maximalValues(numberOfVariables, std::numeric_limits<int64_t>::min());
+                for (uint64_t index = 0; index < values.size(); ++index) {
+                    minimalValues[index % numberOfVariables] = std::min(minimalValues[index % numberOfVariables], values[index]);
+                    maximalValues[index % numberOfVariables] = std::max(maximalValues[index % numberOfVariables], values[index]);
+                }
+                uint64_t numberOfBits = 0;
+                for (uint64_t position = 0; position < numberOfVariables; ++position) {
+                    if (numberOfStates == 0) {
+                        minimalValues[position] = maximalValues[position] = 0;
+                    }
+                    uint64_t range = static_cast<uint64_t>(maximalValues[position]) - static_cast<uint64_t>(minimalValues[position]);
+                    maximalOffsets.push_back(range);
+                    shifts.push_back(numberOfBits);
+                    while (range != 0) {
+                        ++numberOfBits;
+                        range >>= 1;
+                    }
+                }
+                STORM_LOG_THROW(numberOfBits <= 64, storm::exceptions::NotSupportedException, "The values of the selected variables need " << numberOfBits << " bits, but at most 64 are supported.");
+
+                std::vector<uint64_t> stateKeys(numberOfStates);
+                for (uint64_t state = 0; state < numberOfStates; ++state) {
+                    bool valid = computeKey(values.data() + state * numberOfVariables, stateKeys[state]);
+                    STORM_LOG_ASSERT(valid, "The values of state " << state << " are out of range.");
+                }
+                states.resize(numberOfStates);
+                std::iota(states.begin(), states.end(), 0);
+                std::stable_sort(states.begin(), states.end(), [&stateKeys] (uint64_t first, uint64_t second) { return stateKeys[first] < stateKeys[second]; });
+                for (uint64_t index = 0; index < numberOfStates; ++index) {
+                    if (index == 0 || stateKeys[states[index]] != keys.back()) {
+                        keys.push_back(stateKeys[states[index]]);
+                        stateOffsets.push_back(index);
+                    }
+                }
+                stateOffsets.push_back(numberOfStates);
+
+                uint64_t tableBits = 1;
+                while ((1ull << tableBits) < 2 * keys.size()) {
+                    ++tableBits;
+                }
+                tableShift = 64 - tableBits;
+                table.assign(1ull << tableBits, 0);
+                for (uint64_t keyIndex = 0; keyIndex < keys.size(); ++keyIndex) {
+                    uint64_t slot = hashKey(keys[keyIndex], tableShift);
+                    while (table[slot] != 0) {
+                        slot = (slot + 1) & (table.size() - 1);
+                    }
+                    table[slot] = keyIndex + 1;
+                }
+            }
+
+            bool StateValuationIndex::computeKey(int64_t const* values, uint64_t& key) const {
+                key = 0;
+                for (uint64_t position = 0; position < variables.size(); ++position) {
+                    if (values[position] < minimalValues[position]) {
+                        return false;
+                    }
+                    uint64_t offset = static_cast<uint64_t>(values[position]) - static_cast<uint64_t>(minimalValues[position]);
+                    if (offset > maximalOffsets[position]) {
+                        return false;
+                    }
+                    // Variables that take a single value may be shifted past the last bit, shifting by 64 is undefined.
+                    if (shifts[position] < 64) {
+                        key |= offset << shifts[position];
+                    }
+                }
+                return true;
+            }
+
+            uint64_t StateValuationIndex::findKey(uint64_t key) const {
+                uint64_t slot = hashKey(key, tableShift);
+                while (table[slot] != 0) {
+                    if (keys[table[slot] - 1] == key) {
+                        return table[slot] - 1;
+                    }
+                    slot = (slot + 1) & (table.size() - 1);
+                }
+                return keys.size();
+            }
+
+            std::vector<storm::expressions::Variable> const& StateValuationIndex::getVariables() const {
+                return variables;
+            }
+
+            std::vector<std::string> const& StateValuationIndex::getVariableNames() const {
+                return variableNames;
+            }
+
+            std::pair<uint64_t const*, uint64_t const*> StateValuationIndex::getStates(int64_t const* values) const {
+                uint64_t key;
+                if (computeKey(values, key)) {
+                    uint64_t keyIndex = findKey(key);
+                    if (keyIndex < keys.size()) {
+                        return {states.data() + stateOffsets[keyIndex], states.data() + stateOffsets[keyIndex + 1]};
+                    }
+                }
+                return {states.data(), states.data()};
+            }
+
+            uint64_t StateValuationIndex::getState(int64_t const* values) const {
+                auto range = getStates(values);
+                return range.first == range.second ? UNKNOWN_STATE : *range.first;
+            }
+
+            void StateValuationIndex::getStates(int64_t const* values, uint64_t numberOfTuples, uint64_t* states) const {
+                for (uint64_t index = 0; index < numberOfTuples; ++index) {
+                    states[index] = getState(values + index * variables.size());
+                }
+            }
+
+            uint64_t StateValuationIndex::getNumberOfKeys() const {
+                return keys.size();
+            }
+        }
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/expressions/Variable.h"
+
+namespace storm {
+    namespace storage {
+        namespace sparse {
+
+            /*!
+             * Maps the values of a subset of the boolean and integer variables back to the states with these values.
+             * The values of a state are packed into a single 64 bit key (each variable uses the bits needed for the
+             * range of values it takes in the model), so a lookup is a single probe into a hash table.
+             *
+             * Several states may have the same values for the selected variables (e.g. if an auxiliary variable is left
+             * out). All of them are returned by getStates in ascending order.
+             */
+            class StateValuationIndex {
+            public:
+                static constexpr uint64_t UNKNOWN_STATE = std::numeric_limits<uint64_t>::max();
+
+                /*!
+                 * Builds the index over the given variables. If no variables are given, all boolean and integer
+                 * variables are used.
+                 */
+                StateValuationIndex(StateValuations const& valuations, std::vector<storm::expressions::Variable> const& variables = {});
+
+                /*!
+                 * Builds the index over the variables with the given names.
+                 */
+                StateValuationIndex(StateValuations const& valuations, std::vector<std::string> const& variableNames);
+
+                std::vector<storm::expressions::Variable> const& getVariables() const;
+                std::vector<std::string> const& getVariableNames() const;
+
+                /*!
+                 * Retrieves the states with the given values (one per variable in the order of getVariables, booleans are
+                 * given as 0 and 1) as a range of state indices.
+                 */
+                std::pair<uint64_t const*, uint64_t const*> getStates(int64_t const* values) const;
+
+                /*!
+                 * Retrieves the smallest state with the given values or UNKNOWN_STATE if there is none.
+                 */
+                uint64_t getState(int64_t const* values) const;
+
+                /*!
+                 * Looks up the smallest state for each of the given consecutive value tuples.
+                 */
+                void getStates(int64_t const* values, uint64_t numberOfTuples, uint64_t* states) const;
+
+                /*!
+                 * Retrieves the number of distinct value tuples.
+                 */
+                uint64_t getNumberOfKeys() const;
+
+            private:
+                void build(StateValuations const& valuations);
+                bool computeKey(int64_t const* values, uint64_t& key) const;
+                uint64_t findKey(uint64_t key) const;
+
+                std::vector<storm::expressions::Variable> variables;
+                std::vector<std::string> variableNames;
+
+                // For each variable, the smallest value and the position of its bits within a key.
+                std::vector<int64_t> minimalValues;
+                std::vector<uint64_t> maximalOffsets;
+                std::vector<uint64_t> shifts;
+
+                // The distinct keys, the states of key i are states[stateOffsets[i]] to states[stateOffsets[i + 1] - 1].
+                std::vector<uint64_t> keys;
+                std::vector<uint64_t> stateOffsets;
+                std::vector<uint64_t> states;
+
+                // An open addressing hash table over the keys storing the index of a key plus one or zero if empty.
+                std::vector<uint64_t> table;
+                uint64_t tableShift;
+            };
+        }
+    }
+}
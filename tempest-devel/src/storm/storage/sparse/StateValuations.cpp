@@ -1,23 +1,110 @@
 #include "storm/storage/sparse/StateValuations.h"
 
+#include <algorithm>
+#include <cstring>
+
 #include "storm/storage/BitVector.h"
 
 #include "storm/utility/vector.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/constants.h"
 #include "storm/exceptions/InvalidTypeException.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace storm {
     namespace storage {
         namespace sparse {
             
-            StateValuations::StateValuation::StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues) : booleanValues(std::move(booleanValues)), integerValues(std::move(integerValues)), rationalValues(std::move(rationalValues)), observationLabelValues(std::move(observationLabelValues)) {
-                // Intentionally left empty
+            StateValuations::IntegerColumn::IntegerColumn(uint64_t width) : width(width) {
+                STORM_LOG_ASSERT(width == 1 || width == 2 || width == 4 || width == 8, "Illegal width " << width << ".");
             }
-            
-            typename StateValuations::StateValuation const& StateValuations::getValuation(storm::storage::sparse::state_type const& stateIndex) const {
-                STORM_LOG_ASSERT(stateIndex < valuations.size(), "Invalid state index.");
-                STORM_LOG_ASSERT(assertValuation(valuations[stateIndex]), "Invalid  state valuations");
-                return valuations[stateIndex];
+
+            int64_t StateValuations::IntegerColumn::get(uint64_t index) const {
+                STORM_LOG_ASSERT((index + 1) * width <= data.size(), "Invalid index.");
+                uint8_t const* position = data.data() + index * width;
+                switch (width) {
+                    case 1: {
+                        int8_t value;
+                        std::memcpy(&value, position, 1);
+                        return value;
+                    }
+                    case 2: {
+                        int16_t value;
+                        std::memcpy(&value, position, 2);
+                        return value;
+                    }
+                    case 4: {
+                        int32_t value;
+                        std::memcpy(&value, position, 4);
+                        return value;
+                    }
+                    default: {
+                        int64_t value;
+                        std::memcpy(&value, position, 8);
+                        return value;
+                    }
+                }
+            }
+
+            void StateValuations::IntegerColumn::set(uint64_t index, int64_t value) {
+                uint64_t requiredWidth = getWidth(value, value);
+                if (requiredWidth > width) {
+                    widen(requiredWidth);
+                }
+                STORM_LOG_ASSERT((index + 1) * width <= data.size(), "Invalid index.");
+                uint8_t* position = data.data() + index * width;
+                switch (width) {
+                    case 1: {
+                        int8_t narrowValue = static_cast<int8_t>(value);
+                        std::memcpy(position, &narrowValue, 1);
+                        break;
+                    }
+                    case 2: {
+                        int16_t narrowValue = static_cast<int16_t>(value);
+                        std::memcpy(position, &narrowValue, 2);
+                        break;
+                    }
+                    case 4: {
+                        int32_t narrowValue = static_cast<int32_t>(value);
+                        std::memcpy(position, &narrowValue, 4);
+                        break;
+                    }
+                    default:
+                        std::memcpy(position, &value, 8);
+                }
+            }
+
+            void StateValuations::IntegerColumn::resize(uint64_t size) {
+                data.resize(size * width, 0);
+            }
+
+            uint64_t StateValuations::IntegerColumn::getWidth() const {
+                return width;
+            }
+
+            void const* StateValuations::IntegerColumn::getData() const {
+                return data.data();
+            }
+
+            uint64_t StateValuations::IntegerColumn::getWidth(int64_t lowerBound, int64_t upperBound) {
+                for (uint64_t width = 1; width < 8; width *= 2) {
+                    int64_t maximalValue = (1ll << (8 * width - 1)) - 1;
+                    if (lowerBound >= -maximalValue - 1 && upperBound <= maximalValue) {
+                        return width;
+                    }
+                }
+                return 8;
+            }
+
+            void StateValuations::IntegerColumn::widen(uint64_t newWidth) {
+                IntegerColumn widenedColumn(newWidth);
+                uint64_t size = data.size() / width;
+                widenedColumn.resize(size);
+                for (uint64_t index = 0; index < size; ++index) {
+                    widenedColumn.set(index, get(index));
+                }
+                *this = std::move(widenedColumn);
             }
 
             StateValuations::StateValueIterator::StateValueIterator(typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableIt,
@@ -26,9 +113,10 @@ namespace storm {
                                                                     typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                                                     typename std::map<std::string, uint64_t>::const_iterator labelBegin,
                                                                     typename std::map<std::string, uint64_t>::const_iterator labelEnd,
-                                                                    StateValuation const* valuation) : variableIt(variableIt), labelIt(labelIt),
+                                                                    StateValuations const* valuations,
+                                                                    storm::storage::sparse::state_type state) : variableIt(variableIt), labelIt(labelIt),
                                                                     variableBegin(variableBegin), variableEnd(variableEnd),
-                                                                    labelBegin(labelBegin), labelEnd(labelEnd), valuation(valuation) {
+                                                                    labelBegin(labelBegin), labelEnd(labelEnd), valuations(valuations), state(state) {
                 // Intentionally left empty.
             }
 
@@ -62,27 +150,26 @@ namespace storm {
 
             bool StateValuations::StateValueIterator::getBooleanValue() const {
                 STORM_LOG_ASSERT(isBoolean(), "Variable has no boolean type.");
-                return valuation->booleanValues[variableIt->second];
+                return valuations->booleanColumns[variableIt->second][state] != 0;
             }
             
             int64_t StateValuations::StateValueIterator::getIntegerValue() const {
                 STORM_LOG_ASSERT(isInteger(), "Variable has no integer type.");
-                return valuation->integerValues[variableIt->second];
+                return valuations->integerColumns[variableIt->second].get(state);
             }
 
             int64_t StateValuations::StateValueIterator::getLabelValue() const {
                 STORM_LOG_ASSERT(isLabelAssignment(), "Not a label assignment");
-                STORM_LOG_ASSERT(labelIt->second < valuation->observationLabelValues.size(), "Label index " << labelIt->second << " larger than number of labels " << valuation->observationLabelValues.size());
-                return valuation->observationLabelValues[labelIt->second];
+                return valuations->observationLabelColumns[labelIt->second].get(state);
             }
 
             storm::RationalNumber StateValuations::StateValueIterator::getRationalValue() const {
                 STORM_LOG_ASSERT(isRational(), "Variable has no rational type.");
-                return valuation->rationalValues[variableIt->second];
+                return valuations->rationalColumns[variableIt->second][state];
             }
             
             bool StateValuations::StateValueIterator::operator==(StateValueIterator const& other) {
-                STORM_LOG_ASSERT(valuation == valuation, "Comparing iterators for different states");
+                STORM_LOG_ASSERT(valuations == other.valuations && state == other.state, "Comparing iterators for different states");
                 return variableIt == other.variableIt && labelIt == other.labelIt;
             }
             bool StateValuations::StateValueIterator::operator!=(StateValueIterator const& other) {
@@ -108,39 +195,38 @@ namespace storm {
                 return *this;
             }
             
-            StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation) : variableMap(variableMap), labelMap(labelMap), valuation(valuation) {
+            StateValuations::StateValueIteratorRange::StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap, StateValuations const* valuations, storm::storage::sparse::state_type state) : variableMap(variableMap), labelMap(labelMap), valuations(valuations), state(state) {
                 // Intentionally left empty.
             }
             
             StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::begin() const {
-                return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuation);
+                return StateValueIterator(variableMap.cbegin(), labelMap.cbegin(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations, state);
             }
             
             StateValuations::StateValueIterator StateValuations::StateValueIteratorRange::end() const {
-                return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(),  valuation);
+                return StateValueIterator(variableMap.cend(), labelMap.cend(), variableMap.cbegin(), variableMap.cend(), labelMap.cbegin(), labelMap.cend(), valuations, state);
             }
             
             bool StateValuations::getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+                STORM_LOG_ASSERT(stateIndex < numberOfStates, "Invalid state index.");
                 STORM_LOG_ASSERT(variableToIndexMap.count(booleanVariable) > 0, "Variable " << booleanVariable.getName() << " is not part of this valuation.");
-                return valuation.booleanValues[variableToIndexMap.at(booleanVariable)];
+                return booleanColumns[variableToIndexMap.at(booleanVariable)][stateIndex] != 0;
             }
             
-            int64_t const& StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+            int64_t StateValuations::getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const {
+                STORM_LOG_ASSERT(stateIndex < numberOfStates, "Invalid state index.");
                 STORM_LOG_ASSERT(variableToIndexMap.count(integerVariable) > 0, "Variable " << integerVariable.getName() << " is not part of this valuation.");
-                return valuation.integerValues[variableToIndexMap.at(integerVariable)];
+                return integerColumns[variableToIndexMap.at(integerVariable)].get(stateIndex);
             }
             
             storm::RationalNumber const& StateValuations::getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const {
-                auto const& valuation = getValuation(stateIndex);
+                STORM_LOG_ASSERT(stateIndex < numberOfStates, "Invalid state index.");
                 STORM_LOG_ASSERT(variableToIndexMap.count(rationalVariable) > 0, "Variable " << rationalVariable.getName() << " is not part of this valuation.");
-                return valuation.rationalValues[variableToIndexMap.at(rationalVariable)];
+                return rationalColumns[variableToIndexMap.at(rationalVariable)][stateIndex];
             }
             
             bool StateValuations::isEmpty(storm::storage::sparse::state_type const& stateIndex) const {
-                auto const& valuation = valuations[stateIndex]; // Do not use getValuations, as that is only valid after adding stuff.
-                return valuation.booleanValues.empty() && valuation.integerValues.empty() && valuation.rationalValues.empty() && valuation.observationLabelValues.empty();
+                return stateIndex >= numberOfStates || !definedStates[stateIndex] || (variableToIndexMap.empty() && observationLabels.empty());
             }
             
             std::string StateValuations::toString(storm::storage::sparse::state_type const& stateIndex, bool pretty, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) const {
@@ -227,42 +313,6 @@ namespace storm {
                 return result;
             }
             
-            bool StateValuations::assertValuation(StateValuation const& valuation) const {
-                storm::storage::BitVector foundBooleanValues(valuation.booleanValues.size(), false);
-                storm::storage::BitVector foundIntegerValues(valuation.integerValues.size(), false);
-                storm::storage::BitVector foundRationalValues(valuation.rationalValues.size(), false);
-                for (auto const& varIndex : variableToIndexMap) {
-                    storm::storage::BitVector* bv;
-                    if (varIndex.first.hasBooleanType()) {
-                        bv = &foundBooleanValues;
-                    } else if (varIndex.first.hasIntegerType()) {
-                        bv = &foundIntegerValues;
-                    } else if (varIndex.first.hasRationalType()) {
-                        bv = &foundRationalValues;
-                    } else {
-                        STORM_LOG_THROW(false, storm::exceptions::InvalidTypeException, "Unexpected variable type.");
-                    }
-                    if (varIndex.second < bv->size()) {
-                        if (bv->get(varIndex.second)) {
-                            STORM_LOG_ERROR("Multiple variables refer to the same value index");
-                            return false;
-                        }
-                        bv->set(varIndex.second, true);
-                    } else {
-                        STORM_LOG_ERROR("Valuation does not provide a value for all variables");
-                        return false;
-                    }
-                }
-                if (!(foundBooleanValues.full() && foundIntegerValues.full() && foundRationalValues.full())) {
-                    STORM_LOG_ERROR("Valuation has too many entries.");
-                }
-                return true;
-            }
-            
-            StateValuations::StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations) : variableToIndexMap(variableToIndexMap), valuations(valuations) {
-                // Intentionally left empty
-            }
-            
             std::string StateValuations::getStateInfo(state_type const& state) const {
                 STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
                 return this->toString(state);
@@ -270,40 +320,100 @@ namespace storm {
             
             typename StateValuations::StateValueIteratorRange StateValuations::at(state_type const& state) const {
                 STORM_LOG_ASSERT(state < getNumberOfStates(), "Invalid state index.");
-                return StateValueIteratorRange({variableToIndexMap, observationLabels,  &(valuations[state])});
+                return StateValueIteratorRange(variableToIndexMap, observationLabels, this, state);
             }
             
             uint_fast64_t StateValuations::getNumberOfStates() const {
-                return valuations.size();
+                return numberOfStates;
             }
 
             std::size_t StateValuations::hash() const {
                 return 0;
             }
             
-            StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
-                return StateValuations(variableToIndexMap, storm::utility::vector::filterVector(valuations, selectedStates));
+            std::vector<storm::expressions::Variable> StateValuations::getVariables() const {
+                std::vector<storm::expressions::Variable> result;
+                for (auto const& variableIndex : variableToIndexMap) {
+                    result.push_back(variableIndex.first);
+                }
+                return result;
             }
 
-            StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
-                std::vector<StateValuation> selectedValuations;
-                selectedValuations.reserve(selectedStates.size());
-                for (auto const& selectedState : selectedStates){
-                    if (selectedState < valuations.size()) {
-                        selectedValuations.push_back(valuations[selectedState]);
-                    } else {
-                        selectedValuations.emplace_back();
+            std::pair<void const*, uint64_t> StateValuations::getColumn(storm::expressions::Variable const& variable) const {
+                auto indexIt = variableToIndexMap.find(variable);
+                STORM_LOG_THROW(indexIt != variableToIndexMap.end(), storm::exceptions::InvalidArgumentException, "Variable " << variable.getName() << " is not part of this valuation.");
+                if (variable.hasBooleanType()) {
+                    return {booleanColumns[indexIt->second].data(), 1};
+                }
+                STORM_LOG_THROW(variable.hasIntegerType(), storm::exceptions::NotSupportedException, "The values of the rational variable " << variable.getName() << " can not be retrieved as an array.");
+                auto const& column = integerColumns[indexIt->second];
+                return {column.getData(), column.getWidth()};
+            }
+
+            void StateValuations::resize(uint64_t newNumberOfStates) {
+                numberOfStates = newNumberOfStates;
+                definedStates.resize(numberOfStates, false);
+                for (auto& column : booleanColumns) {
+                    column.resize(numberOfStates, 0);
+                }
+                for (auto& column : integerColumns) {
+                    column.resize(numberOfStates);
+                }
+                for (auto& column : rationalColumns) {
+                    column.resize(numberOfStates, storm::utility::zero<storm::RationalNumber>());
+                }
+                for (auto& column : observationLabelColumns) {
+                    column.resize(numberOfStates);
+                }
+            }
+
+            StateValuations StateValuations::copyStates(std::vector<storm::storage::sparse::state_type> const& oldStates) const {
+                StateValuations result;
+                result.variableToIndexMap = variableToIndexMap;
+                result.observationLabels = observationLabels;
+                result.booleanColumns.resize(booleanColumns.size());
+                for (auto const& column : integerColumns) {
+                    result.integerColumns.emplace_back(column.getWidth());
+                }
+                result.rationalColumns.resize(rationalColumns.size());
+                for (auto const& column : observationLabelColumns) {
+                    result.observationLabelColumns.emplace_back(column.getWidth());
+                }
+                result.resize(oldStates.size());
+
+                for (uint64_t newState = 0; newState < oldStates.size(); ++newState) {
+                    uint64_t oldState = oldStates[newState];
+                    if (oldState >= numberOfStates) {
+                        continue;
+                    }
+                    result.definedStates[newState] = definedStates[oldState];
+                    for (uint64_t column = 0; column < booleanColumns.size(); ++column) {
+                        result.booleanColumns[column][newState] = booleanColumns[column][oldState];
+                    }
+                    for (uint64_t column = 0; column < integerColumns.size(); ++column) {
+                        result.integerColumns[column].set(newState, integerColumns[column].get(oldState));
+                    }
+                    for (uint64_t column = 0; column < rationalColumns.size(); ++column) {
+                        result.rationalColumns[column][newState] = rationalColumns[column][oldState];
+                    }
+                    for (uint64_t column = 0; column < observationLabelColumns.size(); ++column) {
+                        result.observationLabelColumns[column].set(newState, observationLabelColumns[column].get(oldState));
                     }
                 }
-                return StateValuations(variableToIndexMap, std::move(selectedValuations));
+                return result;
+            }
+            
+            StateValuations StateValuations::selectStates(storm::storage::BitVector const& selectedStates) const {
+                return copyStates(std::vector<storm::storage::sparse::state_type>(selectedStates.begin(), selectedStates.end()));
+            }
+
+            StateValuations StateValuations::selectStates(std::vector<storm::storage::sparse::state_type> const& selectedStates) const {
+                return copyStates(selectedStates);
             }
 
             StateValuations StateValuations::blowup(const std::vector<uint64_t> &mapNewToOld) const {
-                std::vector<StateValuation> newValuations;
-                for( auto const& oldState : mapNewToOld) {
-                    newValuations.push_back(valuations[oldState]);
-                }
-                return StateValuations(variableToIndexMap, std::move(newValuations));
+                STORM_LOG_ASSERT(std::all_of(mapNewToOld.begin(), mapNewToOld.end(), [this] (uint64_t oldState) { return oldState < numberOfStates; }), "Invalid state index.");
+                return copyStates(mapNewToOld);
             }
             
             StateValuationsBuilder::StateValuationsBuilder() : booleanVarCount(0), integerVarCount(0), rationalVarCount(0), labelCount(0) {
@@ -311,32 +421,55 @@ namespace storm {
             }
             
             void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable) {
-                STORM_LOG_ASSERT(currentStateValuations.valuations.empty(), "Tried to add a variable, although a state has already been added before.");
+                STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add a variable, although a state has already been added before.");
                 STORM_LOG_ASSERT(currentStateValuations.variableToIndexMap.count(variable) == 0, "Variable " << variable.getName() << " already added.");
                 if (variable.hasBooleanType()) {
                     currentStateValuations.variableToIndexMap[variable] = booleanVarCount++;
+                    currentStateValuations.booleanColumns.emplace_back();
                 }
                 if (variable.hasIntegerType()) {
                     currentStateValuations.variableToIndexMap[variable] = integerVarCount++;
+                    currentStateValuations.integerColumns.emplace_back();
                 }
                 if (variable.hasRationalType()) {
                     currentStateValuations.variableToIndexMap[variable] = rationalVarCount++;
+                    currentStateValuations.rationalColumns.emplace_back();
                 }
             }
 
+            void StateValuationsBuilder::addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound) {
+                STORM_LOG_ASSERT(variable.hasIntegerType(), "Bounds can only be given for integer variables.");
+                addVariable(variable);
+                currentStateValuations.integerColumns.back() = StateValuations::IntegerColumn(StateValuations::IntegerColumn::getWidth(lowerBound, upperBound));
+            }
+
             void StateValuationsBuilder::addObservationLabel(const std::string &label) {
+                STORM_LOG_ASSERT(currentStateValuations.numberOfStates == 0, "Tried to add an observation label, although a state has already been added before.");
                 currentStateValuations.observationLabels[label] = labelCount++;
+                currentStateValuations.observationLabelColumns.emplace_back();
             }
             
             void StateValuationsBuilder::addState(storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues,std::vector<int64_t>&& observationLabelValues) {
-                if (state > currentStateValuations.valuations.size()) {
-                    currentStateValuations.valuations.resize(state);
-                }
-                if (state == currentStateValuations.valuations.size()) {
-                    currentStateValuations.valuations.emplace_back(std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(observationLabelValues));
+                STORM_LOG_THROW(booleanValues.size() == booleanVarCount && integerValues.size() == integerVarCount && rationalValues.size() == rationalVarCount, storm::exceptions::InvalidArgumentException, "The valuation of state " << state << " does not provide exactly one value for each variable.");
+                StateValuations& valuations = currentStateValuations;
+                if (state >= valuations.numberOfStates) {
+                    valuations.resize(state + 1);
                 } else {
-                    STORM_LOG_ASSERT(currentStateValuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
-                    currentStateValuations.valuations[state] = typename StateValuations::StateValuation(std::move(booleanValues), std::move(integerValues), std::move(rationalValues), std::move(observationLabelValues));
+                    STORM_LOG_ASSERT(valuations.isEmpty(state), "Adding a valuation to the same state multiple times.");
+                }
+                valuations.definedStates[state] = true;
+                for (uint64_t column = 0; column < booleanValues.size(); ++column) {
+                    valuations.booleanColumns[column][state] = booleanValues[column] ? 1 : 0;
+                }
+                for (uint64_t column = 0; column < integerValues.size(); ++column) {
+                    valuations.integerColumns[column].set(state, integerValues[column]);
+                }
+                for (uint64_t column = 0; column < rationalValues.size(); ++column) {
+                    valuations.rationalColumns[column][state] = std::move(rationalValues[column]);
+                }
+                // Label values without a corresponding label can not be accessed and are therefore dropped.
+                for (uint64_t column = 0; column < std::min<uint64_t>(observationLabelValues.size(), labelCount); ++column) {
+                    valuations.observationLabelColumns[column].set(state, observationLabelValues[column]);
                 }
             }
 
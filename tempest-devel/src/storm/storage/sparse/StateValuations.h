@@ -21,18 +21,31 @@ namespace storm {
             public:
                 friend class StateValuationsBuilder;
 
-                class StateValuation {
+                /*!
+                 * The values of an integer variable (or observation label) for all states, stored as signed integers of
+                 * 1, 2, 4 or 8 bytes. The width is given by the range of the variable if it is known upfront and is
+                 * increased as soon as a value does not fit.
+                 */
+                class IntegerColumn {
                 public:
-                    friend class StateValuations;
-                    StateValuation() = default;
-                    StateValuation(std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues, std::vector<int64_t>&& observationLabelValues = {});
-    
-                private:
+                    IntegerColumn(uint64_t width = 1);
+
+                    int64_t get(uint64_t index) const;
+                    void set(uint64_t index, int64_t value);
+                    void resize(uint64_t size);
                     
-                    std::vector<bool> booleanValues;
-                    std::vector<int64_t> integerValues;
-                    std::vector<storm::RationalNumber> rationalValues;
-                    std::vector<int64_t> observationLabelValues;
+                    // The number of bytes per value.
+                    uint64_t getWidth() const;
+                    void const* getData() const;
+
+                    // Returns the smallest width that can hold all values in the given range.
+                    static uint64_t getWidth(int64_t lowerBound, int64_t upperBound);
+
+                private:
+                    void widen(uint64_t newWidth);
+
+                    uint64_t width;
+                    std::vector<uint8_t> data;
                 };
                 
                 class StateValueIterator {
@@ -43,7 +56,8 @@ namespace storm {
                                        typename std::map<storm::expressions::Variable, uint64_t>::const_iterator variableEnd,
                                        typename std::map<std::string, uint64_t>::const_iterator labelBegin,
                                        typename std::map<std::string, uint64_t>::const_iterator labelEnd,
-                                       StateValuation const* valuation);
+                                       StateValuations const* valuations,
+                                       storm::storage::sparse::state_type state);
                     bool operator==(StateValueIterator const& other);
                     bool operator!=(StateValueIterator const& other);
                     StateValueIterator& operator++();
@@ -73,18 +87,20 @@ namespace storm {
                     typename std::map<std::string, uint64_t>::const_iterator labelBegin;
                     typename std::map<std::string, uint64_t>::const_iterator labelEnd;
 
-                    StateValuation const* const valuation;
+                    StateValuations const* const valuations;
+                    storm::storage::sparse::state_type const state;
                 };
                 
                 class StateValueIteratorRange {
                 public:
-                    StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap, StateValuation const* valuation);
+                    StateValueIteratorRange(std::map<storm::expressions::Variable, uint64_t> const& variableMap, std::map<std::string, uint64_t> const& labelMap, StateValuations const* valuations, storm::storage::sparse::state_type state);
                     StateValueIterator begin() const;
                     StateValueIterator end() const;
                 private:
                     std::map<storm::expressions::Variable, uint64_t> const& variableMap;
                     std::map<std::string, uint64_t> const& labelMap;
-                    StateValuation const* const valuation;
+                    StateValuations const* const valuations;
+                    storm::storage::sparse::state_type const state;
                 };
                 
                 StateValuations() = default;
@@ -93,7 +109,7 @@ namespace storm {
                 StateValueIteratorRange at(storm::storage::sparse::state_type const& state) const;
                 
                 bool getBooleanValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& booleanVariable) const;
-                int64_t const& getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
+                int64_t getIntegerValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& integerVariable) const;
                 storm::RationalNumber const& getRationalValue(storm::storage::sparse::state_type const& stateIndex, storm::expressions::Variable const& rationalVariable) const;
                 /// Returns true, if this valuation does not contain any value.
                 bool isEmpty(storm::storage::sparse::state_type const& stateIndex) const;
@@ -131,16 +147,37 @@ namespace storm {
                 StateValuations blowup(std::vector<uint64_t> const& mapNewToOld) const;
 
                 virtual std::size_t hash() const;
+
+                /*!
+                 * Retrieves the variables of the valuations.
+                 */
+                std::vector<storm::expressions::Variable> getVariables() const;
+
+                /*!
+                 * Retrieves the values of the given boolean or integer variable for all states as one contiguous array.
+                 * Boolean values take one byte (0 or 1) and integer values are signed integers with the returned number
+                 * of bytes per value (1, 2, 4 or 8). The values of states without a valuation are zero. The array is
+                 * valid until this object is modified or destroyed.
+                 *
+                 * @return The array and the number of bytes per value.
+                 */
+                std::pair<void const*, uint64_t> getColumn(storm::expressions::Variable const& variable) const;
                 
             private:
-                StateValuations(std::map<storm::expressions::Variable, uint64_t> const& variableToIndexMap, std::vector<StateValuation>&& valuations);
-                bool assertValuation(StateValuation const& valuation) const;
-                StateValuation const& getValuation(storm::storage::sparse::state_type const& stateIndex) const;
+                void resize(uint64_t numberOfStates);
+                StateValuations copyStates(std::vector<storm::storage::sparse::state_type> const& oldStates) const;
                 
                 std::map<storm::expressions::Variable, uint64_t> variableToIndexMap;
                 std::map<std::string, uint64_t> observationLabels;
-                // A mapping from state indices to their variable valuations.
-                std::vector<StateValuation> valuations;
+
+                // The values are stored column-wise, i.e. there is one column per variable (resp. label) holding its
+                // values for all states.
+                uint64_t numberOfStates = 0;
+                std::vector<bool> definedStates;
+                std::vector<std::vector<uint8_t>> booleanColumns;
+                std::vector<IntegerColumn> integerColumns;
+                std::vector<std::vector<storm::RationalNumber>> rationalColumns;
+                std::vector<IntegerColumn> observationLabelColumns;
                 
             };
             
@@ -153,6 +190,12 @@ namespace storm {
                  */
                 void addVariable(storm::expressions::Variable const& variable);
 
+                /*!
+                 * Adds a new integer variable whose values are known to lie within the given bounds, which allows
+                 * storing them compactly right away.
+                 */
+                void addVariable(storm::expressions::Variable const& variable, int64_t lowerBound, int64_t upperBound);
+
                 void addObservationLabel(std::string const& label);
 
                 /*!
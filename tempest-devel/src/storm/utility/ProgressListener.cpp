@@ -0,0 +1,139 @@
+#include "storm/utility/ProgressListener.h"
+
+#include <chrono>
+#include <mutex>
+
+namespace storm {
+    namespace utility {
+        namespace progress {
+
+            namespace {
+                thread_local std::shared_ptr<ProgressContext> currentContext;
+
+                // The context of the callback installed with setProgressCallback. It is only replaced under the
+                // mutex, reports copy it and call it after unlocking, so a callback may wait for other threads
+                // (e.g. for a lock of an interpreter) without blocking the installation of another callback.
+                std::mutex globalContextMutex;
+                std::shared_ptr<ProgressContext> globalContext;
+                std::atomic<bool> globalCallbackInstalled(false);
+                // A hint that avoids locking the mutex for every check whether a report of the global callback is due.
+                std::atomic<int64_t> globalNextReportTime(0);
+                std::atomic<int64_t> globalReportDelay(0);
+
+                int64_t currentTime() {
+                    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+                }
+
+                void report(ProgressInformation const& information) {
+                    if (currentContext) {
+                        currentContext->report(information);
+                        return;
+                    }
+                    std::shared_ptr<ProgressContext> context;
+                    {
+                        std::lock_guard<std::mutex> lock(globalContextMutex);
+                        context = globalContext;
+                    }
+                    if (context) {
+                        globalNextReportTime.store(currentTime() + globalReportDelay.load());
+                        context->report(information);
+                    }
+                }
+            }
+
+            ProgressContext::ProgressContext(ProgressCallback const& callback, uint64_t minimalDelayInMilliseconds) : callback(callback), reportDelay(static_cast<int64_t>(minimalDelayInMilliseconds) * 1000000), nextReportTime(0), reportInProgress(false), cancelled(false) {
+                // Intentionally left empty.
+            }
+
+            bool ProgressContext::isReportDue() const {
+                return callback && currentTime() >= nextReportTime.load(std::memory_order_relaxed);
+            }
+
+            void ProgressContext::report(ProgressInformation const& information) {
+                // Threads that find another report in progress skip theirs instead of waiting.
+                if (!callback || reportInProgress.exchange(true)) {
+                    return;
+                }
+                int64_t now = currentTime();
+                if (now >= nextReportTime.load()) {
+                    nextReportTime.store(now + reportDelay);
+                    try {
+                        callback(information);
+                    } catch (...) {
+                        reportInProgress.store(false);
+                        throw;
+                    }
+                }
+                reportInProgress.store(false);
+            }
+
+            void ProgressContext::cancel() {
+                cancelled.store(true);
+            }
+
+            bool ProgressContext::isCancelled() const {
+                return cancelled.load(std::memory_order_relaxed);
+            }
+
+            ProgressContextScope::ProgressContextScope(std::shared_ptr<ProgressContext> const& context) : previousContext(std::move(currentContext)) {
+                currentContext = context;
+            }
+
+            ProgressContextScope::~ProgressContextScope() {
+                currentContext = std::move(previousContext);
+            }
+
+            std::shared_ptr<ProgressContext> const& getProgressContext() {
+                return currentContext;
+            }
+
+            bool isCancelled() {
+                return currentContext && currentContext->isCancelled();
+            }
+
+            void setProgressCallback(ProgressCallback const& callback, uint64_t minimalDelayInMilliseconds) {
+                auto context = callback ? std::make_shared<ProgressContext>(callback, minimalDelayInMilliseconds) : nullptr;
+                std::lock_guard<std::mutex> lock(globalContextMutex);
+                // The previous context is released after unlocking, so its callback is not destroyed under the mutex.
+                globalContext.swap(context);
+                globalReportDelay.store(static_cast<int64_t>(minimalDelayInMilliseconds) * 1000000);
+                globalNextReportTime.store(0);
+                globalCallbackInstalled.store(static_cast<bool>(globalContext));
+            }
+
+            void resetProgressCallback() {
+                std::shared_ptr<ProgressContext> context;
+                std::lock_guard<std::mutex> lock(globalContextMutex);
+                globalCallbackInstalled.store(false);
+                globalContext.swap(context);
+            }
+
+            bool isProgressReportDue() {
+                if (currentContext) {
+                    return currentContext->isReportDue();
+                }
+                return globalCallbackInstalled.load(std::memory_order_relaxed) && currentTime() >= globalNextReportTime.load(std::memory_order_relaxed);
+            }
+
+            void reportExploredStates(uint64_t numberOfExploredStates) {
+                if (isProgressReportDue()) {
+                    ProgressInformation information;
+                    information.phase = ProgressPhase::Exploration;
+                    information.numberOfExploredStates = numberOfExploredStates;
+                    report(information);
+                }
+            }
+
+            void reportIteration(uint64_t iteration, double residual) {
+                if (isProgressReportDue()) {
+                    ProgressInformation information;
+                    information.phase = ProgressPhase::Solving;
+                    information.iteration = iteration;
+                    information.residual = residual;
+                    report(information);
+                }
+            }
+
+        }
+    }
+}
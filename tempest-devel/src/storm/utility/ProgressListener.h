@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace storm {
+    namespace utility {
+        namespace progress {
+
+            enum class ProgressPhase { Exploration, Solving };
+
+            struct ProgressInformation {
+                ProgressPhase phase;
+                // The number of states explored so far by the model builder.
+                uint64_t numberOfExploredStates = 0;
+                // The number of iterations performed so far by the current iterative solver.
+                uint64_t iteration = 0;
+                // The maximal difference between the last two iterates, NaN if it is not known.
+                double residual = 0;
+            };
+
+            typedef std::function<void(ProgressInformation const&)> ProgressCallback;
+
+            /*!
+             * The progress callback and the cancellation request of a single computation. A computation uses the
+             * context of the thread it runs on (see ProgressContextScope), so concurrent computations with different
+             * contexts neither receive the reports of each other nor are cancelled together.
+             */
+            class ProgressContext {
+            public:
+                /*!
+                 * Creates a context whose callback is called at most once per given delay and never concurrently. The
+                 * callback may be empty if only cancellation is needed.
+                 */
+                ProgressContext(ProgressCallback const& callback = nullptr, uint64_t minimalDelayInMilliseconds = 100);
+
+                ProgressContext(ProgressContext const&) = delete;
+                ProgressContext& operator=(ProgressContext const&) = delete;
+
+                /*!
+                 * Retrieves whether the callback is set and the delay since its last call passed.
+                 */
+                bool isReportDue() const;
+
+                /*!
+                 * Calls the callback if a report is due and no other report of this context is in progress.
+                 */
+                void report(ProgressInformation const& information);
+
+                /*!
+                 * Requests the computations of this context to stop, see storm::utility::resources::isTerminate.
+                 */
+                void cancel();
+                bool isCancelled() const;
+
+            private:
+                ProgressCallback const callback;
+                int64_t const reportDelay;
+                // The time (in nanoseconds of the steady clock) before which no report is due.
+                std::atomic<int64_t> nextReportTime;
+                std::atomic<bool> reportInProgress;
+                std::atomic<bool> cancelled;
+            };
+
+            /*!
+             * Makes the given context the one of the current thread for the lifetime of the scope. Threads started via
+             * storm::utility::parallel take over the context of the thread that starts them.
+             */
+            class ProgressContextScope {
+            public:
+                explicit ProgressContextScope(std::shared_ptr<ProgressContext> const& context);
+                ~ProgressContextScope();
+
+                ProgressContextScope(ProgressContextScope const&) = delete;
+                ProgressContextScope& operator=(ProgressContextScope const&) = delete;
+
+            private:
+                std::shared_ptr<ProgressContext> previousContext;
+            };
+
+            /*!
+             * Retrieves the context of the current thread, which is null outside of any ProgressContextScope.
+             */
+            std::shared_ptr<ProgressContext> const& getProgressContext();
+
+            /*!
+             * Retrieves whether the context of the current thread was cancelled.
+             */
+            bool isCancelled();
+
+            /*!
+             * Installs a callback that is informed about the progress of state space exploration and value iteration
+             * on threads without a context. The callback is called at most once per given delay and never
+             * concurrently. It replaces the previously installed callback, if there was one, but a report of the
+             * previous callback that is in progress may still finish afterwards.
+             *
+             * @param callback The callback.
+             * @param minimalDelayInMilliseconds The minimal time between two calls of the callback.
+             */
+            void setProgressCallback(ProgressCallback const& callback, uint64_t minimalDelayInMilliseconds = 100);
+
+            /*!
+             * Removes the installed callback.
+             */
+            void resetProgressCallback();
+
+            /*!
+             * Retrieves whether a callback is installed for the current thread and the delay since its last call
+             * passed. This is cheap, so it can be used to avoid computing progress information that would not be
+             * reported.
+             */
+            bool isProgressReportDue();
+
+            /*!
+             * Reports the number of explored states to the callback if a report is due.
+             */
+            void reportExploredStates(uint64_t numberOfExploredStates);
+
+            /*!
+             * Reports the iteration and residual of an iterative solver to the callback if a report is due.
+             */
+            void reportIteration(uint64_t iteration, double residual);
+
+        }
+    }
+}
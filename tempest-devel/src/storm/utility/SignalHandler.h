@@ -1,10 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <cstdlib>
 #include <cstdint>
 
 #include "storm-config.h"
 #include "storm/utility/OsDetection.h"
+#include "storm/utility/ProgressListener.h"
 
 namespace storm {
     namespace utility {
@@ -97,8 +99,8 @@ namespace storm {
                 virtual ~SignalInformation();
 
 
-                // Flag whether the program should terminate
-                bool terminate;
+                // Flag whether the program should terminate. It may be set from other threads than the one that checks it.
+                std::atomic<bool> terminate;
                 // Store last signal code
                 int lastSignal;
             };
@@ -110,12 +112,13 @@ namespace storm {
             }
 
             /*!
-             * Check whether the program should terminate (due to some abort signal).
+             * Check whether the program should terminate (due to some abort signal) or the computation on the current
+             * thread was cancelled (see storm::utility::progress::ProgressContext).
              *
              * @return True iff program should terminate.
              */
             inline bool isTerminate() {
-                return SignalInformation::infos().isTerminate();
+                return SignalInformation::infos().isTerminate() || storm::utility::progress::isCancelled();
             }
 
             /*!
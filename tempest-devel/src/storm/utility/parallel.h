@@ -0,0 +1,46 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "storm/utility/ProgressListener.h"
+
+namespace storm {
+    namespace utility {
+        namespace parallel {
+
+            /*!
+             * Splits the range [0, size) into consecutive blocks and calls function(begin, end) for each block on a
+             * separate thread. The threads take over the progress context of the calling thread.
+             *
+             * @param numberOfThreads The number of threads to use. If zero, as many hardware threads are used as there
+             * are blocks of at least the given minimal size.
+             */
+            template<typename Function>
+            void forEachBlock(uint64_t size, uint64_t numberOfThreads, uint64_t minimalBlockSize, Function const& function) {
+                if (numberOfThreads == 0) {
+                    numberOfThreads = std::max<uint64_t>(1, std::min<uint64_t>(std::thread::hardware_concurrency(), size / std::max<uint64_t>(1, minimalBlockSize)));
+                }
+                numberOfThreads = std::max<uint64_t>(1, std::min(numberOfThreads, size));
+                if (numberOfThreads == 1) {
+                    function(0, size);
+                    return;
+                }
+                std::vector<std::thread> threads;
+                std::shared_ptr<storm::utility::progress::ProgressContext> context = storm::utility::progress::getProgressContext();
+                uint64_t blockSize = (size + numberOfThreads - 1) / numberOfThreads;
+                for (uint64_t begin = 0; begin < size; begin += blockSize) {
+                    threads.emplace_back([&function, context] (uint64_t begin, uint64_t end) {
+                        storm::utility::progress::ProgressContextScope scope(context);
+                        function(begin, end);
+                    }, begin, std::min(begin + blockSize, size));
+                }
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,236 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+#include "storm-pars/api/storm-pars.h"
+#include "storm-pars/modelchecker/instantiation/SparseSmgInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/region/SparseSmgParameterLiftingModelChecker.h"
+#include "storm/api/storm.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/shields/PreShield.h"
+
+namespace {
+    class DoubleViEnvironment {
+    public:
+        typedef double ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    class RationalViEnvironment {
+    public:
+        typedef storm::RationalNumber ValueType;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+            return env;
+        }
+    };
+    template<typename TestType>
+    class SparseSmgParameterLiftingTest : public ::testing::Test {
+    public:
+        typedef typename TestType::ValueType ValueType;
+        typedef storm::modelchecker::SparseSmgParameterLiftingModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, ValueType> CheckerType;
+        SparseSmgParameterLiftingTest() : _environment(TestType::createEnvironment()) {}
+        storm::Environment const& env() const { return _environment; }
+        virtual void SetUp() { carl::VariablePool::getInstance().clear(); }
+        virtual void TearDown() { carl::VariablePool::getInstance().clear(); }
+
+    protected:
+        void buildModel(std::string const& formulaString, std::string const& programFile = STORM_TEST_RESOURCES_DIR "/psmg/slippery_corridor.nm") {
+            program = storm::api::parseProgram(programFile);
+            formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaString, program));
+            model = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->template as<storm::models::sparse::Smg<storm::RationalFunction>>();
+            modelParameters = storm::models::sparse::getProbabilityParameters(*model);
+        }
+
+        std::shared_ptr<CheckerType> createChecker() {
+            auto checker = std::make_shared<CheckerType>();
+            checker->specify(this->env(), model, storm::api::createTask<storm::RationalFunction>(formulas[0], true));
+            return checker;
+        }
+
+        storm::prism::Program program;
+        std::vector<std::shared_ptr<const storm::logic::Formula>> formulas;
+        std::shared_ptr<storm::models::sparse::Smg<storm::RationalFunction>> model;
+        std::set<storm::RationalFunctionVariable> modelParameters;
+
+    private:
+        storm::Environment _environment;
+    };
+
+    typedef ::testing::Types<
+            DoubleViEnvironment,
+            RationalViEnvironment
+    > TestingTypes;
+
+    TYPED_TEST_SUITE(SparseSmgParameterLiftingTest, TestingTypes,);
+
+    TYPED_TEST(SparseSmgParameterLiftingTest, slippery_corridor_Prob) {
+        this->buildModel("<<robot>> Pmax>=0.55 [ F \"goal\" ]");
+        auto regionChecker = storm::api::initializeParameterLiftingRegionModelChecker<storm::RationalFunction, typename TestFixture::ValueType>(this->env(), this->model, storm::api::createTask<storm::RationalFunction>(this->formulas[0], true));
+
+        auto allSatRegion = storm::api::parseRegion<storm::RationalFunction>("0.9<=p<=0.99", this->modelParameters);
+        auto exBothRegion = storm::api::parseRegion<storm::RationalFunction>("0.8<=p<=0.95", this->modelParameters);
+        auto allVioRegion = storm::api::parseRegion<storm::RationalFunction>("0.6<=p<=0.8", this->modelParameters);
+
+        EXPECT_EQ(storm::modelchecker::RegionResult::AllSat, regionChecker->analyzeRegion(this->env(), allSatRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown));
+        EXPECT_EQ(storm::modelchecker::RegionResult::Unknown, regionChecker->analyzeRegion(this->env(), exBothRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown));
+        EXPECT_EQ(storm::modelchecker::RegionResult::AllViolated, regionChecker->analyzeRegion(this->env(), allVioRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown));
+
+        // Nature either slips as often as possible or as rarely as possible.
+        EXPECT_NEAR(0.59049, storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), allSatRegion, storm::solver::OptimizationDirection::Minimize)), 1e-6);
+        EXPECT_NEAR(0.95099005, storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), allSatRegion, storm::solver::OptimizationDirection::Maximize)), 1e-6);
+        EXPECT_NEAR(0.5, storm::utility::convertNumber<double>(regionChecker->getBoundAtInitState(this->env(), allVioRegion, storm::solver::OptimizationDirection::Minimize)), 1e-6);
+    }
+
+    TYPED_TEST(SparseSmgParameterLiftingTest, slippery_corridor_Globally) {
+        this->buildModel("<<robot>> Pmax>=0.45 [ G !\"crash\" ]");
+        auto checker = this->createChecker();
+
+        auto allSatRegion = storm::api::parseRegion<storm::RationalFunction>("0.9<=p<=0.99", this->modelParameters);
+        auto allVioRegion = storm::api::parseRegion<storm::RationalFunction>("0.6<=p<=0.8", this->modelParameters);
+
+        // Avoiding a crash forever coincides with reaching the goal.
+        EXPECT_EQ(storm::modelchecker::RegionResult::AllSat, checker->analyzeRegion(this->env(), allSatRegion));
+        EXPECT_NEAR(0.59049, storm::utility::convertNumber<double>(checker->getBoundAtInitState(this->env(), allSatRegion, storm::solver::OptimizationDirection::Minimize)), 1e-6);
+        EXPECT_NEAR(0.5, storm::utility::convertNumber<double>(checker->getBoundAtInitState(this->env(), allVioRegion, storm::solver::OptimizationDirection::Maximize)), 1e-6);
+    }
+
+    TYPED_TEST(SparseSmgParameterLiftingTest, slippery_corridor_ParallelRefinement) {
+        this->buildModel("<<robot>> Pmax>=0.55 [ F \"goal\" ]");
+        auto checker = this->createChecker();
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.6<=p<=0.99", this->modelParameters);
+
+        auto sequentialResult = checker->performRegionRefinement(this->env(), region, boost::none, 6);
+        auto parallelResult = checker->performParallelRegionRefinement(this->env(), region, boost::none, 6, storm::modelchecker::RegionResultHypothesis::Unknown, 4);
+
+        auto const& sequentialRegions = sequentialResult->getRegionResults();
+        auto const& parallelRegions = parallelResult->getRegionResults();
+        ASSERT_EQ(sequentialRegions.size(), parallelRegions.size());
+        auto variable = *this->modelParameters.begin();
+        // The threshold p^5 = 0.55 is crossed at p ~ 0.8873.
+        for (uint64_t index = 0; index < parallelRegions.size(); ++index) {
+            EXPECT_EQ(sequentialRegions[index].first.toString(), parallelRegions[index].first.toString());
+            EXPECT_EQ(sequentialRegions[index].second, parallelRegions[index].second);
+            double lower = storm::utility::convertNumber<double>(parallelRegions[index].first.getLowerBoundary(variable));
+            double upper = storm::utility::convertNumber<double>(parallelRegions[index].first.getUpperBoundary(variable));
+            if (parallelRegions[index].second == storm::modelchecker::RegionResult::AllSat) {
+                EXPECT_GE(lower, 0.887);
+            } else if (parallelRegions[index].second == storm::modelchecker::RegionResult::AllViolated) {
+                EXPECT_LE(upper, 0.888);
+            } else {
+                EXPECT_LE(lower, 0.888);
+                EXPECT_GE(upper, 0.887);
+            }
+        }
+    }
+
+    TYPED_TEST(SparseSmgParameterLiftingTest, slippery_corridor_wind_ParallelRefinement) {
+        // With two parameters, each refinement step splits a region into four regions, which are analyzed by four workers.
+        this->buildModel("<<robot>> Pmax>=0.55 [ F \"goal\" ]", STORM_TEST_RESOURCES_DIR "/psmg/slippery_corridor_wind.nm");
+        auto checker = this->createChecker();
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.6<=p<=0.99,0.6<=q<=0.99", this->modelParameters);
+
+        auto sequentialResult = checker->performRegionRefinement(this->env(), region, boost::none, 4);
+        auto parallelResult = checker->performParallelRegionRefinement(this->env(), region, boost::none, 4, storm::modelchecker::RegionResultHypothesis::Unknown, 4);
+
+        auto const& sequentialRegions = sequentialResult->getRegionResults();
+        auto const& parallelRegions = parallelResult->getRegionResults();
+        ASSERT_EQ(sequentialRegions.size(), parallelRegions.size());
+        ASSERT_LT(4ull, parallelRegions.size());
+        auto value = [&] (storm::storage::ParameterRegion<storm::RationalFunction> const& region, bool lower) {
+            double pValue = storm::utility::convertNumber<double>(lower ? region.getLowerBoundary("p") : region.getUpperBoundary("p"));
+            double qValue = storm::utility::convertNumber<double>(lower ? region.getLowerBoundary("q") : region.getUpperBoundary("q"));
+            return std::max(std::pow(pValue, 3) * std::pow(qValue, 2), 0.5);
+        };
+        for (uint64_t index = 0; index < parallelRegions.size(); ++index) {
+            EXPECT_EQ(sequentialRegions[index].first.toString(), parallelRegions[index].first.toString());
+            EXPECT_EQ(sequentialRegions[index].second, parallelRegions[index].second);
+            // The value is monotone in both parameters, so it is bounded by the values at the lower and the upper corner.
+            if (parallelRegions[index].second == storm::modelchecker::RegionResult::AllSat) {
+                EXPECT_GE(value(parallelRegions[index].first, true), 0.55 - 1e-6);
+            } else if (parallelRegions[index].second == storm::modelchecker::RegionResult::AllViolated) {
+                EXPECT_LE(value(parallelRegions[index].first, false), 0.55 + 1e-6);
+            }
+        }
+    }
+
+    TYPED_TEST(SparseSmgParameterLiftingTest, slippery_corridor_Sampling) {
+        typedef typename TestFixture::ValueType ValueType;
+        this->buildModel("<<robot>> Pmax>=0.55 [ F \"goal\" ]");
+        uint64_t initialState = *this->model->getInitialStates().begin();
+        auto variable = *this->modelParameters.begin();
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+
+        // Successive samples reuse the game and the values of the previous sample.
+        auto quantitativeFormula = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("<<robot>> Pmax=? [ F \"goal\" ]", this->program)).front();
+        storm::modelchecker::SparseSmgInstantiationModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, ValueType> instantiationChecker(*this->model);
+        instantiationChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(quantitativeFormula, true));
+        instantiationChecker.setInstantiationsAreGraphPreserving(true);
+        for (double value : {0.5, 0.7, 0.9, 0.99, 0.8, 0.95}) {
+            valuation[variable] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(value);
+            auto result = instantiationChecker.check(this->env(), valuation);
+            EXPECT_NEAR(std::max(std::pow(value, 5), 0.5), storm::utility::convertNumber<double>(result->template asExplicitQuantitativeCheckResult<ValueType>()[initialState]), 1e-6);
+        }
+
+        storm::modelchecker::SparseSmgInstantiationModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, ValueType> boundedChecker(*this->model);
+        boundedChecker.specifyFormula(storm::api::createTask<storm::RationalFunction>(this->formulas[0], true));
+        boundedChecker.setInstantiationsAreGraphPreserving(true);
+        valuation[variable] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.9);
+        EXPECT_TRUE(boundedChecker.check(this->env(), valuation)->asExplicitQualitativeCheckResult()[initialState]);
+        valuation[variable] = storm::utility::convertNumber<storm::RationalFunctionCoefficient>(0.85);
+        EXPECT_FALSE(boundedChecker.check(this->env(), valuation)->asExplicitQualitativeCheckResult()[initialState]);
+
+        auto checker = this->createChecker();
+        auto exBothRegion = storm::api::parseRegion<storm::RationalFunction>("0.8<=p<=0.95", this->modelParameters);
+        EXPECT_EQ(storm::modelchecker::RegionResult::ExistsBoth, checker->analyzeRegion(this->env(), exBothRegion, storm::modelchecker::RegionResultHypothesis::Unknown, storm::modelchecker::RegionResult::Unknown, true));
+    }
+
+    TYPED_TEST(SparseSmgParameterLiftingTest, slippery_corridor_Shield) {
+        typedef typename TestFixture::ValueType ValueType;
+        this->buildModel("<<robot>> Pmax>=0.55 [ F \"goal\" ]");
+        auto checker = this->createChecker();
+        auto region = storm::api::parseRegion<storm::RationalFunction>("0.9<=p<=0.99", this->modelParameters);
+        uint64_t initialState = *this->model->getInitialStates().begin();
+        auto const& rowGroupIndices = this->model->getTransitionMatrix().getRowGroupIndices();
+        ASSERT_EQ(2ull, rowGroupIndices[initialState + 1] - rowGroupIndices[initialState]);
+
+        // The shield has to be safe for every slip probability in the region, i.e., nature plays against the robot.
+        std::vector<ValueType> choiceValues = checker->computeChoiceValues(this->env(), region, storm::solver::OptimizationDirection::Minimize);
+        std::vector<double> initialChoiceValues;
+        for (uint64_t row = rowGroupIndices[initialState]; row < rowGroupIndices[initialState + 1]; ++row) {
+            initialChoiceValues.push_back(storm::utility::convertNumber<double>(choiceValues[row]));
+        }
+        std::sort(initialChoiceValues.begin(), initialChoiceValues.end());
+        EXPECT_NEAR(0.5, initialChoiceValues[0], 1e-6);
+        EXPECT_NEAR(0.59049, initialChoiceValues[1], 1e-6);
+
+        auto shieldExpression = std::make_shared<storm::logic::ShieldExpression const>(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Absolute, 0.55);
+        auto shield = checker->computeShield(this->env(), region, shieldExpression);
+        auto preShield = dynamic_cast<tempest::shields::PreShield<ValueType, typename TestFixture::CheckerType::IndexType>*>(shield.get());
+        ASSERT_NE(nullptr, preShield);
+        auto scheduler = preShield->construct();
+        auto const& allowedChoices = scheduler.getChoice(initialState).getChoiceMap();
+        ASSERT_EQ(1ull, allowedChoices.size());
+        EXPECT_NEAR(0.59049, storm::utility::convertNumber<double>(std::get<0>(allowedChoices.front())), 1e-6);
+        // States of the wind are not shielded.
+        for (uint64_t state = 0; state < this->model->getNumberOfStates(); ++state) {
+            if (!checker->getStatesOfCoalition().get(state)) {
+                EXPECT_TRUE(scheduler.getChoice(state).isEmpty());
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,111 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <random>
+#include <sstream>
+
+#include "storm/api/storm.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-pomdp/analysis/BeliefSupportShield.h"
+#include "storm-pomdp/analysis/WinningRegionQueryInterface.h"
+#include "storm-pomdp/generator/BeliefSupportTracker.h"
+#include "storm-pomdp/generator/BitBeliefSupportTracker.h"
+#include "storm-pomdp/transformer/MakePOMDPCanonic.h"
+
+namespace {
+    class BeliefSupportShieldTest : public ::testing::Test {
+    protected:
+        void buildModel(std::string const& path, std::string const& constants, std::string const& formulaString) {
+            storm::prism::Program program = storm::parser::PrismParser::parse(path);
+            program = storm::utility::prism::preprocess(program, constants);
+            formula = storm::api::parsePropertiesForPrismProgram(formulaString, program).front().getRawFormula();
+            pomdp = storm::api::buildSparseModel<double>(program, {formula})->as<storm::models::sparse::Pomdp<double>>();
+            storm::transformer::MakePOMDPCanonic<double> makeCanonic(*pomdp);
+            pomdp = makeCanonic.transform();
+        }
+
+        storm::pomdp::BeliefSupportShield<double> synthesize() {
+            return storm::pomdp::synthesizeBeliefSupportShield(*pomdp, *formula, std::make_shared<storm::utility::solver::Z3SmtSolverFactory>());
+        }
+
+        std::shared_ptr<storm::logic::Formula const> formula;
+        std::shared_ptr<storm::models::sparse::Pomdp<double>> pomdp;
+    };
+
+    TEST_F(BeliefSupportShieldTest, AllowedActionsStayWinning) {
+        buildModel(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [!\"bad\" U \"goal\" ]");
+        auto shield = synthesize();
+        ASSERT_FALSE(shield.getWinningRegion().empty());
+
+        storm::pomdp::WinningRegionQueryInterface<double> queryInterface(*pomdp, shield.getWinningRegion());
+        auto const& transitions = *shield.getTransitions();
+        uint64_t numberOfEntries = 0;
+        for (uint64_t observation = 0; observation < pomdp->getNrObservations(); ++observation) {
+            for (auto const& support : shield.getWinningRegion().getWinningSetsPerObservation(observation)) {
+                ++numberOfEntries;
+                EXPECT_TRUE(shield.isWinning(observation, support));
+                storm::storage::BitVector states = transitions.toStates(observation, support);
+                EXPECT_EQ(support, transitions.toSupport(observation, states));
+                storm::storage::BitVector allowedActions = shield.getAllowedActions(observation, support);
+                EXPECT_FALSE(allowedActions.empty());
+                for (uint64_t action = 0; action < allowedActions.size(); ++action) {
+                    EXPECT_EQ(queryInterface.staysInWinningRegion(states, action), allowedActions.get(action));
+                }
+            }
+        }
+
+        std::stringstream stream;
+        shield.printJsonToStream(stream, pomdp.get());
+        auto json = storm::json<storm::RationalNumber>::parse(stream.str());
+        EXPECT_EQ(numberOfEntries, json.size());
+    }
+
+    TEST_F(BeliefSupportShieldTest, ShieldedRun) {
+        buildModel(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [!\"bad\" U \"goal\" ]");
+        auto shield = synthesize();
+        storm::generator::BitBeliefSupportTracker<double> tracker(shield.getTransitions());
+
+        // Start runs in every maximal winning support and follow random allowed actions.
+        std::mt19937 generator(42);
+        auto const& matrix = pomdp->getTransitionMatrix();
+        for (uint64_t observation = 0; observation < pomdp->getNrObservations(); ++observation) {
+            for (auto const& support : shield.getWinningRegion().getWinningSetsPerObservation(observation)) {
+                tracker.reset(observation, support);
+                uint64_t state = *tracker.getCurrentBeliefSupport().begin();
+                for (uint64_t step = 0; step < 20; ++step) {
+                    storm::storage::BitVector allowedActions = shield.getAllowedActions(tracker.getCurrentObservation(), tracker.getCurrentSupport());
+                    ASSERT_FALSE(allowedActions.empty());
+                    std::vector<uint64_t> actions(allowedActions.begin(), allowedActions.end());
+                    uint64_t action = actions[generator() % actions.size()];
+                    auto row = matrix.getRow(state, action);
+                    state = (row.begin() + generator() % row.getNumberOfEntries())->getColumn();
+                    ASSERT_TRUE(tracker.track(action, pomdp->getObservation(state)));
+                    EXPECT_TRUE(tracker.getCurrentBeliefSupport().get(state));
+                    EXPECT_TRUE(shield.isWinning(tracker.getCurrentObservation(), tracker.getCurrentSupport()));
+                    EXPECT_FALSE(pomdp->getStateLabeling().getStateHasLabel("bad", state));
+                }
+            }
+        }
+    }
+
+    TEST_F(BeliefSupportShieldTest, TrackerMatchesBeliefSupportTracker) {
+        buildModel(STORM_TEST_RESOURCES_DIR "/pomdp/maze2.prism", "sl=0.4", "Pmax=? [F \"goal\" ]");
+        storm::generator::BeliefSupportTracker<double> reference(*pomdp);
+        storm::generator::BitBeliefSupportTracker<double> tracker(*pomdp);
+        EXPECT_EQ(reference.getCurrentBeliefSupport(), tracker.getCurrentBeliefSupport());
+        std::vector<std::pair<uint64_t, uint64_t>> trace = {{0, 0}, {0, 0}, {1, 0}, {2, 1}, {3, 0}, {3, 0}};
+        for (auto const& actionObservation : trace) {
+            reference.track(actionObservation.first, actionObservation.second);
+            EXPECT_TRUE(tracker.track(actionObservation.first, actionObservation.second));
+            EXPECT_EQ(reference.getCurrentBeliefSupport(), tracker.getCurrentBeliefSupport());
+        }
+        EXPECT_EQ(2ul, tracker.getCurrentSupport().getNumberOfSetBits());
+
+        tracker.reset();
+        EXPECT_EQ(pomdp->getInitialStates(), tracker.getCurrentBeliefSupport());
+        tracker.track(0, 0);
+        EXPECT_FALSE(tracker.track(0, 1));
+        EXPECT_FALSE(tracker.isValid());
+    }
+}
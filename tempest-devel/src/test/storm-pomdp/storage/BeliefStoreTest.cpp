@@ -0,0 +1,67 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <boost/container/flat_map.hpp>
+
+#include "storm-pomdp/storage/BeliefStore.h"
+
+namespace {
+    typedef boost::container::flat_map<uint64_t, double> BeliefType;
+    typedef storm::storage::BeliefStore<uint64_t, double> BeliefStoreType;
+
+    TEST(BeliefStoreTest, Deduplication) {
+        BeliefStoreType store;
+        BeliefType first = {{0, 0.5}, {3, 0.5}};
+        BeliefType second = {{0, 0.25}, {3, 0.75}};
+
+        EXPECT_EQ(BeliefStoreType::noId(), store.find(first));
+        auto firstRes = store.findOrAdd(first);
+        EXPECT_TRUE(firstRes.second);
+        auto secondRes = store.findOrAdd(second);
+        EXPECT_TRUE(secondRes.second);
+        EXPECT_NE(firstRes.first, secondRes.first);
+
+        auto againRes = store.findOrAdd(BeliefType({{0, 0.5}, {3, 0.5}}));
+        EXPECT_FALSE(againRes.second);
+        EXPECT_EQ(firstRes.first, againRes.first);
+        EXPECT_EQ(secondRes.first, store.find(second));
+        EXPECT_EQ(2ul, store.size());
+        EXPECT_EQ(4ul, store.getNumberOfEntries());
+
+        auto view = store.getBelief(secondRes.first);
+        ASSERT_EQ(2ul, view.size());
+        EXPECT_EQ(0ul, view.begin()->first);
+        EXPECT_EQ(0.25, view.begin()->second);
+        EXPECT_EQ(3ul, (view.begin() + 1)->first);
+        EXPECT_EQ(0.75, (view.begin() + 1)->second);
+    }
+
+    TEST(BeliefStoreTest, ManyBeliefs) {
+        BeliefStoreType store;
+        uint64_t const numberOfBeliefs = 10000;
+        for (uint64_t i = 0; i < numberOfBeliefs; ++i) {
+            BeliefType belief;
+            if (i % 2 == 0) {
+                belief[i] = 1.0;
+            } else {
+                belief[i - 1] = 0.5;
+                belief[i] = 0.5;
+            }
+            auto res = store.findOrAdd(belief);
+            EXPECT_TRUE(res.second);
+            EXPECT_EQ(i, res.first);
+        }
+        EXPECT_EQ(numberOfBeliefs, store.size());
+        // All beliefs remain retrievable after the table grew.
+        for (uint64_t i = 0; i < numberOfBeliefs; ++i) {
+            auto view = store.getBelief(i);
+            BeliefType belief(boost::container::ordered_unique_range, view.begin(), view.end());
+            EXPECT_EQ(i, store.find(belief));
+        }
+        EXPECT_EQ(BeliefStoreType::noId(), store.find(BeliefType({{1, 1.0}})));
+
+        store.clear();
+        EXPECT_EQ(0ul, store.size());
+        EXPECT_EQ(BeliefStoreType::noId(), store.find(BeliefType({{0, 1.0}})));
+    }
+}
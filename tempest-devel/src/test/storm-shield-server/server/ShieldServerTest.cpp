@@ -0,0 +1,235 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <memory>
+#include <sstream>
+#include <thread>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "storm/shields/ShieldTable.h"
+#include "storm-shield-server/server/ShieldServer.h"
+
+namespace {
+    typedef tempest::shields::server::ShieldServer ShieldServer;
+
+    // A shield in the format of PreShield::printJsonToStream.
+    std::string const exportedShield = R"([
+        {"s": {"x": 1, "done": false}, "c": [{"labels": ["left"], "index": 2, "prob": 0.9}, {"labels": ["right"], "index": 3, "prob": 0.95}]},
+        {"s": {"x": 0, "done": false}, "c": [{"labels": ["right"], "index": 0, "prob": 1.0}]},
+        {"s": {"x": 2, "done": true}, "c": "undefined"},
+        {"s": {"x": -1, "done": true}, "c": [{"labels": ["done"], "index": 5, "prob": 1.0}]}
+    ])";
+
+    template<typename T>
+    void append(std::vector<char>& request, T const& value) {
+        char const* bytes = reinterpret_cast<char const*>(&value);
+        request.insert(request.end(), bytes, bytes + sizeof(T));
+    }
+
+    std::vector<char> createQuery(std::vector<int64_t> const& states) {
+        std::vector<char> request;
+        append(request, static_cast<uint32_t>(ShieldServer::RequestType::Query));
+        append(request, static_cast<uint32_t>(states.size() / 2));
+        for (auto value : states) {
+            append(request, value);
+        }
+        return request;
+    }
+
+    class ShieldServerTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            std::stringstream stream(exportedShield);
+            encoding = tempest::shields::encodeShieldTable(stream);
+            view = std::make_unique<tempest::shields::ShieldTableView>(encoding.data(), encoding.size());
+            server = std::make_unique<ShieldServer>(*view, "/tempest-shield-test");
+            socketPath = "/tmp/tempest-shield-server-test-" + std::to_string(getpid()) + ".sock";
+            unlink(socketPath.c_str());
+            server->listen(socketPath);
+            terminate = false;
+            serverThread = std::thread([this] () { server->run([this] () { return terminate.load(); }); });
+        }
+
+        void TearDown() override {
+            for (auto fileDescriptor : clients) {
+                close(fileDescriptor);
+            }
+            terminate = true;
+            serverThread.join();
+        }
+
+        int connectClient() {
+            int fileDescriptor = socket(AF_UNIX, SOCK_STREAM, 0);
+            EXPECT_LE(0, fileDescriptor);
+            sockaddr_un address = {};
+            address.sun_family = AF_UNIX;
+            std::strncpy(address.sun_path, socketPath.c_str(), sizeof(address.sun_path) - 1);
+            EXPECT_EQ(0, connect(fileDescriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)));
+            // A server that does not answer lets the test fail instead of hanging.
+            timeval timeout = {10, 0};
+            setsockopt(fileDescriptor, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+            clients.push_back(fileDescriptor);
+            return fileDescriptor;
+        }
+
+        void sendAll(int fileDescriptor, std::vector<char> const& request) {
+            uint64_t written = 0;
+            while (written < request.size()) {
+                ssize_t bytes = send(fileDescriptor, request.data() + written, request.size() - written, MSG_NOSIGNAL);
+                ASSERT_LT(0, bytes);
+                written += bytes;
+            }
+        }
+
+        // Returns false if the server closed the connection or did not answer in time.
+        bool receive(int fileDescriptor, void* data, uint64_t size) {
+            uint64_t read = 0;
+            while (read < size) {
+                ssize_t bytes = recv(fileDescriptor, static_cast<char*>(data) + read, size - read, 0);
+                if (bytes <= 0) {
+                    return false;
+                }
+                read += bytes;
+            }
+            return true;
+        }
+
+        template<typename T>
+        T receiveValue(int fileDescriptor) {
+            T value = T();
+            EXPECT_TRUE(receive(fileDescriptor, &value, sizeof(T)));
+            return value;
+        }
+
+        std::string receiveString(int fileDescriptor) {
+            std::string value(receiveValue<uint32_t>(fileDescriptor), '\0');
+            EXPECT_TRUE(receive(fileDescriptor, &value[0], value.size()));
+            return value;
+        }
+
+        std::vector<uint64_t> query(int fileDescriptor, std::vector<int64_t> const& states) {
+            sendAll(fileDescriptor, createQuery(states));
+            return receiveMasks(fileDescriptor);
+        }
+
+        std::vector<uint64_t> receiveMasks(int fileDescriptor) {
+            EXPECT_EQ(static_cast<uint32_t>(ShieldServer::Status::Ok), receiveValue<uint32_t>(fileDescriptor));
+            std::vector<uint64_t> masks(receiveValue<uint32_t>(fileDescriptor));
+            EXPECT_TRUE(receive(fileDescriptor, masks.data(), masks.size() * sizeof(uint64_t)));
+            return masks;
+        }
+
+        std::vector<char> encoding;
+        std::unique_ptr<tempest::shields::ShieldTableView> view;
+        std::unique_ptr<ShieldServer> server;
+        std::string socketPath;
+        std::atomic<bool> terminate;
+        std::thread serverThread;
+        std::vector<int> clients;
+    };
+
+    TEST_F(ShieldServerTest, Protocol) {
+        int client = connectClient();
+        std::vector<char> request;
+        append(request, static_cast<uint32_t>(ShieldServer::RequestType::Describe));
+        sendAll(client, request);
+        EXPECT_EQ(static_cast<uint32_t>(ShieldServer::Status::Ok), receiveValue<uint32_t>(client));
+        EXPECT_EQ("/tempest-shield-test", receiveString(client));
+        ASSERT_EQ(2ul, receiveValue<uint32_t>(client));
+        EXPECT_EQ("done", receiveString(client));
+        EXPECT_EQ("x", receiveString(client));
+        ASSERT_EQ(3ul, receiveValue<uint32_t>(client));
+        EXPECT_EQ("done", receiveString(client));
+        EXPECT_EQ("left", receiveString(client));
+        EXPECT_EQ("right", receiveString(client));
+
+        // States without allowed actions are answered with an empty mask, states which are not in the shield are unknown.
+        EXPECT_EQ(std::vector<uint64_t>({6, 0, 1, tempest::shields::ShieldTableView::UNKNOWN_STATE}), query(client, {0, 1, 1, 2, 1, -1, 0, 5}));
+        EXPECT_EQ(std::vector<uint64_t>(), query(client, {}));
+
+        request.clear();
+        append(request, static_cast<uint32_t>(ShieldServer::RequestType::Statistics));
+        sendAll(client, request);
+        EXPECT_EQ(static_cast<uint32_t>(ShieldServer::Status::Ok), receiveValue<uint32_t>(client));
+        EXPECT_FALSE(receiveString(client).empty());
+
+        // Several requests in a single message are answered in order.
+        std::vector<char> first = createQuery({0, 0});
+        std::vector<char> second = createQuery({1, -1});
+        first.insert(first.end(), second.begin(), second.end());
+        sendAll(client, first);
+        EXPECT_EQ(std::vector<uint64_t>({4}), receiveMasks(client));
+        EXPECT_EQ(std::vector<uint64_t>({1}), receiveMasks(client));
+    }
+
+    TEST_F(ShieldServerTest, InvalidRequests) {
+        int client = connectClient();
+        std::vector<char> request;
+        append(request, static_cast<uint32_t>(7));
+        sendAll(client, request);
+        EXPECT_EQ(static_cast<uint32_t>(ShieldServer::Status::Error), receiveValue<uint32_t>(client));
+        EXPECT_FALSE(receiveString(client).empty());
+        // The connection is closed after the error was sent.
+        char byte;
+        EXPECT_EQ(0, recv(client, &byte, 1, 0));
+
+        client = connectClient();
+        request.clear();
+        append(request, static_cast<uint32_t>(ShieldServer::RequestType::Query));
+        append(request, static_cast<uint32_t>(1u << 30));
+        sendAll(client, request);
+        EXPECT_EQ(static_cast<uint32_t>(ShieldServer::Status::Error), receiveValue<uint32_t>(client));
+        EXPECT_FALSE(receiveString(client).empty());
+        EXPECT_EQ(0, recv(client, &byte, 1, 0));
+
+        // Other clients are still served.
+        EXPECT_EQ(std::vector<uint64_t>({6}), query(connectClient(), {0, 1}));
+    }
+
+    TEST_F(ShieldServerTest, SlowClient) {
+        // This client sends queries as long as the server accepts them, but never reads the answers.
+        int slowClient = connectClient();
+        std::vector<int64_t> states;
+        for (uint64_t index = 0; index < 8192; ++index) {
+            states.push_back(0);
+            states.push_back(1);
+        }
+        std::vector<char> request = createQuery(states);
+        uint64_t numberOfSentBytes = 0;
+        for (uint64_t written = 0; numberOfSentBytes < (1ull << 28); ) {
+            ssize_t bytes = send(slowClient, request.data() + written, request.size() - written, MSG_NOSIGNAL | MSG_DONTWAIT);
+            if (bytes < 0) {
+                ASSERT_TRUE(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+                // Only stop once the server did not read anything for a while.
+                pollfd fileDescriptor = {slowClient, POLLOUT, 0};
+                if (errno != EINTR && poll(&fileDescriptor, 1, 500) == 0) {
+                    break;
+                }
+                continue;
+            }
+            numberOfSentBytes += bytes;
+            written = (written + bytes) % request.size();
+        }
+        // The server stops reading from the slow client once too many answers are pending.
+        EXPECT_LT(numberOfSentBytes, 1ull << 28);
+
+        // Meanwhile, other clients are served without delay.
+        int client = connectClient();
+        EXPECT_EQ(std::vector<uint64_t>({6, 0}), query(client, {0, 1, 1, 2}));
+
+        // The pending answers are delivered once the slow client reads them.
+        EXPECT_EQ(static_cast<uint32_t>(ShieldServer::Status::Ok), receiveValue<uint32_t>(slowClient));
+        EXPECT_EQ(8192ul, receiveValue<uint32_t>(slowClient));
+        std::vector<uint64_t> masks(8192);
+        EXPECT_TRUE(receive(slowClient, masks.data(), masks.size() * sizeof(uint64_t)));
+        EXPECT_EQ(std::vector<uint64_t>(8192, 6), masks);
+    }
+}
@@ -0,0 +1,41 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/models/sparse/ChoiceLabeling.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+TEST(ChoiceLabelingTest, LabelIds) {
+    storm::models::sparse::ChoiceLabeling labeling(6);
+    labeling.addLabel("north", storm::storage::BitVector(6, {0, 3}));
+    labeling.addLabel("east", storm::storage::BitVector(6, {1, 4}));
+    labeling.addLabel("pickup", storm::storage::BitVector(6, std::vector<uint_fast64_t>({5})));
+    EXPECT_FALSE(labeling.hasLabelIds());
+    ASSERT_TRUE(labeling.computeLabelIds());
+
+    // The ids are assigned in the order of the label names.
+    EXPECT_EQ(std::vector<std::string>({"east", "north", "pickup"}), labeling.getLabelsById());
+    EXPECT_EQ(1ul, labeling.getLabelIdOfChoice(0));
+    EXPECT_EQ(storm::models::sparse::ChoiceLabeling::NO_LABEL, labeling.getLabelIdOfChoice(2));
+    EXPECT_EQ(std::set<std::string>({"pickup"}), labeling.getLabelsOfChoice(5));
+    EXPECT_TRUE(labeling.getLabelsOfChoice(2).empty());
+
+    uint64_t choices[] = {5, 4, 3, 2};
+    uint64_t labelIds[4];
+    labeling.getLabelIdsOfChoices(choices, 4, labelIds);
+    EXPECT_EQ(std::vector<uint64_t>({2, 0, 1, storm::models::sparse::ChoiceLabeling::NO_LABEL}), std::vector<uint64_t>(labelIds, labelIds + 4));
+
+    auto subLabeling = labeling.getSubLabeling(storm::storage::BitVector(6, {2, 3, 5}));
+    ASSERT_TRUE(subLabeling.hasLabelIds());
+    EXPECT_EQ(std::set<std::string>({"north"}), subLabeling.getLabelsOfChoice(1));
+
+    // Modifying the labeling discards the ids.
+    labeling.addLabelToChoice("east", 2);
+    EXPECT_FALSE(labeling.hasLabelIds());
+    EXPECT_EQ(std::set<std::string>({"east"}), labeling.getLabelsOfChoice(2));
+    STORM_SILENT_EXPECT_THROW(labeling.getLabelIdsOfChoices(choices, 4, labelIds), storm::exceptions::InvalidOperationException);
+
+    // Choices with several labels have no single label id.
+    labeling.addLabelToChoice("north", 2);
+    EXPECT_FALSE(labeling.computeLabelIds());
+    EXPECT_EQ(std::set<std::string>({"east", "north"}), labeling.getLabelsOfChoice(2));
+}
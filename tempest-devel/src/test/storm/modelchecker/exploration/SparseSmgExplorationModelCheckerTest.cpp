@@ -0,0 +1,72 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/exploration/SparseSmgExplorationModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm-parsers/parser/PrismParser.h"
+#include "storm-parsers/parser/FormulaParser.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/ExplorationSettings.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(SparseSmgExplorationModelCheckerTest, Walker) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+
+    // A parser that we use for conveniently constructing the formulas.
+    storm::parser::FormulaParser formulaParser(program);
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+
+    storm::modelchecker::SparseSmgExplorationModelChecker<storm::models::sparse::Smg<double>, uint32_t> checker(program);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [F \"s3\"]");
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult1 = result->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(0.34545435, quantitativeResult1[0], precision);
+    EXPECT_LE(checker.getPrecision(), precision);
+    EXPECT_TRUE(checker.hasConverged());
+
+    formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmin=? [F \"s3\"]");
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult2 = result->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(0, quantitativeResult2[0], precision);
+    EXPECT_TRUE(checker.hasConverged());
+
+    formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [ a=0 U a=1 ]");
+    result = checker.check(storm::modelchecker::CheckTask<>(*formula, true));
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult3 = result->asExplicitQuantitativeCheckResult<double>();
+    EXPECT_NEAR(0.52, quantitativeResult3[0], precision);
+    EXPECT_TRUE(checker.hasConverged());
+    EXPECT_LE(checker.getNumberOfExploredStates(), checker.getNumberOfDiscoveredStates());
+}
+
+TEST(SparseSmgExplorationModelCheckerTest, WalkerBudget) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+    storm::parser::FormulaParser formulaParser(program);
+    double precision = storm::settings::getModule<storm::settings::modules::ExplorationSettings>().getPrecision();
+
+    storm::modelchecker::SparseSmgExplorationModelChecker<storm::models::sparse::Smg<double>, uint32_t> checker(program);
+    checker.setExplorationBudget(2);
+
+    std::shared_ptr<storm::logic::Formula const> formula = formulaParser.parseSingleFormulaFromString("<<walker>> Pmax=? [F \"s3\"]");
+    storm::modelchecker::CheckTask<> task(*formula, true);
+    task.setShieldingExpression(std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.9));
+    std::unique_ptr<storm::modelchecker::CheckResult> result = checker.check(task);
+    storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& quantitativeResult = result->asExplicitQuantitativeCheckResult<double>();
+
+    // The value is only known up to the reported precision.
+    EXPECT_EQ(2ul, checker.getNumberOfExploredStates());
+    EXPECT_LT(checker.getNumberOfExploredStates(), checker.getNumberOfDiscoveredStates());
+    EXPECT_LE(quantitativeResult[0], 0.34545435 + precision);
+    EXPECT_GE(quantitativeResult[0] + checker.getPrecision(), 0.34545435 - precision);
+    EXPECT_GT(checker.getPrecision(), precision);
+    EXPECT_FALSE(checker.hasConverged());
+
+    // The shield only covers the explored fragment.
+    auto const& exploredModel = checker.getExploredModel();
+    EXPECT_EQ(checker.getNumberOfDiscoveredStates(), exploredModel->getNumberOfStates());
+    EXPECT_FALSE(exploredModel->getStates("unexplored").empty());
+    EXPECT_TRUE(result->hasShield());
+}
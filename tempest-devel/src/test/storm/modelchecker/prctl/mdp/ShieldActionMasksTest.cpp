@@ -0,0 +1,93 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/shields/ShieldActionMasks.h"
+#include "storm/storage/PreScheduler.h"
+#include "storm/utility/prism.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Mdp<double>> buildWalk() {
+        storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/one_dim_walk.nm");
+        program = storm::utility::prism::preprocess(program, "N=4");
+        storm::builder::BuilderOptions options;
+        options.setBuildStateValuations();
+        options.setBuildChoiceLabels();
+        return storm::api::buildSparseModel<double>(program, options)->as<storm::models::sparse::Mdp<double>>();
+    }
+
+    TEST(ShieldActionMasksTest, Walk) {
+        auto mdp = buildWalk();
+        ASSERT_EQ(5ul, mdp->getNumberOfStates());
+
+        // A shield without any choice allows nothing.
+        tempest::shields::ShieldActionMasks<double> empty(storm::storage::PreScheduler<double>(5), *mdp, true);
+        ASSERT_TRUE(empty.hasValuationLookup());
+        EXPECT_EQ(std::vector<std::string>({"x"}), empty.getVariableNames());
+        EXPECT_TRUE(empty.getAllowedChoices().empty());
+        int64_t middle = 2;
+        uint64_t middleState = empty.getStateOfValuation(&middle);
+        ASSERT_NE(tempest::shields::ShieldActionMasks<double>::UNKNOWN_STATE, middleState);
+
+        // Only allow moving right in state x=2. The other states have no choice and allow nothing, just like unknown valuations.
+        storm::storage::PreScheduler<double> shield(5);
+        storm::storage::PreSchedulerChoice<double> choice;
+        auto const& rowGroupIndices = mdp->getTransitionMatrix().getRowGroupIndices();
+        for (uint64_t localChoice = 0; localChoice < rowGroupIndices[middleState + 1] - rowGroupIndices[middleState]; ++localChoice) {
+            if (mdp->getChoiceLabeling().getChoiceHasLabel("right", rowGroupIndices[middleState] + localChoice)) {
+                choice.addChoice(localChoice, 1.0);
+            }
+        }
+        shield.setChoice(choice, middleState, 0);
+
+        tempest::shields::ShieldActionMasks<double> masks(shield, *mdp, true);
+        EXPECT_EQ(std::vector<std::string>({"left", "right"}), masks.getActionNames());
+        int64_t valuations[] = {0, 1, 2, 4, 5};
+        bool result[10];
+        masks.getMasksOfValuations(valuations, 5, result);
+        EXPECT_EQ(std::vector<bool>({false, false, false, false, false, true, false, false, false, false}), std::vector<bool>(result, result + 10));
+        EXPECT_EQ(1ul, masks.getAllowedChoices().getNumberOfSetBits());
+
+        // Local choice indices.
+        tempest::shields::ShieldActionMasks<double> localMasks(shield, *mdp);
+        EXPECT_EQ(2ul, localMasks.getNumberOfActions());
+        uint64_t numberOfAllowedChoices = 0;
+        for (uint64_t action = 0; action < 2; ++action) {
+            numberOfAllowedChoices += localMasks.isAllowed(middleState, action) ? 1 : 0;
+        }
+        EXPECT_EQ(1ul, numberOfAllowedChoices);
+    }
+
+    TEST(ShieldActionMasksTest, ParallelBatch) {
+        auto mdp = buildWalk();
+        // Allow the first choice of every state.
+        storm::storage::PreScheduler<double> shield(5);
+        for (uint64_t state = 0; state < 5; ++state) {
+            storm::storage::PreSchedulerChoice<double> choice;
+            choice.addChoice(0, 1.0);
+            shield.setChoice(choice, state, 0);
+        }
+        tempest::shields::ShieldActionMasks<double> masks(shield, *mdp, true);
+
+        std::vector<uint64_t> states(100000);
+        for (uint64_t index = 0; index < states.size(); ++index) {
+            states[index] = index % 5;
+        }
+        std::unique_ptr<bool[]> sequential(new bool[2 * states.size()]);
+        std::unique_ptr<bool[]> parallel(new bool[2 * states.size()]);
+        masks.getMasks(states.data(), states.size(), sequential.get(), 1);
+        masks.getMasks(states.data(), states.size(), parallel.get(), 4);
+        EXPECT_TRUE(std::equal(sequential.get(), sequential.get() + 2 * states.size(), parallel.get()));
+        for (uint64_t index = 0; index < 5; ++index) {
+            EXPECT_EQ(masks.isAllowed(index, 0), sequential[2 * index]);
+            EXPECT_EQ(masks.isAllowed(index, 1), sequential[2 * index + 1]);
+        }
+
+        uint64_t missingState = 5;
+        STORM_SILENT_EXPECT_THROW(masks.getMasks(&missingState, 1, sequential.get()), storm::exceptions::InvalidArgumentException);
+    }
+}
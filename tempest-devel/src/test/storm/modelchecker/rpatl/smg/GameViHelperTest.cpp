@@ -0,0 +1,182 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/modelchecker/rpatl/helper/internal/GameViHelper.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/MultiplierEnvironment.h"
+#include "storm/environment/solver/GameSolverEnvironment.h"
+#include "storm/storage/SparseMatrix.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    // Counts the memory allocated through the global operator new while started.
+    std::atomic<bool> countAllocations(false);
+    std::atomic<uint64_t> numberOfAllocations(0);
+    std::atomic<uint64_t> numberOfAllocatedBytes(0);
+
+    class AllocationCounter {
+    public:
+        AllocationCounter() {
+            numberOfAllocations = 0;
+            numberOfAllocatedBytes = 0;
+        }
+        void start() { countAllocations = true; }
+        void stop() { countAllocations = false; }
+        uint64_t getNumberOfAllocations() const { return numberOfAllocations; }
+        uint64_t getNumberOfBytes() const { return numberOfAllocatedBytes; }
+    };
+
+    // Builds a game on a line of states in which the players alternate. Each state can either move towards the target
+    // at the end of the line or back to the start. The transitions into the target are collected in b.
+    storm::storage::SparseMatrix<double> buildLineGame(uint64_t numberOfStates, std::vector<double>& b, storm::storage::BitVector& statesOfCoalition) {
+        storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true);
+        b.clear();
+        statesOfCoalition = storm::storage::BitVector(numberOfStates, false);
+        uint64_t row = 0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            statesOfCoalition.set(state, state % 2 == 0);
+            builder.newRowGroup(row);
+            if (state + 1 < numberOfStates) {
+                builder.addNextValue(row, state, 0.5);
+                builder.addNextValue(row++, state + 1, 0.5);
+                b.push_back(0.0);
+            } else {
+                builder.addNextValue(row++, state, 0.5);
+                b.push_back(0.5);
+            }
+            builder.addNextValue(row, 0, 0.1);
+            builder.addNextValue(row++, state, 0.9);
+            b.push_back(0.0);
+        }
+        return builder.build();
+    }
+}
+
+// Replacing the global allocation functions affects the whole test binary, but they only count while an AllocationCounter is started.
+void* operator new(std::size_t size) {
+    if (countAllocations.load(std::memory_order_relaxed)) {
+        ++numberOfAllocations;
+        numberOfAllocatedBytes += size;
+    }
+    if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    std::free(pointer);
+}
+
+TEST(GameViHelperTest, AllocationsPerSolve) {
+    uint64_t const numberOfStates = 1000;
+    uint64_t const numberOfSolves = 20;
+    std::vector<double> b;
+    storm::storage::BitVector statesOfCoalition;
+    storm::storage::SparseMatrix<double> matrix = buildLineGame(numberOfStates, b, statesOfCoalition);
+
+    storm::Environment env;
+    env.solver().multiplier().setType(storm::solver::MultiplierType::Native);
+    storm::modelchecker::helper::internal::GameViHelper<double> viHelper(matrix, statesOfCoalition);
+
+    // The first solve sets up the multiplier and the buffers of the helper.
+    std::vector<double> referenceResult(numberOfStates, 0.0);
+    std::vector<double> choiceValues;
+    viHelper.performValueIteration(env, referenceResult, b, storm::solver::OptimizationDirection::Maximize, choiceValues);
+    EXPECT_GT(viHelper.getNumberOfPerformedIterations(), 1ull);
+
+    std::vector<double> x;
+    x.reserve(numberOfStates);
+    AllocationCounter counter;
+    for (uint64_t solve = 0; solve < numberOfSolves; ++solve) {
+        x.assign(numberOfStates, 0.0);
+        counter.start();
+        viHelper.performValueIteration(env, x, b, storm::solver::OptimizationDirection::Maximize, choiceValues);
+        counter.stop();
+        ASSERT_EQ(referenceResult, x);
+    }
+    // Once set up, the helper and its multiplier reuse their buffers, so repeated solves of the same size do not allocate
+    // anything of the size of the game. This also covers copies of b and x made when passing them.
+    uint64_t bytesPerSolve = counter.getNumberOfBytes() / numberOfSolves;
+    EXPECT_LT(bytesPerSolve, numberOfStates * sizeof(double)) << "Allocations per solve: " << static_cast<double>(counter.getNumberOfAllocations()) / numberOfSolves;
+}
+
+TEST(GameViHelperTest, FillChoiceValuesVector) {
+    std::vector<double> b;
+    storm::storage::BitVector statesOfCoalition;
+    storm::storage::SparseMatrix<double> matrix = buildLineGame(4, b, statesOfCoalition);
+    storm::modelchecker::helper::internal::GameViHelper<double> viHelper(matrix, statesOfCoalition);
+
+    storm::storage::BitVector relevantStates(4, false);
+    relevantStates.set(1, true);
+    relevantStates.set(3, true);
+    std::vector<double> choiceValues = {1.0, 2.0, 3.0, 4.0};
+    viHelper.fillChoiceValuesVector(choiceValues, relevantStates, matrix.getRowGroupIndices());
+    std::vector<double> expected = {0.0, 0.0, 1.0, 2.0, 0.0, 0.0, 3.0, 4.0};
+    EXPECT_EQ(expected, choiceValues);
+}
+
+TEST(GameViHelperTest, MixedPrecision) {
+    uint64_t const numberOfStates = 200;
+    std::vector<double> b;
+    storm::storage::BitVector statesOfCoalition;
+    storm::storage::SparseMatrix<double> matrix = buildLineGame(numberOfStates, b, statesOfCoalition);
+
+    storm::Environment env;
+    env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-10));
+    std::vector<double> referenceResult(numberOfStates, 0.0);
+    std::vector<double> choiceValues;
+    storm::modelchecker::helper::internal::GameViHelper<double> referenceHelper(matrix, statesOfCoalition);
+    referenceHelper.performValueIteration(env, referenceResult, b, storm::solver::OptimizationDirection::Maximize, choiceValues);
+
+    for (bool quantize : {false, true}) {
+        env.solver().game().setMixedPrecision(true);
+        env.solver().game().setQuantizeProbabilities(quantize);
+        storm::modelchecker::helper::internal::GameViHelper<double> viHelper(matrix, statesOfCoalition);
+        std::vector<double> x(numberOfStates, 0.0);
+        viHelper.performValueIteration(env, x, b, storm::solver::OptimizationDirection::Maximize, choiceValues);
+        EXPECT_GT(viHelper.getNumberOfReducedPrecisionIterations(), 0ull);
+        // The single-precision phase takes most of the iterations, the double-precision phase only refines the result.
+        EXPECT_LT(viHelper.getNumberOfPerformedIterations(), referenceHelper.getNumberOfPerformedIterations());
+        EXPECT_LT(viHelper.getReducedPrecisionDistance(), 1e-4);
+        EXPECT_GT(viHelper.getReducedPrecisionErrorBound(), 0.0);
+        EXPECT_LT(viHelper.getReducedPrecisionErrorBound(), 1e-2);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            EXPECT_NEAR(referenceResult[state], x[state], 1e-9);
+        }
+    }
+}
+
+TEST(GameViHelperTest, MixedPrecisionFromBelow) {
+    // Both states reach the target almost surely. Rounding errors may let the single-precision iterates exceed one.
+    storm::storage::SparseMatrixBuilder<double> builder(0, 2, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    builder.newRowGroup(1);
+    builder.addNextValue(1, 1, 0.3);
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    std::vector<double> b = {0.1, 0.7};
+    storm::storage::BitVector statesOfCoalition(2, true);
+
+    storm::Environment env;
+    env.solver().game().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-12));
+    env.solver().game().setMixedPrecision(true);
+    storm::modelchecker::helper::internal::GameViHelper<double> viHelper(matrix, statesOfCoalition);
+    std::vector<double> x(2, 0.0);
+    std::vector<double> choiceValues;
+    viHelper.performValueIteration(env, x, b, storm::solver::OptimizationDirection::Maximize, choiceValues);
+    EXPECT_GT(viHelper.getNumberOfReducedPrecisionIterations(), 0ull);
+    // The refinement starts below the fixpoint, so it never exceeds it.
+    for (auto const& value : x) {
+        EXPECT_LE(value, 1.0);
+        EXPECT_NEAR(1.0, value, 1e-9);
+    }
+}
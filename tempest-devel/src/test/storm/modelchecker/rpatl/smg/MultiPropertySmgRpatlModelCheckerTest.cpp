@@ -0,0 +1,81 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/verification.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/modelchecker/StateFormulaCache.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/logic/ShieldExpression.h"
+#include "storm/environment/Environment.h"
+
+namespace {
+    class MultiPropertySmgRpatlModelCheckerTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/smg/rightDecision.nm");
+            std::string formulasAsString = "<<hiker, native>> Pmax=? [ F lost=1 ]; <<hiker>> Pmin=? [ F lost=1 ]; <<hiker>> Pmax=? [ !(lost=1) U \"target\" ]; <<hiker>> Pmax=? [ F <=3 \"target\" ]; <<native>> Pmin=? [ F <=5 lost=1 ]";
+            formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+            model = storm::api::buildSparseModel<double>(program, formulas);
+        }
+
+        std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> getTasks() const {
+            std::vector<storm::modelchecker::CheckTask<storm::logic::Formula, double>> tasks;
+            for (auto const& formula : formulas) {
+                tasks.emplace_back(*formula);
+            }
+            return tasks;
+        }
+
+        double getValueAtInitialState(storm::modelchecker::CheckResult const& result) const {
+            return result.asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+        }
+
+        std::vector<std::shared_ptr<storm::logic::Formula const>> formulas;
+        std::shared_ptr<storm::models::sparse::Model<double>> model;
+    };
+
+    TEST_F(MultiPropertySmgRpatlModelCheckerTest, SameResultsAsSequential) {
+        storm::Environment env;
+        auto tasks = getTasks();
+        auto cache = std::make_shared<storm::modelchecker::StateFormulaCache>();
+        auto results = storm::api::verifyWithSparseEngine<double>(env, model, tasks, 0, cache);
+        ASSERT_EQ(tasks.size(), results.size());
+        for (uint64_t index = 0; index < tasks.size(); ++index) {
+            auto expected = storm::api::verifyWithSparseEngine<double>(env, model, tasks[index]);
+            ASSERT_TRUE(results[index] != nullptr);
+            EXPECT_NEAR(getValueAtInitialState(*expected), getValueAtInitialState(*results[index]), 1e-6) << *formulas[index];
+        }
+        EXPECT_NEAR(0.1, getValueAtInitialState(*results[0]), 1e-6);
+        EXPECT_NEAR(0.0, getValueAtInitialState(*results[1]), 1e-6);
+        EXPECT_NEAR(1.0, getValueAtInitialState(*results[2]), 1e-6);
+
+        // When the properties are checked one after another, each proposition is only checked once.
+        cache->clear();
+        results = storm::api::verifyWithSparseEngine<double>(env, model, tasks, 1, cache);
+        EXPECT_NEAR(0.1, getValueAtInitialState(*results[0]), 1e-6);
+        EXPECT_LE(cache->getNumberOfEntries(), 5ul);
+        EXPECT_GE(cache->getNumberOfHits(), 3ul);
+    }
+
+    TEST_F(MultiPropertySmgRpatlModelCheckerTest, Shields) {
+        storm::Environment env;
+        auto tasks = getTasks();
+        tasks[3].setShieldingExpression(std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.9));
+        auto results = storm::api::verifyWithSparseEngine<double>(env, model, tasks);
+        EXPECT_FALSE(results[0]->hasShield());
+        EXPECT_TRUE(results[3]->hasShield());
+    }
+
+    TEST_F(MultiPropertySmgRpatlModelCheckerTest, Exceptions) {
+        storm::Environment env;
+        auto tasks = getTasks();
+        // Errors of single properties are reported once all properties were checked.
+        auto invalidFormula = storm::api::extractFormulasFromProperties(storm::api::parseProperties("<<hiker>> Pmax=? [ F \"unknown\" ]"));
+        tasks.emplace_back(*invalidFormula.front());
+        EXPECT_ANY_THROW(storm::api::verifyWithSparseEngine<double>(env, model, tasks));
+    }
+}
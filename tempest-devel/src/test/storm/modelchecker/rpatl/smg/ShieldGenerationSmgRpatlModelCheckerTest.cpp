@@ -17,6 +17,7 @@
 #include "storm/environment/solver/MultiplierEnvironment.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/logic/Formulas.h"
+#include "storm/shields/SafetyLtlShield.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
 
 namespace {
@@ -325,5 +326,36 @@ namespace {
         EXPECT_EQ(shieldingString, compareFileString);
     }
 
+    TYPED_TEST(ShieldGenerationSmgRpatlModelCheckerTest, WalkerSafetyLtl) {
+        typedef typename TestFixture::ValueType ValueType;
+
+        std::string formulasString = "<<walker>> Pmax=? [ G a=0 & G !\"s3\" ]";
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/walker.nm", formulasString);
+        auto smg = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<ValueType>> checker(*smg);
+
+        tasks[0].setShieldingExpression(std::make_shared<storm::logic::ShieldExpression>(storm::logic::ShieldingType::PreSafety, storm::logic::ShieldComparison::Relative, 0.9));
+        auto result = checker.check(this->env(), tasks[0]);
+        ASSERT_TRUE(result->hasShield());
+        auto const* shield = dynamic_cast<tempest::shields::SafetyLtlShield<ValueType, storm::storage::sparse::state_type> const*>(result->template asExplicitQuantitativeCheckResult<ValueType>().getShield().get());
+        ASSERT_NE(nullptr, shield);
+
+        // Only staying in the initial state keeps a=0 for sure.
+        uint64_t initialState = *smg->getInitialStates().begin();
+        uint64_t monitorState = shield->getMonitor().getInitialState(initialState);
+        EXPECT_FALSE(shield->getMonitor().isViolated(monitorState));
+        auto choice = shield->getChoice(initialState, monitorState);
+        auto const& choices = choice.getChoiceMap();
+        ASSERT_EQ(1ul, choices.size());
+        EXPECT_NEAR(1.0, std::get<0>(choices.front()), 1e-6);
+
+        // Moving to a state with a=1 violates the formula.
+        for (auto const& entry : smg->getTransitionMatrix().getRow(smg->getTransitionMatrix().getRowGroupIndices()[initialState])) {
+            uint64_t successor = shield->getMonitor().getSuccessor(monitorState, entry.getColumn());
+            EXPECT_EQ(smg->getStateLabeling().getStateHasLabel("s1", entry.getColumn()), shield->getMonitor().isViolated(successor));
+        }
+    }
+
     // TODO: create more test cases (files)
 }
@@ -0,0 +1,65 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <sstream>
+#include <unistd.h>
+
+#include "storm/shields/ShieldTable.h"
+#include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/exceptions/WrongFormatException.h"
+
+namespace {
+    // A shield in the format of PreShield::printJsonToStream.
+    std::string const exportedShield = R"([
+        {"s": {"x": 1, "done": false}, "c": [{"labels": ["left"], "index": 2, "prob": 0.9}, {"labels": ["right"], "index": 3, "prob": 0.95}]},
+        {"s": {"x": 0, "done": false}, "c": [{"labels": ["right"], "index": 0, "prob": 1.0}]},
+        {"s": {"x": 2, "done": true}, "c": "undefined"},
+        {"s": {"x": -1, "done": true}, "c": [{"labels": ["done"], "index": 5, "prob": 1.0}]}
+    ])";
+
+    TEST(ShieldTableTest, Lookup) {
+        std::stringstream stream(exportedShield);
+        std::vector<char> encoding = tempest::shields::encodeShieldTable(stream);
+        tempest::shields::ShieldTableView view(encoding.data(), encoding.size());
+
+        EXPECT_EQ(4ul, view.getNumberOfStates());
+        EXPECT_EQ(std::vector<std::string>({"done", "x"}), view.getVariableNames());
+        EXPECT_EQ(std::vector<std::string>({"done", "left", "right"}), view.getActionNames());
+
+        int64_t states[] = {0, 1, 0, 0, 1, -1, 1, 2, 0, 5};
+        EXPECT_EQ(6ul, view.getAllowedActions(states));
+        EXPECT_EQ(4ul, view.getAllowedActions(states + 2));
+        EXPECT_EQ(1ul, view.getAllowedActions(states + 4));
+        // States without allowed actions are kept, only states which are not in the shield are unknown.
+        EXPECT_EQ(0ul, view.getAllowedActions(states + 6));
+        EXPECT_EQ(tempest::shields::ShieldTableView::UNKNOWN_STATE, view.getAllowedActions(states + 8));
+
+        std::vector<uint64_t> masks(5);
+        view.getAllowedActions(states, 5, masks.data());
+        EXPECT_EQ(std::vector<uint64_t>({6, 4, 1, 0, tempest::shields::ShieldTableView::UNKNOWN_STATE}), masks);
+    }
+
+    TEST(ShieldTableTest, InvalidShields) {
+        std::stringstream rationalShield(R"([{"s": {"x": 0.5}, "c": [{"labels": ["a"], "index": 0, "prob": 1.0}]}])");
+        STORM_SILENT_EXPECT_THROW(tempest::shields::encodeShieldTable(rationalShield), storm::exceptions::NotSupportedException);
+        std::stringstream duplicateShield(R"([{"s": {"x": 0}, "c": [{"labels": ["a"], "index": 0, "prob": 1.0}]}, {"s": {"x": 0}, "c": [{"labels": ["b"], "index": 1, "prob": 1.0}]}])");
+        STORM_SILENT_EXPECT_THROW(tempest::shields::encodeShieldTable(duplicateShield), storm::exceptions::WrongFormatException);
+        char garbage[64] = {};
+        STORM_SILENT_EXPECT_THROW(tempest::shields::ShieldTableView(garbage, sizeof(garbage)), storm::exceptions::WrongFormatException);
+    }
+
+    TEST(ShieldTableTest, SharedMemory) {
+        std::stringstream stream(exportedShield);
+        std::string name = "/tempest-shield-test-" + std::to_string(getpid());
+        auto owner = tempest::shields::SharedShieldTable::create(name, tempest::shields::encodeShieldTable(stream));
+        {
+            auto client = tempest::shields::SharedShieldTable::open(name);
+            int64_t state[] = {0, 1};
+            EXPECT_EQ(6ul, client->getView().getAllowedActions(state));
+            EXPECT_EQ(owner->getView().getActionNames(), client->getView().getActionNames());
+        }
+        owner.reset();
+        STORM_SILENT_EXPECT_THROW(tempest::shields::SharedShieldTable::open(name), storm::exceptions::FileIoException);
+    }
+}
@@ -17,6 +17,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/logic/Formulas.h"
 #include "storm/exceptions/UncheckedRequirementException.h"
+#include "storm/exceptions/NotSupportedException.h"
 
 namespace {
 
@@ -230,6 +231,35 @@ namespace {
         EXPECT_NEAR(this->parseNumber("0.6336"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
     }
 
+    TYPED_TEST(SmgRpatlModelCheckerTest, WalkerSafetyLtl) {
+        std::string formulasString = "<<walker>> Pmin=? [ G a=0 & G !\"s3\" ]";
+        formulasString += "; <<walker>> Pmax=? [ G a=0 & G !\"s3\" ]";
+        formulasString += "; <<walker>> Pmin=? [ !(a=0 U a=1) ]";
+        formulasString += "; <<walker>> Pmin=? [ !(F \"s3\") ]";
+        formulasString += "; <<walker>> Pmin=? [ G (!\"s3\" | X \"s3\") ]";
+        formulasString += "; <<walker>> Pmax=? [ G F \"s3\" ]";
+
+        auto modelFormulas = this->buildModelFormulas(STORM_TEST_RESOURCES_DIR "/smg/walker.nm", formulasString);
+        auto model = std::move(modelFormulas.first);
+        auto tasks = this->getTasks(modelFormulas.second);
+        auto checker = this->createModelChecker(model);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+
+        result = checker->check(this->env(), tasks[0]);
+        EXPECT_NEAR(this->parseNumber("0.48"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        result = checker->check(this->env(), tasks[1]);
+        EXPECT_NEAR(this->parseNumber("1"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        result = checker->check(this->env(), tasks[2]);
+        EXPECT_NEAR(this->parseNumber("0.48"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        result = checker->check(this->env(), tasks[3]);
+        EXPECT_NEAR(this->parseNumber("0.65454565"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        // "s3" is absorbing
+        result = checker->check(this->env(), tasks[4]);
+        EXPECT_NEAR(this->parseNumber("1"), this->getQuantitativeResultAtInitialState(model, result), this->precision());
+        // Only safety objectives are supported.
+        STORM_SILENT_EXPECT_THROW(checker->check(this->env(), tasks[5]), storm::exceptions::NotSupportedException);
+    }
+
     TYPED_TEST(SmgRpatlModelCheckerTest, MessageHack) {
         // This test is for borders of bounded U with conversations from G and F
         // G
@@ -0,0 +1,106 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/shields/StatisticalShieldEvaluation.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+    class StatisticalShieldEvaluationTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/smg/rightDecision.nm");
+            storm::builder::BuilderOptions options;
+            options.setBuildAllLabels();
+            options.setBuildChoiceLabels();
+            options.setBuildStateValuations();
+            game = storm::api::buildSparseModel<double>(program, options)->template as<storm::models::sparse::Smg<double>>();
+
+            badStates = storm::storage::BitVector(game->getNumberOfStates(), false);
+            for (uint64_t state = 0; state < game->getNumberOfStates(); ++state) {
+                badStates.set(state, game->getStateValuations().getIntegerValue(state, program.getManager().getVariable("lost")) == 1);
+            }
+            ASSERT_FALSE(badStates.empty());
+        }
+
+        // The hiker reaches the target or gets lost on the shortcut. With uniform players, the hiker gets lost with
+        // probability 1/30, with an adversarial native with probability 1/15 and with two adversarial players with
+        // probability 1/10.
+        tempest::shields::StatisticalShieldEvaluator<double> createEvaluator(storm::storage::BitVector const& allowedChoices) const {
+            tempest::shields::StatisticalShieldEvaluator<double> evaluator(*game, storm::logic::PlayerCoalition({std::string("hiker")}), allowedChoices, badStates);
+            evaluator.setStopStates(game->getStates("target"));
+            return evaluator;
+        }
+
+        std::shared_ptr<storm::models::sparse::Smg<double>> game;
+        storm::storage::BitVector badStates;
+    };
+
+    TEST_F(StatisticalShieldEvaluationTest, ClopperPearson) {
+        auto evaluator = createEvaluator(storm::storage::BitVector(game->getNumberOfChoices(), true));
+        tempest::shields::ShieldEvaluationOptions options;
+        options.precision = 0.005;
+        options.confidence = 0.99;
+        options.seed = 3;
+
+        auto result = evaluator.evaluate(options);
+        EXPECT_EQ(0ul, result.numberOfUnfinishedEpisodes);
+        EXPECT_LE(result.upperBound - result.lowerBound, 0.01);
+        EXPECT_LE(result.lowerBound, 1.0 / 30.0);
+        EXPECT_GE(result.upperBound, 1.0 / 30.0);
+        EXPECT_EQ(tempest::shields::ThresholdDecision::Undecided, result.decision);
+
+        options.environmentBehavior = tempest::shields::PlayerBehavior::Adversarial;
+        result = evaluator.evaluate(options);
+        EXPECT_LE(result.lowerBound, 1.0 / 15.0);
+        EXPECT_GE(result.upperBound, 1.0 / 15.0);
+
+        options.shieldedBehavior = tempest::shields::PlayerBehavior::Adversarial;
+        result = evaluator.evaluate(options);
+        EXPECT_LE(result.lowerBound, 0.1);
+        EXPECT_GE(result.upperBound, 0.1);
+    }
+
+    TEST_F(StatisticalShieldEvaluationTest, Sprt) {
+        auto evaluator = createEvaluator(storm::storage::BitVector(game->getNumberOfChoices(), true));
+        tempest::shields::ShieldEvaluationOptions options;
+        options.test = tempest::shields::StatisticalTest::Sprt;
+        options.threshold = 0.05;
+        options.indifference = 0.01;
+        options.batchSize = 1000;
+
+        EXPECT_EQ(tempest::shields::ThresholdDecision::BelowThreshold, evaluator.evaluate(options).decision);
+        options.environmentBehavior = tempest::shields::PlayerBehavior::Adversarial;
+        EXPECT_EQ(tempest::shields::ThresholdDecision::AboveThreshold, evaluator.evaluate(options).decision);
+
+        options.threshold = 0.001;
+        STORM_SILENT_EXPECT_THROW(evaluator.evaluate(options), storm::exceptions::InvalidArgumentException);
+    }
+
+    TEST_F(StatisticalShieldEvaluationTest, Shielded) {
+        // A shield that forbids the shortcut makes the hiker safe, even against an adversarial native.
+        storm::storage::BitVector allowedChoices = ~game->getChoiceLabeling().getChoices("startShortcut");
+        auto evaluator = createEvaluator(allowedChoices);
+        tempest::shields::ShieldEvaluationOptions options;
+        options.shieldedBehavior = tempest::shields::PlayerBehavior::Adversarial;
+        options.environmentBehavior = tempest::shields::PlayerBehavior::Adversarial;
+        options.threshold = 0.01;
+
+        auto result = evaluator.evaluate(options);
+        EXPECT_EQ(0ul, result.numberOfViolations);
+        EXPECT_EQ(tempest::shields::ThresholdDecision::BelowThreshold, result.decision);
+        EXPECT_LT(result.upperBound, 0.01);
+    }
+
+    TEST(ClopperPearsonTest, Interval) {
+        auto interval = tempest::shields::computeClopperPearsonInterval(0, 10, 0.95);
+        EXPECT_EQ(0.0, interval.first);
+        EXPECT_NEAR(0.3085, interval.second, 1e-4);
+        interval = tempest::shields::computeClopperPearsonInterval(5, 10, 0.95);
+        EXPECT_NEAR(0.1871, interval.first, 1e-4);
+        EXPECT_NEAR(0.8129, interval.second, 1e-4);
+    }
+}
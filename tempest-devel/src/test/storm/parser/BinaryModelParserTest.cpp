@@ -0,0 +1,50 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstdio>
+
+#include "storm/api/builder.h"
+#include "storm/api/export.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/parser/BinaryModelParser.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/io/BinaryModelExporter.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/storage/prism/Program.h"
+
+TEST(BinaryModelParserTest, SmgRoundTrip) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+    storm::builder::BuilderOptions options(true, true);
+    options.setBuildStateValuations();
+    options.setBuildChoiceLabels();
+    auto model = storm::api::buildSparseModel<double>(program, options)->as<storm::models::sparse::Smg<double>>();
+
+    std::string filename = ::testing::TempDir() + "walker.smgb";
+    storm::exporter::exportSmgAsBinary(filename, *model);
+    auto loaded = storm::parser::BinaryModelParser::parseSmg(filename, program.getManager());
+    std::remove(filename.c_str());
+
+    EXPECT_EQ(model->getTransitionMatrix(), loaded->getTransitionMatrix());
+    EXPECT_EQ(model->getStatePlayerIndications(), loaded->getStatePlayerIndications());
+    EXPECT_EQ(model->getPlayerNameToIndexMap(), loaded->getPlayerNameToIndexMap());
+    EXPECT_EQ(model->getStateLabeling(), loaded->getStateLabeling());
+    ASSERT_TRUE(loaded->hasChoiceLabeling());
+    EXPECT_EQ(model->getChoiceLabeling(), loaded->getChoiceLabeling());
+    EXPECT_EQ(model->getNumberOfRewardModels(), loaded->getNumberOfRewardModels());
+    ASSERT_TRUE(loaded->hasStateValuations());
+    for (uint64_t state = 0; state < model->getNumberOfStates(); ++state) {
+        EXPECT_EQ(model->getStateValuations().toString(state), loaded->getStateValuations().toString(state));
+    }
+}
+
+TEST(BinaryModelParserTest, CacheKey) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+    storm::builder::BuilderOptions options(true, true);
+    std::string key = storm::exporter::computeModelCacheKey(program, options);
+    EXPECT_EQ(32ul, key.size());
+    EXPECT_EQ(key, storm::exporter::computeModelCacheKey(program, options));
+
+    options.setBuildStateValuations();
+    EXPECT_NE(key, storm::exporter::computeModelCacheKey(program, options));
+    EXPECT_NE(storm::exporter::computeModelCacheKey(program, options), storm::exporter::computeModelCacheKey(program, options, "N=3"));
+}
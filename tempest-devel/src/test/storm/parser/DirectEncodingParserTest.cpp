@@ -1,10 +1,17 @@
 #include "test/storm_gtest.h"
 #include "storm-config.h"
 
+#include <cstdio>
+#include <fstream>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/api/builder.h"
+#include "storm/io/DirectEncodingExporter.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
+#include "storm/models/sparse/Smg.h"
 
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn");
@@ -84,3 +91,99 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
 
+
+TEST(DirectEncodingParserTest, ParallelParsing) {
+    storm::parser::DirectEncodingParserOptions sequentialOptions;
+    sequentialOptions.numberOfThreads = 1;
+    sequentialOptions.buildChoiceLabeling = true;
+    storm::parser::DirectEncodingParserOptions parallelOptions = sequentialOptions;
+    parallelOptions.numberOfThreads = 4;
+
+    for (std::string file : {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.drn", STORM_TEST_RESOURCES_DIR "/mdp/two_dice.drn"}) {
+        auto sequentialModel = storm::parser::DirectEncodingParser<double>::parseModel(file, sequentialOptions);
+        auto parallelModel = storm::parser::DirectEncodingParser<double>::parseModel(file, parallelOptions);
+        EXPECT_EQ(sequentialModel->getType(), parallelModel->getType());
+        EXPECT_EQ(sequentialModel->getTransitionMatrix(), parallelModel->getTransitionMatrix());
+        EXPECT_EQ(sequentialModel->getStateLabeling(), parallelModel->getStateLabeling());
+        EXPECT_EQ(sequentialModel->getChoiceLabeling(), parallelModel->getChoiceLabeling());
+        ASSERT_EQ(sequentialModel->getNumberOfRewardModels(), parallelModel->getNumberOfRewardModels());
+        for (auto const& rewardModel : sequentialModel->getRewardModels()) {
+            auto const& parallelRewardModel = parallelModel->getRewardModel(rewardModel.first);
+            ASSERT_EQ(rewardModel.second.hasStateRewards(), parallelRewardModel.hasStateRewards());
+            ASSERT_EQ(rewardModel.second.hasStateActionRewards(), parallelRewardModel.hasStateActionRewards());
+            if (rewardModel.second.hasStateRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateRewardVector(), parallelRewardModel.getStateRewardVector());
+            }
+            if (rewardModel.second.hasStateActionRewards()) {
+                EXPECT_EQ(rewardModel.second.getStateActionRewardVector(), parallelRewardModel.getStateActionRewardVector());
+            }
+        }
+    }
+}
+
+TEST(DirectEncodingParserTest, SmgExportAndParsing) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/smg/walker.nm");
+    storm::builder::BuilderOptions builderOptions(true, true);
+    builderOptions.setBuildChoiceLabels();
+    auto smg = storm::api::buildSparseModel<double>(program, builderOptions)->as<storm::models::sparse::Smg<double>>();
+
+    std::string filename = ::testing::TempDir() + "walker.drn";
+    std::ofstream stream(filename);
+    storm::exporter::explicitExportSparseModel<double>(stream, smg, {});
+    stream.close();
+
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    options.numberOfThreads = 2;
+    auto modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(filename, options);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(storm::models::ModelType::Smg, modelPtr->getType());
+    auto parsedSmg = modelPtr->as<storm::models::sparse::Smg<double>>();
+    EXPECT_EQ(smg->getTransitionMatrix(), parsedSmg->getTransitionMatrix());
+    EXPECT_EQ(smg->getStatePlayerIndications(), parsedSmg->getStatePlayerIndications());
+    EXPECT_EQ(smg->getPlayerNameToIndexMap(), parsedSmg->getPlayerNameToIndexMap());
+    EXPECT_EQ(smg->getStateLabeling(), parsedSmg->getStateLabeling());
+}
+
+TEST(DirectEncodingParserTest, SmgStreamExport) {
+    std::string filename = ::testing::TempDir() + "stream.drn";
+    std::ofstream stream(filename);
+    storm::exporter::DirectEncodingStreamExporter<double> exporter(stream, storm::models::ModelType::Smg, 3, 4, {"steps"}, {"controller", "environment"});
+    exporter.addState({"init"}, {}, 0);
+    exporter.addChoice("left", {1.0});
+    exporter.addTransition(1, 1.0);
+    exporter.addChoice("right", {1.0});
+    exporter.addTransition(1, 0.5);
+    exporter.addTransition(2, 0.5);
+    exporter.addState({"dead end"}, {}, 1);
+    exporter.addChoice();
+    exporter.addTransition(1, 1.0);
+    exporter.addState({"goal"}, {2.0});
+    exporter.addChoice();
+    exporter.addTransition(2, 1.0);
+    exporter.finalize();
+    stream.close();
+
+    storm::parser::DirectEncodingParserOptions options;
+    options.buildChoiceLabeling = true;
+    auto modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(filename, options);
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(storm::models::ModelType::Smg, modelPtr->getType());
+    auto smg = modelPtr->as<storm::models::sparse::Smg<double>>();
+    EXPECT_EQ(3ul, smg->getNumberOfStates());
+    EXPECT_EQ(4ul, smg->getNumberOfChoices());
+    EXPECT_EQ(5ul, smg->getNumberOfTransitions());
+    EXPECT_EQ(0ul, smg->getPlayerOfState(0));
+    EXPECT_EQ(1ul, smg->getPlayerOfState(1));
+    EXPECT_EQ(storm::storage::INVALID_PLAYER_INDEX, smg->getPlayerOfState(2));
+    EXPECT_EQ(1ul, smg->getPlayerIndex("environment"));
+    EXPECT_TRUE(smg->getStateLabeling().getStateHasLabel("dead end", 1));
+    EXPECT_TRUE(smg->getChoiceLabeling().getChoiceHasLabel("right", 1));
+    ASSERT_TRUE(smg->hasRewardModel("steps"));
+    std::vector<double> expectedStateRewards = {0.0, 0.0, 2.0};
+    EXPECT_EQ(expectedStateRewards, smg->getRewardModel("steps").getStateRewardVector());
+    std::vector<double> expectedActionRewards = {1.0, 1.0, 0.0, 0.0};
+    EXPECT_EQ(expectedActionRewards, smg->getRewardModel("steps").getStateActionRewardVector());
+}
@@ -0,0 +1,92 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/simulator/BatchedSparseModelSimulator.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+    std::shared_ptr<storm::models::sparse::Model<double>> buildDie(std::string const& file) {
+        storm::prism::Program program = storm::api::parseProgram(file);
+        storm::builder::BuilderOptions options;
+        options.setBuildAllRewardModels();
+        options.setBuildAllLabels();
+        return storm::api::buildSparseModel<double>(program, options);
+    }
+
+    TEST(BatchedSparseModelSimulatorTest, KnuthYaoDie) {
+        auto dtmc = buildDie(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        uint64_t const numberOfEpisodes = 60000;
+        storm::simulator::BatchedSparseModelSimulator<double> simulator(*dtmc, numberOfEpisodes, 42);
+        std::vector<double> coinFlips(numberOfEpisodes, 0.0);
+        for (uint64_t step = 0; step < 200; ++step) {
+            simulator.randomStep();
+            for (uint64_t episode = 0; episode < numberOfEpisodes; ++episode) {
+                coinFlips[episode] += simulator.getLastRewards()[episode];
+            }
+        }
+
+        // All episodes end in the sink states, each die value with probability 1/6.
+        uint64_t numberOfOnes = 0;
+        double totalCoinFlips = 0;
+        for (uint64_t episode = 0; episode < numberOfEpisodes; ++episode) {
+            ASSERT_TRUE(simulator.getDone()[episode]);
+            if (dtmc->getStateLabeling().getStateHasLabel("one", simulator.getCurrentStates()[episode])) {
+                ++numberOfOnes;
+            }
+            totalCoinFlips += coinFlips[episode];
+        }
+        EXPECT_NEAR(1.0 / 6.0, static_cast<double>(numberOfOnes) / numberOfEpisodes, 0.01);
+        EXPECT_NEAR(11.0 / 3.0, totalCoinFlips / numberOfEpisodes, 0.05);
+    }
+
+    TEST(BatchedSparseModelSimulatorTest, Reproducible) {
+        auto dtmc = buildDie(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+        storm::simulator::BatchedSparseModelSimulator<double> sequential(*dtmc, 10000, 7);
+        storm::simulator::BatchedSparseModelSimulator<double> parallel(*dtmc, 10000, 7);
+        for (uint64_t step = 0; step < 5; ++step) {
+            sequential.randomStep(1);
+            parallel.randomStep(4);
+            EXPECT_EQ(sequential.getCurrentStates(), parallel.getCurrentStates());
+        }
+        parallel.setSeed(8);
+        parallel.resetToInitial();
+        parallel.randomStep(4);
+        sequential.setSeed(7);
+        sequential.resetToInitial();
+        sequential.randomStep(1);
+        EXPECT_NE(sequential.getCurrentStates(), parallel.getCurrentStates());
+    }
+
+    TEST(BatchedSparseModelSimulatorTest, AllowedChoices) {
+        auto mdp = buildDie(STORM_TEST_RESOURCES_DIR "/mdp/die_c1.nm");
+        uint64_t initialState = *mdp->getInitialStates().begin();
+        uint64_t firstRow = mdp->getTransitionMatrix().getRowGroupIndices()[initialState];
+        ASSERT_EQ(2ul, mdp->getTransitionMatrix().getRowGroupSize(initialState));
+
+        storm::simulator::BatchedSparseModelSimulator<double> simulator(*mdp, 100);
+        storm::storage::BitVector allowedChoices(mdp->getNumberOfChoices(), true);
+        allowedChoices.set(firstRow, false);
+        simulator.setAllowedChoices(allowedChoices);
+
+        std::vector<uint64_t> choices(100, 0);
+        simulator.step(choices.data());
+        for (uint64_t episode = 0; episode < 100; ++episode) {
+            EXPECT_TRUE(simulator.getOverridden()[episode]);
+            EXPECT_EQ(firstRow + 1, simulator.getLastChoices()[episode]);
+        }
+
+        simulator.resetToInitial();
+        simulator.randomStep();
+        for (uint64_t episode = 0; episode < 100; ++episode) {
+            EXPECT_FALSE(simulator.getOverridden()[episode]);
+            EXPECT_EQ(firstRow + 1, simulator.getLastChoices()[episode]);
+        }
+
+        simulator.resetToInitial();
+        choices[0] = 2;
+        STORM_SILENT_EXPECT_THROW(simulator.step(choices.data()), storm::exceptions::InvalidArgumentException);
+    }
+}
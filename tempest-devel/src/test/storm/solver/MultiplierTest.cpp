@@ -31,6 +31,17 @@ namespace {
         }
     };
     
+    class SimdEnvironment {
+    public:
+        typedef double ValueType;
+        static const bool isExact = false;
+        static storm::Environment createEnvironment() {
+            storm::Environment env;
+            env.solver().multiplier().setType(storm::solver::MultiplierType::Simd);
+            return env;
+        }
+    };
+    
     template<typename TestType>
     class MultiplierTest : public ::testing::Test {
     public:
@@ -45,7 +56,8 @@ namespace {
   
     typedef ::testing::Types<
             NativeEnvironment,
-            GmmxxEnvironment
+            GmmxxEnvironment,
+            SimdEnvironment
     > TestingTypes;
     
     TYPED_TEST_SUITE(MultiplierTest, TestingTypes,);
@@ -120,4 +132,86 @@ namespace {
         EXPECT_NEAR(x[0], this->parseNumber("0.923808265834023387639"), this->precision());
     }
     
-}
\ No newline at end of file
+    TYPED_TEST(MultiplierTest, multiplyAndReduceWithDirectionOverrideTest) {
+        typedef typename TestFixture::ValueType ValueType;
+    
+        // Row groups of varying size, including rows with more entries than fit into a single vector register.
+        uint64_t const numberOfStates = 50;
+        storm::storage::SparseMatrixBuilder<ValueType> builder(0, numberOfStates, 0, false, true);
+        storm::storage::BitVector dirOverride(numberOfStates, false);
+        uint64_t row = 0;
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            builder.newRowGroup(row);
+            for (uint64_t choice = 0; choice <= state % 3; ++choice, ++row) {
+                uint64_t numberOfSuccessors = 1 + (state + choice) % 11;
+                for (uint64_t successor = 0; successor < numberOfSuccessors; ++successor) {
+                    builder.addNextValue(row, (state * 7 + choice * 3 + successor) % numberOfStates, this->parseNumber("1") / storm::utility::convertNumber<ValueType>(numberOfSuccessors));
+                }
+            }
+            dirOverride.set(state, state % 2 == 0);
+        }
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+    
+        std::vector<ValueType> x(numberOfStates);
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            x[state] = storm::utility::convertNumber<ValueType>(state) / storm::utility::convertNumber<ValueType>(numberOfStates);
+        }
+        std::vector<ValueType> b(A.getRowCount(), this->parseNumber("0.01"));
+    
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(this->env(), A);
+        for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<ValueType> result(numberOfStates);
+            std::vector<ValueType> expected(numberOfStates);
+            ASSERT_NO_THROW(multiplier->multiplyAndReduce(this->env(), dir, x, &b, result, nullptr, &dirOverride));
+            A.multiplyAndReduce(dir, A.getRowGroupIndices(), x, &b, expected, nullptr, &dirOverride);
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                EXPECT_NEAR(expected[state], result[state], this->precision());
+            }
+        }
+    }
+    
+    TYPED_TEST(MultiplierTest, multiplyWithShortAndEmptyRowsTest) {
+        typedef typename TestFixture::ValueType ValueType;
+    
+        // Rows with zero to five entries in an irregular order, such that the rows do not fill up the last vector register.
+        uint64_t const numberOfRows = 1001;
+        uint64_t const numberOfColumns = 100;
+        storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfRows, numberOfColumns);
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            uint64_t numberOfEntries = (row * 7) % 6;
+            for (uint64_t entry = 0; entry < numberOfEntries; ++entry) {
+                // Column 0 is never used.
+                builder.addNextValue(row, 1 + (row + entry * 13) % (numberOfColumns - 1), this->parseNumber("1") / storm::utility::convertNumber<ValueType>(entry + 2));
+            }
+        }
+        storm::storage::SparseMatrix<ValueType> A;
+        ASSERT_NO_THROW(A = builder.build());
+    
+        std::vector<ValueType> x(numberOfColumns);
+        for (uint64_t column = 0; column < numberOfColumns; ++column) {
+            x[column] = storm::utility::convertNumber<ValueType>(column) / storm::utility::convertNumber<ValueType>(numberOfColumns);
+        }
+        if (!TypeParam::isExact) {
+            // The value of an unused column must not spill into other rows.
+            x[0] = storm::utility::infinity<ValueType>();
+        }
+        std::vector<ValueType> b(numberOfRows);
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            b[row] = storm::utility::convertNumber<ValueType>(row % 10) / storm::utility::convertNumber<ValueType>(10);
+        }
+    
+        auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(this->env(), A);
+        for (std::vector<ValueType> const* bPtr : {static_cast<std::vector<ValueType> const*>(nullptr), static_cast<std::vector<ValueType> const*>(&b)}) {
+            std::vector<ValueType> result(numberOfRows);
+            std::vector<ValueType> expected(numberOfRows);
+            ASSERT_NO_THROW(multiplier->multiply(this->env(), x, bPtr, result));
+            A.multiplyWithVector(x, expected, bPtr);
+            for (uint64_t row = 0; row < numberOfRows; ++row) {
+                // The vectorized kernels may fuse multiplications and additions, which changes the last bits of the result.
+                EXPECT_NEAR(expected[row], result[row], this->precision() * this->parseNumber("10"));
+            }
+        }
+    }
+    
+}
@@ -0,0 +1,40 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/solver/TerminationCondition.h"
+
+TEST(TerminationConditionTest, ShieldDecisionsFixed) {
+    // Two states with two choices each.
+    std::vector<uint64_t> rowGroupIndices = {0, 2, 4};
+    storm::solver::TerminateIfShieldDecisionsFixed<double> condition(rowGroupIndices, true, false, 0.7, false, true, false);
+
+    // Without upper bounds, nothing can be decided.
+    std::vector<double> lower = {0.5, 0.6, 0.75, 0.1};
+    EXPECT_FALSE(condition.terminateNow(lower, storm::solver::SolverGuarantee::LessOrEqual));
+
+    // The second choice of the first state may still pass the threshold.
+    std::vector<double> upper = {0.55, 0.72, 0.8, 0.2};
+    condition.setUpperBounds(upper);
+    EXPECT_FALSE(condition.terminateNow(lower, storm::solver::SolverGuarantee::None));
+    EXPECT_FALSE(condition.terminateNow(lower, storm::solver::SolverGuarantee::LessOrEqual));
+    EXPECT_EQ(1ull, condition.getNumberOfUndecidedStates());
+
+    upper[1] = 0.65;
+    EXPECT_TRUE(condition.terminateNow(lower, storm::solver::SolverGuarantee::LessOrEqual));
+    EXPECT_EQ(0ull, condition.getNumberOfUndecidedStates());
+}
+
+TEST(TerminationConditionTest, RelativeShieldDecisionsFixed) {
+    std::vector<uint64_t> rowGroupIndices = {0, 2};
+    storm::solver::TerminateIfShieldDecisionsFixed<double> condition(rowGroupIndices, true, true, 0.9, true, true, false);
+
+    // The optimal choice is fixed, but the second choice may or may not reach 90% of it.
+    std::vector<double> lower = {0.8, 0.7};
+    std::vector<double> upper = {0.82, 0.75};
+    condition.setUpperBounds(upper);
+    EXPECT_FALSE(condition.terminateNow(lower, storm::solver::SolverGuarantee::LessOrEqual));
+
+    lower = {0.81, 0.7};
+    upper = {0.815, 0.71};
+    EXPECT_TRUE(condition.terminateNow(lower, storm::solver::SolverGuarantee::LessOrEqual));
+}
@@ -0,0 +1,118 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/storage/GameMaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/Stopwatch.h"
+#include "test/storm/storage/SyntheticGames.h"
+
+#include <algorithm>
+#include <boost/optional.hpp>
+#include <string>
+#include <vector>
+
+// Benchmarks of the game MEC decomposition on synthetic games with many (nested) end components. Each instance is also
+// decomposed by repeatedly refining SCC decompositions, as done by the previous algorithm, to validate the results and to
+// compare the running times. The times are recorded as test properties. The benchmarks are disabled by default, run them with
+// --gtest_also_run_disabled_tests --gtest_filter=*GameMaximalEndComponentDecompositionBenchmark*.
+namespace {
+    typedef std::vector<std::vector<uint64_t>> StateSets;
+
+    StateSets toSortedStateSets(storm::storage::GameMaximalEndComponentDecomposition<double> const& decomposition) {
+        StateSets result;
+        for (auto const& mec : decomposition) {
+            std::vector<uint64_t> states;
+            for (auto const& stateChoices : mec) {
+                states.push_back(stateChoices.first);
+            }
+            std::sort(states.begin(), states.end());
+            result.push_back(std::move(states));
+        }
+        std::sort(result.begin(), result.end());
+        return result;
+    }
+
+    // Removes the states with a choice that leaves their SCC and recomputes the SCCs until no state is removed.
+    StateSets computeMecsBySccRefinement(storm::storage::SparseMatrix<double> const& matrix) {
+        storm::storage::BitVector candidates(matrix.getRowGroupCount(), true);
+        storm::storage::BitVector allChoices(matrix.getRowCount(), true);
+        while (true) {
+            storm::storage::StronglyConnectedComponentDecomposition<double> sccs(matrix, storm::storage::StronglyConnectedComponentDecompositionOptions().subsystem(&candidates).choices(&allChoices).dropNaiveSccs());
+            std::vector<uint64_t> sccIndices(matrix.getRowGroupCount(), sccs.size());
+            for (uint64_t sccIndex = 0; sccIndex < sccs.size(); ++sccIndex) {
+                for (auto state : sccs[sccIndex]) {
+                    sccIndices[state] = sccIndex;
+                }
+            }
+            storm::storage::BitVector remaining(matrix.getRowGroupCount(), false);
+            for (uint64_t state = 0; state < matrix.getRowGroupCount(); ++state) {
+                if (sccIndices[state] == sccs.size()) {
+                    continue;
+                }
+                bool staysInScc = true;
+                for (uint64_t choice = matrix.getRowGroupIndices()[state]; staysInScc && choice < matrix.getRowGroupIndices()[state + 1]; ++choice) {
+                    for (auto const& entry : matrix.getRow(choice)) {
+                        if (sccIndices[entry.getColumn()] != sccIndices[state]) {
+                            staysInScc = false;
+                            break;
+                        }
+                    }
+                }
+                remaining.set(state, staysInScc);
+            }
+            if (remaining == candidates) {
+                StateSets result;
+                for (auto const& scc : sccs) {
+                    result.emplace_back(scc.begin(), scc.end());
+                    std::sort(result.back().begin(), result.back().end());
+                }
+                std::sort(result.begin(), result.end());
+                return result;
+            }
+            candidates = remaining;
+        }
+    }
+
+    // If no number of MECs is expected, the result is only compared with the SCC refinement.
+    void runBenchmark(std::string const& name, storm::storage::SparseMatrix<double> const& matrix, bool compareWithSccRefinement, boost::optional<uint64_t> expectedNumberOfMecs) {
+        storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+        storm::utility::Stopwatch decompositionWatch(true);
+        storm::storage::GameMaximalEndComponentDecomposition<double> decomposition(matrix, backwardTransitions);
+        decompositionWatch.stop();
+        if (expectedNumberOfMecs) {
+            EXPECT_EQ(expectedNumberOfMecs.get(), decomposition.size()) << name;
+        }
+        ::testing::Test::RecordProperty(name + "-ms", std::to_string(decompositionWatch.getTimeInMilliseconds()));
+
+        if (compareWithSccRefinement) {
+            storm::utility::Stopwatch refinementWatch(true);
+            StateSets expected = computeMecsBySccRefinement(matrix);
+            refinementWatch.stop();
+            EXPECT_EQ(expected, toSortedStateSets(decomposition)) << name;
+            ::testing::Test::RecordProperty(name + "-scc-refinement-ms", std::to_string(refinementWatch.getTimeInMilliseconds()));
+        }
+    }
+}
+
+TEST(GameMaximalEndComponentDecompositionBenchmark, DISABLED_NestedRings) {
+    // Every level requires another refinement round of the previous algorithm.
+    for (uint64_t numberOfLevels : {10, 100, 500}) {
+        runBenchmark("nested-rings-" + std::to_string(numberOfLevels), storm::test::buildNestedRingGame(numberOfLevels, 20), true, numberOfLevels + 1);
+    }
+    runBenchmark("nested-rings-5000", storm::test::buildNestedRingGame(5000, 20), false, 5001);
+}
+
+TEST(GameMaximalEndComponentDecompositionBenchmark, DISABLED_Pockets) {
+    for (uint64_t numberOfPockets : {10, 1000}) {
+        // Two ring states are removed per refinement round of the previous algorithm.
+        runBenchmark("pockets-" + std::to_string(numberOfPockets), storm::test::buildPocketGame(2000, numberOfPockets, 4), true, numberOfPockets + 1);
+    }
+    runBenchmark("pockets-50000", storm::test::buildPocketGame(100000, 50000, 4), false, 50001);
+}
+
+TEST(GameMaximalEndComponentDecompositionBenchmark, DISABLED_RandomBlocks) {
+    for (uint64_t seed = 0; seed < 5; ++seed) {
+        runBenchmark("random-blocks-" + std::to_string(seed), storm::test::buildRandomBlockGame(20000, 16, 0.02, seed), true, boost::none);
+    }
+}
@@ -0,0 +1,80 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+#include "storm/storage/GameMaximalEndComponentDecomposition.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "test/storm/storage/SyntheticGames.h"
+
+TEST(GameMaximalEndComponentDecomposition, NestedRings) {
+    uint64_t const numberOfLevels = 4;
+    uint64_t const ringSize = 5;
+    storm::storage::SparseMatrix<double> matrix = storm::test::buildNestedRingGame(numberOfLevels, ringSize);
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+    storm::storage::BitVector allStates(matrix.getRowGroupCount(), true);
+
+    storm::storage::GameMaximalEndComponentDecomposition<double> mecDecomposition;
+    ASSERT_NO_THROW(mecDecomposition = storm::storage::GameMaximalEndComponentDecomposition<double>(matrix, backwardTransitions, allStates));
+
+    // One pocket per level and the innermost ring.
+    ASSERT_EQ(numberOfLevels + 1, mecDecomposition.size());
+
+    uint64_t const statesPerLevel = ringSize + 2;
+    uint64_t numberOfRingMecs = 0;
+    for (auto const& mec : mecDecomposition) {
+        if (mec.size() == 2) {
+            uint64_t pocketState = *mec.getStateSet().begin();
+            EXPECT_EQ(ringSize, pocketState % statesPerLevel);
+            EXPECT_TRUE(mec.containsState(pocketState + 1));
+        } else {
+            ++numberOfRingMecs;
+            ASSERT_EQ(ringSize, mec.size());
+            uint64_t innermostOffset = (numberOfLevels - 1) * statesPerLevel;
+            for (uint64_t k = 0; k < ringSize; ++k) {
+                ASSERT_TRUE(mec.containsState(innermostOffset + k));
+            }
+            for (uint64_t k = 0; k < ringSize; ++k) {
+                EXPECT_EQ(2ull, mec.getChoicesForState(innermostOffset + k).size());
+            }
+        }
+    }
+    EXPECT_EQ(1ull, numberOfRingMecs);
+}
+
+TEST(GameMaximalEndComponentDecomposition, Subsystem) {
+    uint64_t const numberOfLevels = 3;
+    uint64_t const ringSize = 4;
+    storm::storage::SparseMatrix<double> matrix = storm::test::buildNestedRingGame(numberOfLevels, ringSize);
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+
+    // The outermost ring on its own can be left by dropping into the next ring.
+    storm::storage::BitVector outerRing(matrix.getRowGroupCount(), false);
+    for (uint64_t state = 0; state < ringSize; ++state) {
+        outerRing.set(state, true);
+    }
+    storm::storage::GameMaximalEndComponentDecomposition<double> mecDecomposition(matrix, backwardTransitions, outerRing);
+    EXPECT_EQ(0ull, mecDecomposition.size());
+
+    // Restricting the outermost ring to the choices moving along the ring yields a single MEC.
+    storm::storage::BitVector ringChoices(matrix.getRowCount(), false);
+    for (uint64_t state = 0; state < ringSize; ++state) {
+        ringChoices.set(matrix.getRowGroupIndices()[state], true);
+    }
+    mecDecomposition = storm::storage::GameMaximalEndComponentDecomposition<double>(matrix, backwardTransitions, outerRing, ringChoices);
+    ASSERT_EQ(1ull, mecDecomposition.size());
+    EXPECT_EQ(ringSize, mecDecomposition[0].size());
+    for (uint64_t state = 0; state < ringSize; ++state) {
+        EXPECT_EQ(1ull, mecDecomposition[0].getChoicesForState(state).size());
+    }
+}
+
+TEST(GameMaximalEndComponentDecomposition, ManyNestedLevels) {
+    // A deep nesting that required one refinement round per level with the previous algorithm.
+    uint64_t const numberOfLevels = 2000;
+    uint64_t const ringSize = 50;
+    storm::storage::SparseMatrix<double> matrix = storm::test::buildNestedRingGame(numberOfLevels, ringSize);
+    storm::storage::SparseMatrix<double> backwardTransitions = matrix.transpose(true);
+    storm::storage::BitVector allStates(matrix.getRowGroupCount(), true);
+
+    storm::storage::GameMaximalEndComponentDecomposition<double> mecDecomposition(matrix, backwardTransitions, allStates);
+    EXPECT_EQ(numberOfLevels + 1, mecDecomposition.size());
+}
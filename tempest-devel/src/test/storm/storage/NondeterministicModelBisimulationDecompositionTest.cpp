@@ -5,9 +5,18 @@
 #include "storm-parsers/parser/FormulaParser.h"
 
 #include "storm/builder/ExplicitModelBuilder.h"
+#include "storm/api/bisimulation.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/api/verification.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/modelchecker/rpatl/SparseSmgRpatlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/environment/Environment.h"
 
 #include "storm/storage/bisimulation/NondeterministicModelBisimulationDecomposition.h"
 #include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/Smg.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
@@ -56,3 +65,64 @@ TEST(NondeterministicModelBisimulationDecomposition, TwoDice) {
     EXPECT_EQ(26ul, result->getNumberOfTransitions());
     EXPECT_EQ(14ul, result->as<storm::models::sparse::Mdp<double>>()->getNumberOfChoices());
 }
+
+TEST(NondeterministicModelBisimulationDecomposition, Game) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/smg/symmetricLanes.nm");
+    std::vector<storm::jani::Property> properties = storm::api::parsePropertiesForPrismProgram("<<robot>> Pmax=? [F \"goal\"]", program);
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(properties);
+    storm::builder::BuilderOptions options(formulas);
+    options.setBuildChoiceLabels();
+    std::shared_ptr<storm::models::sparse::Smg<double>> smg = storm::api::buildSparseModel<double>(program, options)->as<storm::models::sparse::Smg<double>>();
+    ASSERT_EQ(5ul, smg->getNumberOfStates());
+
+    typename storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>>::Options bisimulationOptions(*smg, formulas);
+    storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>> bisim(*smg, bisimulationOptions);
+    ASSERT_NO_THROW(bisim.computeBisimulationDecomposition());
+    std::shared_ptr<storm::models::sparse::Smg<double>> quotient;
+    ASSERT_NO_THROW(quotient = bisim.getQuotient());
+
+    // The two lanes are merged, but the differently labeled choices leading to them are not.
+    EXPECT_EQ(storm::models::ModelType::Smg, quotient->getType());
+    EXPECT_EQ(4ul, quotient->getNumberOfStates());
+    EXPECT_EQ(5ul, quotient->getNumberOfChoices());
+    EXPECT_EQ(smg->getPlayerNameToIndexMap(), quotient->getPlayerNameToIndexMap());
+    ASSERT_TRUE(quotient->hasChoiceLabeling());
+
+    std::vector<uint_fast64_t> stateMapping = bisim.getQuotientStateMapping();
+    std::vector<uint_fast64_t> const& choiceMapping = bisim.getQuotientChoiceMapping();
+    ASSERT_EQ(smg->getNumberOfChoices(), choiceMapping.size());
+    for (uint_fast64_t state = 0; state < smg->getNumberOfStates(); ++state) {
+        EXPECT_EQ(smg->getPlayerOfState(state), quotient->getPlayerOfState(stateMapping[state]));
+        for (auto choice = smg->getTransitionMatrix().getRowGroupIndices()[state]; choice < smg->getTransitionMatrix().getRowGroupIndices()[state + 1]; ++choice) {
+            EXPECT_EQ(smg->getChoiceLabeling().getLabelsOfChoice(choice), quotient->getChoiceLabeling().getLabelsOfChoice(choiceMapping[choice]));
+        }
+    }
+
+    // Values computed on the quotient lift back to the original game.
+    storm::Environment env;
+    storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> checker(*smg);
+    storm::modelchecker::SparseSmgRpatlModelChecker<storm::models::sparse::Smg<double>> quotientChecker(*quotient);
+    auto result = checker.check(env, storm::api::createTask<double>(formulas.front(), false));
+    auto quotientResult = quotientChecker.check(env, storm::api::createTask<double>(formulas.front(), false));
+    std::vector<double> liftedValues = bisim.liftStateValues(quotientResult->asExplicitQuantitativeCheckResult<double>().getValueVector());
+    for (uint_fast64_t state = 0; state < smg->getNumberOfStates(); ++state) {
+        EXPECT_NEAR(result->asExplicitQuantitativeCheckResult<double>().getValueVector()[state], liftedValues[state], 1e-6);
+    }
+    EXPECT_NEAR(0.6, liftedValues[*smg->getInitialStates().begin()], 1e-6);
+
+    // A shield of the quotient that only allows going left lifts to the original game.
+    uint_fast64_t initialState = *smg->getInitialStates().begin();
+    uint_fast64_t quotientInitialState = stateMapping[initialState];
+    storm::storage::PreScheduler<double> quotientShield(quotient->getNumberOfStates());
+    for (uint_fast64_t localChoice = 0; localChoice < quotient->getTransitionMatrix().getRowGroupSize(quotientInitialState); ++localChoice) {
+        if (quotient->getChoiceLabeling().getChoiceHasLabel("left", quotient->getTransitionMatrix().getRowGroupIndices()[quotientInitialState] + localChoice)) {
+            storm::storage::PreSchedulerChoice<double> choice;
+            choice.addChoice(localChoice, 0.6);
+            quotientShield.setChoice(choice, quotientInitialState, 0);
+        }
+    }
+    storm::storage::PreScheduler<double> shield = storm::api::liftPreShield(bisim, *smg, quotientShield);
+    auto const& allowedChoices = shield.getChoice(initialState).getChoiceMap();
+    ASSERT_EQ(1ul, allowedChoices.size());
+    EXPECT_TRUE(smg->getChoiceLabeling().getChoiceHasLabel("left", smg->getTransitionMatrix().getRowGroupIndices()[initialState] + std::get<1>(allowedChoices.front())));
+}
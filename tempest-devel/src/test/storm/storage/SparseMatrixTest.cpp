@@ -792,3 +792,22 @@ TEST(SparseMatrix, Permute) {
     EXPECT_EQ(matrix.getRowSum(3), matrixperm.getRowSum(3));
     EXPECT_EQ(matrix.getRowSum(2), matrixperm.getRowSum(4));
 }
+
+TEST(SparseMatrix, CompressedRowStorage) {
+    storm::storage::SparseMatrixBuilder<double> matrixBuilder(4, 3, 5, true, true, 2);
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(0, 1, 1.0));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 0, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(1, 2, 0.5));
+    ASSERT_NO_THROW(matrixBuilder.newRowGroup(3));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 0, 0.2));
+    ASSERT_NO_THROW(matrixBuilder.addNextValue(3, 1, 0.8));
+    storm::storage::SparseMatrix<double> matrix;
+    ASSERT_NO_THROW(matrix = matrixBuilder.build());
+
+    EXPECT_EQ(std::vector<uint64_t>({0, 1, 3, 3, 5}), matrix.getRowIndications());
+    EXPECT_EQ(std::vector<uint64_t>({0, 3, 4}), matrix.getRowGroupIndices());
+    ASSERT_EQ(5ul, matrix.getColumnsAndValues().size());
+    EXPECT_EQ(2ul, matrix.getColumnsAndValues()[2].getColumn());
+    EXPECT_EQ(0.2, matrix.getColumnsAndValues()[3].getValue());
+}
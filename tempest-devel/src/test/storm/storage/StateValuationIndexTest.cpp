@@ -0,0 +1,89 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/sparse/StateValuationIndex.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace {
+    storm::storage::sparse::StateValuations buildValuations(storm::expressions::ExpressionManager& manager) {
+        storm::storage::sparse::StateValuationsBuilder builder;
+        builder.addVariable(manager.declareBooleanVariable("b"));
+        builder.addVariable(manager.declareIntegerVariable("x"));
+        builder.addVariable(manager.declareIntegerVariable("clock"));
+        builder.addState(0, {false}, {0, 0});
+        builder.addState(1, {false}, {0, 1});
+        builder.addState(2, {true}, {1, 0});
+        builder.addState(3, {false}, {-3, 0});
+        builder.addState(4, {false}, {0, 2});
+        return builder.build(5);
+    }
+
+    TEST(StateValuationIndexTest, AllVariables) {
+        storm::expressions::ExpressionManager manager;
+        auto valuations = buildValuations(manager);
+        storm::storage::sparse::StateValuationIndex index(valuations);
+        ASSERT_EQ(3ul, index.getVariables().size());
+        EXPECT_EQ(5ul, index.getNumberOfKeys());
+
+        for (uint64_t state = 0; state < 5; ++state) {
+            std::vector<int64_t> values;
+            for (auto const& variable : index.getVariables()) {
+                values.push_back(variable.hasBooleanType() ? valuations.getBooleanValue(state, variable) : valuations.getIntegerValue(state, variable));
+            }
+            EXPECT_EQ(state, index.getState(values.data()));
+        }
+    }
+
+    TEST(StateValuationIndexTest, Projection) {
+        storm::expressions::ExpressionManager manager;
+        auto valuations = buildValuations(manager);
+        storm::storage::sparse::StateValuationIndex index(valuations, std::vector<std::string>({"x", "b"}));
+        EXPECT_EQ(std::vector<std::string>({"x", "b"}), index.getVariableNames());
+        EXPECT_EQ(3ul, index.getNumberOfKeys());
+
+        // The states that only differ in the clock share their projection.
+        int64_t values[] = {0, 0, 1, 1, -3, 0, 5, 0, 1, 0, 0, 2};
+        auto range = index.getStates(values);
+        EXPECT_EQ(std::vector<uint64_t>({0, 1, 4}), std::vector<uint64_t>(range.first, range.second));
+
+        uint64_t states[6];
+        index.getStates(values, 6, states);
+        uint64_t const unknown = storm::storage::sparse::StateValuationIndex::UNKNOWN_STATE;
+        EXPECT_EQ(std::vector<uint64_t>({0, 2, 3, unknown, unknown, unknown}), std::vector<uint64_t>(states, states + 6));
+
+        STORM_SILENT_EXPECT_THROW(storm::storage::sparse::StateValuationIndex(valuations, std::vector<std::string>({"y"})), storm::exceptions::InvalidArgumentException);
+    }
+
+    TEST(StateValuationIndexTest, WideLayout) {
+        // The first variable needs all 64 bits, so the constant ones are placed past the last bit of the key.
+        storm::expressions::ExpressionManager manager;
+        storm::storage::sparse::StateValuationsBuilder builder;
+        builder.addVariable(manager.declareBooleanVariable("b"));
+        builder.addVariable(manager.declareIntegerVariable("x"));
+        builder.addVariable(manager.declareIntegerVariable("c"));
+        int64_t const minimum = std::numeric_limits<int64_t>::min();
+        int64_t const maximum = std::numeric_limits<int64_t>::max();
+        builder.addState(0, {false}, {minimum, 7});
+        builder.addState(1, {false}, {0, 7});
+        builder.addState(2, {false}, {maximum, 7});
+        auto valuations = builder.build(3);
+        storm::storage::sparse::StateValuationIndex index(valuations, std::vector<std::string>({"x", "c", "b"}));
+        EXPECT_EQ(3ul, index.getNumberOfKeys());
+        int64_t values[] = {minimum, 7, 0, 0, 7, 0, maximum, 7, 0, 0, 6, 0, 0, 7, 1};
+        uint64_t states[5];
+        index.getStates(values, 5, states);
+        uint64_t const unknown = storm::storage::sparse::StateValuationIndex::UNKNOWN_STATE;
+        EXPECT_EQ(std::vector<uint64_t>({0, 1, 2, unknown, unknown}), std::vector<uint64_t>(states, states + 5));
+
+        // One more bit does not fit into the key.
+        storm::storage::sparse::StateValuationsBuilder wideBuilder;
+        wideBuilder.addVariable(manager.getVariable("b"));
+        wideBuilder.addVariable(manager.getVariable("x"));
+        wideBuilder.addState(0, {false}, {minimum});
+        wideBuilder.addState(1, {true}, {maximum});
+        STORM_SILENT_EXPECT_THROW(storm::storage::sparse::StateValuationIndex(wideBuilder.build(2)), storm::exceptions::NotSupportedException);
+    }
+}
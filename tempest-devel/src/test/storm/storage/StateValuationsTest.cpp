@@ -0,0 +1,77 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include <cstring>
+
+#include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+    template<typename IntegerType>
+    IntegerType getColumnEntry(std::pair<void const*, uint64_t> const& column, uint64_t state) {
+        EXPECT_EQ(sizeof(IntegerType), column.second);
+        IntegerType value;
+        std::memcpy(&value, static_cast<uint8_t const*>(column.first) + state * sizeof(IntegerType), sizeof(IntegerType));
+        return value;
+    }
+
+    TEST(StateValuationsTest, Columns) {
+        storm::expressions::ExpressionManager manager;
+        auto b = manager.declareBooleanVariable("b");
+        auto x = manager.declareIntegerVariable("x");
+        auto y = manager.declareIntegerVariable("y");
+        storm::storage::sparse::StateValuationsBuilder builder;
+        builder.addVariable(b);
+        builder.addVariable(x, -3, 100);
+        builder.addVariable(y, 0, 1000);
+        builder.addState(0, {true}, {-3, 1000});
+        builder.addState(2, {false}, {100, 7});
+        STORM_SILENT_EXPECT_THROW(builder.addState(3, {true}, {0}), storm::exceptions::InvalidArgumentException);
+        auto valuations = builder.build(3);
+
+        ASSERT_EQ(3ul, valuations.getNumberOfStates());
+        EXPECT_FALSE(valuations.isEmpty(0));
+        EXPECT_TRUE(valuations.isEmpty(1));
+        EXPECT_FALSE(valuations.isEmpty(2));
+        EXPECT_TRUE(valuations.getBooleanValue(0, b));
+        EXPECT_EQ(-3, valuations.getIntegerValue(0, x));
+        EXPECT_EQ(1000, valuations.getIntegerValue(0, y));
+        EXPECT_EQ(100, valuations.getIntegerValue(2, x));
+        EXPECT_EQ("[b\t& x=-3\t& y=1000]", valuations.toString(0));
+
+        auto booleanColumn = valuations.getColumn(b);
+        EXPECT_EQ(1ul, booleanColumn.second);
+        EXPECT_EQ(std::vector<uint8_t>({1, 0, 0}), std::vector<uint8_t>(static_cast<uint8_t const*>(booleanColumn.first), static_cast<uint8_t const*>(booleanColumn.first) + 3));
+        EXPECT_EQ(-3, getColumnEntry<int8_t>(valuations.getColumn(x), 0));
+        EXPECT_EQ(100, getColumnEntry<int8_t>(valuations.getColumn(x), 2));
+        EXPECT_EQ(1000, getColumnEntry<int16_t>(valuations.getColumn(y), 0));
+        EXPECT_EQ(7, getColumnEntry<int16_t>(valuations.getColumn(y), 2));
+    }
+
+    TEST(StateValuationsTest, Widening) {
+        storm::expressions::ExpressionManager manager;
+        auto x = manager.declareIntegerVariable("x");
+        storm::storage::sparse::StateValuationsBuilder builder;
+        builder.addVariable(x);
+        builder.addState(0, {}, {5});
+        builder.addState(1, {}, {-200});
+        builder.addState(2, {}, {1ll << 40});
+        auto valuations = builder.build(3);
+
+        EXPECT_EQ(5, getColumnEntry<int64_t>(valuations.getColumn(x), 0));
+        EXPECT_EQ(-200, valuations.getIntegerValue(1, x));
+        EXPECT_EQ(1ll << 40, valuations.getIntegerValue(2, x));
+
+        auto selected = valuations.selectStates(std::vector<uint64_t>({2, 7, 0}));
+        ASSERT_EQ(3ul, selected.getNumberOfStates());
+        EXPECT_EQ(1ll << 40, selected.getIntegerValue(0, x));
+        EXPECT_TRUE(selected.isEmpty(1));
+        EXPECT_EQ(5, selected.getIntegerValue(2, x));
+
+        auto blownUp = valuations.blowup({1, 1, 0});
+        EXPECT_EQ(-200, blownUp.getIntegerValue(0, x));
+        EXPECT_EQ(-200, blownUp.getIntegerValue(1, x));
+        EXPECT_EQ(5, blownUp.getIntegerValue(2, x));
+    }
+}
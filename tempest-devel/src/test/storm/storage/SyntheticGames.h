@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+    namespace test {
+
+        /*!
+         * Builds a synthetic game consisting of nested rings of states. Each ring state may move along its ring or drop
+         * into the next inner ring, so only the innermost ring can not be left. Additionally, each level has a closed
+         * pocket of two states that is reachable from the first state of every ring but the innermost one.
+         * The game has numberOfLevels + 1 MECs.
+         */
+        inline storm::storage::SparseMatrix<double> buildNestedRingGame(uint64_t numberOfLevels, uint64_t ringSize) {
+            uint64_t statesPerLevel = ringSize + 2;
+            uint64_t numberOfStates = numberOfLevels * statesPerLevel;
+            storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true);
+            uint64_t row = 0;
+            for (uint64_t level = 0; level < numberOfLevels; ++level) {
+                uint64_t offset = level * statesPerLevel;
+                for (uint64_t k = 0; k < ringSize; ++k) {
+                    builder.newRowGroup(row);
+                    builder.addNextValue(row++, offset + (k + 1) % ringSize, 1.0);
+                    if (level + 1 < numberOfLevels) {
+                        builder.addNextValue(row, offset + k, 0.5);
+                        builder.addNextValue(row++, offset + statesPerLevel + k, 0.5);
+                    } else {
+                        builder.addNextValue(row++, offset + (k + ringSize - 1) % ringSize, 1.0);
+                    }
+                    if (k == 0 && level + 1 < numberOfLevels) {
+                        builder.addNextValue(row++, offset + ringSize, 1.0);
+                    }
+                }
+                builder.newRowGroup(row);
+                builder.addNextValue(row++, offset + ringSize + 1, 1.0);
+                builder.newRowGroup(row);
+                builder.addNextValue(row, offset + ringSize, 0.5);
+                builder.addNextValue(row++, offset + ringSize + 1, 0.5);
+            }
+            return builder.build();
+        }
+
+        /*!
+         * Builds a synthetic game with one long ring that can be traversed in both directions. The first numberOfPockets ring
+         * states may enter a closed pocket of pocketSize states and the first ring state may leave to an absorbing state.
+         * Hence, the ring itself is no MEC, but every pocket and the absorbing state are.
+         */
+        inline storm::storage::SparseMatrix<double> buildPocketGame(uint64_t ringSize, uint64_t numberOfPockets, uint64_t pocketSize) {
+            uint64_t absorbingState = ringSize;
+            uint64_t firstPocketState = ringSize + 1;
+            uint64_t numberOfStates = firstPocketState + numberOfPockets * pocketSize;
+            storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true);
+            uint64_t row = 0;
+            for (uint64_t k = 0; k < ringSize; ++k) {
+                builder.newRowGroup(row);
+                builder.addNextValue(row++, (k + 1) % ringSize, 1.0);
+                builder.addNextValue(row++, (k + ringSize - 1) % ringSize, 1.0);
+                if (k == 0) {
+                    builder.addNextValue(row++, absorbingState, 1.0);
+                }
+                if (k < numberOfPockets) {
+                    builder.addNextValue(row++, firstPocketState + k * pocketSize, 1.0);
+                }
+            }
+            builder.newRowGroup(row);
+            builder.addNextValue(row++, absorbingState, 1.0);
+            for (uint64_t pocket = 0; pocket < numberOfPockets; ++pocket) {
+                uint64_t offset = firstPocketState + pocket * pocketSize;
+                for (uint64_t k = 0; k < pocketSize; ++k) {
+                    builder.newRowGroup(row);
+                    builder.addNextValue(row++, offset + (k + 1) % pocketSize, 1.0);
+                    builder.addNextValue(row, offset + k, 0.5);
+                    builder.addNextValue(row++, offset + (k + pocketSize - 1) % pocketSize, 0.5);
+                }
+            }
+            return builder.build();
+        }
+
+        /*!
+         * Builds a random game whose states are partitioned into blocks of blockSize states. Each state has one to three
+         * choices with one or two successors. Successors are drawn from the block of the state and only with the given
+         * probability from the whole game, so many blocks contain (nested) end components.
+         */
+        inline storm::storage::SparseMatrix<double> buildRandomBlockGame(uint64_t numberOfStates, uint64_t blockSize, double leaveProbability, uint64_t seed) {
+            std::mt19937_64 generator(seed);
+            std::uniform_int_distribution<uint64_t> numberDistribution(0, 2);
+            std::bernoulli_distribution leaveDistribution(leaveProbability);
+            storm::storage::SparseMatrixBuilder<double> builder(0, numberOfStates, 0, false, true);
+            uint64_t row = 0;
+            for (uint64_t state = 0; state < numberOfStates; ++state) {
+                builder.newRowGroup(row);
+                uint64_t blockStart = state - state % blockSize;
+                uint64_t blockEnd = std::min(blockStart + blockSize, numberOfStates);
+                uint64_t numberOfChoices = 1 + numberDistribution(generator);
+                for (uint64_t choice = 0; choice < numberOfChoices; ++choice) {
+                    std::vector<uint64_t> successors;
+                    uint64_t numberOfSuccessors = 1 + numberDistribution(generator) % 2;
+                    for (uint64_t k = 0; k < numberOfSuccessors; ++k) {
+                        if (leaveDistribution(generator)) {
+                            successors.push_back(std::uniform_int_distribution<uint64_t>(0, numberOfStates - 1)(generator));
+                        } else {
+                            successors.push_back(std::uniform_int_distribution<uint64_t>(blockStart, blockEnd - 1)(generator));
+                        }
+                    }
+                    std::sort(successors.begin(), successors.end());
+                    successors.erase(std::unique(successors.begin(), successors.end()), successors.end());
+                    for (auto successor : successors) {
+                        builder.addNextValue(row, successor, 1.0 / successors.size());
+                    }
+                    ++row;
+                }
+            }
+            return builder.build();
+        }
+    }
+}
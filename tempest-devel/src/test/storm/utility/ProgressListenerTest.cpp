@@ -0,0 +1,110 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#include "storm/api/builder.h"
+#include "storm/api/verification.h"
+#include "storm/api/properties.h"
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/exceptions/AbortException.h"
+#include "storm/environment/Environment.h"
+#include "storm/modelchecker/results/CheckResult.h"
+#include "storm/utility/ProgressListener.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/parallel.h"
+
+#include <atomic>
+#include <thread>
+
+namespace {
+    class ProgressListenerTest : public ::testing::Test {
+    protected:
+        void SetUp() override {
+            program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/smg/rightDecision.nm");
+            storm::utility::progress::setProgressCallback([this] (storm::utility::progress::ProgressInformation const& information) { reports.push_back(information); }, 0);
+        }
+
+        void TearDown() override {
+            storm::utility::progress::resetProgressCallback();
+            storm::utility::resources::SignalInformation::infos().setTerminate(false);
+        }
+
+        storm::prism::Program program;
+        std::vector<storm::utility::progress::ProgressInformation> reports;
+    };
+
+    TEST_F(ProgressListenerTest, ExplorationAndSolving) {
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("<<hiker, native>> Pmax=? [ F lost=1 ]", program));
+        auto model = storm::api::buildSparseModel<double>(program, formulas);
+        ASSERT_FALSE(reports.empty());
+        EXPECT_EQ(model->getNumberOfStates(), reports.back().numberOfExploredStates);
+        for (uint64_t index = 1; index < reports.size(); ++index) {
+            EXPECT_EQ(storm::utility::progress::ProgressPhase::Exploration, reports[index].phase);
+            EXPECT_LT(reports[index - 1].numberOfExploredStates, reports[index].numberOfExploredStates);
+        }
+
+        reports.clear();
+        storm::Environment env;
+        storm::api::verifyWithSparseEngine<double>(env, model, storm::api::createTask<double>(formulas.front(), false));
+        ASSERT_FALSE(reports.empty());
+        EXPECT_EQ(storm::utility::progress::ProgressPhase::Solving, reports.back().phase);
+        EXPECT_GT(reports.back().iteration, 0ul);
+        EXPECT_GE(reports.back().residual, 0.0);
+
+        // No reports are made once the callback is removed.
+        reports.clear();
+        storm::utility::progress::resetProgressCallback();
+        storm::api::buildSparseModel<double>(program, formulas);
+        EXPECT_TRUE(reports.empty());
+    }
+
+    TEST_F(ProgressListenerTest, Delay) {
+        storm::utility::progress::setProgressCallback([this] (storm::utility::progress::ProgressInformation const& information) { reports.push_back(information); }, 1000000);
+        for (uint64_t states = 1; states <= 100; ++states) {
+            storm::utility::progress::reportExploredStates(states);
+        }
+        ASSERT_EQ(1ul, reports.size());
+        EXPECT_EQ(1ul, reports.front().numberOfExploredStates);
+        EXPECT_FALSE(storm::utility::progress::isProgressReportDue());
+    }
+
+    TEST_F(ProgressListenerTest, Cancellation) {
+        // The callback requests termination, which aborts the exploration.
+        storm::utility::progress::setProgressCallback([] (storm::utility::progress::ProgressInformation const&) { storm::utility::resources::SignalInformation::infos().setTerminate(true); }, 0);
+        STORM_SILENT_EXPECT_THROW(storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions()), storm::exceptions::AbortException);
+    }
+
+    TEST_F(ProgressListenerTest, Context) {
+        // Reports of computations with a context go to its callback instead of the global one.
+        std::vector<storm::utility::progress::ProgressInformation> contextReports;
+        auto context = std::make_shared<storm::utility::progress::ProgressContext>([&contextReports] (storm::utility::progress::ProgressInformation const& information) { contextReports.push_back(information); }, 0);
+        {
+            storm::utility::progress::ProgressContextScope scope(context);
+            EXPECT_EQ(context, storm::utility::progress::getProgressContext());
+            storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions());
+        }
+        EXPECT_FALSE(contextReports.empty());
+        EXPECT_TRUE(reports.empty());
+        EXPECT_EQ(nullptr, storm::utility::progress::getProgressContext());
+
+        // Cancelling the context only stops its computations, also on the threads they start.
+        context->cancel();
+        {
+            storm::utility::progress::ProgressContextScope scope(context);
+            STORM_SILENT_EXPECT_THROW(storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions()), storm::exceptions::AbortException);
+            std::atomic<uint64_t> numberOfCancelledBlocks(0);
+            storm::utility::parallel::forEachBlock(4, 4, 1, [&numberOfCancelledBlocks] (uint64_t, uint64_t) {
+                if (storm::utility::resources::isTerminate()) {
+                    ++numberOfCancelledBlocks;
+                }
+            });
+            EXPECT_EQ(4ul, numberOfCancelledBlocks.load());
+        }
+        EXPECT_FALSE(storm::utility::resources::isTerminate());
+        bool otherThreadTerminated = true;
+        std::thread([&otherThreadTerminated] () { otherThreadTerminated = storm::utility::resources::isTerminate(); }).join();
+        EXPECT_FALSE(otherThreadTerminated);
+        EXPECT_NO_THROW(storm::api::buildSparseModel<double>(program, storm::builder::BuilderOptions()));
+    }
+}
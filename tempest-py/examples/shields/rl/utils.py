@@ -29,7 +29,7 @@ class ShieldHandler(ABC):
         pass
 
 class MiniGridShieldHandler(ShieldHandler):
-    def __init__(self, grid_file, grid_to_prism_path, prism_path, formula, shield_value=0.9 ,prism_config=None, shield_comparision='relative') -> None:
+    def __init__(self, grid_file, grid_to_prism_path, prism_path, formula, shield_value=0.9 ,prism_config=None, shield_comparision='relative', model_cache_dir=None) -> None:
         self.grid_file = grid_file
         self.grid_to_prism_path = grid_to_prism_path
         self.prism_path = prism_path
@@ -37,6 +37,7 @@ class MiniGridShieldHandler(ShieldHandler):
         self.prism_config = prism_config
         self.shield_value = shield_value
         self.shield_comparision = shield_comparision
+        self.model_cache_dir = model_cache_dir
     
     def __export_grid_to_text(self, env):
         f = open(self.grid_file, "w")
@@ -74,7 +75,12 @@ class MiniGridShieldHandler(ShieldHandler):
         options.set_build_state_valuations(True)
         options.set_build_choice_labels(True)
         options.set_build_all_labels()
-        model = stormpy.build_sparse_model_with_options(program, options)
+        if self.model_cache_dir is None:
+            model = stormpy.build_sparse_model_with_options(program, options)
+        else:
+            # Identical grids and formulas yield identical games, so load them from the cache instead of building them again.
+            os.makedirs(self.model_cache_dir, exist_ok=True)
+            model = stormpy.build_sparse_model_with_cache(program, options, self.model_cache_dir)
         
         result = stormpy.model_checking(model, formulas[0], extract_scheduler=True, shield_expression=shield_specification)
         
@@ -1,3 +1,4 @@
+import contextlib
 import sys
 
 if sys.version_info[0] == 2:
@@ -42,6 +43,8 @@ def _convert_sparse_model(model, parametric=False):
             return model._as_sparse_pctmc()
         elif model.model_type == ModelType.MA:
             return model._as_sparse_pma()
+        elif model.model_type == ModelType.SMG:
+            return model._as_sparse_psmg()
         else:
             raise StormError("Not supported parametric model constructed")
     else:
@@ -56,6 +59,8 @@ def _convert_sparse_model(model, parametric=False):
             return model._as_sparse_ctmc()
         elif model.model_type == ModelType.MA:
             return model._as_sparse_ma()
+        elif model.model_type == ModelType.SMG:
+            return model._as_sparse_smg()
         else:
             raise StormError("Not supported non-parametric model constructed")
 
@@ -93,15 +98,16 @@ def _convert_symbolic_model(model, parametric=False):
             raise StormError("Not supported non-parametric model constructed")
 
 
-def build_model(symbolic_description, properties=None):
+def build_model(symbolic_description, properties=None, progress_callback=None):
     """
     Build a model in sparse representation from a symbolic description.
 
     :param symbolic_description: Symbolic model description to translate into a model.
     :param List[Property] properties: List of properties that should be preserved during the translation. If None, then all properties are preserved.
+    :param progress_callback: Function that is called with a ProgressInformation at most every 100ms, possibly from another thread.
     :return: Model in sparse representation.
     """
-    return build_sparse_model(symbolic_description, properties=properties)
+    return build_sparse_model(symbolic_description, properties=properties, progress_callback=progress_callback)
 
 
 def build_parametric_model(symbolic_description, properties=None):
@@ -115,12 +121,13 @@ def build_parametric_model(symbolic_description, properties=None):
     return build_sparse_parametric_model(symbolic_description, properties=properties)
 
 
-def build_sparse_model(symbolic_description, properties=None):
+def build_sparse_model(symbolic_description, properties=None, progress_callback=None):
     """
     Build a model in sparse representation from a symbolic description.
 
     :param symbolic_description: Symbolic model description to translate into a model.
     :param List[Property] properties: List of properties that should be preserved during the translation. If None, then all properties are preserved.
+    :param progress_callback: Function that is called with a ProgressInformation at most every 100ms, possibly from another thread.
     :return: Model in sparse representation.
     """
     if not symbolic_description.undefined_constants_are_graph_preserving:
@@ -128,9 +135,9 @@ def build_sparse_model(symbolic_description, properties=None):
 
     if properties:
         formulae = [(prop.raw_formula if isinstance(prop, Property) else prop) for prop in properties]
-        intermediate = core._build_sparse_model_from_symbolic_description(symbolic_description, formulae)
+        intermediate = core._build_sparse_model_from_symbolic_description(symbolic_description, formulae, progress_callback=progress_callback)
     else:
-        intermediate = core._build_sparse_model_from_symbolic_description(symbolic_description)
+        intermediate = core._build_sparse_model_from_symbolic_description(symbolic_description, progress_callback=progress_callback)
     return _convert_sparse_model(intermediate, parametric=False)
 
 
@@ -241,6 +248,29 @@ def perform_sparse_bisimulation(model, properties, bisimulation_type):
         return core._perform_bisimulation(model, formulae, bisimulation_type)
 
 
+def compute_game_bisimulation(model, properties, bisimulation_type=BisimulationType.STRONG):
+    """
+    Compute the bisimulation decomposition of an SMG. Only states of the same player and equally labeled choices are merged.
+    :param model: SMG in sparse representation.
+    :param properties: Properties to preserve during bisimulation.
+    :param bisimulation_type: Type of bisimulation (only strong is supported).
+    :return: Decomposition providing the quotient and the mappings to the quotient.
+    """
+    formulae = [(prop.raw_formula if isinstance(prop, Property) else prop) for prop in properties]
+    return core._compute_game_bisimulation_decomposition(model, formulae, bisimulation_type)
+
+
+def lift_pre_shield(decomposition, model, quotient_shield):
+    """
+    Lift a pre-shield computed on the quotient of a game bisimulation to the original game.
+    :param decomposition: Decomposition returned by compute_game_bisimulation.
+    :param model: The original SMG.
+    :param quotient_shield: Pre-scheduler constructed from a shield of the quotient.
+    :return: Pre-scheduler for the original game.
+    """
+    return core._lift_pre_shield(decomposition, model, quotient_shield)
+
+
 def perform_symbolic_bisimulation(model, properties):
     """
     Perform bisimulation on model in symbolic representation.
@@ -256,19 +286,22 @@ def perform_symbolic_bisimulation(model, properties):
         return core._perform_symbolic_bisimulation(model, formulae, bisimulation_type)
 
 
-def model_checking(model, property, only_initial_states=False, extract_scheduler=False, force_fully_observable=False, environment=Environment(), shield_expression=None):
+def model_checking(model, property, only_initial_states=False, extract_scheduler=False, force_fully_observable=False, environment=Environment(), shield_expression=None, progress_callback=None, cancellation_token=None):
     """
     Perform model checking on model for property.
     :param model: Model.
     :param property: Property to check for.
     :param only_initial_states: If True, only results for initial states are computed, otherwise for all states.
     :param extract_scheduler: If True, try to extract a scheduler
+    :param progress_callback: Function that is called with a ProgressInformation at most every 100ms, possibly from another thread (sparse models only).
+    :param cancellation_token: CancellationToken; if it is cancelled before or during model checking (and not reset), a StormError is raised instead of returning a result (sparse models only).
     :return: Model checking result.
     :rtype: CheckResult
     """
     if model.is_sparse_model:
         return check_model_sparse(model, property, only_initial_states=only_initial_states,
-                                  extract_scheduler=extract_scheduler, force_fully_observable=force_fully_observable, environment=environment, shield_expression=shield_expression)
+                                  extract_scheduler=extract_scheduler, force_fully_observable=force_fully_observable, environment=environment, shield_expression=shield_expression,
+                                  progress_callback=progress_callback, cancellation_token=cancellation_token)
     else:
         assert (model.is_symbolic_model)
         if extract_scheduler:
@@ -277,17 +310,36 @@ def model_checking(model, property, only_initial_states=False, extract_scheduler
                               environment=environment)
 
 
-def check_model_sparse(model, property, only_initial_states=False, extract_scheduler=False, force_fully_observable=False, environment=Environment(), shield_expression=None):
+@contextlib.contextmanager
+def _cancellable(cancellation_token):
+    try:
+        yield
+    except RuntimeError:
+        # Cancelled computations raise an error instead of returning their incomplete results.
+        if cancellation_token is not None and cancellation_token.cancelled:
+            raise StormError("The computation was cancelled")
+        raise
+
+
+def check_model_sparse(model, property, only_initial_states=False, extract_scheduler=False, force_fully_observable=False, environment=Environment(), shield_expression=None, progress_callback=None, cancellation_token=None):
     """
     Perform model checking on model for property.
+    The GIL is released during model checking, so that other Python threads continue to run.
     :param model: Model.
     :param property: Property to check for.
     :param only_initial_states: If True, only results for initial states are computed, otherwise for all states.
     :param extract_scheduler: If True, try to extract a scheduler
     :param force_fully_observable: If True, treat a POMDP as an MDP
+    :param progress_callback: Function that is called with a ProgressInformation at most every 100ms, possibly from another thread.
+    :param cancellation_token: CancellationToken; if it is cancelled before or during model checking (and not reset), a StormError is raised instead of returning a result.
     :return: Model checking result.
     :rtype: CheckResult
     """
+    with _cancellable(cancellation_token):
+        return _check_model_sparse(model, property, only_initial_states, extract_scheduler, force_fully_observable, environment, shield_expression, progress_callback, cancellation_token)
+
+
+def _check_model_sparse(model, property, only_initial_states, extract_scheduler, force_fully_observable, environment, shield_expression, progress_callback, cancellation_token):
     if isinstance(property, Property):
         formula = property.raw_formula
     else:
@@ -301,24 +353,24 @@ def check_model_sparse(model, property, only_initial_states=False, extract_sched
             elif model.is_exact:
                 task = core.ExactCheckTask(formula, only_initial_states)
                 task.set_produce_schedulers(extract_scheduler)
-                return core._exact_model_checking_fully_observable(model, task, environment=environment)
+                return core._exact_model_checking_fully_observable(model, task, environment=environment, progress_callback=progress_callback, cancellation_token=cancellation_token)
             else:
                 task = core.CheckTask(formula, only_initial_states)
                 task.set_produce_schedulers(extract_scheduler)
-                return core._model_checking_fully_observable(model, task, environment=environment)
+                return core._model_checking_fully_observable(model, task, environment=environment, progress_callback=progress_callback, cancellation_token=cancellation_token)
         else:
             raise RuntimeError("Forcing models that are fully observable is not possible")
 
     if model.supports_parameters:
         task = core.ParametricCheckTask(formula, only_initial_states)
         task.set_produce_schedulers(extract_scheduler)
-        return core._parametric_model_checking_sparse_engine(model, task, environment=environment)
+        return core._parametric_model_checking_sparse_engine(model, task, environment=environment, progress_callback=progress_callback, cancellation_token=cancellation_token)
     else:
 
         if model.is_exact:
             task = core.ExactCheckTask(formula, only_initial_states)
             task.set_produce_schedulers(extract_scheduler)
-            return core._exact_model_checking_sparse_engine(model, task, environment=environment)
+            return core._exact_model_checking_sparse_engine(model, task, environment=environment, progress_callback=progress_callback, cancellation_token=cancellation_token)
         else:
             task = core.CheckTask(formula, only_initial_states)
             task.set_produce_schedulers(extract_scheduler)
@@ -326,7 +378,45 @@ def check_model_sparse(model, property, only_initial_states=False, extract_sched
             if shield_expression is not None:
                 task.set_shielding_expression(shield_expression)            
 
-            return core._model_checking_sparse_engine(model, task, environment=environment)
+            return core._model_checking_sparse_engine(model, task, environment=environment, progress_callback=progress_callback, cancellation_token=cancellation_token)
+
+
+def model_checking_all(model, properties, only_initial_states=False, extract_scheduler=False, environment=Environment(), shield_expressions=None, number_of_threads=0, progress_callback=None, cancellation_token=None):
+    """
+    Perform model checking of several properties on one sparse model.
+    The properties are checked concurrently and the satisfaction sets of common state subformulas are only computed once.
+    :param model: Sparse model.
+    :param properties: Properties to check for.
+    :param only_initial_states: If True, only results for initial states are computed, otherwise for all states.
+    :param extract_scheduler: If True, try to extract schedulers
+    :param shield_expressions: A shield expression for all properties or a list with a shield expression (or None) per property.
+    :param number_of_threads: Number of threads, if zero one thread per property up to the number of hardware threads.
+    :param progress_callback: Function that is called with a ProgressInformation at most every 100ms, possibly from another thread.
+    :param cancellation_token: CancellationToken; if it is cancelled before or during model checking (and not reset), a StormError is raised instead of returning results.
+    :return: Model checking results in the order of the properties.
+    :rtype: list of CheckResult
+    """
+    if not model.is_sparse_model or model.supports_parameters:
+        raise NotImplementedError("Checking several properties at once is only supported for sparse models without parameters.")
+    if shield_expressions is None or not isinstance(shield_expressions, (list, tuple)):
+        shield_expressions = [shield_expressions] * len(properties)
+    if len(shield_expressions) != len(properties):
+        raise ValueError("Expected one shield expression per property.")
+
+    tasks = []
+    for property, shield_expression in zip(properties, shield_expressions):
+        formula = property.raw_formula if isinstance(property, Property) else property
+        task = core.ExactCheckTask(formula, only_initial_states) if model.is_exact else core.CheckTask(formula, only_initial_states)
+        task.set_produce_schedulers(extract_scheduler)
+        if shield_expression is not None:
+            task.set_shielding_expression(shield_expression)
+        tasks.append(task)
+
+    with _cancellable(cancellation_token):
+        if model.is_exact:
+            return core._exact_model_checking_sparse_engine_multiple(model, tasks, environment=environment, number_of_threads=number_of_threads, progress_callback=progress_callback, cancellation_token=cancellation_token)
+        else:
+            return core._model_checking_sparse_engine_multiple(model, tasks, environment=environment, number_of_threads=number_of_threads, progress_callback=progress_callback, cancellation_token=cancellation_token)
 
 
 def check_model_dd(model, property, only_initial_states=False, environment=Environment()):
@@ -63,4 +63,8 @@ prism_smg_robot = _path("smg", "robotics_planning.prism")
 prism_smg_controller = _path("smg", "robot_controller.prism")
 
 """Safety Shield Synthesis"""
-prism_smg_shield_synth = _path("smg", "safety_shield_robot.prism")
\ No newline at end of file
+prism_smg_shield_synth = _path("smg", "safety_shield_robot.prism")
+"""Shield Counterexample Example"""
+prism_smg_slippery_corridor = _path("smg", "slippery_corridor.prism")
+"""Parametric SMG Example"""
+prism_psmg_slippery_corridor = _path("psmg", "slippery_corridor.nm")
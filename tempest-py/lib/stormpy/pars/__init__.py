@@ -29,6 +29,8 @@ class ModelInstantiator:
             self._instantiator = PCtmcInstantiator(model)
         elif model.model_type == ModelType.MA:
             self._instantiator = PMaInstantiator(model)
+        elif model.model_type == ModelType.SMG:
+            self._instantiator = PSmgInstantiator(model)
         else:
             raise StormError("Model type {} not supported".format(model.model_type))
 
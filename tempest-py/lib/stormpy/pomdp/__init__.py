@@ -75,4 +75,21 @@ def create_observation_trace_unfolder(model, risk_assessment, expr_manager):
     if model.is_exact:
         return pomdp.ObservationTraceUnfolderExact(model, risk_assessment, expr_manager)
     else:
-        return pomdp.ObservationTraceUnfolderDouble(model, risk_assessment, expr_manager)
\ No newline at end of file
+        return pomdp.ObservationTraceUnfolderDouble(model, risk_assessment, expr_manager)
+
+def synthesize_belief_support_shield(model, formula, lookahead=0, options=None):
+    """
+    Compute a safety shield for a canonic POMDP that is keyed by the observation and the belief support.
+    The winning region for the qualitative reach-avoid formula (e.g. Pmax=? [!"bad" U "goal"]) is computed by the SAT-based iterative policy search.
+
+    :param model: A canonic POMDP
+    :param formula: A probability operator formula
+    :param lookahead: Lookahead of the search, 0 for the number of states
+    :param options: IterativeQualitativeSearchOptions
+    :return: A belief support shield, use shield.create_tracker() to track the belief support at runtime
+    """
+    if model.is_exact or model.supports_parameters:
+        raise NotImplementedError("Belief support shields are only supported for POMDPs with floating point probabilities")
+    if options is None:
+        options = IterativeQualitativeSearchOptions()
+    return pomdp.synthesize_belief_support_shield_Double(model, formula, options, lookahead)
@@ -31,3 +31,26 @@ def create_shield_action_lookup(model, shield):
         ret[state_valuation] = l
 
     return ret
+
+def evaluate_shield(game, coalition, allowed_choices, bad_states, stop_states=None, options=None):
+    """
+    Estimate the probability that a game reaches a bad state when the coalition is restricted by a shield.
+    Episodes are simulated on all cores until the statistical test in the options stops.
+
+    :param game: A sparse SMG.
+    :param coalition: The names of the shielded players.
+    :param allowed_choices: The choices the shield allows, e.g. ShieldActionMasks.allowed_choices.
+    :param bad_states: The states whose reachability is a violation.
+    :param stop_states: The states in which episodes end without a violation.
+    :param options: ShieldEvaluationOptions, defaults are used if not given.
+    :return: A ShieldEvaluationResult.
+    """
+    if options is None:
+        options = ShieldEvaluationOptions()
+    if game.is_exact:
+        evaluator = StatisticalShieldEvaluatorExact(game, coalition, allowed_choices, bad_states)
+    else:
+        evaluator = StatisticalShieldEvaluatorDouble(game, coalition, allowed_choices, bad_states)
+    if stop_states is not None:
+        evaluator.set_stop_states(stop_states)
+    return evaluator.evaluate(options)
@@ -222,3 +222,19 @@ def create_simulator(model, seed = None):
             return SparseSimulator(model, seed)
     else:
         raise NotImplementedError("Currently, we only support simulators for sparse models.")
+
+
+def create_batched_simulator(model, nr_episodes, seed=0):
+    """
+    Factory method for creating a simulator that advances many episodes of a sparse model at once.
+
+    :param model: A sparse model
+    :param nr_episodes: The number of episodes that are simulated in parallel.
+    :param seed: A seed for reproducibility. Each episode uses its own random stream derived from this seed.
+    :return: A batched simulator whose states, rewards and flags are exposed as numpy arrays
+    """
+    if not isinstance(model, stormpy.storage._ModelBase) or not model.is_sparse_model:
+        raise NotImplementedError("Currently, we only support batched simulators for sparse models.")
+    if model.is_exact:
+        return stormpy.core._BatchedSparseModelSimulatorExact(model, nr_episodes, seed)
+    return stormpy.core._BatchedSparseModelSimulatorDouble(model, nr_episodes, seed)
@@ -1,5 +1,6 @@
 #include "bisimulation.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/models/sparse/Smg.h"
 
 
 template <storm::dd::DdType DdType, typename ValueType>
@@ -16,6 +17,18 @@ void define_bisimulation(py::module& m) {
     m.def("_perform_symbolic_bisimulation", &performBisimulationMinimization<storm::dd::DdType::Sylvan, double>, "Perform bisimulation", py::arg("model"), py::arg("formulas"), py::arg("bisimulation_type"));
     m.def("_perform_symbolic_parametric_bisimulation", &performBisimulationMinimization<storm::dd::DdType::Sylvan, storm::RationalFunction>, "Perform bisimulation on parametric model", py::arg("model"), py::arg("formulas"), py::arg("bisimulation_type"));
 
+    // Bisimulation of games with mappings to the quotient
+    using SmgDecomposition = storm::storage::NondeterministicModelBisimulationDecomposition<storm::models::sparse::Smg<double>>;
+    py::class_<SmgDecomposition, std::shared_ptr<SmgDecomposition>>(m, "SmgBisimulationDecomposition", "Bisimulation decomposition of an SMG")
+        .def_property_readonly("quotient", &SmgDecomposition::getQuotient, "Quotient game")
+        .def_property_readonly("quotient_state_mapping", &SmgDecomposition::getQuotientStateMapping, "Quotient state for each state of the original game")
+        .def_property_readonly("quotient_choice_mapping", &SmgDecomposition::getQuotientChoiceMapping, "Quotient choice for each choice of the original game")
+        .def("lift_state_values", &SmgDecomposition::liftStateValues, "Lift values of the quotient states to the original game", py::arg("quotient_state_values"))
+        .def("lift_choice_values", &SmgDecomposition::liftChoiceValues, "Lift values of the quotient choices to the original game", py::arg("quotient_choice_values"))
+    ;
+    m.def("_compute_game_bisimulation_decomposition", &storm::api::computeGameBisimulationDecomposition<double>, "Compute the bisimulation decomposition of a game", py::arg("model"), py::arg("formulas"), py::arg("bisimulation_type"), py::keep_alive<0, 1>());
+    m.def("_lift_pre_shield", &storm::api::liftPreShield<double>, "Lift a pre-shield of the quotient to the original game", py::arg("decomposition"), py::arg("model"), py::arg("quotient_shield"));
+
     // BisimulationType
     py::enum_<storm::storage::BisimulationType>(m, "BisimulationType", "Types of bisimulation")
         .value("STRONG", storm::storage::BisimulationType::Strong)
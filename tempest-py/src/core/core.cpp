@@ -1,6 +1,8 @@
 #include "core.h"
+#include "progress.h"
 #include "storm/utility/initialize.h"
 #include "storm/utility/SignalHandler.h"
+#include "storm/io/BinaryModelExporter.h"
 #include "storm/io/DirectEncodingExporter.h"
 #include "storm/storage/ModelFormulasPair.h"
 #include "storm/storage/dd/DdType.h"
@@ -71,20 +73,24 @@ void define_parse(py::module& m) {
 
 // Thin wrapper for model building using sparse representation
 template<typename ValueType>
-std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& modelDescription, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, bool jit = false, bool doctor = false) {
-    if (formulas.empty()) {
-        // Build all labels and rewards
-        storm::builder::BuilderOptions options(true, true);
-        return storm::api::buildSparseModel<ValueType>(modelDescription, options, jit, doctor);
-    } else {
-        // Only build labels necessary for formulas
-        return storm::api::buildSparseModel<ValueType>(modelDescription, formulas, jit, doctor);
-    }
+std::shared_ptr<storm::models::sparse::Model<ValueType>> buildSparseModel(storm::storage::SymbolicModelDescription const& modelDescription, std::vector<std::shared_ptr<storm::logic::Formula const>> const& formulas, bool jit = false, bool doctor = false, py::object const& progressCallback = py::none()) {
+    return callWithoutGil(progressCallback, [&]() {
+        if (formulas.empty()) {
+            // Build all labels and rewards
+            storm::builder::BuilderOptions options(true, true);
+            return storm::api::buildSparseModel<ValueType>(modelDescription, options, jit, doctor);
+        } else {
+            // Only build labels necessary for formulas
+            return storm::api::buildSparseModel<ValueType>(modelDescription, formulas, jit, doctor);
+        }
+    });
 }
 
 template<typename ValueType>
-std::shared_ptr<storm::models::ModelBase> buildSparseModelWithOptions(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options, bool jit = false, bool doctor = false) {
-    return storm::api::buildSparseModel<ValueType>(modelDescription, options, jit, doctor);
+std::shared_ptr<storm::models::ModelBase> buildSparseModelWithOptions(storm::storage::SymbolicModelDescription const& modelDescription, storm::builder::BuilderOptions const& options, bool jit = false, bool doctor = false, py::object const& progressCallback = py::none()) {
+    return callWithoutGil(progressCallback, [&]() {
+        return storm::api::buildSparseModel<ValueType>(modelDescription, options, jit, doctor);
+    });
 }
 
 // Thin wrapper for model building using symbolic representation
@@ -103,20 +109,29 @@ void define_build(py::module& m) {
 
     py::class_<storm::parser::DirectEncodingParserOptions>(m, "DirectEncodingParserOptions", "Options for the .drn parser")
             .def(py::init<>(), "initialise")
-            .def_readwrite("build_choice_labels", &storm::parser::DirectEncodingParserOptions::buildChoiceLabeling, "Build with choice labels");
+            .def_readwrite("build_choice_labels", &storm::parser::DirectEncodingParserOptions::buildChoiceLabeling, "Build with choice labels")
+            .def_readwrite("number_of_threads", &storm::parser::DirectEncodingParserOptions::numberOfThreads, "Number of threads used to parse the states (0: all hardware threads)");
 
     // Build model
-    m.def("_build_sparse_model_from_symbolic_description", &buildSparseModel<double>, "Build the model in sparse representation", py::arg("model_description"), py::arg("formulas") = std::vector<std::shared_ptr<storm::logic::Formula const>>(), py::arg("use_jit") = false, py::arg("doctor") = false);
-    m.def("_build_sparse_exact_model_from_symbolic_description", &buildSparseModel<storm::RationalNumber>, "Build the model in sparse representation with exact number representation", py::arg("model_description"), py::arg("formulas") = std::vector<std::shared_ptr<storm::logic::Formula const>>(), py::arg("use_jit") = false, py::arg("doctor") = false);
-    m.def("_build_sparse_parametric_model_from_symbolic_description", &buildSparseModel<storm::RationalFunction>, "Build the parametric model in sparse representation", py::arg("model_description"), py::arg("formulas") = std::vector<std::shared_ptr<storm::logic::Formula const>>(), py::arg("use_jit") = false, py::arg("doctor") = false);
-    m.def("build_sparse_model_with_options", &buildSparseModelWithOptions<double>, "Build the model in sparse representation", py::arg("model_description"), py::arg("options"), py::arg("use_jit") = false, py::arg("doctor") = false);
-    m.def("build_sparse_exact_model_with_options", &buildSparseModelWithOptions<storm::RationalNumber>, "Build the model in sparse representation with exact number representation", py::arg("model_description"), py::arg("options"), py::arg("use_jit") = false, py::arg("doctor") = false);
-    m.def("build_sparse_parametric_model_with_options", &buildSparseModelWithOptions<storm::RationalFunction>, "Build the model in sparse representation", py::arg("model_description"), py::arg("options"), py::arg("use_jit") = false, py::arg("doctor") = false);
+    m.def("_build_sparse_model_from_symbolic_description", &buildSparseModel<double>, "Build the model in sparse representation", py::arg("model_description"), py::arg("formulas") = std::vector<std::shared_ptr<storm::logic::Formula const>>(), py::arg("use_jit") = false, py::arg("doctor") = false, py::arg("progress_callback") = py::none());
+    m.def("_build_sparse_exact_model_from_symbolic_description", &buildSparseModel<storm::RationalNumber>, "Build the model in sparse representation with exact number representation", py::arg("model_description"), py::arg("formulas") = std::vector<std::shared_ptr<storm::logic::Formula const>>(), py::arg("use_jit") = false, py::arg("doctor") = false, py::arg("progress_callback") = py::none());
+    m.def("_build_sparse_parametric_model_from_symbolic_description", &buildSparseModel<storm::RationalFunction>, "Build the parametric model in sparse representation", py::arg("model_description"), py::arg("formulas") = std::vector<std::shared_ptr<storm::logic::Formula const>>(), py::arg("use_jit") = false, py::arg("doctor") = false, py::arg("progress_callback") = py::none());
+    m.def("build_sparse_model_with_options", &buildSparseModelWithOptions<double>, "Build the model in sparse representation", py::arg("model_description"), py::arg("options"), py::arg("use_jit") = false, py::arg("doctor") = false, py::arg("progress_callback") = py::none());
+    m.def("build_sparse_exact_model_with_options", &buildSparseModelWithOptions<storm::RationalNumber>, "Build the model in sparse representation with exact number representation", py::arg("model_description"), py::arg("options"), py::arg("use_jit") = false, py::arg("doctor") = false, py::arg("progress_callback") = py::none());
+    m.def("build_sparse_parametric_model_with_options", &buildSparseModelWithOptions<storm::RationalFunction>, "Build the model in sparse representation", py::arg("model_description"), py::arg("options"), py::arg("use_jit") = false, py::arg("doctor") = false, py::arg("progress_callback") = py::none());
     m.def("_build_symbolic_model_from_symbolic_description", &buildSymbolicModel<storm::dd::DdType::Sylvan, double>, "Build the model in symbolic representation", py::arg("model_description"), py::arg("formulas") = std::vector<std::shared_ptr<storm::logic::Formula const>>());
     m.def("_build_symbolic_parametric_model_from_symbolic_description", &buildSymbolicModel<storm::dd::DdType::Sylvan, storm::RationalFunction>, "Build the parametric model in symbolic representation", py::arg("model_description"), py::arg("formulas") = std::vector<std::shared_ptr<storm::logic::Formula const>>());
     m.def("_build_sparse_model_from_drn", &storm::api::buildExplicitDRNModel<double>, "Build the model from DRN", py::arg("file"), py::arg("options") = storm::parser::DirectEncodingParserOptions());
     m.def("_build_sparse_exact_model_from_drn", &storm::api::buildExplicitDRNModel<storm::RationalNumber>, "Build the model from DRN", py::arg("file"), py::arg("options") = storm::parser::DirectEncodingParserOptions());
     m.def("_build_sparse_parametric_model_from_drn", &storm::api::buildExplicitDRNModel<storm::RationalFunction>, "Build the parametric model from DRN", py::arg("file"), py::arg("options") = storm::parser::DirectEncodingParserOptions());
+    m.def("build_sparse_model_with_cache", &storm::api::buildSparseModelWithCache, "Build the model in sparse representation, using a directory as cache for built games", py::arg("program"), py::arg("options"), py::arg("cache_directory"));
+    m.def("build_model_from_binary", [](std::string const& file, storm::prism::Program const* program) -> std::shared_ptr<storm::models::sparse::Model<double>> {
+            if (program) {
+                return storm::parser::BinaryModelParser::parseSmg(file, program->getManager());
+            }
+            return storm::parser::BinaryModelParser::parseSmg(file);
+        }, "Load a game in binary model format. The state valuations are only loaded if the program the game was built from is given", py::arg("file"), py::arg("program") = nullptr, py::keep_alive<0, 2>());
+    m.def("compute_model_cache_key", &storm::exporter::computeModelCacheKey, "Compute the key under which a model built from the program is cached", py::arg("program"), py::arg("options"), py::arg("constant_definitions") = "");
     m.def("build_sparse_model_from_explicit", &storm::api::buildExplicitModel<double>, "Build the model model from explicit input", py::arg("transition_file"), py::arg("labeling_file"), py::arg("state_reward_file") = "", py::arg("transition_reward_file") = "", py::arg("choice_labeling_file") = "");
 
     m.def("make_sparse_model_builder", &storm::api::makeExplicitModelBuilder<double>, "Construct a builder instance", py::arg("model_description"), py::arg("options"), py::arg("action_mask") = nullptr);
@@ -181,4 +196,5 @@ void define_export(py::module& m) {
     m.def("_export_to_drn", &exportDRN<double>, "Export model in DRN format", py::arg("model"), py::arg("file"), py::arg("options")=storm::exporter::DirectEncodingOptions());
     m.def("_export_exact_to_drn", &exportDRN<storm::RationalNumber>, "Export model in DRN format", py::arg("model"), py::arg("file"), py::arg("options")=storm::exporter::DirectEncodingOptions());
     m.def("_export_parametric_to_drn", &exportDRN<storm::RationalFunction>, "Export parametric model in DRN format", py::arg("model"), py::arg("file"), py::arg("options")=storm::exporter::DirectEncodingOptions());
+    m.def("export_to_binary", &storm::api::exportSparseModelAsBinary, "Export game in binary model format", py::arg("model"), py::arg("file"));
 }
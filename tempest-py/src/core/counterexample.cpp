@@ -2,6 +2,7 @@
 #include "counterexample.h"
 #include "storm/environment/Environment.h"
 #include "storm-counterexamples/api/counterexamples.h"
+#include "src/helpers.h"
 
 
 using namespace storm::counterexamples;
@@ -58,6 +59,25 @@ void define_counterexamples(py::module& m) {
         py::class_<CexInput>(m, "SMTCounterExampleInput", "Precomputed input for counterexample generation")
                 .def("add_reward_and_threshold", &CexInput::addRewardThresholdCombination, "add another reward structure and threshold", py::arg("reward_name"), py::arg("threshold"));
 
+    using UnsafeState = ShieldCounterexample<double>::UnsafeState;
+    py::class_<UnsafeState>(m, "ShieldCounterexampleUnsafeState", "Coalition state in which the shield does not allow any action")
+            .def_readonly("state", &UnsafeState::state, "The unsafe state")
+            .def_readonly("value", &UnsafeState::value, "Optimal value of the coalition in the state")
+            .def_readonly("opponent_choices", &UnsafeState::opponentChoices, "Choices of the opponents in the reachable states")
+            .def_readonly("paths", &UnsafeState::paths, "Most likely violating paths, starting in the state")
+            .def_readonly("path_probabilities", &UnsafeState::pathProbabilities, "Probabilities of the violating paths");
+
+    py::class_<ShieldCounterexample<double>, std::shared_ptr<ShieldCounterexample<double>>>(m, "ShieldCounterexample", "Counterexample for the states in which a shield does not allow any action")
+            .def_property_readonly("threshold", &ShieldCounterexample<double>::getThreshold, "Threshold of the shield")
+            .def_property_readonly("unsafe_states", &ShieldCounterexample<double>::getUnsafeStates, "Explanations of the unsafe states")
+            .def("to_json", [](ShieldCounterexample<double> const& counterexample) { return counterexample.toJson().dump(); }, "Export the counterexample as JSON string")
+            .def("__str__", &streamToString<ShieldCounterexample<double>>);
+
+    m.def("compute_shield_counterexample", [](std::shared_ptr<storm::models::sparse::Smg<double>> model, std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldingExpression, size_t maxK, uint64_t numberOfThreads) {
+                py::gil_scoped_release release;
+                return storm::api::computeShieldCounterexample(model, formula, shieldingExpression, maxK, numberOfThreads);
+            }, "Explain the coalition states in which an absolute pre-safety shield does not allow any action", py::arg("model"), py::arg("formula"), py::arg("shield_expression"), py::arg("max_k") = 5, py::arg("number_of_threads") = 1);
+
 
 
 }
@@ -1,5 +1,6 @@
 #include "modelchecking.h"
 #include "result.h"
+#include "progress.h"
 #include "storm/models/symbolic/StandardRewardModel.h"
 #include "storm/modelchecker/results/CheckResult.h"
 #include "storm/modelchecker/csl/helper/SparseCtmcCslHelper.h"
@@ -10,13 +11,26 @@ using CheckTask = storm::modelchecker::CheckTask<storm::logic::Formula, ValueTyp
 
 // Thin wrapper for model checking using sparse engine
 template<typename ValueType>
-std::shared_ptr<storm::modelchecker::CheckResult> modelCheckingSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, CheckTask<ValueType> const& task, storm::Environment const& env) {
-    return storm::api::verifyWithSparseEngine<ValueType>(env, model, task);
+std::shared_ptr<storm::modelchecker::CheckResult> modelCheckingSparseEngine(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, CheckTask<ValueType> const& task, storm::Environment const& env, py::object const& progressCallback, py::object const& cancellationToken) {
+    return callWithoutGil(progressCallback, [&]() {
+        return std::shared_ptr<storm::modelchecker::CheckResult>(storm::api::verifyWithSparseEngine<ValueType>(env, model, task));
+    }, cancellationToken);
 }
 
+// Model checking of several properties at once, concurrently and with shared results of common subformulas
 template<typename ValueType>
-std::shared_ptr<storm::modelchecker::CheckResult> modelCheckingFullyObservableSparseEngine(std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> model, CheckTask<ValueType> const& task, storm::Environment const& env) {
-    return storm::api::verifyWithSparseEngine<ValueType>(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task);
+std::vector<std::shared_ptr<storm::modelchecker::CheckResult>> modelCheckingSparseEngineMultiple(std::shared_ptr<storm::models::sparse::Model<ValueType>> model, std::vector<CheckTask<ValueType>> const& tasks, storm::Environment const& env, uint64_t numberOfThreads, py::object const& progressCallback, py::object const& cancellationToken) {
+    return callWithoutGil(progressCallback, [&]() {
+        auto results = storm::api::verifyWithSparseEngine<ValueType>(env, model, tasks, numberOfThreads);
+        return std::vector<std::shared_ptr<storm::modelchecker::CheckResult>>(std::make_move_iterator(results.begin()), std::make_move_iterator(results.end()));
+    }, cancellationToken);
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::modelchecker::CheckResult> modelCheckingFullyObservableSparseEngine(std::shared_ptr<storm::models::sparse::Pomdp<ValueType>> model, CheckTask<ValueType> const& task, storm::Environment const& env, py::object const& progressCallback, py::object const& cancellationToken) {
+    return callWithoutGil(progressCallback, [&]() {
+        return std::shared_ptr<storm::modelchecker::CheckResult>(storm::api::verifyWithSparseEngine<ValueType>(env, model->template as<storm::models::sparse::Mdp<ValueType>>(), task));
+    }, cancellationToken);
 }
 
 // Thin wrapper for model checking using dd engine
@@ -82,11 +96,13 @@ void define_modelchecking(py::module& m) {
     ;
 
     // Model checking
-    m.def("_model_checking_fully_observable", &modelCheckingFullyObservableSparseEngine<double>, py::arg("model"), py::arg("task"), py::arg("environment")  = storm::Environment());
-    m.def("_exact_model_checking_fully_observable", &modelCheckingFullyObservableSparseEngine<storm::RationalNumber>, py::arg("model"), py::arg("task"), py::arg("environment")  = storm::Environment());
-    m.def("_model_checking_sparse_engine", &modelCheckingSparseEngine<double>, "Perform model checking using the sparse engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment());
-    m.def("_exact_model_checking_sparse_engine",  &modelCheckingSparseEngine<storm::RationalNumber>, "Perform model checking using the sparse engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment());
-    m.def("_parametric_model_checking_sparse_engine", &modelCheckingSparseEngine<storm::RationalFunction>, "Perform parametric model checking using the sparse engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment());
+    m.def("_model_checking_fully_observable", &modelCheckingFullyObservableSparseEngine<double>, py::arg("model"), py::arg("task"), py::arg("environment")  = storm::Environment(), py::arg("progress_callback") = py::none(), py::arg("cancellation_token") = py::none());
+    m.def("_exact_model_checking_fully_observable", &modelCheckingFullyObservableSparseEngine<storm::RationalNumber>, py::arg("model"), py::arg("task"), py::arg("environment")  = storm::Environment(), py::arg("progress_callback") = py::none(), py::arg("cancellation_token") = py::none());
+    m.def("_model_checking_sparse_engine", &modelCheckingSparseEngine<double>, "Perform model checking using the sparse engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment(), py::arg("progress_callback") = py::none(), py::arg("cancellation_token") = py::none());
+    m.def("_exact_model_checking_sparse_engine",  &modelCheckingSparseEngine<storm::RationalNumber>, "Perform model checking using the sparse engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment(), py::arg("progress_callback") = py::none(), py::arg("cancellation_token") = py::none());
+    m.def("_parametric_model_checking_sparse_engine", &modelCheckingSparseEngine<storm::RationalFunction>, "Perform parametric model checking using the sparse engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment(), py::arg("progress_callback") = py::none(), py::arg("cancellation_token") = py::none());
+    m.def("_model_checking_sparse_engine_multiple", &modelCheckingSparseEngineMultiple<double>, "Perform model checking of several tasks concurrently using the sparse engine", py::arg("model"), py::arg("tasks"), py::arg("environment") = storm::Environment(), py::arg("number_of_threads") = 0, py::arg("progress_callback") = py::none(), py::arg("cancellation_token") = py::none());
+    m.def("_exact_model_checking_sparse_engine_multiple", &modelCheckingSparseEngineMultiple<storm::RationalNumber>, "Perform model checking of several tasks concurrently using the sparse engine", py::arg("model"), py::arg("tasks"), py::arg("environment") = storm::Environment(), py::arg("number_of_threads") = 0, py::arg("progress_callback") = py::none(), py::arg("cancellation_token") = py::none());
     m.def("_model_checking_dd_engine", &modelCheckingDdEngine<storm::dd::DdType::Sylvan, double>, "Perform model checking using the dd engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment());
     m.def("_parametric_model_checking_dd_engine", &modelCheckingDdEngine<storm::dd::DdType::Sylvan, storm::RationalFunction>, "Perform parametric model checking using the dd engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment());
     m.def("_model_checking_hybrid_engine", &modelCheckingHybridEngine<storm::dd::DdType::Sylvan, double>, "Perform model checking using the hybrid engine", py::arg("model"), py::arg("task"), py::arg("environment") = storm::Environment());
@@ -0,0 +1,33 @@
+#include "progress.h"
+
+#include <sstream>
+
+void define_progress(py::module& m) {
+    py::enum_<storm::utility::progress::ProgressPhase>(m, "ProgressPhase", "Phase of a long-running computation")
+        .value("EXPLORATION", storm::utility::progress::ProgressPhase::Exploration)
+        .value("SOLVING", storm::utility::progress::ProgressPhase::Solving)
+    ;
+
+    py::class_<storm::utility::progress::ProgressInformation>(m, "ProgressInformation", "Progress of a long-running computation, as passed to progress callbacks")
+        .def_readonly("phase", &storm::utility::progress::ProgressInformation::phase, "Phase of the computation")
+        .def_readonly("explored_states", &storm::utility::progress::ProgressInformation::numberOfExploredStates, "Number of states explored so far by the model builder")
+        .def_readonly("iteration", &storm::utility::progress::ProgressInformation::iteration, "Number of iterations performed so far by the iterative solver")
+        .def_readonly("residual", &storm::utility::progress::ProgressInformation::residual, "Maximal difference between the last two iterates of the iterative solver (NaN if unknown)")
+        .def("__str__", [](storm::utility::progress::ProgressInformation const& information) {
+                std::stringstream stream;
+                if (information.phase == storm::utility::progress::ProgressPhase::Exploration) {
+                    stream << "Explored " << information.numberOfExploredStates << " states";
+                } else {
+                    stream << "Iteration " << information.iteration << " with residual " << information.residual;
+                }
+                return stream.str();
+            })
+    ;
+
+    py::class_<CancellationToken, std::shared_ptr<CancellationToken>>(m, "CancellationToken", "Token to cancel model checking from another thread. Only the computations the token is passed to are cancelled")
+        .def(py::init<>())
+        .def("cancel", &CancellationToken::cancel, "Request the computations of this token to stop, including the ones started until the token is reset")
+        .def("reset", &CancellationToken::reset, "Allow new computations of this token to run after a cancellation")
+        .def_property_readonly("cancelled", &CancellationToken::isCancelled, "Whether a cancellation was requested")
+    ;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "common.h"
+#include "storm/utility/ProgressListener.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/AbortException.h"
+
+void define_progress(py::module& m);
+
+// Cancels the computations it is passed to. Cancellation is cooperative: the token cancels the progress contexts of these
+// computations, which the model builder and the iterative solvers check regularly. Other computations are not affected.
+class CancellationToken {
+public:
+    // Cancels the running computations of this token and all computations it is passed to until it is reset.
+    void cancel() {
+        std::lock_guard<std::mutex> lock(mutex);
+        cancelled = true;
+        for (auto const& weakContext : contexts) {
+            if (auto context = weakContext.lock()) {
+                context->cancel();
+            }
+        }
+    }
+
+    // Allows new computations to run. Computations that were cancelled before stay cancelled.
+    void reset() {
+        std::lock_guard<std::mutex> lock(mutex);
+        cancelled = false;
+    }
+
+    bool isCancelled() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return cancelled;
+    }
+
+    // Registers the context of a computation this token is passed to.
+    void attach(std::shared_ptr<storm::utility::progress::ProgressContext> const& context) {
+        std::lock_guard<std::mutex> lock(mutex);
+        contexts.erase(std::remove_if(contexts.begin(), contexts.end(), [] (std::weak_ptr<storm::utility::progress::ProgressContext> const& weakContext) { return weakContext.expired(); }), contexts.end());
+        contexts.push_back(context);
+        if (cancelled) {
+            context->cancel();
+        }
+    }
+
+private:
+    mutable std::mutex mutex;
+    bool cancelled = false;
+    std::vector<std::weak_ptr<storm::utility::progress::ProgressContext>> contexts;
+};
+
+// Gives the computations on the current thread their own progress context for the lifetime of the scope, so that
+// concurrent computations neither receive the reports of each other nor are cancelled together. The callback is
+// called with the GIL held, errors raised by it cancel the computation and are kept to be rethrown once the
+// computation returned. If a cancellation token is given, it cancels the computation as well.
+class ProgressCallbackScope {
+public:
+    ProgressCallbackScope(py::object const& callback, py::object const& cancellationToken = py::none(), uint64_t minimalDelayInMilliseconds = 100) : state(std::make_shared<State>()) {
+        storm::utility::progress::ProgressCallback progressCallback;
+        if (!callback.is_none()) {
+            state->function = callback;
+            // The callback only shares the state, so copying it does not touch any Python object without the GIL.
+            std::shared_ptr<State> state = this->state;
+            progressCallback = [state] (storm::utility::progress::ProgressInformation const& information) {
+                py::gil_scoped_acquire acquire;
+                if (state->error) {
+                    return;
+                }
+                try {
+                    state->function(information);
+                } catch (py::error_already_set const&) {
+                    state->error = std::current_exception();
+                    state->context->cancel();
+                }
+            };
+        }
+        context = std::make_shared<storm::utility::progress::ProgressContext>(progressCallback, minimalDelayInMilliseconds);
+        state->context = context.get();
+        if (!cancellationToken.is_none()) {
+            cancellationToken.cast<CancellationToken&>().attach(context);
+        }
+        contextScope = std::make_unique<storm::utility::progress::ProgressContextScope>(context);
+    }
+
+    // The context and the state are released with the GIL held, as the state owns the Python callback.
+    ~ProgressCallbackScope() = default;
+
+    void rethrowError() {
+        if (state->error) {
+            std::exception_ptr pendingError = state->error;
+            state->error = nullptr;
+            std::rethrow_exception(pendingError);
+        }
+        // The result of a cancelled computation may be incomplete.
+        STORM_LOG_THROW(!context->isCancelled(), storm::exceptions::AbortException, "The computation was cancelled, its result may be incomplete.");
+    }
+
+private:
+    struct State {
+        py::function function;
+        std::exception_ptr error;
+        storm::utility::progress::ProgressContext* context = nullptr;
+    };
+
+    std::shared_ptr<State> state;
+    std::shared_ptr<storm::utility::progress::ProgressContext> context;
+    std::unique_ptr<storm::utility::progress::ProgressContextScope> contextScope;
+};
+
+// Runs a long computation without holding the GIL, so that other Python threads keep running meanwhile.
+template<typename Function>
+auto callWithoutGil(py::object const& progressCallback, Function const& function, py::object const& cancellationToken = py::none()) -> decltype(function()) {
+    ProgressCallbackScope scope(progressCallback, cancellationToken);
+    decltype(function()) result;
+    try {
+        py::gil_scoped_release release;
+        result = function();
+    } catch (...) {
+        scope.rethrowError();
+        throw;
+    }
+    scope.rethrowError();
+    return result;
+}
@@ -7,6 +7,10 @@
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 
 #include "storm/models/symbolic/StandardRewardModel.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidOperationException.h"
+
+#include "src/views.h"
 
 template<typename ValueType>
 std::shared_ptr<storm::modelchecker::QualitativeCheckResult> createFilterInitialStatesSparse(std::shared_ptr<storm::models::sparse::Model<ValueType>> model) {
@@ -85,6 +89,11 @@ void define_result(py::module& m) {
             return result[state];
         }, py::arg("state"), "Get result for given state")
         .def("get_values", [](storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& res) {return res.getValueVector();}, "Get model checking result values for all states")
+        .def_property_readonly("values", [](py::object const& self) {
+                auto const& result = self.cast<storm::modelchecker::ExplicitQuantitativeCheckResult<double> const&>();
+                STORM_LOG_THROW(result.isResultForAllStates(), storm::exceptions::InvalidOperationException, "The values are only available as an array if the result is given for all states.");
+                return readOnlyView(result.getValueVector(), self);
+            }, "Model checking result values for all states as a read-only numpy array without copying")
         .def_property_readonly("scheduler", [](storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& res) {return res.getScheduler();}, "get scheduler")
         .def_property_readonly("shield", [](storm::modelchecker::ExplicitQuantitativeCheckResult<double> const& res) {return res.getShield();}, "get shield")
     ;
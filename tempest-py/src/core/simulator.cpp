@@ -1,5 +1,11 @@
 #include "simulator.h"
 #include <storm/simulator/DiscreteTimeSparseModelSimulator.h>
+#include <storm/simulator/BatchedSparseModelSimulator.h>
+#include <storm/shields/ShieldActionMasks.h>
+#include <storm/utility/macros.h>
+#include <storm/exceptions/InvalidArgumentException.h>
+
+#include "src/views.h"
 
 template<typename ValueType>
 void define_sparse_model_simulator(py::module& m, std::string const& vtSuffix) {
@@ -11,6 +17,63 @@ void define_sparse_model_simulator(py::module& m, std::string const& vtSuffix) {
     dtsmsd.def("get_last_reward", &storm::simulator::DiscreteTimeSparseModelSimulator<ValueType>::getLastRewards);
     dtsmsd.def("get_current_state", &storm::simulator::DiscreteTimeSparseModelSimulator<ValueType>::getCurrentState);
     dtsmsd.def("reset_to_initial_state", &storm::simulator::DiscreteTimeSparseModelSimulator<ValueType>::resetToInitial);
+
+    using BatchedSimulator = storm::simulator::BatchedSparseModelSimulator<ValueType>;
+    py::class_<BatchedSimulator> bsms(m, ("_BatchedSparseModelSimulator" + vtSuffix).c_str(), "Simulator for many episodes of sparse discrete-time models in memory at once");
+    bsms.def(py::init<storm::models::sparse::Model<ValueType> const&, uint64_t, uint64_t>(), py::arg("model"), py::arg("nr_episodes"), py::arg("seed") = 0, py::keep_alive<1, 2>());
+    bsms.def_property_readonly("nr_episodes", &BatchedSimulator::getNumberOfEpisodes, "Number of episodes");
+    bsms.def("set_seed", &BatchedSimulator::setSeed, py::arg("seed"), "Restart the random streams of all episodes");
+    bsms.def("set_allowed_choices", &BatchedSimulator::setAllowedChoices, py::arg("allowed_choices"), "Restrict the choices to the given rows, not allowed choices are replaced by allowed ones");
+    bsms.def("set_shield", [](BatchedSimulator& simulator, tempest::shields::ShieldActionMasks<ValueType> const& masks) {
+            simulator.setAllowedChoices(masks.getAllowedChoices());
+        }, py::arg("shield"), "Restrict the choices to the ones allowed by the given shield action masks");
+    bsms.def("clear_allowed_choices", &BatchedSimulator::clearAllowedChoices, "Allow all choices");
+    bsms.def("set_terminal_states", &BatchedSimulator::setTerminalStates, py::arg("states"), "Mark states as terminal in addition to the sink states");
+    bsms.def("reset_to_initial_state", [](BatchedSimulator& simulator, py::object const& episodes) {
+            if (episodes.is_none()) {
+                simulator.resetToInitial();
+            } else {
+                auto mask = episodes.cast<py::array_t<bool, py::array::c_style | py::array::forcecast>>();
+                STORM_LOG_THROW(mask.ndim() == 1 && static_cast<uint64_t>(mask.shape(0)) == simulator.getNumberOfEpisodes(), storm::exceptions::InvalidArgumentException, "Expected a boolean array with one entry per episode.");
+                simulator.resetToInitial(mask.data());
+            }
+        }, py::arg("episodes") = py::none(), "Move all episodes (or those selected by a boolean array) to the initial state");
+    bsms.def("set_current_states", [](BatchedSimulator& simulator, py::array_t<uint64_t, py::array::c_style | py::array::forcecast> const& states) {
+            STORM_LOG_THROW(states.ndim() == 1 && static_cast<uint64_t>(states.shape(0)) == simulator.getNumberOfEpisodes(), storm::exceptions::InvalidArgumentException, "Expected one state per episode.");
+            simulator.setCurrentStates(states.data());
+        }, py::arg("states"), "Move the episodes to the given states");
+    bsms.def("step", [](BatchedSimulator& simulator, py::array_t<uint64_t, py::array::c_style | py::array::forcecast> const& choices, uint64_t numberOfThreads) {
+            STORM_LOG_THROW(choices.ndim() == 1 && static_cast<uint64_t>(choices.shape(0)) == simulator.getNumberOfEpisodes(), storm::exceptions::InvalidArgumentException, "Expected one choice per episode.");
+            uint64_t const* input = choices.data();
+            py::gil_scoped_release release;
+            simulator.step(input, numberOfThreads);
+        }, py::arg("choices"), py::arg("number_of_threads") = 0, "Take the given local choice in each episode");
+    bsms.def("random_step", [](BatchedSimulator& simulator, uint64_t numberOfThreads) {
+            py::gil_scoped_release release;
+            simulator.randomStep(numberOfThreads);
+        }, py::arg("number_of_threads") = 0, "Take a uniformly chosen allowed choice in each episode");
+    // The following arrays are views on the state of the simulator, i.e. they are updated by each step.
+    bsms.def_property_readonly("current_states", [](py::object const& self) {
+            auto const& simulator = self.cast<BatchedSimulator const&>();
+            return readOnlyView(py::dtype::of<uint64_t>(), {simulator.getNumberOfEpisodes()}, simulator.getCurrentStates().data(), self);
+        }, "Current state of each episode");
+    bsms.def_property_readonly("last_choices", [](py::object const& self) {
+            auto const& simulator = self.cast<BatchedSimulator const&>();
+            return readOnlyView(py::dtype::of<uint64_t>(), {simulator.getNumberOfEpisodes()}, simulator.getLastChoices().data(), self);
+        }, "Row of the choice taken in the last step of each episode");
+    bsms.def_property_readonly("last_rewards", [](py::object const& self) {
+            auto const& simulator = self.cast<BatchedSimulator const&>();
+            size_t numberOfRewardModels = simulator.getNumberOfEpisodes() == 0 ? 0 : simulator.getLastRewards().size() / simulator.getNumberOfEpisodes();
+            return readOnlyView(py::dtype::of<double>(), {simulator.getNumberOfEpisodes(), numberOfRewardModels}, simulator.getLastRewards().data(), self);
+        }, "Rewards of the last step with one column per reward model");
+    bsms.def_property_readonly("done", [](py::object const& self) {
+            auto const& simulator = self.cast<BatchedSimulator const&>();
+            return readOnlyView(py::dtype::of<bool>(), {simulator.getNumberOfEpisodes()}, simulator.getDone().data(), self);
+        }, "Whether each episode is in a terminal state");
+    bsms.def_property_readonly("overridden", [](py::object const& self) {
+            auto const& simulator = self.cast<BatchedSimulator const&>();
+            return readOnlyView(py::dtype::of<bool>(), {simulator.getNumberOfEpisodes()}, simulator.getOverridden().data(), self);
+        }, "Whether the choice of each episode in the last step was replaced by an allowed one");
 }
 
 template void define_sparse_model_simulator<double>(py::module& m, std::string const& vtSuffix);
@@ -10,6 +10,7 @@
 #include "core/environment.h"
 #include "core/transformation.h"
 #include "core/simulator.h"
+#include "core/progress.h"
 
 PYBIND11_MODULE(core, m) {
     m.doc() = "core";
@@ -21,6 +22,7 @@ PYBIND11_MODULE(core, m) {
 
     define_environment(m);
     define_core(m);
+    define_progress(m);
 
     define_property(m);
     define_parse(m);
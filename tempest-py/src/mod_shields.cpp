@@ -3,7 +3,9 @@
 #include "shields/optimal_shield.h"
 #include "shields/post_shield.h"
 #include "shields/pre_shield.h"
+#include "shields/safety_ltl_shield.h"
 #include "shields/shield_handling.h"
+#include "shields/shield_evaluation.h"
 
 
 #include "storm/storage/Scheduler.h"
@@ -26,6 +28,12 @@ PYBIND11_MODULE(shields, m) {
     define_post_shield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(m, "Exact");
     define_optimal_shield<double, typename storm::storage::SparseMatrix<double>::index_type>(m, "Double");
     define_optimal_shield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(m, "Exact");
+    define_safety_monitor(m);
+    define_safety_ltl_shield<double, typename storm::storage::SparseMatrix<double>::index_type>(m, "Double");
+    define_safety_ltl_shield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(m, "Exact");
     define_shield_handling<double, typename storm::storage::SparseMatrix<double>::index_type>(m, "Double");
     define_shield_handling<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(m, "Exact");
+    define_shield_evaluation_options(m);
+    define_shield_evaluation<double>(m, "Double");
+    define_shield_evaluation<storm::RationalNumber>(m, "Exact");
 }
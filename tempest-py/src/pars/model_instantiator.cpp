@@ -1,6 +1,7 @@
 #include "model_instantiator.h"
 #include "storm/models/sparse/Model.h"
 #include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+#include "storm-pars/modelchecker/instantiation/SparseSmgInstantiationModelChecker.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 
 
@@ -25,6 +26,7 @@ template<typename ValueType> using Dtmc = storm::models::sparse::Dtmc<ValueType>
 template<typename ValueType> using Mdp = storm::models::sparse::Mdp<ValueType>;
 template<typename ValueType> using Ctmc = storm::models::sparse::Ctmc<ValueType>;
 template<typename ValueType> using MarkovAutomaton = storm::models::sparse::MarkovAutomaton<ValueType>;
+template<typename ValueType> using Smg = storm::models::sparse::Smg<ValueType>;
 
 using namespace storm::modelchecker;
 
@@ -50,6 +52,11 @@ void define_model_instantiator(py::module& m) {
         .def("instantiate", &storm::utility::ModelInstantiator<MarkovAutomaton<storm::RationalFunction>, MarkovAutomaton<double>>::instantiate, "Instantiate model with given parameter values")
     ;
 
+    py::class_<storm::utility::ModelInstantiator<Smg<storm::RationalFunction>,Smg<double>>>(m, "PSmgInstantiator", "Instantiate PSMGs to SMGs")
+        .def(py::init<Smg<storm::RationalFunction>>(), "parametric model"_a)
+        .def("instantiate", &storm::utility::ModelInstantiator<Smg<storm::RationalFunction>, Smg<double>>::instantiate, "Instantiate model with given parameter values")
+    ;
+
     py::class_<storm::utility::ModelInstantiator<Dtmc<storm::RationalFunction>, Dtmc<storm::RationalFunction>>>(m, "PartialPDtmcInstantiator", "Instantiate PDTMCs to DTMCs")
             .def(py::init<Dtmc<storm::RationalFunction>>(), "parametric model"_a)
             .def("instantiate", &storm::utility::ModelInstantiator<Dtmc<storm::RationalFunction>, Dtmc<storm::RationalFunction>>::instantiate, "Instantiate model with given parameter values")
@@ -110,4 +117,16 @@ void define_model_instantiation_checker(py::module& m) {
         .def("set_graph_preserving", &SparseMdpInstantiationModelChecker<Mdp<storm::RationalFunction>, storm::RationalNumber>::setInstantiationsAreGraphPreserving, "value"_a)
     ;
 
+    py::class_<SparseInstantiationModelChecker<Smg<storm::RationalFunction>, double>, std::shared_ptr<SparseInstantiationModelChecker<Smg<storm::RationalFunction>, double>>> bpsmginstchecker(m, "_PSmgInstantiationCheckerBase", "Instantiate pSMGs to SMGs and immediately check (base)");
+    bpsmginstchecker.def("specify_formula", &SparseInstantiationModelChecker<Smg<storm::RationalFunction>, double>::specifyFormula, "check_task"_a);
+
+    py::class_<SparseSmgInstantiationModelChecker<Smg<storm::RationalFunction>, double>, std::shared_ptr<SparseSmgInstantiationModelChecker<Smg<storm::RationalFunction>, double>>> (m, "PSmgInstantiationChecker", "Instantiate pSMGs to SMGs and immediately check", bpsmginstchecker)
+        .def(py::init<Smg<storm::RationalFunction>>(), "parametric model"_a)
+        .def("check", [](SparseSmgInstantiationModelChecker<Smg<storm::RationalFunction>, double> &ssimc, storm::Environment const& env, storm::utility::parametric::Valuation<storm::RationalFunction> const& val) -> std::shared_ptr<CheckResult> {
+                py::gil_scoped_release release;
+                return ssimc.check(env,val);
+            }, "env"_a, "instantiation"_a)
+        .def("set_graph_preserving", &SparseSmgInstantiationModelChecker<Smg<storm::RationalFunction>, double>::setInstantiationsAreGraphPreserving, "value"_a)
+    ;
+
 }
\ No newline at end of file
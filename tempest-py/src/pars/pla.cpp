@@ -5,6 +5,7 @@
 
 typedef storm::modelchecker::SparseDtmcParameterLiftingModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> DtmcParameterLiftingModelChecker;
 typedef storm::modelchecker::SparseMdpParameterLiftingModelChecker<storm::models::sparse::Mdp<storm::RationalFunction>, double> MdpParameterLiftingModelChecker;
+typedef storm::modelchecker::SparseSmgParameterLiftingModelChecker<storm::models::sparse::Smg<storm::RationalFunction>, double> SmgParameterLiftingModelChecker;
 
 typedef storm::modelchecker::RegionModelChecker<storm::RationalFunction> RegionModelChecker;
 typedef storm::storage::ParameterRegion<storm::RationalFunction> Region;
@@ -34,6 +35,29 @@ storm::modelchecker::ExplicitQuantitativeCheckResult<double> getBound_mdp(std::s
     return checker->getBound(env, region, maximise ?  storm::solver::OptimizationDirection::Maximize : storm::solver::OptimizationDirection::Minimize)->asExplicitQuantitativeCheckResult<double>();
 }
 
+storm::modelchecker::ExplicitQuantitativeCheckResult<double> getBound_smg(std::shared_ptr<SmgParameterLiftingModelChecker>& checker, storm::Environment const& env, Region const& region, bool maximise) {
+    return checker->getBound(env, region, maximise ?  storm::solver::OptimizationDirection::Maximize : storm::solver::OptimizationDirection::Minimize)->asExplicitQuantitativeCheckResult<double>();
+}
+
+std::vector<double> computeChoiceValues_smg(std::shared_ptr<SmgParameterLiftingModelChecker>& checker, storm::Environment const& env, Region const& region, bool maximise) {
+    py::gil_scoped_release release;
+    return checker->computeChoiceValues(env, region, maximise ?  storm::solver::OptimizationDirection::Maximize : storm::solver::OptimizationDirection::Minimize);
+}
+
+std::shared_ptr<tempest::shields::AbstractShield<double, storm::storage::sparse::state_type>> computeShield_smg(std::shared_ptr<SmgParameterLiftingModelChecker>& checker, storm::Environment const& env, Region const& region, std::shared_ptr<storm::logic::ShieldExpression const> const& shieldExpression) {
+    py::gil_scoped_release release;
+    return checker->computeShield(env, region, shieldExpression);
+}
+
+std::vector<std::pair<Region, storm::modelchecker::RegionResult>> performRegionRefinement_smg(std::shared_ptr<SmgParameterLiftingModelChecker>& checker, storm::Environment const& env, Region const& region, boost::optional<double> coverageThreshold, boost::optional<uint64_t> depthThreshold, uint64_t numberOfThreads) {
+    py::gil_scoped_release release;
+    boost::optional<storm::RationalFunction> threshold;
+    if (coverageThreshold) {
+        threshold = storm::utility::convertNumber<storm::RationalFunction>(coverageThreshold.get());
+    }
+    return checker->performParallelRegionRefinement(env, region, threshold, depthThreshold, storm::modelchecker::RegionResultHypothesis::Unknown, numberOfThreads)->getRegionResults();
+}
+
 std::set<storm::Polynomial> gatherDerivatives(storm::models::sparse::Model<storm::RationalFunction> const& model, carl::Variable const& var) {
     std::set<storm::Polynomial> derivatives;
     for (auto it : model.getTransitionMatrix()) {
@@ -104,6 +128,13 @@ void define_pla(py::module& m) {
     py::class_<MdpParameterLiftingModelChecker, std::shared_ptr<MdpParameterLiftingModelChecker>>(m, "MdpParameterLiftingModelChecker", "Region model checker for MPDs", regionModelChecker)
             .def(py::init<>())
             .def("get_bound_all_states", &getBound_mdp, "Get bound", py::arg("environment"), py::arg("region"), py::arg("maximise")= true);
+    py::class_<SmgParameterLiftingModelChecker, std::shared_ptr<SmgParameterLiftingModelChecker>>(m, "SmgParameterLiftingModelChecker", "Region model checker for SMGs, where nature resolves the parameters", regionModelChecker)
+            .def(py::init<>())
+            .def("get_bound_all_states", &getBound_smg, "Get bound", py::arg("environment"), py::arg("region"), py::arg("maximise")= true)
+            .def("compute_choice_values", &computeChoiceValues_smg, "Compute the value of every choice, where nature maximises or minimises", py::arg("environment"), py::arg("region"), py::arg("maximise") = false)
+            .def("compute_shield", &computeShield_smg, "Compute a shield for the coalition that is safe for all parameter valuations in the region", py::arg("environment"), py::arg("region"), py::arg("shield_expression") = nullptr)
+            .def("perform_region_refinement", &performRegionRefinement_smg, "Refine the region until the coverage or depth threshold is reached, analysing the regions of each depth in parallel", py::arg("environment"), py::arg("region"), py::arg("coverage_threshold") = boost::none, py::arg("depth_threshold") = boost::none, py::arg("number_of_threads") = 0)
+            .def_property_readonly("states_of_coalition", &SmgParameterLiftingModelChecker::getStatesOfCoalition, "States that belong to the coalition of the game formula");
 
     m.def("create_region_checker", &createRegionChecker, "Create region checker", py::arg("environment"), py::arg("model"), py::arg("formula"), py::arg("generate_splitting_estimate") = false, py::arg("allow_model_simplification") = true);
     //m.def("is_parameter_lifting_sound", &storm::utility::parameterlifting::validateParameterLiftingSound, "Check if parameter lifting is sound", py::arg("model"), py::arg("formula"));
@@ -1,10 +1,14 @@
 #include "tracker.h"
 #include "src/helpers.h"
+#include <storm-pomdp/analysis/BeliefSupportShield.h>
 #include <storm-pomdp/analysis/IterativePolicySearch.h>
 #include <storm-pomdp/analysis/QualitativeAnalysisOnGraphs.h>
 #include <storm-pomdp/analysis/WinningRegionQueryInterface.h>
+#include <storm-pomdp/generator/BitBeliefSupportTracker.h>
 #include <storm/logic/Formula.h>
 
+#include <sstream>
+
 template<typename ValueType> using SparsePomdp = storm::models::sparse::Pomdp<ValueType>;
 
 template<typename ValueType>
@@ -43,6 +47,24 @@ void define_qualitative_policy_search(py::module& m, std::string const& vtSuffix
     wrqi.def(py::init<SparsePomdp <ValueType> const&, storm::pomdp::WinningRegion const&>(), py::arg("pomdp"), py::arg("BeliefSupportWinningRegion"));
     wrqi.def("query_current_belief", &storm::pomdp::WinningRegionQueryInterface<ValueType>::isInWinningRegion, py::arg("current_belief"));
     wrqi.def("query_action",  &storm::pomdp::WinningRegionQueryInterface<ValueType>::staysInWinningRegion, py::arg("current_belief"), py::arg("action"));
+
+    m.def(("synthesize_belief_support_shield_" + vtSuffix).c_str(), [](SparsePomdp<ValueType> const& pomdp, storm::logic::Formula const& formula, storm::pomdp::MemlessSearchOptions const& options, uint64_t lookahead) {
+            return storm::pomdp::synthesizeBeliefSupportShield(pomdp, formula, std::make_shared<storm::utility::solver::Z3SmtSolverFactory>(), options, lookahead);
+        }, "Compute the winning region and the corresponding belief support shield", py::arg("pomdp"), py::arg("formula"), py::arg("options"), py::arg("lookahead") = 0);
+    py::class_<storm::pomdp::BeliefSupportShield<ValueType>> bss(m, ("BeliefSupportShield" + vtSuffix).c_str(), "Safety shield keyed by observation and belief support");
+    bss.def(py::init<SparsePomdp<ValueType> const&, storm::pomdp::WinningRegion const&>(), py::arg("pomdp"), py::arg("winning_region"));
+    bss.def("is_winning", &storm::pomdp::BeliefSupportShield<ValueType>::isWinning, "Is the belief support in the winning region?", py::arg("observation"), py::arg("support"));
+    bss.def("is_allowed", &storm::pomdp::BeliefSupportShield<ValueType>::isAllowed, "Does the action keep the belief support in the winning region?", py::arg("observation"), py::arg("support"), py::arg("action"));
+    bss.def("get_allowed_actions", &storm::pomdp::BeliefSupportShield<ValueType>::getAllowedActions, "Actions that keep the belief support in the winning region", py::arg("observation"), py::arg("support"));
+    bss.def_property_readonly("winning_region", &storm::pomdp::BeliefSupportShield<ValueType>::getWinningRegion, "The underlying winning region");
+    bss.def("create_tracker", [](storm::pomdp::BeliefSupportShield<ValueType> const& shield) {
+            return storm::generator::BitBeliefSupportTracker<ValueType>(shield.getTransitions());
+        }, "Create a belief support tracker that shares the transitions of the shield");
+    bss.def("to_json", [](storm::pomdp::BeliefSupportShield<ValueType> const& shield, SparsePomdp<ValueType> const* pomdp) {
+            std::stringstream stream;
+            shield.printJsonToStream(stream, pomdp);
+            return stream.str();
+        }, "Export the allowed actions for the maximal winning belief supports", py::arg("pomdp") = nullptr);
 }
 
 template void define_qualitative_policy_search<double>(py::module& m, std::string const& vtSuffix);
@@ -1,6 +1,7 @@
 #include "tracker.h"
 #include "src/helpers.h"
 #include <storm-pomdp/generator/BeliefSupportTracker.h>
+#include <storm-pomdp/generator/BitBeliefSupportTracker.h>
 #include <storm-pomdp/generator/NondeterministicBeliefTracker.h>
 
 
@@ -18,6 +19,16 @@ void define_tracker(py::module& m, std::string const& vtSuffix) {
     tracker.def("get_current_belief_support", &SparsePomdpTracker<ValueType>::getCurrentBeliefSupport, "What is the support given the trace so far");
     tracker.def("track", &SparsePomdpTracker<ValueType>::track, py::arg("action"), py::arg("observation"));
 
+    py::class_<storm::generator::BitBeliefSupportTracker<ValueType>> bitTracker(m, ("BitBeliefSupportTracker" + vtSuffix).c_str(), "Tracker for belief supports over the states with the current observation, updated with bit operations");
+    bitTracker.def(py::init<SparsePomdp<ValueType> const&>(), py::arg("pomdp"));
+    bitTracker.def("track", &storm::generator::BitBeliefSupportTracker<ValueType>::track, "Update the belief support, returns False if the observation is impossible", py::arg("action"), py::arg("observation"));
+    bitTracker.def("reset", py::overload_cast<>(&storm::generator::BitBeliefSupportTracker<ValueType>::reset), "Reset to the initial belief support");
+    bitTracker.def("reset", py::overload_cast<uint64_t, storm::storage::BitVector const&>(&storm::generator::BitBeliefSupportTracker<ValueType>::reset), "Reset to the given belief support", py::arg("observation"), py::arg("support"));
+    bitTracker.def_property_readonly("observation", &storm::generator::BitBeliefSupportTracker<ValueType>::getCurrentObservation, "The current observation");
+    bitTracker.def_property_readonly("support", &storm::generator::BitBeliefSupportTracker<ValueType>::getCurrentSupport, "The current belief support over the states with the current observation");
+    bitTracker.def("get_current_belief_support", &storm::generator::BitBeliefSupportTracker<ValueType>::getCurrentBeliefSupport, "The current belief support as a set of states");
+    bitTracker.def_property_readonly("is_valid", &storm::generator::BitBeliefSupportTracker<ValueType>::isValid);
+
     py::class_<storm::generator::SparseBeliefState<ValueType>> sbel(m, ("SparseBeliefState" + vtSuffix).c_str(), "Belief state in sparse format");
     sbel.def("get", &storm::generator::SparseBeliefState<ValueType>::get, py::arg("state"));
     sbel.def_property_readonly("risk", &storm::generator::SparseBeliefState<ValueType>::getRisk);
@@ -8,6 +8,8 @@
 
 #include "storm/api/export.h"
 
+#include "src/views.h"
+
 
 template <typename ValueType, typename IndexType>
 void define_abstract_shield(py::module& m, std::string vt_suffix) {
@@ -19,6 +21,9 @@ void define_abstract_shield(py::module& m, std::string vt_suffix) {
         .def("compute_row_group_size", &AbstractShield::computeRowGroupSizes)
         .def("get_class_name", &AbstractShield::getClassName)
         .def("get_optimization_direction", &AbstractShield::getOptimizationDirection)
+        .def_property_readonly("row_group_indices", [](py::object const& self) {
+                return readOnlyView(self.cast<AbstractShield const&>().getRowGroupIndices(), self);
+            }, "First choice of each state (and the number of choices at the end) as a read-only numpy array without copying")
       ;
 }
 
@@ -3,6 +3,8 @@
 #include "storm/shields/AbstractShield.h"
 #include "storm/shields/OptimalShield.h"
 
+#include "src/views.h"
+
 template <typename ValueType, typename IndexType>
 void define_optimal_shield(py::module& m, std::string vt_suffix) {
     using OptimalShield = tempest::shields::OptimalShield<ValueType, IndexType>;
@@ -10,9 +12,15 @@ void define_optimal_shield(py::module& m, std::string vt_suffix) {
 
     std::string shieldClassName = std::string("OptimalShield") + vt_suffix;
 
-    py::class_<OptimalShield, AbstractShield, std::shared_ptr<OptimalShield>>(m, shieldClassName.c_str())
+    py::class_<OptimalShield, AbstractShield, std::shared_ptr<OptimalShield>> shield(m, shieldClassName.c_str());
+    shield
         .def("construct", &OptimalShield::construct, "Construct the shield")
     ;
+    if constexpr (std::is_same<ValueType, double>::value) {
+        shield.def_property_readonly("choice_values", [](py::object const& self) {
+                return readOnlyView(self.cast<OptimalShield const&>().getChoiceValues(), self);
+            }, "Values of all choices the shield is based on as a read-only numpy array without copying, see row_group_indices for the choices of each state");
+    }
 }
 
 template void define_optimal_shield<double, typename storm::storage::SparseMatrix<double>::index_type>(py::module& m, std::string vt_suffix);
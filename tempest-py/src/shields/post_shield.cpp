@@ -3,6 +3,8 @@
 #include "storm/shields/AbstractShield.h"
 #include "storm/shields/PostShield.h"
 
+#include "src/views.h"
+
 template <typename ValueType, typename IndexType>
 void define_post_shield(py::module& m, std::string vt_suffix) {
     using PostShield = tempest::shields::PostShield<ValueType, IndexType>;
@@ -10,9 +12,15 @@ void define_post_shield(py::module& m, std::string vt_suffix) {
 
     std::string shieldClassName = std::string("PostShield") + vt_suffix;
     
-    py::class_<PostShield, AbstractShield, std::shared_ptr<PostShield>>(m, shieldClassName.c_str())
+    py::class_<PostShield, AbstractShield, std::shared_ptr<PostShield>> shield(m, shieldClassName.c_str());
+    shield
         .def("construct", &PostShield::construct, "Construct the shield")
     ;
+    if constexpr (std::is_same<ValueType, double>::value) {
+        shield.def_property_readonly("choice_values", [](py::object const& self) {
+                return readOnlyView(self.cast<PostShield const&>().getChoiceValues(), self);
+            }, "Values of all choices the shield is based on as a read-only numpy array without copying, see row_group_indices for the choices of each state");
+    }
 }
 
 
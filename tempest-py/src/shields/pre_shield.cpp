@@ -1,25 +1,81 @@
 #include "pre_shield.h"
 
 #include "storm/shields/PreShield.h"
+
+#include "src/views.h"
 #include "storm/shields/AbstractShield.h"
+#include "storm/shields/ShieldActionMasks.h"
 
 
 #include "storm/storage/Scheduler.h"
 #include "storm/storage/SchedulerChoice.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/Distribution.h"
+#include "storm/models/sparse/Model.h"
+
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+#include <pybind11/numpy.h>
 
 
 template <typename ValueType, typename IndexType>
 void define_pre_shield(py::module& m, std::string vt_suffix) {
     using PreShield = tempest::shields::PreShield<ValueType, IndexType>;
     using AbstractShield = tempest::shields::AbstractShield<ValueType, IndexType>;
+    using ShieldActionMasks = tempest::shields::ShieldActionMasks<ValueType>;
+    using Model = storm::models::sparse::Model<ValueType>;
 
     std::string shieldClassName = std::string("PreShield") + vt_suffix;
+    std::string masksClassName = std::string("ShieldActionMasks") + vt_suffix;
 
 
-    py::class_<PreShield, AbstractShield, std::shared_ptr<PreShield>>(m, shieldClassName.c_str())
+    py::class_<PreShield, AbstractShield, std::shared_ptr<PreShield>> shield(m, shieldClassName.c_str());
+    shield
     .def("construct", &PreShield::construct, "Construct the shield")
+    .def("action_masks", [](PreShield& shield, Model const& model, bool useChoiceLabels, std::shared_ptr<storm::storage::sparse::StateValuationIndex> const& valuationIndex) {
+            return std::make_shared<ShieldActionMasks>(shield.construct(), model, useChoiceLabels, valuationIndex);
+        }, "Construct the shield as a table for batched queries", py::arg("model"), py::arg("use_choice_labels") = false, py::arg("valuation_index") = nullptr)
+    ;
+    if constexpr (std::is_same<ValueType, double>::value) {
+        shield.def_property_readonly("choice_values", [](py::object const& self) {
+                return readOnlyView(self.cast<PreShield const&>().getChoiceValues(), self);
+            }, "Values of all choices the shield is based on as a read-only numpy array without copying, see row_group_indices for the choices of each state");
+    }
+
+    py::class_<ShieldActionMasks, std::shared_ptr<ShieldActionMasks>>(m, masksClassName.c_str(), "The actions a pre shield allows in each state, for batched queries. States without a choice of the shield allow no action")
+    .def("__init__", [](ShieldActionMasks& instance, storm::storage::PreScheduler<ValueType> const& shield, Model const& model, bool useChoiceLabels, std::shared_ptr<storm::storage::sparse::StateValuationIndex> const& valuationIndex) -> void {
+            new (&instance) ShieldActionMasks(shield, model, useChoiceLabels, valuationIndex);
+        }, py::arg("shield"), py::arg("model"), py::arg("use_choice_labels") = false, py::arg("valuation_index") = nullptr)
+    .def_property_readonly("nr_states", &ShieldActionMasks::getNumberOfStates, "Number of states")
+    .def_property_readonly("nr_actions", &ShieldActionMasks::getNumberOfActions, "Number of actions, i.e. columns of the masks")
+    .def_property_readonly("action_names", &ShieldActionMasks::getActionNames, "Choice labels or local choice indices of the actions")
+    .def_property_readonly("variable_names", &ShieldActionMasks::getVariableNames, "Variables of the valuations accepted by query_valuations")
+    .def_property_readonly("allowed_choices", &ShieldActionMasks::getAllowedChoices, "Choices (rows of the transition matrix) the shield allows")
+    .def("query", [](ShieldActionMasks const& masks, py::array_t<uint64_t, py::array::c_style | py::array::forcecast> const& states, uint64_t numberOfThreads) {
+            STORM_LOG_THROW(states.ndim() == 1, storm::exceptions::InvalidArgumentException, "Expected a one-dimensional array of state ids.");
+            uint64_t numberOfStates = states.shape(0);
+            py::array_t<bool> result({numberOfStates, masks.getNumberOfActions()});
+            uint64_t const* input = states.data();
+            bool* output = result.mutable_data();
+            {
+                py::gil_scoped_release release;
+                masks.getMasks(input, numberOfStates, output, numberOfThreads);
+            }
+            return result;
+        }, "Get the masks of allowed actions as a boolean array of shape (len(state_ids), nr_actions)", py::arg("state_ids"), py::arg("number_of_threads") = 0)
+    .def("query_valuations", [](ShieldActionMasks const& masks, py::array_t<int64_t, py::array::c_style | py::array::forcecast> const& valuations, uint64_t numberOfThreads) {
+            STORM_LOG_THROW(valuations.ndim() == 2 && static_cast<uint64_t>(valuations.shape(1)) == masks.getVariableNames().size(), storm::exceptions::InvalidArgumentException, "Expected an array of shape (n, " << masks.getVariableNames().size() << ").");
+            uint64_t numberOfStates = valuations.shape(0);
+            py::array_t<bool> result({numberOfStates, masks.getNumberOfActions()});
+            int64_t const* input = valuations.data();
+            bool* output = result.mutable_data();
+            {
+                py::gil_scoped_release release;
+                masks.getMasksOfValuations(input, numberOfStates, output, numberOfThreads);
+            }
+            return result;
+        }, "Get the masks of allowed actions for states given by their valuations (one row per state, columns as in variable_names). Unknown states allow no action", py::arg("valuations"), py::arg("number_of_threads") = 0)
     ;
 }
 
@@ -0,0 +1,35 @@
+#include "safety_ltl_shield.h"
+
+#include "storm/shields/SafetyLtlShield.h"
+#include "storm/shields/AbstractShield.h"
+
+#include "storm/storage/PreSchedulerChoice.h"
+
+
+void define_safety_monitor(py::module& m) {
+    using SafetyMonitor = tempest::shields::SafetyMonitor;
+
+    py::class_<SafetyMonitor>(m, "SafetyMonitor", "Monitor tracking a safety LTL formula along a run of a game")
+    .def("initial_state", &SafetyMonitor::getInitialState, "Get the monitor state after starting in the given model state", py::arg("model_state"))
+    .def("successor", &SafetyMonitor::getSuccessor, "Get the monitor state after moving to the given model state", py::arg("monitor_state"), py::arg("model_state"))
+    .def("is_violated", &SafetyMonitor::isViolated, "Is the formula violated in the given monitor state?", py::arg("monitor_state"))
+    .def("is_satisfied", &SafetyMonitor::isSatisfied, "Is the formula satisfied by every continuation in the given monitor state?", py::arg("monitor_state"))
+    .def_property_readonly("nr_states", &SafetyMonitor::getNumberOfStates, "Number of monitor states")
+    ;
+}
+
+template <typename ValueType, typename IndexType>
+void define_safety_ltl_shield(py::module& m, std::string vt_suffix) {
+    using SafetyLtlShield = tempest::shields::SafetyLtlShield<ValueType, IndexType>;
+    using AbstractShield = tempest::shields::AbstractShield<ValueType, IndexType>;
+
+    std::string shieldClassName = std::string("SafetyLtlShield") + vt_suffix;
+
+    py::class_<SafetyLtlShield, AbstractShield, std::shared_ptr<SafetyLtlShield>>(m, shieldClassName.c_str())
+    .def_property_readonly("monitor", &SafetyLtlShield::getMonitor, py::return_value_policy::reference_internal, "The monitor of the formula")
+    .def("get_choice", &SafetyLtlShield::getChoice, "Get the allowed choices in a model state for the given monitor state", py::arg("model_state"), py::arg("monitor_state"))
+    ;
+}
+
+template void define_safety_ltl_shield<double, typename storm::storage::SparseMatrix<double>::index_type>(py::module& m, std::string vt_suffix);
+template void define_safety_ltl_shield<storm::RationalNumber, typename storm::storage::SparseMatrix<storm::RationalNumber>::index_type>(py::module& m, std::string vt_suffix);
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "common.h"
+
+void define_safety_monitor(py::module& m);
+
+template <typename ValueType, typename IndexType>
+void define_safety_ltl_shield(py::module& m, std::string vt_suffix);
@@ -0,0 +1,93 @@
+#include "shield_evaluation.h"
+
+#include "storm/shields/StatisticalShieldEvaluation.h"
+#include "storm/models/sparse/Smg.h"
+#include "storm/logic/PlayerCoalition.h"
+#include "storm/storage/BitVector.h"
+
+#include <sstream>
+
+void define_shield_evaluation_options(py::module& m) {
+    using Options = tempest::shields::ShieldEvaluationOptions;
+    using Result = tempest::shields::ShieldEvaluationResult;
+
+    py::enum_<tempest::shields::PlayerBehavior>(m, "PlayerBehavior", "How a player picks its choices during the evaluation")
+        .value("UNIFORM", tempest::shields::PlayerBehavior::Uniform)
+        .value("ADVERSARIAL", tempest::shields::PlayerBehavior::Adversarial)
+    ;
+
+    py::enum_<tempest::shields::StatisticalTest>(m, "StatisticalTest", "The statistical test deciding when to stop simulating")
+        .value("CLOPPER_PEARSON", tempest::shields::StatisticalTest::ClopperPearson)
+        .value("SPRT", tempest::shields::StatisticalTest::Sprt)
+    ;
+
+    py::enum_<tempest::shields::ThresholdDecision>(m, "ThresholdDecision", "Whether the violation probability is below or above the threshold")
+        .value("UNDECIDED", tempest::shields::ThresholdDecision::Undecided)
+        .value("BELOW_THRESHOLD", tempest::shields::ThresholdDecision::BelowThreshold)
+        .value("ABOVE_THRESHOLD", tempest::shields::ThresholdDecision::AboveThreshold)
+    ;
+
+    py::class_<Options>(m, "ShieldEvaluationOptions", "Options for the statistical evaluation of shields")
+        .def(py::init<>())
+        .def_readwrite("horizon", &Options::horizon, "Maximal number of steps of an episode")
+        .def_readwrite("shielded_behavior", &Options::shieldedBehavior, "Behavior of the shielded player among the allowed choices")
+        .def_readwrite("environment_behavior", &Options::environmentBehavior, "Behavior of the other players")
+        .def_readwrite("test", &Options::test, "Statistical test")
+        .def_readwrite("confidence", &Options::confidence, "Confidence of the interval")
+        .def_readwrite("precision", &Options::precision, "Half width of the interval at which Clopper-Pearson stops")
+        .def_property("threshold", [](Options const& options) -> py::object {
+                return options.threshold ? py::cast(options.threshold.get()) : py::none();
+            }, [](Options& options, py::object const& threshold) {
+                options.threshold = threshold.is_none() ? boost::none : boost::optional<double>(threshold.cast<double>());
+            }, "Threshold on the violation probability or None")
+        .def_readwrite("indifference", &Options::indifference, "Half width of the indifference region of the SPRT")
+        .def_readwrite("alpha", &Options::alpha, "Probability that the SPRT wrongly decides above the threshold")
+        .def_readwrite("beta", &Options::beta, "Probability that the SPRT wrongly decides below the threshold")
+        .def_readwrite("batch_size", &Options::batchSize, "Number of episodes simulated between two checks of the statistics")
+        .def_readwrite("max_nr_episodes", &Options::maximalNumberOfEpisodes, "Maximal number of simulated episodes")
+        .def_readwrite("seed", &Options::seed, "Seed of the simulation")
+        .def_readwrite("number_of_threads", &Options::numberOfThreads, "Number of threads, zero for all hardware threads")
+    ;
+
+    py::class_<Result>(m, "ShieldEvaluationResult", "Result of the statistical evaluation of a shield")
+        .def_readonly("nr_episodes", &Result::numberOfEpisodes, "Number of simulated episodes")
+        .def_readonly("nr_violations", &Result::numberOfViolations, "Number of episodes that reached a bad state")
+        .def_readonly("nr_unfinished_episodes", &Result::numberOfUnfinishedEpisodes, "Number of episodes that reached the horizon")
+        .def_readonly("estimate", &Result::estimate, "Estimated violation probability")
+        .def_readonly("lower_bound", &Result::lowerBound, "Lower bound of the confidence interval")
+        .def_readonly("upper_bound", &Result::upperBound, "Upper bound of the confidence interval")
+        .def_readonly("decision", &Result::decision, "Decision with respect to the threshold")
+        .def("__str__", [](Result const& result) {
+                std::stringstream stream;
+                stream << result.estimate << " in [" << result.lowerBound << ", " << result.upperBound << "] (" << result.numberOfViolations << " of " << result.numberOfEpisodes << " episodes)";
+                return stream.str();
+            })
+    ;
+
+    m.def("compute_clopper_pearson_interval", &tempest::shields::computeClopperPearsonInterval, "Compute the Clopper-Pearson interval of a binomial distribution", py::arg("nr_successes"), py::arg("nr_trials"), py::arg("confidence"));
+}
+
+template <typename ValueType>
+void define_shield_evaluation(py::module& m, std::string vt_suffix) {
+    using Evaluator = tempest::shields::StatisticalShieldEvaluator<ValueType>;
+    std::string evaluatorClassName = std::string("StatisticalShieldEvaluator") + vt_suffix;
+
+    py::class_<Evaluator>(m, evaluatorClassName.c_str(), "Estimates the violation probability of a shielded game by simulation")
+    .def("__init__", [](Evaluator& instance, storm::models::sparse::Model<ValueType> const& model, storm::storage::BitVector const& shieldedStates, storm::storage::BitVector const& allowedChoices, storm::storage::BitVector const& badStates) -> void {
+            new (&instance) Evaluator(model, shieldedStates, allowedChoices, badStates);
+        }, py::arg("model"), py::arg("shielded_states"), py::arg("allowed_choices"), py::arg("bad_states"), py::keep_alive<1, 2>())
+    .def("__init__", [](Evaluator& instance, storm::models::sparse::Smg<ValueType> const& game, std::vector<std::string> const& coalition, storm::storage::BitVector const& allowedChoices, storm::storage::BitVector const& badStates) -> void {
+            std::vector<boost::variant<std::string, storm::storage::PlayerIndex>> players(coalition.begin(), coalition.end());
+            new (&instance) Evaluator(game, storm::logic::PlayerCoalition(players), allowedChoices, badStates);
+        }, py::arg("game"), py::arg("coalition"), py::arg("allowed_choices"), py::arg("bad_states"), py::keep_alive<1, 2>())
+    .def("set_stop_states", &Evaluator::setStopStates, py::arg("stop_states"), "Episodes that reach these states end without a violation")
+    .def("evaluate", [](Evaluator const& evaluator, tempest::shields::ShieldEvaluationOptions const& options) {
+            py::gil_scoped_release release;
+            return evaluator.evaluate(options);
+        }, py::arg("options"), "Simulate episodes until the statistical test stops")
+    .def("compute_choices_of_players", &Evaluator::computeChoicesOfPlayers, py::arg("options"), "Compute the choices the players pick from under the given behaviors")
+    ;
+}
+
+template void define_shield_evaluation<double>(py::module& m, std::string vt_suffix);
+template void define_shield_evaluation<storm::RationalNumber>(py::module& m, std::string vt_suffix);
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "common.h"
+
+void define_shield_evaluation_options(py::module& m);
+
+template <typename ValueType>
+void define_shield_evaluation(py::module& m, std::string vt_suffix);
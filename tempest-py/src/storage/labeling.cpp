@@ -4,6 +4,10 @@
 #include "storm/models/sparse/ItemLabeling.h"
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/models/sparse/ChoiceLabeling.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+#include <pybind11/numpy.h>
 
 // Define python bindings
 void define_labeling(py::module& m) {
@@ -41,6 +45,27 @@ void define_labeling(py::module& m) {
             .def("set_choices", [](storm::models::sparse::ChoiceLabeling& labeling, std::string const& label, storm::storage::BitVector const& choices) {
                 labeling.setChoices(label, choices);
             },  "Add a label to a the given choices", py::arg("label"), py::arg("choices"))
+            .def("compute_label_ids", &storm::models::sparse::ChoiceLabeling::computeLabelIds, "Compute the label id of each choice if every choice has at most one label, returns whether this succeeded")
+            .def("has_label_ids", &storm::models::sparse::ChoiceLabeling::hasLabelIds, "Check whether the label id of each choice is available")
+            .def("get_labels_by_id", &storm::models::sparse::ChoiceLabeling::getLabelsById, "Get the labels ordered by their id")
+            .def("get_label_id_of_choice", [](storm::models::sparse::ChoiceLabeling const& labeling, uint64_t choice) -> py::object {
+                uint64_t labelId;
+                labeling.getLabelIdsOfChoices(&choice, 1, &labelId);
+                return labelId == storm::models::sparse::ChoiceLabeling::NO_LABEL ? py::none() : py::cast(labelId);
+            }, py::arg("choice"), "Get the id of the label of the given choice or None if the choice has no label")
+            .def("get_label_ids_of_choices", [](storm::models::sparse::ChoiceLabeling const& labeling, py::array_t<uint64_t, py::array::c_style | py::array::forcecast> const& choices) {
+                STORM_LOG_THROW(choices.ndim() == 1, storm::exceptions::InvalidArgumentException, "Expected a one-dimensional array of choices.");
+                uint64_t numberOfChoices = choices.shape(0);
+                py::array_t<uint64_t> result(numberOfChoices);
+                uint64_t const* input = choices.data();
+                uint64_t* output = result.mutable_data();
+                {
+                    py::gil_scoped_release release;
+                    labeling.getLabelIdsOfChoices(input, numberOfChoices, output);
+                }
+                return result;
+            }, py::arg("choices"), "Get the label ids of the given choices, choices without label are mapped to NO_LABEL")
+            .def_property_readonly_static("NO_LABEL", [](py::object const&) { return storm::models::sparse::ChoiceLabeling::NO_LABEL; })
             .def("__str__", &streamToString<storm::models::sparse::ChoiceLabeling>)
     ;
 }
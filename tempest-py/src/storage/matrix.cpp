@@ -4,6 +4,7 @@
 
 #include "storm/utility/graph.h"
 #include "src/helpers.h"
+#include "src/views.h"
 
 template<typename ValueType> using SparseMatrix = storm::storage::SparseMatrix<ValueType>;
 template<typename ValueType> using SparseMatrixBuilder = storm::storage::SparseMatrixBuilder<ValueType>;
@@ -12,6 +13,17 @@ template<typename ValueType> using MatrixEntry = storm::storage::MatrixEntry<ent
 using RationalFunction = storm::RationalFunction;
 using row_index = unsigned int;
 
+// Read-only view on the columns or values of the entries of a matrix. As both are stored interleaved, the view skips
+// over the other member of each entry.
+template<typename T>
+py::array entryMemberView(py::object const& self, bool values) {
+    auto const& entries = self.cast<SparseMatrix<double> const&>().getColumnsAndValues();
+    MatrixEntry<double> entry;
+    char const* member = values ? reinterpret_cast<char const*>(&entry.getValue()) : reinterpret_cast<char const*>(&entry.getColumn());
+    char const* data = entries.empty() ? nullptr : reinterpret_cast<char const*>(entries.data()) + (member - reinterpret_cast<char const*>(&entry));
+    return readOnlyView(py::dtype::of<T>(), {entries.size()}, {sizeof(MatrixEntry<double>)}, reinterpret_cast<T const*>(data), self);
+}
+
 void define_sparse_matrix_nt(py::module& m) {
     m.def("_topological_sort_double", [](SparseMatrix<double>& matrix, std::vector<uint64_t> initial) { return storm::utility::graph::getTopologicalSort(matrix, initial); }, "matrix"_a, "initial"_a,  "get topological sort w.r.t. a transition matrix");
     m.def("_topological_sort_rf", [](SparseMatrix<storm::RationalFunction>& matrix, std::vector<uint64_t> initial) { return storm::utility::graph::getTopologicalSort(matrix, initial); }, "matrix"_a, "initial"_a,  "get topological sort w.r.t. a transition matrix");
@@ -65,7 +77,8 @@ void define_sparse_matrix(py::module& m, std::string const& vtSuffix) {
     ;
 
     // SparseMatrix
-    py::class_<SparseMatrix<ValueType>>(m, (vtSuffix + "SparseMatrix").c_str(), "Sparse matrix")
+    py::class_<SparseMatrix<ValueType>> sparseMatrix(m, (vtSuffix + "SparseMatrix").c_str(), "Sparse matrix");
+    sparseMatrix
         .def("__iter__", [](SparseMatrix<ValueType>& matrix) {
                 return py::make_iterator(matrix.begin(), matrix.end());
             }, py::keep_alive<0, 1>() /* Essential: keep object alive while iterator exists */)
@@ -117,6 +130,24 @@ void define_sparse_matrix(py::module& m, std::string const& vtSuffix) {
             }, py::return_value_policy::reference, py::keep_alive<1, 0>())
     ;
 
+    // The compressed row storage as read-only numpy arrays that share the memory of the matrix and keep it alive.
+    if constexpr (std::is_same<ValueType, double>::value) {
+        sparseMatrix
+            .def_property_readonly("row_indications", [](py::object const& self) {
+                    return readOnlyView(self.cast<SparseMatrix<double> const&>().getRowIndications(), self);
+                }, "Index of the first entry of each row (and the number of entries at the end) as a read-only numpy array without copying")
+            .def_property_readonly("columns", [](py::object const& self) {
+                    return entryMemberView<entry_index<double>>(self, false);
+                }, "Column of each entry as a read-only numpy array without copying")
+            .def_property_readonly("values", [](py::object const& self) {
+                    return entryMemberView<double>(self, true);
+                }, "Value of each entry as a read-only numpy array without copying")
+            .def_property_readonly("row_group_indices", [](py::object const& self) {
+                    return readOnlyView(self.cast<SparseMatrix<double> const&>().getRowGroupIndices(), self);
+                }, "First row of each row group (and the number of rows at the end) as a read-only numpy array without copying")
+        ;
+    }
+
 
     // Rows
     py::class_<typename SparseMatrix<ValueType>::rows>(m, (vtSuffix + "SparseMatrixRows").c_str(), "Set of rows in a sparse matrix")
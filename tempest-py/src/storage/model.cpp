@@ -142,6 +142,12 @@ void define_model(py::module& m) {
         .def("_as_sparse_ppomdp", [](ModelBase &modelbase) {
             return modelbase.as<SparsePomdp<RationalFunction>>();
         }, "Get model as sparse pPOMDP")
+        .def("_as_sparse_smg", [](ModelBase &modelbase) {
+                return modelbase.as<Smg<double>>();
+            }, "Get model as sparse SMG")
+        .def("_as_sparse_psmg", [](ModelBase &modelbase) {
+                return modelbase.as<Smg<RationalFunction>>();
+            }, "Get model as sparse pSMG")
         .def("_as_sparse_ctmc", [](ModelBase &modelbase) {
                 return modelbase.as<SparseCtmc<double>>();
             }, "Get model as sparse CTMC")
@@ -200,7 +206,7 @@ void define_sparse_model(py::module& m, std::string const& vtSuffix) {
                 return SparseModelStates<ValueType>(model);
             }, "Get states")
         .def_property_readonly("reward_models", [](SparseModel<ValueType>& model) {return model.getRewardModels(); }, "Reward models")
-        .def_property_readonly("transition_matrix", &getTransitionMatrix<ValueType>, py::return_value_policy::reference, py::keep_alive<1, 0>(), "Transition matrix")
+        .def_property_readonly("transition_matrix", &getTransitionMatrix<ValueType>, py::return_value_policy::reference_internal, "Transition matrix")
         .def_property_readonly("backward_transition_matrix", &SparseModel<ValueType>::getBackwardTransitions, py::return_value_policy::reference, py::keep_alive<1, 0>(), "Backward transition matrix")
         .def("get_reward_model", [](SparseModel<ValueType>& model, std::string const& name) {return model.getRewardModel(name);}, py::return_value_policy::reference, py::keep_alive<1, 0>(), "Reward model")
         .def("has_state_valuations", [](SparseModel<ValueType> const& model) {return model.hasStateValuations();}, "has state valuation?")
@@ -307,7 +313,7 @@ void define_sparse_parametric_model(py::module& m) {
                 return SparseModelStates<RationalFunction>(model);
             }, "Get states")
         .def_property_readonly("reward_models", [](SparseModel<RationalFunction> const& model) {return model.getRewardModels(); }, "Reward models")
-        .def_property_readonly("transition_matrix", &getTransitionMatrix<RationalFunction>, py::return_value_policy::reference, py::keep_alive<1, 0>(), "Transition matrix")
+        .def_property_readonly("transition_matrix", &getTransitionMatrix<RationalFunction>, py::return_value_policy::reference_internal, "Transition matrix")
         .def_property_readonly("backward_transition_matrix", &SparseModel<RationalFunction>::getBackwardTransitions, py::return_value_policy::reference, py::keep_alive<1, 0>(), "Backward transition matrix")
         .def("has_state_valuations", [](SparseModel<RationalFunction> const& model) {return model.hasStateValuations();}, "has state valuation?")
         .def_property_readonly("state_valuations",  [](SparseModel<RationalFunction> const& model) {return model.getStateValuations();}, "state valuations")
@@ -342,6 +348,12 @@ void define_sparse_parametric_model(py::module& m) {
         .def("apply_scheduler", [](SparseMarkovAutomaton<RationalFunction> const& ma, storm::storage::Scheduler<RationalFunction> const& scheduler, bool dropUnreachableStates) { return ma.applyScheduler(scheduler, dropUnreachableStates); } , "apply scheduler", "scheduler"_a, "drop_unreachable_states"_a = true)
         .def("__str__", &getModelInfoPrinter)
     ;
+    py::class_<Smg<RationalFunction>, std::shared_ptr<Smg<RationalFunction>>>(m, "SparseParametricSmg", "pSMG in sparse representation", modelRatFunc)
+        .def_property_readonly("nondeterministic_choice_indices", [](Smg<RationalFunction> const& smg) { return smg.getNondeterministicChoiceIndices(); })
+        .def("get_player_of_state", &Smg<RationalFunction>::getPlayerOfState, py::arg("state_index"))
+        .def("get_player_index", &Smg<RationalFunction>::getPlayerIndex, py::arg("player_name"))
+        .def("__str__", &getModelInfoPrinter)
+    ;
 
     py::class_<SparseRewardModel<RationalFunction>>(m, "SparseParametricRewardModel", "Reward structure for parametric sparse models")
         .def_property_readonly("has_state_rewards", &SparseRewardModel<RationalFunction>::hasStateRewards)
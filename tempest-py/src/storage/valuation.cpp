@@ -2,14 +2,37 @@
 #include "src/helpers.h"
 
 #include "storm/storage/sparse/StateValuations.h"
+#include "storm/storage/sparse/StateValuationIndex.h"
 #include "storm/storage/expressions/Variable.h"
 #include "storm/storage/expressions/ExpressionManager.h"
+#include "storm/utility/macros.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+
+#include <pybind11/numpy.h>
 
 // Thin wrappers
 std::string toJson(storm::storage::sparse::StateValuations const& valuations, storm::storage::sparse::state_type const& stateIndex, boost::optional<std::set<storm::expressions::Variable>> const& selectedVariables) {
     return valuations.toJson(stateIndex, selectedVariables).dump();
 }
 
+py::array getColumn(py::object const& self, storm::expressions::Variable const& variable) {
+    auto const& valuations = self.cast<storm::storage::sparse::StateValuations const&>();
+    auto column = valuations.getColumn(variable);
+    py::dtype dtype = py::dtype::of<bool>();
+    if (variable.hasIntegerType()) {
+        switch (column.second) {
+            case 1: dtype = py::dtype::of<int8_t>(); break;
+            case 2: dtype = py::dtype::of<int16_t>(); break;
+            case 4: dtype = py::dtype::of<int32_t>(); break;
+            default: dtype = py::dtype::of<int64_t>();
+        }
+    }
+    // The array is a read-only view on the stored values that keeps the valuations alive.
+    py::array result(dtype, {valuations.getNumberOfStates()}, {column.second}, column.first, self);
+    result.attr("flags").attr("writeable") = false;
+    return result;
+}
+
 void add_state(storm::storage::sparse::StateValuationsBuilder& builder, storm::storage::sparse::state_type const& state, std::vector<bool>&& booleanValues, std::vector<int64_t>&& integerValues, std::vector<storm::RationalNumber>&& rationalValues) {
     return builder.addState(state, std::move(booleanValues), std::move(integerValues), std::move(rationalValues));
 }
@@ -24,16 +47,58 @@ void define_statevaluation(py::module& m) {
         .def("get_rational_value", &storm::storage::sparse::StateValuations::getRationalValue, py::arg("state"), py::arg("variable"))
         .def("get_string", &storm::storage::sparse::StateValuations::toString, py::arg("state"), py::arg("pretty")=true, py::arg("selected_variables")=boost::none)
         .def("get_json", &toJson, py::arg("state"), py::arg("selected_variables")=boost::none)
-        .def("get_nr_of_states", &storm::storage::sparse::StateValuations::getNumberOfStates);
+        .def("get_nr_of_states", &storm::storage::sparse::StateValuations::getNumberOfStates)
+        .def_property_readonly("variables", &storm::storage::sparse::StateValuations::getVariables, "The variables of the valuations")
+        .def("get_column", &getColumn, py::arg("variable"), "Get the values of a boolean or integer variable for all states as a read-only numpy array without copying")
+        .def("get_column", [](py::object const& self, std::string const& name) {
+                for (auto const& variable : self.cast<storm::storage::sparse::StateValuations const&>().getVariables()) {
+                    if (variable.getName() == name) {
+                        return getColumn(self, variable);
+                    }
+                }
+                STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "The state valuations do not contain a variable named " << name << ".");
+            }, py::arg("variable_name"), "Get the values of the boolean or integer variable with the given name for all states as a read-only numpy array without copying")
     ;
 
 
     py::class_<storm::storage::sparse::StateValuationsBuilder, std::shared_ptr<storm::storage::sparse::StateValuationsBuilder>>(m,"StateValuationsBuilder")
             .def(py::init<>())
-            .def("add_variable", &storm::storage::sparse::StateValuationsBuilder::addVariable, py::arg("variable"), "Adds a new variable")
+            .def("add_variable", py::overload_cast<storm::expressions::Variable const&>(&storm::storage::sparse::StateValuationsBuilder::addVariable), py::arg("variable"), "Adds a new variable")
+            .def("add_variable", py::overload_cast<storm::expressions::Variable const&, int64_t, int64_t>(&storm::storage::sparse::StateValuationsBuilder::addVariable), py::arg("variable"), py::arg("lower_bound"), py::arg("upper_bound"), "Adds a new integer variable with the given bounds")
             .def("add_state", &add_state, py::arg("state"), py::arg("boolean_values") = std::vector<bool>(), py::arg("integer_values") = std::vector<int64_t>(), py::arg("rational_values") = std::vector<storm::RationalNumber>(), "Adds a new state, no more variables should be added afterwards")
             .def("build", &storm::storage::sparse::StateValuationsBuilder::build, "Creates the finalized state valuations object")
             ;
 
+    using StateValuationIndex = storm::storage::sparse::StateValuationIndex;
+    py::class_<StateValuationIndex, std::shared_ptr<StateValuationIndex>>(m, "StateValuationIndex", "Maps values of selected variables back to the states with these values")
+            .def(py::init<storm::storage::sparse::StateValuations const&, std::vector<std::string> const&>(), py::arg("valuations"), py::arg("variable_names"), "Build the index over the variables with the given names")
+            .def(py::init<storm::storage::sparse::StateValuations const&>(), py::arg("valuations"), "Build the index over all boolean and integer variables")
+            .def_property_readonly("variable_names", &StateValuationIndex::getVariableNames, "Variables in the order in which values are given")
+            .def_property_readonly("nr_keys", &StateValuationIndex::getNumberOfKeys, "Number of distinct value tuples")
+            .def("get_states", [](StateValuationIndex const& index, std::vector<int64_t> const& values) {
+                    STORM_LOG_THROW(values.size() == index.getVariables().size(), storm::exceptions::InvalidArgumentException, "Expected " << index.getVariables().size() << " values.");
+                    auto range = index.getStates(values.data());
+                    return std::vector<uint64_t>(range.first, range.second);
+                }, py::arg("values"), "Get all states with the given values (booleans given as 0 and 1)")
+            .def("get_state", [](StateValuationIndex const& index, std::vector<int64_t> const& values) -> py::object {
+                    STORM_LOG_THROW(values.size() == index.getVariables().size(), storm::exceptions::InvalidArgumentException, "Expected " << index.getVariables().size() << " values.");
+                    uint64_t state = index.getState(values.data());
+                    return state == StateValuationIndex::UNKNOWN_STATE ? py::none() : py::cast(state);
+                }, py::arg("values"), "Get the smallest state with the given values or None")
+            .def("lookup", [](StateValuationIndex const& index, py::array_t<int64_t, py::array::c_style | py::array::forcecast> const& values) {
+                    STORM_LOG_THROW(values.ndim() == 2 && static_cast<uint64_t>(values.shape(1)) == index.getVariables().size(), storm::exceptions::InvalidArgumentException, "Expected an array of shape (n, " << index.getVariables().size() << ").");
+                    uint64_t numberOfTuples = values.shape(0);
+                    py::array_t<uint64_t> result(numberOfTuples);
+                    int64_t const* input = values.data();
+                    uint64_t* output = result.mutable_data();
+                    {
+                        py::gil_scoped_release release;
+                        index.getStates(input, numberOfTuples, output);
+                    }
+                    return result;
+                }, py::arg("values"), "Get the smallest state for each row of values, unknown rows are mapped to UNKNOWN_STATE")
+            .def_property_readonly_static("UNKNOWN_STATE", [](py::object const&) { return StateValuationIndex::UNKNOWN_STATE; })
+            ;
+
 
 }
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "src/common.h"
+
+#include <pybind11/numpy.h>
+
+// Read-only numpy view on the given data that keeps the owner alive.
+template<typename T>
+py::array readOnlyView(py::dtype const& dtype, std::vector<size_t> const& shape, T const* data, py::object const& owner) {
+    py::array result(dtype, shape, data, owner);
+    result.attr("flags").attr("writeable") = false;
+    return result;
+}
+
+// Read-only numpy view on the given data with the given strides (in bytes), e.g. on one member of an array of structs.
+template<typename T>
+py::array readOnlyView(py::dtype const& dtype, std::vector<size_t> const& shape, std::vector<size_t> const& strides, T const* data, py::object const& owner) {
+    py::array result(dtype, shape, strides, data, owner);
+    result.attr("flags").attr("writeable") = false;
+    return result;
+}
+
+// Read-only numpy view on the values of the given vector that keeps the owner alive.
+template<typename T>
+py::array readOnlyView(std::vector<T> const& values, py::object const& owner) {
+    return readOnlyView(py::dtype::of<T>(), {values.size()}, values.data(), owner);
+}
@@ -0,0 +1,47 @@
+import stormpy
+import stormpy.simulator
+import stormpy.examples
+import stormpy.examples.files
+
+from configurations import numpy_avail
+
+
+@numpy_avail
+class TestBatchedSimulator:
+    def test_die(self):
+        import numpy as np
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_dtmc_die)
+        model = stormpy.build_model(program)
+        simulator = stormpy.simulator.create_batched_simulator(model, 20000, seed=42)
+        assert simulator.nr_episodes == 20000
+        states = simulator.current_states
+        assert not states.flags.writeable
+        assert np.all(states == model.initial_states[0])
+
+        for _ in range(200):
+            simulator.random_step()
+        assert np.all(simulator.done)
+        # The views are updated in place.
+        assert np.all(states == simulator.current_states)
+        ones = np.array([model.labeling.has_state_label("one", s) for s in range(model.nr_states)])
+        assert abs(ones[states].mean() - 1 / 6) < 0.02
+
+        simulator.reset_to_initial_state()
+        assert not np.any(simulator.done)
+
+    def test_allowed_choices(self):
+        import numpy as np
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_mdp_coin_2_2)
+        model = stormpy.build_model(program)
+        initial = model.initial_states[0]
+        first_row = model.transition_matrix.get_row_group_start(initial)
+        nr_local_choices = model.transition_matrix.get_row_group_end(initial) - first_row
+        assert nr_local_choices > 1
+        allowed = stormpy.BitVector(model.nr_choices, True)
+        for row in range(first_row, first_row + nr_local_choices - 1):
+            allowed.set(row, False)
+        simulator = stormpy.simulator.create_batched_simulator(model, 10)
+        simulator.set_allowed_choices(allowed)
+        simulator.step(np.zeros(10, dtype=np.uint64))
+        assert np.all(simulator.last_choices == first_row + nr_local_choices - 1)
+        assert np.all(simulator.overridden)
@@ -1,5 +1,7 @@
 import stormpy
 import stormpy.logic
+import stormpy.examples
+import stormpy.examples.files
 from helpers.helper import get_example_path
 
 import math
@@ -91,3 +93,27 @@ class TestBisimulation:
         assert model_bisim.nr_transitions == 454
         assert model_bisim.model_type == stormpy.ModelType.DTMC
         assert model_bisim.has_parameters
+
+    def test_game_bisimulation(self):
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_smg_lights)
+        properties = stormpy.parse_properties_for_prism_program("<<shield>> R{\"differenceWithInterferenceCost\"}min=? [ LRA ]", program)
+        options = stormpy.BuilderOptions([p.raw_formula for p in properties])
+        options.set_build_choice_labels(True)
+        model = stormpy.build_sparse_model_with_options(program, options)
+        assert model.model_type == stormpy.ModelType.SMG
+
+        decomposition = stormpy.compute_game_bisimulation(model, properties)
+        quotient = decomposition.quotient
+        assert quotient.model_type == stormpy.ModelType.SMG
+        assert quotient.nr_states <= model.nr_states
+        state_mapping = decomposition.quotient_state_mapping
+        assert len(state_mapping) == model.nr_states
+        assert len(decomposition.quotient_choice_mapping) == model.nr_choices
+        for state in range(model.nr_states):
+            assert model.get_player_of_state(state) == quotient.get_player_of_state(state_mapping[state])
+
+        result = stormpy.model_checking(model, properties[0])
+        quotient_result = stormpy.model_checking(quotient, properties[0])
+        lifted = decomposition.lift_state_values(quotient_result.get_values())
+        for state in range(model.nr_states):
+            assert math.isclose(result.at(state), lifted[state], rel_tol=1e-4, abs_tol=1e-6)
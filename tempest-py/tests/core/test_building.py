@@ -34,3 +34,20 @@ class TestBuilding:
         assert model.state_valuations.get_integer_value(id, s_var) == 7
         assert model.state_valuations.get_integer_value(id, d_var) == 3
 
+
+    def test_build_smg_with_cache(self, tmp_path):
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_smg_lights)
+        options = stormpy.BuilderOptions(True, True)
+        options.set_build_state_valuations(True)
+        options.set_build_choice_labels(True)
+        model = stormpy.build_sparse_model_with_cache(program, options, str(tmp_path))
+        assert model.model_type == stormpy.ModelType.SMG
+        key = stormpy.compute_model_cache_key(program, options)
+        assert (tmp_path / (key + ".smgb")).exists()
+
+        cached = stormpy.build_sparse_model_with_cache(program, options, str(tmp_path))
+        assert cached.nr_states == model.nr_states
+        assert cached.nr_transitions == model.nr_transitions
+        assert cached.labeling.get_labels() == model.labeling.get_labels()
+        for state in range(model.nr_states):
+            assert cached.state_valuations.get_string(state) == model.state_valuations.get_string(state)
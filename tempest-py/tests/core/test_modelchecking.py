@@ -1,6 +1,7 @@
 import stormpy
 import stormpy.logic
 from helpers.helper import get_example_path
+from configurations import numpy_avail
 
 import math
 
@@ -30,6 +31,18 @@ class TestModelChecking:
         result = stormpy.model_checking(model, formulas[0])
         assert math.isclose(result.at(initial_state), 49 / 128, rel_tol=1e-5)
 
+    def test_model_checking_all_properties(self):
+        program = stormpy.parse_prism_program(get_example_path("dtmc", "die.pm"))
+        formulas = stormpy.parse_properties_for_prism_program("P=? [ F \"one\" ]; P=? [ F \"two\" ]; P=? [ F \"done\" ]; P=? [ !\"done\" U \"one\" ]", program)
+        model = stormpy.build_model(program, formulas)
+        initial_state = model.initial_states[0]
+        results = stormpy.model_checking_all(model, formulas, number_of_threads=2)
+        assert len(results) == 4
+        for result, expected in zip(results, [1 / 6, 1 / 6, 1, 1 / 6]):
+            assert math.isclose(result.at(initial_state), expected)
+        for formula, result in zip(formulas, results):
+            assert math.isclose(result.at(initial_state), stormpy.model_checking(model, formula).at(initial_state))
+
     def test_model_checking_jani_dtmc(self):
         jani_model, formulas = stormpy.parse_jani_model(get_example_path("dtmc", "die.jani"))
         formulas = stormpy.eliminate_reward_accumulations(jani_model, formulas)
@@ -71,6 +84,20 @@ class TestModelChecking:
         reference = [1 / 6, 1 / 3, 0, 2 / 3, 0, 0, 0, 1, 0, 0, 0, 0, 0]
         assert all(map(math.isclose, result.get_values(), reference))
 
+    @numpy_avail
+    def test_model_checking_values_array(self):
+        import numpy as np
+        program = stormpy.parse_prism_program(get_example_path("dtmc", "die.pm"))
+        formulas = stormpy.parse_properties_for_prism_program("P=? [ F \"one\" ]", program)
+        model = stormpy.build_model(program, formulas)
+        result = stormpy.model_checking(model, formulas[0])
+        values = result.values
+        assert values.dtype == np.float64
+        assert not values.flags.writeable
+        assert np.allclose(values, result.get_values())
+        del result
+        assert math.isclose(values[0], 1 / 6)
+
     def test_model_checking_only_initial(self):
         program = stormpy.parse_prism_program(get_example_path("dtmc", "die.pm"))
         formulas = stormpy.parse_properties_for_prism_program("Pmax=? [F{\"coin_flips\"}<=3 \"one\"]", program)
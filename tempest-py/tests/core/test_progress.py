@@ -0,0 +1,106 @@
+import stormpy
+from helpers.helper import get_example_path
+
+import math
+import pytest
+
+
+class TestProgress:
+    def test_progress_callback(self):
+        program = stormpy.parse_prism_program(get_example_path("mdp", "coin2-2.nm"))
+        formulas = stormpy.parse_properties_for_prism_program("Pmin=? [ F \"finished\" & \"all_coins_equal_1\"]", program)
+        reports = []
+        model = stormpy.build_model(program, formulas, progress_callback=reports.append)
+        assert model.nr_states == 272
+        assert len(reports) > 0
+        assert all(report.phase == stormpy.ProgressPhase.EXPLORATION for report in reports)
+        assert all(0 < report.explored_states <= model.nr_states for report in reports)
+
+        reports = []
+        result = stormpy.model_checking(model, formulas[0], progress_callback=reports.append)
+        assert math.isclose(result.at(model.initial_states[0]), 49 / 128, rel_tol=1e-5)
+        assert all(report.phase == stormpy.ProgressPhase.SOLVING and report.iteration > 0 for report in reports)
+
+    def test_progress_callback_error(self):
+        program = stormpy.parse_prism_program(get_example_path("mdp", "coin2-2.nm"))
+
+        def callback(report):
+            raise ValueError("Stop")
+
+        with pytest.raises(ValueError):
+            stormpy.build_model(program, progress_callback=callback)
+        # The error does not cancel later computations.
+        model = stormpy.build_model(program)
+        assert model.nr_states == 272
+
+    def test_concurrent_callbacks(self):
+        import threading
+        program = stormpy.parse_prism_program(get_example_path("mdp", "coin2-2.nm"))
+        formulas = stormpy.parse_properties_for_prism_program("Pmin=? [ F \"finished\" & \"all_coins_equal_1\"]", program)
+        model = stormpy.build_model(program, formulas)
+
+        def callback(report):
+            raise ValueError("Stop")
+
+        errors = []
+
+        def check_with_error():
+            try:
+                stormpy.model_checking(model, formulas[0], progress_callback=callback)
+            except ValueError as error:
+                errors.append(error)
+
+        # Each computation only reports to its own callback and the error only cancels the computation that raised it.
+        thread = threading.Thread(target=check_with_error)
+        thread.start()
+        reports = []
+        result = stormpy.model_checking(model, formulas[0], progress_callback=reports.append)
+        thread.join()
+        assert len(errors) == 1
+        assert math.isclose(result.at(model.initial_states[0]), 49 / 128, rel_tol=1e-5)
+        assert len(reports) > 0
+
+    def test_cancellation(self):
+        program = stormpy.parse_prism_program(get_example_path("dtmc", "die.pm"))
+        formulas = stormpy.parse_properties_for_prism_program("P=? [ F \"one\" ]", program)
+        model = stormpy.build_model(program, formulas)
+        token = stormpy.CancellationToken()
+        assert not token.cancelled
+        token.cancel()
+        assert token.cancelled
+        with pytest.raises(stormpy.StormError):
+            stormpy.model_checking(model, formulas[0], cancellation_token=token)
+        # The token only cancels the computations it is passed to.
+        result = stormpy.model_checking(model, formulas[0])
+        assert math.isclose(result.at(model.initial_states[0]), 1 / 6)
+        result = stormpy.model_checking(model, formulas[0], cancellation_token=stormpy.CancellationToken())
+        assert math.isclose(result.at(model.initial_states[0]), 1 / 6)
+        assert token.cancelled
+        with pytest.raises(stormpy.StormError):
+            stormpy.model_checking_all(model, formulas, cancellation_token=token)
+        token.reset()
+        assert not token.cancelled
+        result = stormpy.model_checking(model, formulas[0], cancellation_token=token)
+        assert math.isclose(result.at(model.initial_states[0]), 1 / 6)
+
+    def test_cancellation_during_computation(self):
+        import threading
+        program = stormpy.parse_prism_program(get_example_path("mdp", "coin2-2.nm"))
+        formulas = stormpy.parse_properties_for_prism_program("Pmin=? [ F \"finished\" & \"all_coins_equal_1\"]", program)
+        model = stormpy.build_model(program, formulas)
+        token = stormpy.CancellationToken()
+        errors = []
+
+        def check_with_token():
+            try:
+                stormpy.model_checking(model, formulas[0], progress_callback=lambda report: token.cancel(), cancellation_token=token)
+            except stormpy.StormError as error:
+                errors.append(error)
+
+        # Cancelling the token from its own progress callback stops its computation, a concurrent one keeps running.
+        thread = threading.Thread(target=check_with_token)
+        thread.start()
+        result = stormpy.model_checking(model, formulas[0])
+        thread.join()
+        assert token.cancelled == (len(errors) == 1)
+        assert math.isclose(result.at(model.initial_states[0]), 49 / 128, rel_tol=1e-5)
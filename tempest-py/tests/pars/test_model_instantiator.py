@@ -79,3 +79,22 @@ class TestModelInstantiator:
         res = result.at(model.initial_states[0])
         assert isinstance(res, stormpy.Rational)
         assert res == stormpy.Rational("29/15")
+
+    def test_psmg_instantiation_checker(self):
+        program = stormpy.parse_prism_program(get_example_path("psmg", "slippery_corridor.nm"))
+        formulas = stormpy.parse_properties_for_prism_program("<<robot>> Pmax=? [F \"goal\"]", program)
+        model = stormpy.build_parametric_model(program, formulas)
+
+        parameters = model.collect_probability_parameters()
+        instantiated_model = stormpy.pars.ModelInstantiator(model).instantiate({p: stormpy.RationalRF("0.9") for p in parameters})
+        assert instantiated_model.model_type == stormpy.ModelType.SMG
+        assert instantiated_model.nr_states == model.nr_states
+
+        inst_checker = stormpy.pars.PSmgInstantiationChecker(model)
+        inst_checker.specify_formula(stormpy.ParametricCheckTask(formulas[0].raw_formula, True))
+        inst_checker.set_graph_preserving(True)
+        env = stormpy.Environment()
+        for value in [0.6, 0.9, 0.95, 0.8]:
+            point = {p: stormpy.RationalRF(value) for p in parameters}
+            result = inst_checker.check(env, point)
+            assert math.isclose(result.at(model.initial_states[0]), max(value ** 5, 0.5), rel_tol=1e-6)
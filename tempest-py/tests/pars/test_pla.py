@@ -129,3 +129,52 @@ class TestPLA:
         result_vec = checker.get_bound_all_states(env, region, True)
         assert len(result_vec.get_values()) == model.nr_states
         assert math.isclose(result_vec.at(model.initial_states[0]), 0.836963056082918, rel_tol=1e-6)
+
+    def test_pla_smg(self):
+        program = stormpy.parse_prism_program(get_example_path("psmg", "slippery_corridor.nm"))
+        formulas = stormpy.parse_properties_for_prism_program("<<robot>> Pmax>=0.55 [F \"goal\"]", program)
+        model = stormpy.build_parametric_model(program, formulas)
+        assert model.model_type == stormpy.ModelType.SMG
+        assert model.has_parameters
+        env = stormpy.Environment()
+        checker = stormpy.pars.create_region_checker(env, model, formulas[0].raw_formula)
+        assert type(checker) == stormpy.pars.SmgParameterLiftingModelChecker
+        parameters = model.collect_probability_parameters()
+        assert len(parameters) == 1
+        region = stormpy.pars.ParameterRegion.create_from_string("0.9<=p<=0.99", parameters)
+        assert checker.check_region(env, region) == stormpy.pars.RegionResult.ALLSAT
+        result_vec = checker.get_bound_all_states(env, region, False)
+        assert math.isclose(result_vec.at(model.initial_states[0]), 0.59049, rel_tol=1e-6)
+        region = stormpy.pars.ParameterRegion.create_from_string("0.6<=p<=0.8", parameters)
+        assert checker.check_region(env, region) == stormpy.pars.RegionResult.ALLVIOLATED
+
+    def test_pla_smg_shield(self):
+        import stormpy.shields
+        program = stormpy.parse_prism_program(get_example_path("psmg", "slippery_corridor.nm"))
+        formulas = stormpy.parse_properties_for_prism_program("<<robot>> Pmax>=0.55 [F \"goal\"]", program)
+        model = stormpy.build_parametric_model(program, formulas)
+        env = stormpy.Environment()
+        checker = stormpy.pars.SmgParameterLiftingModelChecker()
+        checker.specify(env, model, formulas[0].raw_formula)
+        parameters = model.collect_probability_parameters()
+        region = stormpy.pars.ParameterRegion.create_from_string("0.9<=p<=0.99", parameters)
+        choice_values = checker.compute_choice_values(env, region)
+        assert len(choice_values) == model.nr_choices
+        shield_expression = stormpy.logic.ShieldExpression(stormpy.logic.ShieldingType.PRE_SAFETY, stormpy.logic.ShieldComparison.ABSOLUTE, 0.55)
+        shield = checker.compute_shield(env, region, shield_expression)
+        assert shield is not None
+
+    def test_pla_smg_parallel_refinement(self):
+        program = stormpy.parse_prism_program(get_example_path("psmg", "slippery_corridor.nm"))
+        formulas = stormpy.parse_properties_for_prism_program("<<robot>> Pmax>=0.55 [F \"goal\"]", program)
+        model = stormpy.build_parametric_model(program, formulas)
+        env = stormpy.Environment()
+        checker = stormpy.pars.SmgParameterLiftingModelChecker()
+        checker.specify(env, model, formulas[0].raw_formula)
+        parameters = model.collect_probability_parameters()
+        region = stormpy.pars.ParameterRegion.create_from_string("0.6<=p<=0.99", parameters)
+        results = checker.perform_region_refinement(env, region, depth_threshold=4, number_of_threads=2)
+        assert len(results) > 1
+        kinds = set(result for _, result in results)
+        assert stormpy.pars.RegionResult.ALLSAT in kinds
+        assert stormpy.pars.RegionResult.ALLVIOLATED in kinds
@@ -0,0 +1,65 @@
+import json
+
+import stormpy
+import stormpy.logic
+import stormpy.examples
+import stormpy.examples.files
+
+import pytest
+
+
+class TestShieldCounterexamples:
+    def build_model(self, formula):
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_smg_slippery_corridor)
+        formulas = stormpy.parse_properties_for_prism_program(formula, program)
+        options = stormpy.BuilderOptions([p.raw_formula for p in formulas])
+        options.set_build_state_valuations(True)
+        options.set_build_choice_labels(True)
+        model = stormpy.build_sparse_model_with_options(program, options)
+        return model, formulas[0].raw_formula
+
+    @pytest.mark.parametrize("formula", ["<<robot>> Pmax=? [F \"goal\"]", "<<robot>> Pmax=? [G !\"crash\"]"])
+    def test_unsafe_states(self, formula):
+        model, raw_formula = self.build_model(formula)
+        shield_expression = stormpy.logic.ShieldExpression(stormpy.logic.ShieldingType.PRE_SAFETY, stormpy.logic.ShieldComparison.ABSOLUTE, 0.8)
+        counterexample = stormpy.compute_shield_counterexample(model, raw_formula, shield_expression, max_k=5)
+        assert counterexample.threshold == 0.8
+        initial_state = model.initial_states[0]
+        unsafe_states = {unsafe.state: unsafe for unsafe in counterexample.unsafe_states}
+        assert initial_state in unsafe_states
+        crash = model.labeling.get_states("crash")
+        for unsafe in counterexample.unsafe_states:
+            assert unsafe.value < 0.8
+            assert len(unsafe.paths) == len(unsafe.path_probabilities) > 0
+            for path in unsafe.paths:
+                assert path[0] == unsafe.state
+                assert crash.get(path[-1])
+            # The paths are disjoint events of the violation.
+            assert sum(unsafe.path_probabilities) <= 1 - unsafe.value + 1e-6
+
+        # The robot steps through the corridor while the wind always blows a gust. This leaves exactly five ways to crash.
+        unsafe = unsafe_states[initial_state]
+        assert unsafe.value == pytest.approx(0.9 ** 5)
+        assert unsafe.path_probabilities == pytest.approx([0.1, 0.09, 0.081, 0.0729, 0.06561])
+        assert sum(unsafe.path_probabilities) == pytest.approx(1 - unsafe.value)
+        assert len(unsafe.opponent_choices) == 2
+        for state, choice in unsafe.opponent_choices.items():
+            assert model.choice_labeling.get_labels_of_choice(model.transition_matrix.get_row_group_start(state) + choice) == {"gust"}
+
+    def test_max_k_and_json(self):
+        model, raw_formula = self.build_model("<<robot>> Pmax=? [F \"goal\"]")
+        shield_expression = stormpy.logic.ShieldExpression(stormpy.logic.ShieldingType.PRE_SAFETY, stormpy.logic.ShieldComparison.ABSOLUTE, 0.8)
+        counterexample = stormpy.compute_shield_counterexample(model, raw_formula, shield_expression, max_k=2, number_of_threads=2)
+        for unsafe in counterexample.unsafe_states:
+            assert len(unsafe.paths) <= 2
+        exported = json.loads(counterexample.to_json())
+        assert len(exported) == len(counterexample.unsafe_states)
+        assert [entry["state"] for entry in exported] == [unsafe.state for unsafe in counterexample.unsafe_states]
+        assert "valuation" in exported[0]
+        assert "states without safe action" in str(counterexample)
+
+    def test_relative_shield(self):
+        model, raw_formula = self.build_model("<<robot>> Pmax=? [F \"goal\"]")
+        shield_expression = stormpy.logic.ShieldExpression(stormpy.logic.ShieldingType.PRE_SAFETY, stormpy.logic.ShieldComparison.RELATIVE, 0.8)
+        with pytest.raises(stormpy.StormError):
+            stormpy.compute_shield_counterexample(model, raw_formula, shield_expression)
@@ -0,0 +1,61 @@
+import stormpy
+import stormpy.logic
+import stormpy.shields
+import stormpy.examples
+import stormpy.examples.files
+
+
+class TestShieldEvaluation:
+    def build_shield(self):
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_smg_shield_synth)
+        formulas = stormpy.parse_properties_for_prism_program("<<shieldedRobot>> Pmax=? [G !\"crash\"]", program)
+        options = stormpy.BuilderOptions([p.raw_formula for p in formulas])
+        options.set_build_state_valuations(True)
+        options.set_build_choice_labels(True)
+        options.set_build_all_labels()
+        model = stormpy.build_sparse_model_with_options(program, options)
+        shield_expression = stormpy.logic.ShieldExpression(stormpy.logic.ShieldingType.PRE_SAFETY, stormpy.logic.ShieldComparison.RELATIVE, 0.9)
+        result = stormpy.model_checking(model, formulas[0], extract_scheduler=True, shield_expression=shield_expression)
+        assert result.has_shield
+        return model, result.shield
+
+    def test_shielded_is_safer(self):
+        model, shield = self.build_shield()
+        crash = model.labeling.get_states("crash")
+        options = stormpy.shields.ShieldEvaluationOptions()
+        options.horizon = 30
+        options.batch_size = 4096
+        options.max_nr_episodes = 4096
+        options.seed = 1
+
+        unshielded = stormpy.shields.evaluate_shield(model, ["shieldedRobot"], stormpy.BitVector(model.nr_choices, True), crash, options=options)
+        shielded = stormpy.shields.evaluate_shield(model, ["shieldedRobot"], shield.action_masks(model).allowed_choices, crash, options=options)
+        assert unshielded.nr_episodes == shielded.nr_episodes == 4096
+        for result in [unshielded, shielded]:
+            assert result.lower_bound <= result.estimate <= result.upper_bound
+        assert shielded.estimate < unshielded.estimate
+
+    def test_threshold(self):
+        model, shield = self.build_shield()
+        options = stormpy.shields.ShieldEvaluationOptions()
+        assert options.threshold is None
+        options.horizon = 30
+        options.threshold = 0.5
+        options.environment_behavior = stormpy.shields.PlayerBehavior.ADVERSARIAL
+        result = stormpy.shields.evaluate_shield(model, ["shieldedRobot"], shield.action_masks(model).allowed_choices, model.labeling.get_states("crash"), options=options)
+        # The decision has to agree with the confidence interval. The interval may still contain the threshold once it is
+        # narrow enough or the episode budget ran out.
+        assert result.lower_bound <= result.estimate <= result.upper_bound
+        if result.decision == stormpy.shields.ThresholdDecision.BELOW_THRESHOLD:
+            assert result.upper_bound < 0.5
+        elif result.decision == stormpy.shields.ThresholdDecision.ABOVE_THRESHOLD:
+            assert result.lower_bound > 0.5
+        else:
+            assert result.decision == stormpy.shields.ThresholdDecision.UNDECIDED
+            assert result.lower_bound <= 0.5 <= result.upper_bound
+            assert result.upper_bound - result.lower_bound <= 2 * options.precision or result.nr_episodes >= options.max_nr_episodes
+
+    def test_clopper_pearson(self):
+        lower, upper = stormpy.shields.compute_clopper_pearson_interval(5, 10, 0.95)
+        assert abs(lower - 0.1871) < 1e-4
+        assert abs(upper - 0.8129) < 1e-4
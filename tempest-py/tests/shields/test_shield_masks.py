@@ -0,0 +1,70 @@
+import json
+
+import stormpy
+import stormpy.logic
+import stormpy.shields
+import stormpy.examples
+import stormpy.examples.files
+
+from configurations import numpy_avail
+
+
+@numpy_avail
+class TestShieldActionMasks:
+    def build_shield(self):
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_mdp_lava_simple)
+        formulas = stormpy.parse_properties_for_prism_program("Pmax=? [G !\"AgentIsInLavaAndNotDone\"]", program)
+        options = stormpy.BuilderOptions([p.raw_formula for p in formulas])
+        options.set_build_state_valuations(True)
+        options.set_build_choice_labels(True)
+        model = stormpy.build_sparse_model_with_options(program, options)
+        shield_expression = stormpy.logic.ShieldExpression(stormpy.logic.ShieldingType.PRE_SAFETY, stormpy.logic.ShieldComparison.RELATIVE, 0.9)
+        result = stormpy.model_checking(model, formulas[0], extract_scheduler=True, shield_expression=shield_expression)
+        assert result.has_shield
+        return model, result.shield
+
+    def test_choice_values(self):
+        import numpy as np
+        model, shield = self.build_shield()
+        row_group_indices = shield.row_group_indices
+        choice_values = shield.choice_values
+        assert np.array_equal(row_group_indices, model.transition_matrix.row_group_indices)
+        assert choice_values.shape == (model.nr_choices,)
+        assert np.all((choice_values >= -1e-6) & (choice_values <= 1 + 1e-6))
+        # The view shares the memory of the shield and keeps it alive.
+        del shield
+        assert choice_values.shape == (model.nr_choices,)
+        assert row_group_indices[-1] == model.nr_choices
+
+    def test_query_state_ids(self):
+        import numpy as np
+        model, shield = self.build_shield()
+        masks = shield.action_masks(model)
+        scheduler = shield.construct()
+        state_ids = np.arange(model.nr_states, dtype=np.uint64)
+        result = masks.query(state_ids)
+        assert result.shape == (model.nr_states, masks.nr_actions)
+        assert result.dtype == np.bool_
+        for state in range(model.nr_states):
+            # States without a choice of the shield allow no action.
+            choices = [choice[1] for choice in scheduler.get_choice(state).choice_map]
+            expected = np.zeros(masks.nr_actions, dtype=np.bool_)
+            expected[list(choices)] = True
+            assert (result[state] == expected).all()
+        assert (masks.query(state_ids, number_of_threads=4) == result).all()
+        assert result.sum() == masks.allowed_choices.number_of_set_bits()
+
+    def test_query_valuations(self):
+        import numpy as np
+        model, shield = self.build_shield()
+        masks = shield.action_masks(model, use_choice_labels=True)
+        assert "Agent_done" in masks.action_names
+        valuations = []
+        for state in range(model.nr_states):
+            valuation = json.loads(model.state_valuations.get_json(state))
+            valuations.append([int(valuation[variable]) for variable in masks.variable_names])
+        by_valuation = masks.query_valuations(np.array(valuations))
+        by_state = masks.query(np.arange(model.nr_states))
+        assert (by_valuation == by_state).all()
+        unknown = masks.query_valuations(np.full((1, len(masks.variable_names)), -1))
+        assert not unknown.any()
@@ -1,6 +1,7 @@
 import stormpy
 import stormpy.logic
 from helpers.helper import get_example_path
+from configurations import numpy_avail
 
 
 class TestLabeling:
@@ -48,3 +49,39 @@ class TestLabeling:
         initial_states = model.initial_states
         assert len(initial_states) == 1
         assert 0 in initial_states
+
+    def test_choice_label_ids(self):
+        import stormpy.examples
+        import stormpy.examples.files
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_mdp_lava_simple)
+        options = stormpy.BuilderOptions()
+        options.set_build_choice_labels(True)
+        model = stormpy.build_sparse_model_with_options(program, options)
+        labeling = model.choice_labeling
+        assert labeling.has_label_ids()
+        labels_by_id = labeling.get_labels_by_id()
+        assert labels_by_id == sorted(labeling.get_labels())
+        for choice in range(model.nr_choices):
+            label_id = labeling.get_label_id_of_choice(choice)
+            labels = labeling.get_labels_of_choice(choice)
+            if label_id is None:
+                assert len(labels) == 0
+            else:
+                assert labels == {labels_by_id[label_id]}
+
+    @numpy_avail
+    def test_choice_label_ids_batched(self):
+        import numpy as np
+        import stormpy.examples
+        import stormpy.examples.files
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_mdp_lava_simple)
+        options = stormpy.BuilderOptions()
+        options.set_build_choice_labels(True)
+        model = stormpy.build_sparse_model_with_options(program, options)
+        labeling = model.choice_labeling
+        choices = np.arange(model.nr_choices, dtype=np.uint64)[::-1]
+        label_ids = labeling.get_label_ids_of_choices(choices)
+        assert label_ids.dtype == np.uint64
+        for choice, label_id in zip(choices, label_ids):
+            expected = labeling.get_label_id_of_choice(int(choice))
+            assert label_id == (stormpy.ChoiceLabeling.NO_LABEL if expected is None else expected)
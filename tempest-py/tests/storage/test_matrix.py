@@ -1,5 +1,6 @@
 import stormpy
 from helpers.helper import get_example_path
+from configurations import numpy_avail
 
 import math
 
@@ -139,3 +140,32 @@ class TestMatrix:
         assert submatrix.nr_entries == 10
         for e in submatrix:
             assert e.value() == 0.5 or e.value() == 0 or (e.value() == 1 and e.column > 3)
+
+    @numpy_avail
+    def test_matrix_arrays(self):
+        import numpy as np
+        program = stormpy.parse_prism_program(get_example_path("mdp", "two_dice.nm"))
+        model = stormpy.build_model(program)
+        matrix = model.transition_matrix
+        row_indications = matrix.row_indications
+        columns = matrix.columns
+        values = matrix.values
+        row_group_indices = matrix.row_group_indices
+        assert row_indications.shape == (matrix.nr_rows + 1,)
+        assert columns.shape == values.shape == (matrix.nr_entries,)
+        assert row_group_indices.shape == (matrix.nr_columns + 1,)
+        assert row_group_indices[-1] == matrix.nr_rows
+        assert not values.flags.writeable
+        for row in range(matrix.nr_rows):
+            entries = list(matrix.get_row(row))
+            begin, end = row_indications[row], row_indications[row + 1]
+            assert [entry.column for entry in entries] == list(columns[begin:end])
+            assert [entry.value() for entry in entries] == list(values[begin:end])
+        assert np.allclose(np.add.reduceat(values, row_indications[:-1]), 1)
+
+        # The arrays share the memory with the matrix and keep it alive.
+        entry = next(iter(matrix))
+        entry.set_value(0.25)
+        assert values[0] == 0.25
+        del model, matrix
+        assert values[0] == 0.25
@@ -0,0 +1,51 @@
+import json
+
+import stormpy
+import stormpy.examples
+import stormpy.examples.files
+
+from configurations import numpy_avail
+
+
+class TestStateValuationIndex:
+    def build_model(self):
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_mdp_lava_simple)
+        options = stormpy.BuilderOptions()
+        options.set_build_state_valuations(True)
+        return stormpy.build_sparse_model_with_options(program, options)
+
+    def values_of(self, model, state, variable_names):
+        valuation = json.loads(model.state_valuations.get_json(state))
+        return [int(valuation[name]) for name in variable_names]
+
+    def test_all_variables(self):
+        model = self.build_model()
+        index = stormpy.StateValuationIndex(model.state_valuations)
+        assert sorted(index.variable_names) == ["AgentDone", "viewAgent", "xAgent", "yAgent"]
+        assert index.nr_keys == model.nr_states
+        for state in range(model.nr_states):
+            values = self.values_of(model, state, index.variable_names)
+            assert index.get_state(values) == state
+            assert index.get_states(values) == [state]
+
+    def test_projection(self):
+        model = self.build_model()
+        index = stormpy.StateValuationIndex(model.state_valuations, ["xAgent", "yAgent"])
+        assert index.variable_names == ["xAgent", "yAgent"]
+        assert index.nr_keys < model.nr_states
+        for state in range(model.nr_states):
+            states = index.get_states(self.values_of(model, state, index.variable_names))
+            assert state in states
+            assert states == sorted(states)
+        assert index.get_state([100, 100]) is None
+
+    @numpy_avail
+    def test_lookup(self):
+        import numpy as np
+        model = self.build_model()
+        index = stormpy.StateValuationIndex(model.state_valuations)
+        values = np.array([self.values_of(model, state, index.variable_names) for state in range(model.nr_states)] + [[-1] * 4])
+        states = index.lookup(values)
+        assert states.dtype == np.uint64
+        assert (states[:-1] == np.arange(model.nr_states)).all()
+        assert states[-1] == stormpy.StateValuationIndex.UNKNOWN_STATE
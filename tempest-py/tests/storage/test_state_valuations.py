@@ -0,0 +1,43 @@
+import json
+
+import stormpy
+import stormpy.examples
+import stormpy.examples.files
+
+from configurations import numpy_avail
+
+
+@numpy_avail
+class TestStateValuationColumns:
+    def build_model(self):
+        program = stormpy.parse_prism_program(stormpy.examples.files.prism_mdp_lava_simple)
+        options = stormpy.BuilderOptions()
+        options.set_build_state_valuations(True)
+        return stormpy.build_sparse_model_with_options(program, options)
+
+    def test_columns(self):
+        import numpy as np
+        model = self.build_model()
+        valuations = model.state_valuations
+        assert sorted(variable.name for variable in valuations.variables) == ["AgentDone", "viewAgent", "xAgent", "yAgent"]
+        for variable in valuations.variables:
+            column = valuations.get_column(variable)
+            assert column.shape == (model.nr_states,)
+            assert not column.flags.writeable
+            if variable.has_boolean_type():
+                assert column.dtype == np.bool_
+            else:
+                # The bounds of the variables are small, so a single byte suffices.
+                assert column.dtype == np.int8
+            for state in range(model.nr_states):
+                assert int(column[state]) == int(json.loads(valuations.get_json(state))[variable.name])
+
+    def test_column_by_name(self):
+        import numpy as np
+        model = self.build_model()
+        column = model.state_valuations.get_column("xAgent")
+        for state in range(model.nr_states):
+            assert column[state] == model.state_valuations.get_integer_value(state, next(v for v in model.state_valuations.variables if v.name == "xAgent"))
+        # The column stays valid after the model is gone.
+        del model
+        assert np.all(column >= 0)